@@ -0,0 +1,498 @@
+//
+// This file contains the code to implement the art_name_index class
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// Use the following commands to build this object, save it to the library,
+//    and display the library contents:
+//
+//   g++ -std=c++17 -c art-name-index.cc
+//   ar -Prs ~/data/lib/libfoutil.a art-name-index.o
+//   ar -Ptv ~/data/lib/libfoutil.a
+
+#include "art-name-index.h"
+#include <algorithm>
+#include <cstring>
+
+art_name_index::art_name_index()
+  : root( nullptr ), node_bytes( 0 )
+{
+    //
+    // There is no name 0, so the IDs line up with the gbtree record IDs
+    names.push_back( "" );
+    name_flgs.push_back( styp_flags() );
+}
+
+art_name_index::~art_name_index()
+{
+    free_node( root );
+}
+
+void art_name_index::free_node( art_node *node_ptr )
+{
+    if ( node_ptr == nullptr ) return;
+    if ( is_leaf( node_ptr ) )
+    {
+        delete to_leaf( node_ptr );
+        return;
+    }
+    switch ( node_ptr->type )
+    {
+    case node4:
+    {
+        art_node4 *nd4 = reinterpret_cast<art_node4 *>( node_ptr );
+        for ( int idx = 0; idx < node_ptr->num_children; idx++ )
+          free_node( nd4->children[ idx ] );
+        delete nd4;
+        break;
+    }
+    case node16:
+    {
+        art_node16 *nd16 = reinterpret_cast<art_node16 *>( node_ptr );
+        for ( int idx = 0; idx < node_ptr->num_children; idx++ )
+          free_node( nd16->children[ idx ] );
+        delete nd16;
+        break;
+    }
+    case node48:
+    {
+        art_node48 *nd48 = reinterpret_cast<art_node48 *>( node_ptr );
+        for ( int idx = 0; idx < node_ptr->num_children; idx++ )
+          free_node( nd48->children[ idx ] );
+        delete nd48;
+        break;
+    }
+    case node256:
+    {
+        art_node256 *nd256 = reinterpret_cast<art_node256 *>( node_ptr );
+        for ( int idx = 0; idx < 256; idx++ )
+          free_node( nd256->children[ idx ] );
+        delete nd256;
+        break;
+    }
+    }
+}
+
+string art_name_index::make_key( const string& utf8name )
+{
+    string sort_key = coll_rcrd.make_sort_key( utf8name );
+    string key;
+    key.reserve( sort_key.size() + 2 );
+    for ( char key_ch : sort_key )
+    {
+        key.push_back( key_ch );
+        if ( key_ch == '\0' ) key.push_back( '\x01' );
+    }
+    key.append( 2, '\0' );
+    return key;
+}
+
+art_name_index::art_node **art_name_index::find_child( art_node *node_ptr,
+  unsigned char key_byte )
+{
+    switch ( node_ptr->type )
+    {
+    case node4:
+    {
+        art_node4 *nd4 = reinterpret_cast<art_node4 *>( node_ptr );
+        for ( int idx = 0; idx < node_ptr->num_children; idx++ )
+          if ( nd4->keys[ idx ] == key_byte ) return &nd4->children[ idx ];
+        break;
+    }
+    case node16:
+    {
+        art_node16 *nd16 = reinterpret_cast<art_node16 *>( node_ptr );
+        unsigned char *key_end = nd16->keys + node_ptr->num_children;
+        unsigned char *key_it = lower_bound( nd16->keys, key_end, key_byte );
+        if ( key_it != key_end && *key_it == key_byte )
+          return &nd16->children[ key_it - nd16->keys ];
+        break;
+    }
+    case node48:
+    {
+        art_node48 *nd48 = reinterpret_cast<art_node48 *>( node_ptr );
+        if ( nd48->child_idx[ key_byte ] != 0 )
+          return &nd48->children[ nd48->child_idx[ key_byte ] - 1 ];
+        break;
+    }
+    case node256:
+    {
+        art_node256 *nd256 = reinterpret_cast<art_node256 *>( node_ptr );
+        if ( nd256->children[ key_byte ] != nullptr )
+          return &nd256->children[ key_byte ];
+        break;
+    }
+    }
+    return nullptr;
+}
+
+art_name_index::art_leaf *art_name_index::min_leaf( art_node *node_ptr )
+{
+    while ( node_ptr != nullptr && !is_leaf( node_ptr ) )
+    {
+        switch ( node_ptr->type )
+        {
+        case node4:
+            node_ptr =
+              reinterpret_cast<art_node4 *>( node_ptr )->children[ 0 ];
+            break;
+        case node16:
+            node_ptr =
+              reinterpret_cast<art_node16 *>( node_ptr )->children[ 0 ];
+            break;
+        case node48:
+        {
+            art_node48 *nd48 = reinterpret_cast<art_node48 *>( node_ptr );
+            int byte_idx = 0;
+            while ( nd48->child_idx[ byte_idx ] == 0 ) byte_idx++;
+            node_ptr = nd48->children[ nd48->child_idx[ byte_idx ] - 1 ];
+            break;
+        }
+        case node256:
+        {
+            art_node256 *nd256 = reinterpret_cast<art_node256 *>( node_ptr );
+            int byte_idx = 0;
+            while ( nd256->children[ byte_idx ] == nullptr ) byte_idx++;
+            node_ptr = nd256->children[ byte_idx ];
+            break;
+        }
+        }
+    }
+    return node_ptr == nullptr ? nullptr : to_leaf( node_ptr );
+}
+
+int art_name_index::prefix_mismatch( art_node *node_ptr, const string& key,
+  size_t depth )
+{
+    //
+    // Returns how many bytes of the node prefix the key matches from
+    //   depth on.  The bytes past the ones kept in the node are taken from
+    //   a leaf under the node, since all of them have the same prefix.
+    size_t max_cmp = min( size_t( min( node_ptr->prefix_len,
+      uint32_t( max_prefix_len ) ) ), key.size() - depth );
+    size_t idx = 0;
+    for ( ; idx < max_cmp; idx++ )
+      if ( node_ptr->prefix[ idx ] != static_cast<unsigned char>(
+        key[ depth + idx ] ) ) return int( idx );
+    if ( node_ptr->prefix_len > uint32_t( max_prefix_len ) )
+    {
+        art_leaf *leaf_ptr = min_leaf( node_ptr );
+        max_cmp = min( size_t( node_ptr->prefix_len ),
+          min( leaf_ptr->key.size(), key.size() ) - depth );
+        for ( ; idx < max_cmp; idx++ )
+          if ( leaf_ptr->key[ depth + idx ] != key[ depth + idx ] )
+            return int( idx );
+    }
+    return int( idx );
+}
+
+art_name_index::art_node4 *art_name_index::new_node4()
+{
+    art_node4 *nd4 = new art_node4();
+    nd4->hdr.type = node4;
+    node_bytes += sizeof( art_node4 );
+    return nd4;
+}
+
+void art_name_index::add_child( art_node *node_ptr, art_node **node_ref,
+  unsigned char key_byte, art_node *child )
+{
+    switch ( node_ptr->type )
+    {
+    case node4:
+    {
+        art_node4 *nd4 = reinterpret_cast<art_node4 *>( node_ptr );
+        int num_chld = node_ptr->num_children;
+        if ( num_chld < 4 )
+        {
+            int pos = 0;
+            while ( pos < num_chld && nd4->keys[ pos ] < key_byte ) pos++;
+            memmove( nd4->keys + pos + 1, nd4->keys + pos, num_chld - pos );
+            memmove( nd4->children + pos + 1, nd4->children + pos,
+              ( num_chld - pos ) * sizeof( art_node * ) );
+            nd4->keys[ pos ] = key_byte;
+            nd4->children[ pos ] = child;
+            node_ptr->num_children++;
+            return;
+        }
+        art_node16 *nd16 = new art_node16();
+        nd16->hdr = nd4->hdr;
+        nd16->hdr.type = node16;
+        memcpy( nd16->keys, nd4->keys, 4 );
+        memcpy( nd16->children, nd4->children, 4 * sizeof( art_node * ) );
+        node_bytes += sizeof( art_node16 ) - sizeof( art_node4 );
+        *node_ref = &nd16->hdr;
+        delete nd4;
+        add_child( &nd16->hdr, node_ref, key_byte, child );
+        return;
+    }
+    case node16:
+    {
+        art_node16 *nd16 = reinterpret_cast<art_node16 *>( node_ptr );
+        int num_chld = node_ptr->num_children;
+        if ( num_chld < 16 )
+        {
+            int pos = lower_bound( nd16->keys, nd16->keys + num_chld,
+              key_byte ) - nd16->keys;
+            memmove( nd16->keys + pos + 1, nd16->keys + pos, num_chld - pos );
+            memmove( nd16->children + pos + 1, nd16->children + pos,
+              ( num_chld - pos ) * sizeof( art_node * ) );
+            nd16->keys[ pos ] = key_byte;
+            nd16->children[ pos ] = child;
+            node_ptr->num_children++;
+            return;
+        }
+        art_node48 *nd48 = new art_node48();
+        nd48->hdr = nd16->hdr;
+        nd48->hdr.type = node48;
+        for ( int idx = 0; idx < 16; idx++ )
+        {
+            nd48->child_idx[ nd16->keys[ idx ] ] = idx + 1;
+            nd48->children[ idx ] = nd16->children[ idx ];
+        }
+        node_bytes += sizeof( art_node48 ) - sizeof( art_node16 );
+        *node_ref = &nd48->hdr;
+        delete nd16;
+        add_child( &nd48->hdr, node_ref, key_byte, child );
+        return;
+    }
+    case node48:
+    {
+        art_node48 *nd48 = reinterpret_cast<art_node48 *>( node_ptr );
+        int num_chld = node_ptr->num_children;
+        if ( num_chld < 48 )
+        {
+            //
+            // Nothing is ever taken out, so the slots fill in order
+            nd48->children[ num_chld ] = child;
+            nd48->child_idx[ key_byte ] = num_chld + 1;
+            node_ptr->num_children++;
+            return;
+        }
+        art_node256 *nd256 = new art_node256();
+        nd256->hdr = nd48->hdr;
+        nd256->hdr.type = node256;
+        for ( int byte_idx = 0; byte_idx < 256; byte_idx++ )
+          if ( nd48->child_idx[ byte_idx ] != 0 )
+            nd256->children[ byte_idx ] =
+            nd48->children[ nd48->child_idx[ byte_idx ] - 1 ];
+        node_bytes += sizeof( art_node256 ) - sizeof( art_node48 );
+        *node_ref = &nd256->hdr;
+        delete nd48;
+        add_child( &nd256->hdr, node_ref, key_byte, child );
+        return;
+    }
+    case node256:
+    {
+        art_node256 *nd256 = reinterpret_cast<art_node256 *>( node_ptr );
+        nd256->children[ key_byte ] = child;
+        node_ptr->num_children++;
+        return;
+    }
+    }
+}
+
+int art_name_index::insert_key( art_node **node_ref, const string& key,
+  size_t depth, int new_id )
+{
+    art_node *node_ptr = *node_ref;
+    if ( node_ptr == nullptr )
+    {
+        *node_ref = from_leaf( new art_leaf{ new_id, key } );
+        node_bytes += sizeof( art_leaf ) + key.size();
+        return new_id;
+    }
+    if ( is_leaf( node_ptr ) )
+    {
+        //
+        // Split the leaf with a node 4 that holds the part of the two keys
+        //   that is the same.  The keys can't run out before they differ
+        //   since neither one is a prefix of the other.
+        art_leaf *old_leaf = to_leaf( node_ptr );
+        if ( old_leaf->key == key ) return old_leaf->name_id;
+        size_t cmn_len = 0;
+        while ( key[ depth + cmn_len ] == old_leaf->key[ depth + cmn_len ] )
+          cmn_len++;
+        art_node4 *nd4 = new_node4();
+        nd4->hdr.prefix_len = cmn_len;
+        memcpy( nd4->hdr.prefix, key.data() + depth,
+          min( cmn_len, size_t( max_prefix_len ) ) );
+        *node_ref = &nd4->hdr;
+        add_child( &nd4->hdr, node_ref,
+          old_leaf->key[ depth + cmn_len ], node_ptr );
+        node_bytes += sizeof( art_leaf ) + key.size();
+        add_child( &nd4->hdr, node_ref, key[ depth + cmn_len ],
+          from_leaf( new art_leaf{ new_id, key } ) );
+        return new_id;
+    }
+    if ( node_ptr->prefix_len > 0 )
+    {
+        uint32_t diff_at = prefix_mismatch( node_ptr, key, depth );
+        if ( diff_at < node_ptr->prefix_len )
+        {
+            //
+            // The key leaves the prefix part way, so a new node 4 takes
+            //   the part before that, and the old node keeps the part
+            //   after the byte that now picks it in the new node.
+            art_node4 *nd4 = new_node4();
+            nd4->hdr.prefix_len = diff_at;
+            memcpy( nd4->hdr.prefix, node_ptr->prefix,
+              min( diff_at, uint32_t( max_prefix_len ) ) );
+            *node_ref = &nd4->hdr;
+            if ( node_ptr->prefix_len <= uint32_t( max_prefix_len ) )
+            {
+                add_child( &nd4->hdr, node_ref, node_ptr->prefix[ diff_at ],
+                  node_ptr );
+                node_ptr->prefix_len -= diff_at + 1;
+                memmove( node_ptr->prefix, node_ptr->prefix + diff_at + 1,
+                  node_ptr->prefix_len );
+            }
+            else
+            {
+                art_leaf *leaf_ptr = min_leaf( node_ptr );
+                node_ptr->prefix_len -= diff_at + 1;
+                add_child( &nd4->hdr, node_ref,
+                  leaf_ptr->key[ depth + diff_at ], node_ptr );
+                memcpy( node_ptr->prefix,
+                  leaf_ptr->key.data() + depth + diff_at + 1,
+                  min( node_ptr->prefix_len, uint32_t( max_prefix_len ) ) );
+            }
+            node_bytes += sizeof( art_leaf ) + key.size();
+            add_child( &nd4->hdr, node_ref, key[ depth + diff_at ],
+              from_leaf( new art_leaf{ new_id, key } ) );
+            return new_id;
+        }
+        depth += node_ptr->prefix_len;
+    }
+    art_node **child_ref = find_child( node_ptr, key[ depth ] );
+    if ( child_ref != nullptr )
+      return insert_key( child_ref, key, depth + 1, new_id );
+    node_bytes += sizeof( art_leaf ) + key.size();
+    add_child( node_ptr, node_ref, key[ depth ],
+      from_leaf( new art_leaf{ new_id, key } ) );
+    return new_id;
+}
+
+int art_name_index::place_name( const string& utf8name, styp_flags flg_idd )
+{
+    int new_id = int( names.size() );
+    int name_id = insert_key( &root, make_key( utf8name ), 0, new_id );
+    if ( name_id == new_id )
+    {
+        names.push_back( utf8name );
+        name_flgs.push_back( flg_idd );
+    }
+    return name_id;
+}
+
+int art_name_index::find_name( const string& utf8name )
+{
+    string key = make_key( utf8name );
+    art_node *node_ptr = root;
+    size_t depth = 0;
+    while ( node_ptr != nullptr )
+    {
+        if ( is_leaf( node_ptr ) )
+        {
+            art_leaf *leaf_ptr = to_leaf( node_ptr );
+            return leaf_ptr->key == key ? leaf_ptr->name_id : 0;
+        }
+        //
+        // Only the prefix bytes kept in the node are checked here, and the
+        //   leaf check above catches any difference in the rest.
+        size_t chk_len =
+          min( node_ptr->prefix_len, uint32_t( max_prefix_len ) );
+        for ( size_t idx = 0; idx < chk_len; idx++ )
+          if ( depth + idx >= key.size() || node_ptr->prefix[ idx ] !=
+            static_cast<unsigned char>( key[ depth + idx ] ) ) return 0;
+        depth += node_ptr->prefix_len;
+        if ( depth >= key.size() ) return 0;
+        art_node **child_ref = find_child( node_ptr, key[ depth ] );
+        node_ptr = child_ref == nullptr ? nullptr : *child_ref;
+        depth++;
+    }
+    return 0;
+}
+
+string art_name_index::get_name( int name_id )
+{
+    if ( name_id <= 0 || name_id >= int( names.size() ) ) return "";
+    return names[ name_id ];
+}
+
+void art_name_index::walk_in_order( art_node *node_ptr,
+  vector<int>& name_ids )
+{
+    if ( node_ptr == nullptr ) return;
+    if ( is_leaf( node_ptr ) )
+    {
+        name_ids.push_back( to_leaf( node_ptr )->name_id );
+        return;
+    }
+    switch ( node_ptr->type )
+    {
+    case node4:
+    {
+        art_node4 *nd4 = reinterpret_cast<art_node4 *>( node_ptr );
+        for ( int idx = 0; idx < node_ptr->num_children; idx++ )
+          walk_in_order( nd4->children[ idx ], name_ids );
+        break;
+    }
+    case node16:
+    {
+        art_node16 *nd16 = reinterpret_cast<art_node16 *>( node_ptr );
+        for ( int idx = 0; idx < node_ptr->num_children; idx++ )
+          walk_in_order( nd16->children[ idx ], name_ids );
+        break;
+    }
+    case node48:
+    {
+        art_node48 *nd48 = reinterpret_cast<art_node48 *>( node_ptr );
+        for ( int byte_idx = 0; byte_idx < 256; byte_idx++ )
+          if ( nd48->child_idx[ byte_idx ] != 0 )
+            walk_in_order( nd48->children[ nd48->child_idx[ byte_idx ] - 1 ],
+            name_ids );
+        break;
+    }
+    case node256:
+    {
+        art_node256 *nd256 = reinterpret_cast<art_node256 *>( node_ptr );
+        for ( int byte_idx = 0; byte_idx < 256; byte_idx++ )
+          walk_in_order( nd256->children[ byte_idx ], name_ids );
+        break;
+    }
+    }
+}
+
+void art_name_index::list_in_order( vector<int>& name_ids )
+{
+    name_ids.clear();
+    name_ids.reserve( size() );
+    walk_in_order( root, name_ids );
+}
+
+size_t art_name_index::get_mem_bytes()
+{
+    //
+    // The nodes and leaves with their keys, and the names with their
+    //   flags.  The string headers are counted but not any extra space
+    //   the strings have reserved.
+    size_t mem_bytes = node_bytes +
+      names.size() * ( sizeof( string ) + sizeof( styp_flags ) );
+    for ( auto& name : names ) mem_bytes += name.size();
+    return mem_bytes;
+}
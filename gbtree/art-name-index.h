@@ -0,0 +1,141 @@
+//
+// The art_name_index class is a name index backend that keeps the names
+//   in an adaptive radix tree, to compare against the gbtree for the name
+//   workload.
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// A radix tree goes by the bytes of its keys, so the key of a name is the
+//   sort key that utf8_rcrd_type makes for it in the collation the names
+//   are set to, the strxfrm() key of the locale, the UCA key or the name
+//   itself for the byte order.  Two sort keys compare with memcmp() the
+//   same way the gbtree compares the names, which keeps the in order walk
+//   in the same order as the gbtree.  The UCA keys have null bytes in
+//   them, so each null of a sort key is written as a null and a 0x01
+//   byte, and the key ends with two nulls.  That keeps the memcmp() order
+//   and makes sure no key is the prefix of another one.  The collation
+//   has to be set before the first name is placed, the same as for the
+//   gbtree.
+//
+// The inner nodes come in the four sizes of the ART paper, with room for
+//   4, 16, 48 or 256 children, and a node is moved to the next size when
+//   it fills.  The children of the 4 and 16 nodes are kept in byte order.
+//   The part of the keys that all of the children of a node share is kept
+//   in the node, up to max_prefix_len bytes of it with the full length.
+//   When the shared part is longer than that the rest is checked at the
+//   leaf, which holds the whole key, as the paper does.  A child pointer
+//   with its low bit set is a leaf.
+//
+// The names are kept in a vector by ID, and the leaves hold the IDs.
+//   Names are only added, never taken out, the same as the gbtree.
+//
+
+#ifndef ART_NAME_INDEX_H
+#define ART_NAME_INDEX_H
+
+#include "name-index.h"
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+class art_name_index : public name_index_type
+{
+public:
+    static const int max_prefix_len = 10;
+
+private:
+    enum art_node_type : uint8_t { node4, node16, node48, node256 };
+
+    struct art_node {
+        art_node_type type;
+        uint16_t num_children;
+        uint32_t prefix_len;
+        unsigned char prefix[ max_prefix_len ];
+    };
+    struct art_node4 {
+        art_node hdr;
+        unsigned char keys[ 4 ];
+        art_node *children[ 4 ];
+    };
+    struct art_node16 {
+        art_node hdr;
+        unsigned char keys[ 16 ];
+        art_node *children[ 16 ];
+    };
+    //
+    // child_idx holds the slot of the child for each byte plus 1, or 0
+    //   when there isn't one.
+    struct art_node48 {
+        art_node hdr;
+        unsigned char child_idx[ 256 ];
+        art_node *children[ 48 ];
+    };
+    struct art_node256 {
+        art_node hdr;
+        art_node *children[ 256 ];
+    };
+    struct art_leaf {
+        int name_id;
+        string key;
+    };
+
+    art_node *root;
+    //
+    // Only used for its make_sort_key() method, which goes by the
+    //   collation of all of the utf8_rcrd_type records
+    utf8_rcrd_type coll_rcrd;
+    vector<string> names;
+    vector<styp_flags> name_flgs;
+    size_t node_bytes;
+
+    static bool is_leaf( const art_node *node_ptr )
+      { return ( reinterpret_cast<uintptr_t>( node_ptr ) & 1 ) != 0; };
+    static art_leaf *to_leaf( const art_node *node_ptr )
+      { return reinterpret_cast<art_leaf *>(
+      reinterpret_cast<uintptr_t>( node_ptr ) & ~uintptr_t( 1 ) ); };
+    static art_node *from_leaf( art_leaf *leaf_ptr )
+      { return reinterpret_cast<art_node *>(
+      reinterpret_cast<uintptr_t>( leaf_ptr ) | 1 ); };
+
+    string make_key( const string& utf8name );
+    art_node **find_child( art_node *node_ptr, unsigned char key_byte );
+    art_leaf *min_leaf( art_node *node_ptr );
+    int prefix_mismatch( art_node *node_ptr, const string& key, size_t depth );
+    void add_child( art_node *node_ptr, art_node **node_ref,
+      unsigned char key_byte, art_node *child );
+    art_node4 *new_node4();
+    int insert_key( art_node **node_ref, const string& key, size_t depth,
+      int new_id );
+    void walk_in_order( art_node *node_ptr, vector<int>& name_ids );
+    void free_node( art_node *node_ptr );
+
+public:
+    art_name_index();
+    ~art_name_index();
+    art_name_index( const art_name_index& ) = delete;
+    art_name_index& operator=( const art_name_index& ) = delete;
+    int place_name( const string& utf8name, styp_flags flg_idd );
+    int find_name( const string& utf8name );
+    string get_name( int name_id );
+    int size() { return int( names.size() ) - 1; };
+    void list_in_order( vector<int>& name_ids );
+    size_t get_mem_bytes();
+    string get_backend_name() { return "adaptive radix tree"; };
+};
+
+#endif  //  ART_NAME_INDEX_H
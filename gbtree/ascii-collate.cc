@@ -0,0 +1,323 @@
+//
+// This file contains the code to implement the ASCII collation tables and
+//   the compare that uses them
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// Use the following commands to build this object, save it to the library,
+//    and display the library contents:
+//
+//   g++ -std=c++17 -c ascii-collate.cc
+//   ar -Prs ~/data/lib/libfoutil.a ascii-collate.o
+//   ar -Ptv ~/data/lib/libfoutil.a
+
+#include "ascii-collate.h"
+#include <cctype>
+#include <clocale>
+#include <cstring>
+#include <vector>
+
+ascii_collator::ascii_collator()
+  : tables_made( false )
+  , num_levels( 0 )
+  , num_fast_chs( 0 )
+  , one_byte_wgts( false )
+  , bytewise( false )
+  , num_samples( 0 )
+  , sample_fails( 0 )
+{
+    memset( fast_ch, 0, sizeof( fast_ch ) );
+    memset( wgt_1, 0, sizeof( wgt_1 ) );
+    memset( wgt_off, 0, sizeof( wgt_off ) );
+    memset( wgt_len, 0, sizeof( wgt_len ) );
+}
+
+string ascii_collator::xfrm( const string& str )
+{
+    size_t xfrm_len = strxfrm( nullptr, str.c_str(), 0 );
+    string xfrm_key( xfrm_len + 1, '\0' );
+    strxfrm( &xfrm_key[ 0 ], str.c_str(), xfrm_len + 1 );
+    xfrm_key.resize( xfrm_len );
+    return xfrm_key;
+}
+
+string ascii_collator::table_key( const string& str ) const
+{
+    string tbl_key;
+    for ( int lvl = 0; lvl < num_levels; lvl++ )
+    {
+        if ( lvl > 0 ) tbl_key.push_back( level_sep );
+        for ( unsigned char str_ch : str )
+          tbl_key.append( wgt_bytes, wgt_off[ lvl ][ str_ch ],
+          wgt_len[ lvl ][ str_ch ] );
+    }
+    return tbl_key;
+}
+
+bool ascii_collator::setup()
+{
+    tables_made = true;
+    num_fast_chs = 0;
+    memset( fast_ch, 0, sizeof( fast_ch ) );
+    wgt_bytes.clear();
+    const char *loc_name = setlocale( LC_COLLATE, nullptr );
+    coll_locale = loc_name != nullptr ? loc_name : "";
+    auto split_levels = []( const string& xfrm_key )
+    {
+        vector<string> lvl_wgts( 1 );
+        for ( char key_ch : xfrm_key )
+        {
+            if ( static_cast<unsigned char>( key_ch ) == level_sep )
+              lvl_wgts.emplace_back();
+            else lvl_wgts.back().push_back( key_ch );
+        }
+        return lvl_wgts;
+    };
+    num_levels = split_levels( xfrm( "a" ) ).size();
+    if ( num_levels > max_levels )
+    {
+        num_levels = 0;
+        return false;
+    }
+    //
+    // The 0 byte ends a string, so it is never in the tables
+    for ( int ch_val = 1; ch_val < 128; ch_val++ )
+    {
+        vector<string> lvl_wgts = split_levels( xfrm( string( 1,
+          char( ch_val ) ) ) );
+        if ( int( lvl_wgts.size() ) != num_levels ) continue;
+        bool fits = true;
+        for ( auto& lvl_wgt : lvl_wgts )
+          if ( lvl_wgt.size() > 255 || wgt_bytes.size() + lvl_wgt.size() >
+            65535 ) fits = false;
+        if ( !fits ) continue;
+        for ( int lvl = 0; lvl < num_levels; lvl++ )
+        {
+            wgt_off[ lvl ][ ch_val ] = wgt_bytes.size();
+            wgt_len[ lvl ][ ch_val ] = lvl_wgts[ lvl ].size();
+            wgt_bytes += lvl_wgts[ lvl ];
+        }
+        fast_ch[ ch_val ] = true;
+    }
+    //
+    // Checks every pair, which finds the contractions and any other rule
+    //   of the locale that makes the weights of a byte depend on the bytes
+    //   next to it.
+    for ( int ch_1 = 1; ch_1 < 128; ch_1++ )
+    {
+        for ( int ch_2 = 1; ch_2 < 128 && fast_ch[ ch_1 ]; ch_2++ )
+        {
+            if ( !fast_ch[ ch_2 ] ) continue;
+            string ch_pair = { char( ch_1 ), char( ch_2 ) };
+            if ( xfrm( ch_pair ) != table_key( ch_pair ) )
+            {
+                fast_ch[ ch_1 ] = false;
+                fast_ch[ ch_2 ] = false;
+            }
+        }
+    }
+    one_byte_wgts = true;
+    bytewise = num_levels == 1;
+    for ( int ch_val = 1; ch_val < 128; ch_val++ )
+    {
+        if ( !fast_ch[ ch_val ] ) continue;
+        num_fast_chs++;
+        for ( int lvl = 0; lvl < num_levels; lvl++ )
+        {
+            if ( wgt_len[ lvl ][ ch_val ] != 1 )
+            {
+                one_byte_wgts = false;
+                continue;
+            }
+            wgt_1[ lvl ][ ch_val ] = wgt_bytes[ wgt_off[ lvl ][ ch_val ] ];
+            if ( wgt_1[ lvl ][ ch_val ] != ch_val ) bytewise = false;
+        }
+    }
+    if ( !one_byte_wgts ) bytewise = false;
+    if ( num_fast_chs > 0 && !check_samples() )
+    {
+        num_fast_chs = 0;
+        memset( fast_ch, 0, sizeof( fast_ch ) );
+    }
+    return num_fast_chs > 0;
+}
+
+bool ascii_collator::check_samples()
+{
+    //
+    // Pairs that differ the way file names often do, by the case of a
+    //   letter or by the punctuation that a locale may ignore until the
+    //   last level
+    static const char *const fixed_pairs[][ 2 ] = {
+        { "ab", "a-b" }, { "a-b", "a b" }, { "ab", "Ab" }, { "aB", "Ab" },
+        { "a.b", "a_b" }, { "co-op", "coop" }, { "coop", "co op" },
+        { "a-b-c", "ab-c" }, { "a--b", "a-b-" }, { "x-1", "x1-" },
+        { "A b", "a B" }, { "file (1).txt", "file(1).txt" },
+        { "IMG_0001.JPG", "img-0001.jpg" }, { "IMG_0001.JPG", "IMG0001.JPG" }
+    };
+    const int num_gen_pairs = 2000;
+    num_samples = 0;
+    sample_fails = 0;
+    fail_sample.clear();
+    auto cmp_sign = []( int cmp_rslt )
+      { return cmp_rslt < 0 ? -1 : ( cmp_rslt > 0 ? 1 : 0 ); };
+    auto check_pair = [ & ]( const string& str_a, const string& str_b )
+    {
+        if ( !can_compare( str_a.data(), str_a.size() ) ||
+          !can_compare( str_b.data(), str_b.size() ) ) return;
+        num_samples++;
+        if ( cmp_sign( compare( str_a.data(), str_a.size(), str_b.data(),
+          str_b.size() ) ) == cmp_sign( strcoll( str_a.c_str(),
+          str_b.c_str() ) ) ) return;
+        if ( sample_fails++ == 0 )
+          fail_sample = "[" + str_a + "] to [" + str_b + "]";
+    };
+    for ( auto& smpl_pair : fixed_pairs )
+    {
+        check_pair( smpl_pair[ 0 ], smpl_pair[ 1 ] );
+        check_pair( smpl_pair[ 1 ], smpl_pair[ 0 ] );
+    }
+    //
+    // The rest are made from the bytes in the tables, mostly letters and
+    //   digits as in the names, and each is compared to a copy of itself
+    //   with one byte changed, put in, taken out or moved, so that the
+    //   pair is the same at the first level as often as it can be.  A
+    //   fixed seed makes the same samples every time.
+    vector<char> all_chs;
+    vector<char> name_chs;
+    for ( int ch_val = 1; ch_val < 128; ch_val++ )
+    {
+        if ( !fast_ch[ ch_val ] ) continue;
+        all_chs.push_back( char( ch_val ) );
+        if ( isalnum( ch_val ) ) name_chs.push_back( char( ch_val ) );
+    }
+    if ( name_chs.empty() ) name_chs = all_chs;
+    uint32_t rnd_state = 0x2545F491;
+    auto next_rnd = [ &rnd_state ]( uint32_t rnd_lim )
+    {
+        rnd_state = rnd_state * 1103515245 + 12345;
+        return ( rnd_state >> 8 ) % rnd_lim;
+    };
+    auto rnd_ch = [ & ]()
+    {
+        return next_rnd( 4 ) == 0 ? all_chs[ next_rnd( all_chs.size() ) ] :
+          name_chs[ next_rnd( name_chs.size() ) ];
+    };
+    for ( int smpl = 0; smpl < num_gen_pairs; smpl++ )
+    {
+        string str_a;
+        int str_len = 2 + next_rnd( 15 );
+        for ( int idx = 0; idx < str_len; idx++ ) str_a.push_back( rnd_ch() );
+        string str_b = str_a;
+        size_t pos = next_rnd( str_len );
+        switch ( next_rnd( 5 ) )
+        {
+        case 0:
+            str_b[ pos ] = rnd_ch();
+            break;
+        case 1:
+            str_b.insert( pos, 1, rnd_ch() );
+            break;
+        case 2:
+            str_b.erase( pos, 1 );
+            break;
+        case 3:
+            if ( isalpha( static_cast<unsigned char>( str_b[ pos ] ) ) )
+              str_b[ pos ] ^= 0x20;
+            else str_b[ pos ] = all_chs[ next_rnd( all_chs.size() ) ];
+            break;
+        default:
+            str_b.push_back( str_b[ pos ] );
+            str_b.erase( pos, 1 );
+            break;
+        }
+        check_pair( str_a, str_b );
+        check_pair( str_b, str_a );
+    }
+    return sample_fails == 0;
+}
+
+int ascii_collator::compare( const char *str_a, size_t len_a,
+  const char *str_b, size_t len_b ) const
+{
+    //
+    // A string that runs out of weights first is the lesser, as below
+    size_t min_len = len_a < len_b ? len_a : len_b;
+    int len_cmp = len_a < len_b ? -1 : ( len_a > len_b ? 1 : 0 );
+    if ( bytewise )
+    {
+        int cmp_rslt = memcmp( str_a, str_b, min_len );
+        return cmp_rslt != 0 ? cmp_rslt : len_cmp;
+    }
+    if ( one_byte_wgts )
+    {
+        for ( int lvl = 0; lvl < num_levels; lvl++ )
+        {
+            const uint8_t *lvl_wgt = wgt_1[ lvl ];
+            const unsigned char *ustr_a =
+              reinterpret_cast<const unsigned char *>( str_a );
+            const unsigned char *ustr_b =
+              reinterpret_cast<const unsigned char *>( str_b );
+            for ( size_t idx = 0; idx < min_len; idx++ )
+            {
+                int wgt_a = lvl_wgt[ ustr_a[ idx ] ];
+                int wgt_b = lvl_wgt[ ustr_b[ idx ] ];
+                if ( wgt_a != wgt_b ) return wgt_a < wgt_b ? -1 : 1;
+            }
+            if ( len_cmp != 0 ) return len_cmp;
+        }
+        return 0;
+    }
+    for ( int lvl = 0; lvl < num_levels; lvl++ )
+    {
+        //
+        // The end of a level is the level_sep byte of the key, or the end
+        //   of the key after the last level, and neither is ever a weight
+        //   byte, so a string that runs out of weights first is the lesser.
+        const int lvl_end = lvl + 1 < num_levels ? level_sep : 0;
+        const uint16_t *lvl_off = wgt_off[ lvl ];
+        const uint8_t *lvl_len = wgt_len[ lvl ];
+        size_t ch_a = 0, ch_b = 0;
+        size_t wgt_a = 0, wgt_b = 0;
+        while ( true )
+        {
+            while ( ch_a < len_a &&
+              wgt_a >= lvl_len[ static_cast<unsigned char>( str_a[ ch_a ] ) ] )
+            {
+                ch_a++;
+                wgt_a = 0;
+            }
+            while ( ch_b < len_b &&
+              wgt_b >= lvl_len[ static_cast<unsigned char>( str_b[ ch_b ] ) ] )
+            {
+                ch_b++;
+                wgt_b = 0;
+            }
+            if ( ch_a == len_a && ch_b == len_b ) break;
+            int byte_a = ch_a == len_a ? lvl_end :
+              static_cast<unsigned char>( wgt_bytes[ lvl_off[
+              static_cast<unsigned char>( str_a[ ch_a ] ) ] + wgt_a ] );
+            int byte_b = ch_b == len_b ? lvl_end :
+              static_cast<unsigned char>( wgt_bytes[ lvl_off[
+              static_cast<unsigned char>( str_b[ ch_b ] ) ] + wgt_b ] );
+            if ( byte_a != byte_b ) return byte_a < byte_b ? -1 : 1;
+            wgt_a++;
+            wgt_b++;
+        }
+    }
+    return 0;
+}
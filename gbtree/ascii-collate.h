@@ -0,0 +1,134 @@
+//
+// The ascii_collator class compares two pure ASCII name strings in the
+//   same order as strcoll() does for the collation locale in use, with
+//   weight tables and byte loops in place of the general glibc code.
+//   Most of the names found on the drives are ASCII, so most of the
+//   compares of the UTF-8 name btree can be done this way.
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// The glibc collation of a locale is the multi level ordering of the
+//   ISO 14651 table, which is the DUCET ordering that fo-utils.h describes
+//   for the collation characters, with the primary weights of all of the
+//   characters compared first, then the secondary weights and so on.  The
+//   strxfrm() key of a string is the weights of each level one after the
+//   other with a level_sep byte between the levels.
+//
+// Rather than carrying a copy of the table, the weights of each ASCII
+//   byte are taken from the strxfrm() key of that byte alone in the locale
+//   in use when setup() is done.  A byte is only used when its key has the
+//   same number of levels as the key of "a" and no level_sep in its
+//   weights, and then the key of every pair of those bytes is checked
+//   against the weights put together.  A byte that is part of a pair that
+//   doesn't match, such as one that starts a contraction like the "aa"
+//   of Danish, is dropped from the tables.  A string with a byte that is
+//   not in the tables can't be compared here and has to go to strcoll().
+//
+// The single bytes and the pairs don't show every rule of a locale.  The
+//   weights of a level can depend on where in the string a byte is, such
+//   as the positions kept for the ignorable bytes at the last level, and
+//   those only show up in longer strings.  So setup() also compares a set
+//   of longer sample strings both ways, and when the tables and strcoll()
+//   don't give the same order for any of them, none of the bytes are put
+//   in the tables and every compare goes to strcoll().
+//
+// The compare walks the weights of the two strings a level at a time, the
+//   same as strcmp() would walk their keys, without making the keys.  When
+//   each byte has a one byte weight at each level, which is the usual case,
+//   the walk is one table lookup for each byte of each string, and when
+//   there is one level with each byte its own weight, as for the C and
+//   C.UTF-8 locales, the compare is just memcmp().
+//
+
+#ifndef ASCII_COLLATE_H
+#define ASCII_COLLATE_H
+
+#include <cstdint>
+#include <string>
+
+using namespace std;
+
+class ascii_collator
+{
+public:
+    static const int max_levels = 4;
+    static const unsigned char level_sep = 0x01;
+
+private:
+    bool tables_made;
+    int num_levels;
+    int num_fast_chs;
+    bool one_byte_wgts;
+    bool bytewise;
+    // The weight of each byte at each level when one_byte_wgts is set
+    uint8_t wgt_1[ max_levels ][ 256 ];
+    // True for the bytes whose weights are in the tables
+    bool fast_ch[ 256 ];
+    // The weights of each byte at each level are wgt_len[][] bytes of
+    //   wgt_bytes from wgt_off[][]
+    uint16_t wgt_off[ max_levels ][ 128 ];
+    uint8_t wgt_len[ max_levels ][ 128 ];
+    string wgt_bytes;
+    string coll_locale;
+    int num_samples;
+    int sample_fails;
+    string fail_sample;
+
+    static string xfrm( const string& str );
+    string table_key( const string& str ) const;
+    //
+    // Compares the sample strings with the tables and with strcoll(), and
+    //   gives false when any of them are not in the same order
+    bool check_samples();
+
+public:
+    ascii_collator();
+    //
+    // Makes the tables for the collation locale now in use.  Returns false
+    //   when none of the ASCII bytes can be done with the tables, which
+    //   includes a failed check of the sample strings.  The tables have to
+    //   be made again if the locale is changed.
+    bool setup();
+    bool is_set_up() const { return tables_made; };
+    bool is_usable() const { return num_fast_chs > 0; };
+    int get_fast_ch_cnt() const { return num_fast_chs; };
+    int get_level_cnt() const { return num_levels; };
+    string get_locale() const { return coll_locale; };
+    //
+    // The number of sample string pairs that setup() checked, how many of
+    //   them the tables put in another order than strcoll() did, and the
+    //   first of those pairs
+    int get_sample_cnt() const { return num_samples; };
+    int get_sample_fail_cnt() const { return sample_fails; };
+    string get_fail_sample() const { return fail_sample; };
+    //
+    // True when all of the bytes of the string are in the tables
+    bool can_compare( const char *str, size_t len ) const
+    {
+        for ( size_t idx = 0; idx < len; idx++ )
+          if ( !fast_ch[ static_cast<unsigned char>( str[ idx ] ) ] )
+            return false;
+        return true;
+    };
+    //
+    // Gives less than, equal to or greater than 0 the same as strcoll()
+    //   does.  can_compare() must be true for both strings.
+    int compare( const char *str_a, size_t len_a, const char *str_b,
+      size_t len_b ) const;
+};
+
+#endif  //  ASCII_COLLATE_H
@@ -0,0 +1,62 @@
+//
+// The Default Unicode Collation Element Table, compiled in for the
+//   uca_collator class.  The ducet-table.cc source is made from the DUCET
+//   allkeys.txt listing by the mk-ducet-table program in the uni-utils
+//   folder and is not edited by hand.
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// Each collation element is packed in a uint32_t with the primary weight
+//   in the top 16 bits, then 9 bits of secondary weight, 5 bits of
+//   tertiary weight, a spare bit and the variable flag of the "*" entries
+//   in the low bit.  Those are wide enough for the weight ranges of the
+//   listing, which mk-ducet-table checks.
+//
+// A ce_ref is the index of the first element of an entry in ducet_ces
+//   shifted up 5 bits, with the count of its elements in the low 5 bits.
+//   The entries of single code points are ducet_cps, in code point order,
+//   with their ce_refs at the same index of ducet_ce_refs.  The
+//   contractions are 4 values each in ducet_contrs, the 2 or 3 code
+//   points of the contraction with a 0 after 2 of them, then the ce_ref,
+//   and they are in code point order too.
+//
+// The implicit weight ranges of the @implicitweights lines are 4 values
+//   each in ducet_implicits, the first and last code points of the range,
+//   the code point the second weight counts from, and the base weight.
+//
+
+#ifndef DUCET_TABLE_H
+#define DUCET_TABLE_H
+
+#include <cstdint>
+
+extern const char *const ducet_version;
+extern const int ducet_single_cnt;
+extern const int ducet_contr_cnt;
+extern const int ducet_implicit_cnt;
+extern const uint32_t ducet_ces[];
+extern const uint32_t ducet_cps[];
+extern const uint32_t ducet_ce_refs[];
+extern const uint32_t ducet_contrs[];
+extern const uint32_t ducet_implicits[];
+
+inline uint32_t ducet_primary( uint32_t ce ) { return ce >> 16; }
+inline uint32_t ducet_secondary( uint32_t ce ) { return ce >> 7 & 0x1ff; }
+inline uint32_t ducet_tertiary( uint32_t ce ) { return ce >> 2 & 0x1f; }
+inline bool ducet_variable( uint32_t ce ) { return ( ce & 1 ) != 0; }
+
+#endif  //  DUCET_TABLE_H
@@ -19,15 +19,50 @@ using namespace std;
 #define INdevel
 
 //
-// GGG - For now, the INFOdisplay define needs to be turned on at all
-//   times until I decide how to solve the problem with getting name
-//   strings.
+// Macro to enable the info display.  The searches keep their own search
+//   keys apart from the display names, so it can be turned off to place
+//   the names without making the display strings, though USEncurses
+//   turns it back on.  With it on, gbtree::set_search_info() can still
+//   leave out the lines made for each level of a search.
 #define INFOdisplay
 
 //
 // Macro to enable ncurses I/O capabilities
 #define USEncurses
 
+//
+// Macro to keep a subtree node count in each btree node so that the rank,
+//   select and range count methods are available
+#define USEorder_stats
+
+//
+// Macro to keep a Merkle digest of each subtree so that two btrees can be
+//   compared by only looking at the parts that are different
+#define USEmerkle_dgst
+
+//
+// Macro to use the compact utf8_rcrd_type record, which keeps only the
+//   name store index of the name in the record with the encoding flags
+//   packed in its top bits.  The search string additions that were never
+//   put to use are dropped.  The subtree count of the order statistics
+//   and the key abbreviation of USEsort_key_abbr would each add 8 bytes
+//   back to every record, so the compact records go without them, and a
+//   record is 24 bytes in place of the 48 of the full record.
+// #define USEcompact_utf8_rcrd
+
+//
+// Macro to keep the first 8 bytes of the sort key of each UTF-8 name in
+//   its record while the sort key compares are on, so most compares are
+//   done with one integer compare on the record that has already been
+//   read.  This adds 8 bytes to the full utf8_rcrd_type record, and the
+//   compact record leaves it out.
+#define USEsort_key_abbr
+
+#ifdef USEcompact_utf8_rcrd
+#undef USEorder_stats
+#undef USEsort_key_abbr
+#endif  //  #ifdef USEcompact_utf8_rcrd
+
 //
 // Macro to provide the btree graphic output display coding additions
 // #define GENbtreeGRF
@@ -53,24 +88,36 @@ const int siz_buffer = 5;
 //
 // Since bit fields are implemented starting from the least significant
 //   bit, I am changing the order here to reflect the bit placement
-//   used for the command line operations option
+//   used for the command line operations option.  The options past
+//   0x8000 don't fit in the usage chart so they are listed below it.
 struct flag_set {
-    uint16_t play_name_store_stream : 1;   // 0x0001
-    uint16_t show_name_store_strings : 1;  // 0x0002
-    uint16_t show_data_record_sizes : 1;   // 0x0004
-    uint16_t play_back_names_read : 1;     // 0x0008
-    uint16_t show_info_output : 1;         // 0x0010
-    uint16_t read_strings_from_file : 1;   // 0x0020
-    uint16_t show_debugging_output : 1;    // 0x0040
-    uint16_t track_base_search_vars : 1;   // 0x0080
-    uint16_t show_default_base_vars : 1;   // 0x0100
-    uint16_t change_start_str_num : 1;     // 0x0200
-    uint16_t show_btree_graph_display : 1; // 0x0400
-    uint16_t test_base_search_vars : 1;    // 0x0800
-    uint16_t show_gbtree_traverse : 1;     // 0x1000
-    uint16_t temp1bit : 1;                 // 0x2000
-    uint16_t temp2bit : 1;                 // 0x4000
-    uint16_t show_any : 1;                 // 0x8000
+    uint32_t play_name_store_stream : 1;   // 0x0001
+    uint32_t show_name_store_strings : 1;  // 0x0002
+    uint32_t show_data_record_sizes : 1;   // 0x0004
+    uint32_t play_back_names_read : 1;     // 0x0008
+    uint32_t show_info_output : 1;         // 0x0010
+    uint32_t read_strings_from_file : 1;   // 0x0020
+    uint32_t show_debugging_output : 1;    // 0x0040
+    uint32_t track_base_search_vars : 1;   // 0x0080
+    uint32_t show_default_base_vars : 1;   // 0x0100
+    uint32_t change_start_str_num : 1;     // 0x0200
+    uint32_t show_btree_graph_display : 1; // 0x0400
+    uint32_t test_base_search_vars : 1;    // 0x0800
+    uint32_t show_gbtree_traverse : 1;     // 0x1000
+    uint32_t rebalance_btree : 1;          // 0x2000
+    uint32_t derive_balance_points : 1;    // 0x4000
+    uint32_t show_any : 1;                 // 0x8000
+    uint32_t benchmark_lookups : 1;        // 0x10000
+    uint32_t merkle_diff : 1;              // 0x20000
+    uint32_t ext_ingest : 1;               // 0x40000
+    uint32_t art_name_index : 1;           // 0x80000
+    uint32_t sort_key_cmps : 1;            // 0x100000
+    uint32_t uca_collation : 1;            // 0x200000
+    uint32_t byte_order_collation : 1;     // 0x400000
+    uint32_t memo_base_search_vars : 1;    // 0x800000
+    uint32_t bench_base_search_depth : 1;  // 0x1000000
+    uint32_t normalize_names : 1;          // 0x2000000
+    uint32_t skip_search_levels : 1;       // 0x4000000
 };
 
 extern flag_set pflg;
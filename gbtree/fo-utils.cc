@@ -73,7 +73,7 @@ bool validate_iso8859_1char( uint16_t ch )
     return checking;
 }
 
-styp_flags identify_encoding( string ch_seq, styp_flags dflt_flg )
+styp_flags identify_encoding( const string& ch_seq, styp_flags dflt_flg )
 {
     // GGG - This function needs to be Verified
     //   Problem found - When an ISO_8859_1 high bit char 0xf1 is seen in an
@@ -245,7 +245,7 @@ styp_flags identify_encoding( string ch_seq, styp_flags dflt_flg )
 //   convert it losslessly bi-directional to UTF-8 and return the UTF-8
 //   string.
 //
-string utf8from8859_1( string iso8859_1 )
+string utf8from8859_1( const string& iso8859_1 )
 {
     // GGG - This function needs to be verified
     string transfrm;
@@ -334,9 +334,22 @@ significant_collation_chars scc;
 scc_idx scc_idx_to_str_bal[ ggg_bal_lst_siz ];
 uint16_t scc_set[ scc_set_size ];
 
-string scc_set_array_to_utf8( scc_idx scc_strng )
+string scc_set_array_to_utf8( const scc_idx& scc_strng )
 {
+    //
+    // The UTF-8 size is added up first so the string is made at its full
+    //   size once, instead of growing a few times over for the longer base
+    //   search strings.  The scc_set code points are all in the BMP.
+    size_t utf8_siz = 0;
+    for ( uint8_t scc_idx : scc_strng )
+    {
+        uint16_t blst_ch = cmask & scc_idx;
+        blst_ch < scc_set_size || ( blst_ch = scc_set_size - 1 );
+        utf8_siz += scc_set[ blst_ch ] < 0x80 ? 1 :
+          scc_set[ blst_ch ] < 0x800 ? 2 : 3;
+    }
     string tstr;
+    tstr.reserve( utf8_siz );
     for ( uint8_t scc_idx : scc_strng )
     {
         // Added some error checking
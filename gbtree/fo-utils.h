@@ -452,9 +452,9 @@ extern string my_exit_msg;
 
 bool validate_iso8859_1char( uint16_t ch );
 
-styp_flags identify_encoding( string ch_seq, styp_flags dflt_flg );
+styp_flags identify_encoding( const string& ch_seq, styp_flags dflt_flg );
 
-string utf8from8859_1( string iso8859_1 );
+string utf8from8859_1( const string& iso8859_1 );
 
 //
 // The UTF-8 string is required to be ISO_8859_1 compatible or this
@@ -465,7 +465,7 @@ string iso8859_1from_utf8( string uft8strng );
 // Define a character mask
 const uint16_t cmask = 0x00ff;
 
-string scc_set_array_to_utf8( scc_idx scc_strng );
+string scc_set_array_to_utf8( const scc_idx& scc_strng );
 
 string scc_idx_to_UTF_8( uint8_t indx );
 
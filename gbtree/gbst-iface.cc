@@ -51,6 +51,11 @@
 #include "../uni-utils/hex-symbol.h"
 #include "../uni-utils/uni-utils.h"
 #include "hash-rcrd-type.h"
+#include <algorithm>
+#include <clocale>
+#include <cstring>
+#include <fstream>
+#include <map>
 
 void atexit_handl_2()
 {
@@ -64,7 +69,9 @@ extern significant_collation_chars scc;
 //   gbst_interface_type constructor
 styp_flags default_flg_set;
 
-gbst_interface_type::gbst_interface_type()
+gbst_interface_type::gbst_interface_type( name_index_backend bknd )
+  : name_idx( make_name_index( bknd ) ), idx_place_time( 0 ),
+    idx_place_cnt( 0 ), norm_time( 0 )
 {
     const int result_2 = atexit( atexit_handl_2 );
     //
@@ -144,7 +151,7 @@ gbst_interface_type::gbst_interface_type()
     nxt_tbl_index = 1;
 }
 
-int gbst_interface_type::search_place_name( string fil_sys_name )
+int gbst_interface_type::search_place_name( const string& fil_sys_name )
 {
     // GGG - Need to work on this
     // This is where the btree stuff needs to be implemented, at first
@@ -230,53 +237,53 @@ int gbst_interface_type::search_place_name( string fil_sys_name )
 #endif  //  #ifdef SETUP_hash_test
 
 #ifdef INFOdisplay
-    str_utf8 rcinftxt( "New rcrd: txt[" + utf8name + "]" );
-    int colnum = rcinftxt.numsym;
-    uint16_t cmask = 0x0ff;
+    //
+    // The line for each name goes with the search lines of the info
+    //   display.
+    if ( gbtree::get_search_info() )
+    {
+        str_utf8 rcinftxt( "New rcrd: txt[" + utf8name + "]" );
+        int colnum = rcinftxt.numsym;
+        uint16_t cmask = 0x0ff;
 
 #ifdef SETUP_hash_test  // Define this macro to enable the hash testing
-    ostringstream shahex;
-    shahex << "sha1[" << hex;
-    for ( auto hbyt : str_sha_dgst )
-    {
-        uint16_t tbyt = cmask & hbyt;
-        shahex << setfill( '0' ) << setw( 2 ) << tbyt;
-    }
-    shahex << "]," << dec;
-    ostringstream md5hex;
-    md5hex << "md5[" << hex;
-    for ( auto hbyt : str_md5_dgst )
-    {
-        uint16_t tbyt = cmask & hbyt;
-        md5hex << setfill( '0' ) << setw( 2 ) << tbyt;
-    }
-    md5hex << setfill( ' ' ) << dec << "].";
-    int hashsiz = shahex.str().size() + 1 + md5hex.str().size();
-    iout << rcinftxt.target;
-    colnum += 2 + hashsiz;
-    if ( inf_wid > colnum )
-    {
-        iout << ", ";
-    }
-    else
-    {
-        iout << "," << endl << "    ";
-    }
-    iout << shahex.str() << " " << md5hex.str() << endl;
+        ostringstream shahex;
+        shahex << "sha1[" << hex;
+        for ( auto hbyt : str_sha_dgst )
+        {
+            uint16_t tbyt = cmask & hbyt;
+            shahex << setfill( '0' ) << setw( 2 ) << tbyt;
+        }
+        shahex << "]," << dec;
+        ostringstream md5hex;
+        md5hex << "md5[" << hex;
+        for ( auto hbyt : str_md5_dgst )
+        {
+            uint16_t tbyt = cmask & hbyt;
+            md5hex << setfill( '0' ) << setw( 2 ) << tbyt;
+        }
+        md5hex << setfill( ' ' ) << dec << "].";
+        int hashsiz = shahex.str().size() + 1 + md5hex.str().size();
+        iout << rcinftxt.target;
+        colnum += 2 + hashsiz;
+        if ( inf_wid > colnum )
+        {
+            iout << ", ";
+        }
+        else
+        {
+            iout << "," << endl << "    ";
+        }
+        iout << shahex.str() << " " << md5hex.str() << endl;
 
 #else  // Not doing hash test, just display utf8 name
 
-    iout << rcinftxt.target << "." << endl;
+        iout << rcinftxt.target << "." << endl;
 #endif  //  #ifdef SETUP_hash_test
+    }
 
 #endif // #ifdef INFOdisplay
 
-    //
-    // Create the new record as a temp to get the defaults set correctly
-    //   then copy to new_str_ptr so it can be referenced when needed.
-    utf8_rcrd_type tmp_spr( utf8name, flg_idd );
-    new_str_ptr = tmp_spr;
-
 #ifdef SETUP_hash_test  // Define this macro to enable the hash testing
     sha1_rcrd_type new_sha_rcrd( str_sha_dgst );
     md5_rcrd_type new_md5_rcrd( str_md5_dgst );
@@ -300,19 +307,14 @@ int gbst_interface_type::search_place_name( string fil_sys_name )
     //   but could be the index of some other node that has replaced the
     //   original.  Any replacements would be done by the place_new_node
     //   method which is a part of the base class gbtree (see gbtree.{h,cc}.
+    //   The gbtree name index does that part now, see name-index.cc.
     //
+    auto place_start = chrono::steady_clock::now();
+    new_str_place = name_idx->place_name( utf8name, flg_idd );
+    idx_place_time += chrono::steady_clock::now() - place_start;
+    idx_place_cnt++;
 
-#ifdef INdevel    // Declarations for development only
-  if ( dbgf.a3 )
-  {
-    tmp_spr.shossp( "Disp static search parms and tmp_spr "
-      "before call to place_new_node:" );
-    new_str_ptr.shossp( "Disp static search parms and new_str_ptr "
-      "before call to place_new_node:" );
-  }
-#endif // #ifdef INdevel
-
-    if ( ( new_str_place = new_str_ptr.place_new_node() ) > 0
+    if ( new_str_place > 0
 
 #ifdef SETUP_hash_test  // Define this macro to enable the hash testing
       && ( new_sha_place = new_sha_rcrd.place_new_node() ) > 0
@@ -328,7 +330,20 @@ int gbst_interface_type::search_place_name( string fil_sys_name )
             //   be a need in the future to add something here, possibly
             //   a tracker for duplicate names.
         }
-        else nxt_tbl_index = new_str_place + 1;
+        else
+        {
+            nxt_tbl_index = new_str_place + 1;
+            //
+            // The normalization stage.  The name index keeps the name as
+            //   it was given so the original can be had back, and only
+            //   the secondary index is by the normalized name.
+            if ( norm_idx )
+            {
+                auto norm_start = chrono::steady_clock::now();
+                norm_idx->add_name( utf8name, new_str_place );
+                norm_time += chrono::steady_clock::now() - norm_start;
+            }
+        }
         //
         // Get the sha1 and md5 digests for the string here and place
         //   them in their respective hash record type btree after writing
@@ -354,7 +369,15 @@ int gbst_interface_type::search_place_name( string fil_sys_name )
     return new_str_place;
 }
 
-void gbst_interface_type::test_btree_bsv()
+void gbst_interface_type::start_name_norm(
+  name_normalizer::norm_form form_set, bool fold_set )
+{
+    norm_idx.reset( new norm_name_index );
+    norm_idx->setup( form_set, fold_set );
+    norm_time = chrono::steady_clock::duration( 0 );
+}
+
+void gbst_interface_type::test_btree_bsv( int test_lvls )
 {
 
 #ifdef INdevel
@@ -364,5 +387,333 @@ void gbst_interface_type::test_btree_bsv()
 
     utf8_rcrd_type tmp_spr;
     new_str_ptr = tmp_spr;
-    new_str_ptr.test_bss_compute();
+    new_str_ptr.test_bss_compute( test_lvls );
+}
+
+//
+// Decodes a UTF-8 string into its code points, returning an empty vector
+//   if the string is not valid UTF-8.
+static vector<uint32_t> utf8_code_points( const string& utf8_str )
+{
+    vector<uint32_t> cod_pts;
+    size_t pos = 0;
+    while ( pos < utf8_str.size() )
+    {
+        uint8_t lead = utf8_str[ pos ];
+        int nfollow = lead < 0x80 ? 0 : ( lead & 0xe0 ) == 0xc0 ? 1 :
+          ( lead & 0xf0 ) == 0xe0 ? 2 : ( lead & 0xf8 ) == 0xf0 ? 3 : -1;
+        if ( nfollow < 0 || pos + nfollow >= utf8_str.size() ) return {};
+        uint32_t cod_pt = nfollow == 0 ? lead : lead & ( 0x3f >> nfollow );
+        for ( int idx = 1; idx <= nfollow; idx++ )
+        {
+            uint8_t follow = utf8_str[ pos + idx ];
+            if ( ( follow & 0xc0 ) != 0x80 ) return {};
+            cod_pt = ( cod_pt << 6 ) | ( follow & 0x3f );
+        }
+        cod_pts.push_back( cod_pt );
+        pos += nfollow + 1;
+    }
+    return cod_pts;
+}
+
+//
+// Installs a new scc_set and set of level 1 to 5 balance strings (given as
+//   scc_set indexes) if the resulting scc_set still collates in order,
+//   otherwise the previous values are put back.
+static bool apply_balance_points( const uint16_t new_scc[],
+  const vector<scc_idx>& bal_idx )
+{
+    uint16_t prev_scc[ scc_set_size ];
+    copy( scc_set, scc_set + scc_set_size, prev_scc );
+    copy( new_scc, new_scc + scc_set_size, scc_set );
+    if ( !test_scc_set_validity() )
+    {
+        errs << "The derived scc_set does not collate in order with the " <<
+          "current locale, so the built in balance points are kept." << endl;
+        copy( prev_scc, prev_scc + scc_set_size, scc_set );
+        return false;
+    }
+    for ( int idx = 0; idx < ggg_bal_lst_siz; idx++ )
+    {
+        scc_idx_to_str_bal[ idx ] = bal_idx[ idx ];
+        ggguniq_str_bal_list[ idx ] = scc_set_array_to_utf8( bal_idx[ idx ] );
+    }
+    return true;
+}
+
+//
+// Picks up to num_wanted characters from the use counts for an scc_set
+//   part, in collation order.  Characters that don't sort as distinct
+//   primary characters in the current locale (case pairs and punctuation
+//   in most locales other than C) would make the set collate out of
+//   order, so of any such pair only the more used one is kept.  When
+//   after is not empty, the characters must also sort as distinct after
+//   it.  The least used characters are dropped when there are too many.
+static vector<uint32_t> pick_primary_chars( const map<uint32_t, int>& chr_cnt,
+  size_t num_wanted, const string& after )
+{
+    vector<pair<string, int> > by_coll;
+    for ( auto& cnt_itm : chr_cnt )
+      by_coll.emplace_back( U_code_pt_to_UTF_8( cnt_itm.first ),
+      cnt_itm.second );
+    sort( by_coll.begin(), by_coll.end(),
+      []( const pair<string, int>& lft, const pair<string, int>& rt )
+      { return strcoll( lft.first.c_str(), rt.first.c_str() ) < 0; } );
+    vector<pair<string, int> > kept;
+    if ( by_coll.empty() ) return {};
+    const string lo_ch = by_coll.front().first;
+    const string hi_ch = by_coll.back().first;
+    for ( auto& chr_itm : by_coll )
+    {
+        const string& prev_ch = kept.empty() ? after : kept.back().first;
+        if ( !prev_ch.empty() && strcoll( ( prev_ch + hi_ch ).c_str(),
+          ( chr_itm.first + lo_ch ).c_str() ) >= 0 )
+        {
+            if ( !kept.empty() && chr_itm.second > kept.back().second )
+              kept.back() = chr_itm;
+            continue;
+        }
+        kept.push_back( chr_itm );
+    }
+    while ( kept.size() > num_wanted )
+    {
+        auto min_it = min_element( kept.begin(), kept.end(),
+          []( const pair<string, int>& lft, const pair<string, int>& rt )
+          { return lft.second < rt.second; } );
+        kept.erase( min_it );
+    }
+    vector<uint32_t> picked;
+    for ( auto& chr_itm : kept )
+      picked.push_back( utf8_code_points( chr_itm.first )[ 0 ] );
+    return picked;
+}
+
+bool gbst_interface_type::derive_balance_points(
+  const vector<string>& name_sample )
+{
+    if ( nxt_tbl_index != 1 )
+    {
+        errs << "Balance points can only be changed before any names are " <<
+          "placed in the btree." << endl;
+        return false;
+    }
+    vector<string> sorted_names;
+    map<uint32_t, int> ascii_cnt;
+    map<uint32_t, int> non_ascii_cnt;
+    for ( const string& smpl_name : name_sample )
+    {
+        vector<uint32_t> cod_pts = utf8_code_points( smpl_name );
+        if ( cod_pts.empty() ) continue;
+        sorted_names.push_back( smpl_name );
+        for ( uint32_t cod_pt : cod_pts )
+        {
+            if ( cod_pt > ' ' && cod_pt < del ) ascii_cnt[ cod_pt ]++;
+            else if ( cod_pt > 0x7f && cod_pt < 0xfffd &&
+              !( cod_pt >= 0xd800 && cod_pt <= 0xdfff ) &&
+              !is_cod_pt_combining( cod_pt ) )
+              non_ascii_cnt[ cod_pt ]++;
+        }
+    }
+    const int bal_range = ggg_bal_lst_siz - 1;
+    if ( sorted_names.size() < static_cast<size_t>( bal_range ) * 4 )
+    {
+        errs << "A sample of " << sorted_names.size() << " names is too " <<
+          "small to derive balance points from." << endl;
+        return false;
+    }
+    sort( sorted_names.begin(), sorted_names.end(),
+      []( const string& lft, const string& rt )
+      { return strcoll( lft.c_str(), rt.c_str() ) < 0; } );
+    //
+    // Both parts of the scc_set start from the built in characters with a
+    //   zero count so that a sample using only a few characters still
+    //   fills the set, then the characters the sample uses are added.
+    //   The 0x01 and replacement character ends of the set stay fixed.
+    uint16_t new_scc[ scc_set_size ];
+    copy( scc_set, scc_set + scc_set_size, new_scc );
+    for ( int idx = 1; idx < scc_size_ascii; idx++ )
+      ascii_cnt[ scc_set[ idx ] ] += 0;
+    vector<uint32_t> ascii_part =
+      pick_primary_chars( ascii_cnt, scc_size_ascii - 1, "" );
+    if ( ascii_part.size() == static_cast<size_t>( scc_size_ascii - 1 ) )
+      copy( ascii_part.begin(), ascii_part.end(), new_scc + 1 );
+    for ( int idx = scc_size_ascii; idx < scc_set_size - 1; idx++ )
+      non_ascii_cnt[ scc_set[ idx ] ] += 0;
+    vector<uint32_t> utf_16_part = pick_primary_chars( non_ascii_cnt,
+      scc_size_utf_16 - 1, U_code_pt_to_UTF_8( new_scc[ scc_size_ascii - 1 ] ) );
+    if ( utf_16_part.size() == static_cast<size_t>( scc_size_utf_16 - 1 ) )
+      copy( utf_16_part.begin(), utf_16_part.end(), new_scc + scc_size_ascii );
+    //
+    // Each balance string is the greatest string of scc characters that
+    //   does not collate after its quantile name, cut to the shortest
+    //   length that collates after the previous quantile name.
+    //   The first and last entries are never used as base search
+    //   variables, so they are just set to the lowest and highest ASCII
+    //   characters doubled like the built in table.
+    auto scc_to_utf8 = [ &new_scc ]( const scc_idx& scc_strng )
+    {
+        string tstr;
+        for ( uint8_t scc_ch : scc_strng )
+          tstr += U_code_pt_to_UTF_8( new_scc[ scc_ch ] );
+        return tstr;
+    };
+    const size_t max_bal_len = 12;
+    vector<scc_idx> bal_idx( ggg_bal_lst_siz );
+    bal_idx[ 0 ] = scc_idx( 2, 1 );
+    bal_idx[ bal_range ] = scc_idx( 2, scc_size_ascii - 1 );
+    string prev_bal = scc_to_utf8( scc_idx( 1, 0 ) );
+    for ( int idx = 1; idx < bal_range; idx++ )
+    {
+        const string& prev_quant =
+          sorted_names[ ( idx - 1 ) * sorted_names.size() / bal_range ];
+        const string& quant_name =
+          sorted_names[ idx * sorted_names.size() / bal_range ];
+        scc_idx approx;
+        scc_idx after_prev;
+        while ( approx.size() < max_bal_len )
+        {
+            int best_ch = 0;
+            for ( int sdx = 1; sdx <= scc_set_size - 2; sdx++ )
+            {
+                scc_idx trial = approx;
+                trial.push_back( sdx );
+                if ( strcoll( scc_to_utf8( trial ).c_str(),
+                  quant_name.c_str() ) <= 0 ) best_ch = sdx;
+                else break;
+            }
+            if ( best_ch == 0 ) break;
+            approx.push_back( best_ch );
+            string approx_str = scc_to_utf8( approx );
+            if ( after_prev.empty() &&
+              strcoll( approx_str.c_str(), prev_bal.c_str() ) > 0 )
+              after_prev = approx;
+            if ( strcoll( approx_str.c_str(), prev_quant.c_str() ) > 0 ) break;
+        }
+        //
+        // Use the shortest one that falls between the two quantile names
+        //   if there is one, otherwise settle for one that is at least
+        //   after the previous balance string.
+        if ( strcoll( scc_to_utf8( approx ).c_str(), prev_bal.c_str() ) <= 0 )
+        {
+            if ( after_prev.empty() )
+            {
+                errs << "The name sample is not diverse enough to derive " <<
+                  "balance point " << idx << " of " << bal_range << "." << endl;
+                return false;
+            }
+            approx = after_prev;
+        }
+        bal_idx[ idx ] = approx;
+        prev_bal = scc_to_utf8( approx );
+    }
+    return apply_balance_points( new_scc, bal_idx );
+}
+
+bool gbst_interface_type::save_balance_points( const string& prof_file )
+{
+    ofstream prof_strm( prof_file );
+    if ( !prof_strm )
+    {
+        errs << "Unable to open balance profile " << prof_file <<
+          " for writing." << endl;
+        return false;
+    }
+    //
+    // The balance points are in the strcoll() order of the locale, so the
+    //   name of it goes with them.
+    const char *loc_name = setlocale( LC_COLLATE, nullptr );
+    prof_strm << "# gbtree UTF-8 balance profile" << endl << "locale " <<
+      ( loc_name != nullptr ? loc_name : "" ) << endl << "scc";
+    for ( int idx = 0; idx < scc_set_size; idx++ )
+      prof_strm << " " << hex << scc_set[ idx ] << dec;
+    prof_strm << endl;
+    for ( int idx = 0; idx < ggg_bal_lst_siz; idx++ )
+      prof_strm << "bal " << idx << " " <<
+      scc_set_array_to_utf8( scc_idx_to_str_bal[ idx ] ) << endl;
+    return prof_strm.good();
+}
+
+bool gbst_interface_type::load_balance_points( const string& prof_file )
+{
+    if ( nxt_tbl_index != 1 )
+    {
+        errs << "Balance points can only be changed before any names are " <<
+          "placed in the btree." << endl;
+        return false;
+    }
+    ifstream prof_strm( prof_file );
+    if ( !prof_strm )
+    {
+        errs << "Unable to open balance profile " << prof_file << "." << endl;
+        return false;
+    }
+    uint16_t new_scc[ scc_set_size ];
+    int scc_cnt = 0;
+    vector<string> bal_strs( ggg_bal_lst_siz );
+    int bal_cnt = 0;
+    string prof_line;
+    while ( getline( prof_strm, prof_line ) )
+    {
+        istringstream line_strm( prof_line );
+        string tag;
+        line_strm >> tag;
+        if ( tag == "locale" )
+        {
+            //
+            // A profile saved before the locale was kept has no locale line
+            //   and is taken in any locale.
+            string prof_locale;
+            line_strm >> prof_locale;
+            const char *loc_name = setlocale( LC_COLLATE, nullptr );
+            string run_locale = loc_name != nullptr ? loc_name : "";
+            if ( prof_locale != run_locale )
+            {
+                errs << "The balance profile " << prof_file << " is in the " <<
+                  "order of the [" << prof_locale << "] locale, but the " <<
+                  "names are in the order of the [" << run_locale <<
+                  "] locale." << endl;
+                return false;
+            }
+        }
+        else if ( tag == "scc" )
+        {
+            unsigned int cod_pt;
+            while ( scc_cnt < scc_set_size && line_strm >> hex >> cod_pt )
+              new_scc[ scc_cnt++ ] = cod_pt;
+        }
+        else if ( tag == "bal" )
+        {
+            int idx;
+            string bal_str;
+            if ( line_strm >> idx >> bal_str && idx >= 0 &&
+              idx < ggg_bal_lst_siz )
+            {
+                bal_strs[ idx ] = bal_str;
+                bal_cnt++;
+            }
+        }
+    }
+    if ( scc_cnt != scc_set_size || bal_cnt != ggg_bal_lst_siz ||
+      new_scc[ 0 ] != 0x01 || new_scc[ scc_set_size - 1 ] != 0xfffd )
+    {
+        errs << "The balance profile " << prof_file << " is not complete." <<
+          endl;
+        return false;
+    }
+    vector<scc_idx> bal_idx( ggg_bal_lst_siz );
+    for ( int idx = 0; idx < ggg_bal_lst_siz; idx++ )
+    {
+        for ( uint32_t cod_pt : utf8_code_points( bal_strs[ idx ] ) )
+        {
+            uint16_t* scc_pos = find( new_scc, new_scc + scc_set_size, cod_pt );
+            if ( scc_pos == new_scc + scc_set_size )
+            {
+                errs << "Balance string " << idx << " of profile " <<
+                  prof_file << " uses a character not in its scc set." << endl;
+                return false;
+            }
+            bal_idx[ idx ].push_back( scc_pos - new_scc );
+        }
+    }
+    return apply_balance_points( new_scc, bal_idx );
 }
@@ -43,7 +43,12 @@
 
 #include "utf8-name-store.h"
 #include "utf8-rcrd-type.h"
+#include "name-index.h"
+#include "name-norm.h"
+#include <chrono>
 #include <iostream>
+#include <memory>
+#include <vector>
 
 #ifdef INdevel
     // Declarations/definitions/code for development only
@@ -54,21 +59,72 @@ using namespace std;
 
 class gbst_interface_type
 {
+    //
+    // The index the names are placed in, which is the UTF-8 gbtree unless
+    //   another backend is asked for.  See name-index.h.
+    unique_ptr<name_index_type> name_idx;
+    //
+    // The secondary index of the names by their normalized strings, which
+    //   is only made when start_name_norm() is called.
+    unique_ptr<norm_name_index> norm_idx;
 
 public:
     utf8_rcrd_type new_str_ptr;
     int nxt_tbl_index;
+    //
+    // The time spent in the name index by search_place_name() and the
+    //   number of calls, so the backends can be compared without the
+    //   encoding and hash work that goes with each name.
+    chrono::steady_clock::duration idx_place_time;
+    long idx_place_cnt;
+    //
+    // The time spent normalizing the new names and adding them to the
+    //   secondary index
+    chrono::steady_clock::duration norm_time;
 
-    gbst_interface_type();
+    gbst_interface_type( name_index_backend bknd = gbtree_backend );
+    //
+    // Searches the name index for the name, and returns the ID for it.
+    //   That can be the ID of an existing name if it is already there.
+    //   With the gbtree backend the ID is the utf8_rcrd_type index.
+    int search_place_name( const string& fil_sys_name );
+    name_index_type& get_name_index() { return *name_idx; };
     //
-    // Searches the b tree for the name, and returns utf8_rcrd_type
-    //   index for it.  That index can be the index of an existing
-    //   utf8_rcrd_type record if it already exists.
-    int search_place_name( string fil_sys_name );
+    // Starts the normalization stage of search_place_name(), which adds
+    //   each new name to the secondary index by its normalized string.
+    //   The names placed before it is started are not in that index.
+    void start_name_norm( name_normalizer::norm_form form_set,
+      bool fold_set );
+    norm_name_index *get_norm_index() { return norm_idx.get(); };
     //
-    // Test the btree base search variable process
-    void test_btree_bsv();
+    // Test the btree base search variable process for every position down
+    //   to test_lvls levels below the head
+    void test_btree_bsv( int test_lvls );
+    //
+    // The base search variables for levels 1 to 5 of the UTF-8 btree come
+    //   from the ggguniq_str_bal_list table, which was chosen for one
+    //   particular set of file names.  This method replaces the table
+    //   with quantiles of a sample of the names to be stored, and also
+    //   replaces the non-ASCII part of the scc_set with the characters
+    //   the sample actually uses.  It can only be done before any name is
+    //   placed in the btree, since the base search variables determine
+    //   the shape of the tree.  Returns false and keeps the built in
+    //   values if the sample is too small or not diverse enough.
+    bool derive_balance_points( const vector<string>& name_sample );
+    //
+    // Save or load the balance points, the scc_set and the 33 balance
+    //   strings, in the profile file that goes with a name data base so
+    //   that a reloaded data base gets the same btree shape.  The load
+    //   has the same restriction as the derive above.  The profile also
+    //   names the LC_COLLATE locale whose order the points are in, and the
+    //   load won't take a profile made in another locale.
+    bool save_balance_points( const string& prof_file );
+    bool load_balance_points( const string& prof_file );
     // Show the fo_string_ptr[] array
 };
 
+//
+// The flags for a plain UTF-8 name, set up by the constructor
+extern styp_flags default_flg_set;
+
 #endif //GBST_IFACE_H
@@ -48,10 +48,21 @@
 
 #include "gbst-iface.h"
 #include "hash-rcrd-type.h"
+#include "gbtree-rebal.h"
+#include "gbtree-frozen.h"
+#include "gbtree-snap.h"
+#include "gbtree-defrag.h"
+#include "gbtree-merkle.h"
+#include "gbtree-succinct.h"
+#include "gbtree-ingest.h"
+#include "art-name-index.h"
+#include "ascii-collate.h"
+#include "uca-collate.h"
 #include "../uni-utils/hex-symbol.h"
 #include "../uni-utils/uni-utils.h"
 // #include <iostream>
-// #include <cstring>
+#include <cstring>
+#include <cmath>
 // #include <ctype.h>
 #include <fstream>
 // #include <sstream>
@@ -59,6 +70,13 @@
 #include <chrono>
 #include <ctime>
 #include <locale>
+#include <clocale>
+#include <random>
+#include <algorithm>
+#include <thread>
+#include <new>
+#include <cstdlib>
+#include <openssl/evp.h>
 #include <sys/ioctl.h>
 #include <termios.h>
 
@@ -83,7 +101,65 @@ debug_flags dbgf;
 heap_mon_class heap_mn;
 #endif  //  #ifdef INdevel
 
-int run_test_set( ifstream& f2proc, int start_str_num = 0 );
+//
+// The heap allocations made by each thread, counted by the operator new
+//   below so the benchmarks can show how many a placement or a lookup
+//   takes.  They are counted by thread since the snapshot readers are
+//   allocating at the same time.
+thread_local long num_heap_allocs = 0;
+//
+// The most heap allocations a name placement is expected to take with the
+//   info display lines of the searches left out, for the name itself and
+//   for each level of the UTF-8 btree search.  run_test_set() checks them.
+const double max_allocs_per_name = 16;
+const double max_allocs_per_level = 3;
+
+void *operator new( size_t alloc_size )
+{
+    num_heap_allocs++;
+    void *alloc_ptr = malloc( alloc_size == 0 ? 1 : alloc_size );
+    if ( alloc_ptr == nullptr ) throw bad_alloc();
+    return alloc_ptr;
+}
+
+//
+// GCC takes the free() of these as a mismatch with the new above once
+//   they are inlined, though the new is the malloc() here.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+void operator delete( void *alloc_ptr ) noexcept
+{
+    free( alloc_ptr );
+}
+
+void operator delete( void *alloc_ptr, size_t alloc_size ) noexcept
+{
+    free( alloc_ptr );
+}
+#pragma GCC diagnostic pop
+
+int run_test_set( ifstream& f2proc, int start_str_num = 0,
+  int bsv_test_lvls = 14 );
+void bench_lookups( gbtree& tree_hndl, vector<string> qkeys,
+  const string& tree_typ );
+void stress_conc_writers( vector<string> dgsts );
+void bench_defrag( gbtree& tree_hndl, vector<string> qkeys,
+  const string& tree_typ );
+void test_succinct( gbtree& tree_hndl, const vector<string>& qkeys,
+  const string& tree_typ, size_t rcrd_bytes );
+void test_ext_ingest( ifstream& f2proc, gbtree& utf8_hndl );
+void bench_name_index( ifstream& f2proc, gbst_interface_type& gbst_iface,
+  int num_lines );
+void bench_dgst_table( vector<string> dgsts );
+void bench_sort_keys( utf8_rcrd_type& utf8_hndl, vector<string> qkeys );
+void bench_bss_depth( utf8_rcrd_type& utf8_hndl );
+void test_ascii_collation( ifstream& f2proc );
+void test_uca_collation( ifstream& f2proc, gbst_interface_type& gbst_iface );
+void test_name_norm( ifstream& f2proc, gbst_interface_type& gbst_iface,
+  int num_lines );
+#ifdef USEmerkle_dgst
+void test_merkle_diff( gbtree& utf8_hndl );
+#endif  //  #ifdef USEmerkle_dgst
 
 int main(int argc, char* argv[])
 {
@@ -116,17 +192,21 @@ int main(int argc, char* argv[])
 #ifdef INdevel
           "the desired" << endl <<
           "starting line in the file if [Change start string number]" <<
-          " is set, and the desired" << endl <<
+          " is set, the desired" << endl <<
           "debug flag set as a hex value 0xnnnnnnnn " <<
-          "defining desired bits if [Debugging on] is set." <<
+          "defining desired bits if [Debugging on] is set," << endl <<
 #else
-          "and the desired starting line in" << endl <<
-          "the file if [Change start string number] is set." <<
+          "the desired starting line in" << endl <<
+          "the file if [Change start string number] is set, " <<
 #endif  //  #ifdef INdevel
+          "and the number of levels to test if [Test base search vars]" <<
+          " is set." <<
           endl <<
           " hex                                  0421842184218421" << endl <<
           " code  where the avail operations are 01⅟₀⁰̸₁0/1¹̸₀⁰̷₁¹̷₀1" << endl <<
-          "0x0000 To be defined ─────────────────┴┴┘│││││││││││││" << endl <<
+          "0x0000 To be defined ─────────────────┘│││││││││││││││" << endl <<
+          "0x4000 Derive balance points from file ┘││││││││││││││" << endl <<
+          "0x2000 Rebalance between inserts ───────┘│││││││││││││" << endl <<
           "0x1000 Show gbtree traverse ─────────────┘││││││││││││" << endl <<
           "0x0800 Test base search vars ─────────────┘│││││││││││" << endl <<
           "0x0400 Show Btree graph display ───────────┘││││││││││" << endl <<
@@ -144,6 +224,19 @@ int main(int argc, char* argv[])
           "0x0004 Show data record sizes ─────────────────────┘││" << endl <<
           "0x0002 Show strings put in name store ──────────────┘│" << endl <<
           "0x0001 Play back name store as stream ───────────────┘" << endl <<
+          "0x10000 Benchmark the frozen snapshot lookups" << endl <<
+          "0x20000 Keep the Merkle subtree digests and test the diff" << endl <<
+          "0x40000 Ingest the file to an archive through disk runs" << endl <<
+          "0x80000 Place the names in an adaptive radix tree" << endl <<
+          "0x100000 Compare the names by their strxfrm() sort keys" << endl <<
+          "0x200000 Order the names by the built in UCA collation" << endl <<
+          "0x400000 Order the names by their UTF-8 bytes" << endl <<
+          "0x800000 Keep the base search variables of each node" << endl <<
+          "0x1000000 Benchmark the base search variables by btree depth" <<
+          endl <<
+          "0x2000000 Index the names by their NFC case folded strings" <<
+          endl <<
+          "0x4000000 Leave the search levels out of the tracked info" << endl <<
           "         Exiting ..." << endl;
         exit(1);
         cout << "Went past the exit(1) statement, why?" << endl;
@@ -173,6 +266,19 @@ int main(int argc, char* argv[])
         // OK, read the binary string
         numxform = stoul( argv[1], nullptr, 2 );
     }
+    pflg.skip_search_levels = ( numxform & 0x4000000 ) == 0x4000000;
+    pflg.normalize_names = ( numxform & 0x2000000 ) == 0x2000000;
+    pflg.bench_base_search_depth = ( numxform & 0x1000000 ) == 0x1000000;
+    pflg.memo_base_search_vars = ( numxform & 0x800000 ) == 0x800000;
+    pflg.byte_order_collation = ( numxform & 0x400000 ) == 0x400000;
+    pflg.uca_collation = ( numxform & 0x200000 ) == 0x200000;
+    pflg.sort_key_cmps = ( numxform & 0x100000 ) == 0x100000;
+    pflg.art_name_index = ( numxform & 0x80000 ) == 0x80000;
+    pflg.ext_ingest = ( numxform & 0x40000 ) == 0x40000;
+    pflg.merkle_diff = ( numxform & 0x20000 ) == 0x20000;
+    pflg.benchmark_lookups = ( numxform & 0x10000 ) == 0x10000;
+    pflg.derive_balance_points = ( numxform & 0x4000 ) == 0x4000;
+    pflg.rebalance_btree = ( numxform & 0x2000 ) == 0x2000;
     pflg.show_gbtree_traverse = ( numxform & 0x1000 ) == 0x1000;
     pflg.test_base_search_vars = ( numxform & 0x0800 ) == 0x0800;
     pflg.change_start_str_num = ( numxform & 0x0200 ) == 0x0200;
@@ -186,6 +292,16 @@ int main(int argc, char* argv[])
     pflg.show_name_store_strings = ( numxform & 0x0002 ) == 0x0002;
     pflg.play_name_store_stream = ( numxform & 0x0001 ) == 0x0001;
     pflg.show_any = numxform != 0;
+
+#if defined (INFOdisplay) && !defined (USEncurses)
+    //
+    // Without the ncurses info window the info stream is only read when it
+    //   is saved at the end, so the lines of each search level are left out
+    //   unless it will be.  They can be left out of the saved stream too,
+    //   which keeps the placement figures of the benchmarks clear of them.
+    gbtree::set_search_info( pflg.track_base_search_vars &&
+      !pflg.skip_search_levels );
+#endif  //  defined (INFOdisplay) && !defined (USEncurses)
     auto file2process = argv[2];
     int start_str_num = 0;
     // use currently commented out  -    char *entry_locale;
@@ -288,6 +404,16 @@ int main(int argc, char* argv[])
     cout << flg_set << ( nflgs > 1 ? " flags are set." :
       nflgs == 1 ? " flag is set." : " no flags are set." ) << endl;
 #endif  //  #ifdef INdevel
+    //
+    // The base search variable test shows every position down to the
+    //   number of levels below the head given, so each level added
+    //   doubles its output.
+    int bsv_test_lvls = 14;
+    if ( pflg.test_base_search_vars && argc > nxtarg )
+    {
+        bsv_test_lvls = stoul( argv[nxtarg], nullptr, 10 );
+        nxtarg++;
+    }
     //
     // GGG - This section needs to be reviewed as there appears to be some
     //   settings made in the if statement [if ( pflg.show_any )] that will
@@ -335,9 +461,9 @@ int main(int argc, char* argv[])
           hex << numxform << dec << endl;
     }
     if ( pflg.change_start_str_num )
-      run_test_set( f2proc, start_str_num );
+      run_test_set( f2proc, start_str_num, bsv_test_lvls );
     else
-      run_test_set( f2proc );
+      run_test_set( f2proc, 0, bsv_test_lvls );
 
 #ifdef INFOdisplay    // Declarations for development only
     ostringstream stime;
@@ -377,12 +503,17 @@ ncursio *foiorf = nullptr;
 int16_t inf_ht, inf_wid;
 md5dgstArrayType mdtmp;
 
-int run_test_set( ifstream& f2proc, int start_str_num )
+int run_test_set( ifstream& f2proc, int start_str_num, int bsv_test_lvls )
 {
-    gbst_interface_type gbst_iface;
+    gbst_interface_type gbst_iface( pflg.art_name_index ? art_backend :
+      gbtree_backend );
     const int siz_index_list = ptr_tbl_max_rcrd - 1;
     int index_list[ siz_index_list ];
     int line_no = 0;
+    // Subtrees taller than rebal_ht_limit get rebuilt, and each step of
+    //   the rebalancer visits about rebal_step_size nodes.
+    const int rebal_ht_limit = 16;
+    const int rebal_step_size = 64;
 
     if ( pflg.show_data_record_sizes )
     {
@@ -409,12 +540,12 @@ int run_test_set( ifstream& f2proc, int start_str_num )
 
         union tu
         {
-            uint16_t tflgtst;
+            uint32_t tflgtst;
             flag_set tflag;
         } u;
         u.tflag = pflg;
         u.tflgtst = 0x0001;
-        for ( int i = 0; i < 16; i++ )
+        for ( int i = 0; i < 26; i++ )
         {
             // tflag = reinterpret_cast<flag_set>( tflgtst )
             drsiz << "For flag test = 0x" << hex << setw(4) <<
@@ -423,16 +554,16 @@ int run_test_set( ifstream& f2proc, int start_str_num )
               drsiz << ", track_base_search_vars is set";
             if ( u.tflag.change_start_str_num )
               drsiz << ", change_start_str_num is set";
-            if ( u.tflag.temp1bit > 0 )
-              drsiz << ", temp1bit = " << u.tflag.temp1bit;
+            if ( u.tflag.rebalance_btree )
+              drsiz << ", rebalance_btree is set";
             if ( u.tflag.read_strings_from_file )
               drsiz << ", read_strings_from_file is set";
             if ( u.tflag.show_info_output )
               drsiz << ", show_info_output is set";
             if ( u.tflag.play_back_names_read )
               drsiz << ", play_back_names_read is set";
-            if ( u.tflag.temp2bit > 0 )
-              drsiz << ", temp2bit= " << u.tflag.temp2bit;
+            if ( u.tflag.derive_balance_points )
+              drsiz << ", derive_balance_points is set";
             if ( u.tflag.show_data_record_sizes )
               drsiz << ", show_data_record_sizes is set";
             if ( u.tflag.show_name_store_strings )
@@ -441,6 +572,26 @@ int run_test_set( ifstream& f2proc, int start_str_num )
               drsiz << ", play_name_store_stream is set";
             if ( u.tflag.show_any )
               drsiz << ", show_any is set";
+            if ( u.tflag.benchmark_lookups )
+              drsiz << ", benchmark_lookups is set";
+            if ( u.tflag.merkle_diff )
+              drsiz << ", merkle_diff is set";
+            if ( u.tflag.ext_ingest )
+              drsiz << ", ext_ingest is set";
+            if ( u.tflag.art_name_index )
+              drsiz << ", art_name_index is set";
+            if ( u.tflag.sort_key_cmps )
+              drsiz << ", sort_key_cmps is set";
+            if ( u.tflag.uca_collation )
+              drsiz << ", uca_collation is set";
+            if ( u.tflag.byte_order_collation )
+              drsiz << ", byte_order_collation is set";
+            if ( u.tflag.memo_base_search_vars )
+              drsiz << ", memo_base_search_vars is set";
+            if ( u.tflag.bench_base_search_depth )
+              drsiz << ", bench_base_search_depth is set";
+            if ( u.tflag.normalize_names )
+              drsiz << ", normalize_names is set";
             drsiz << "." << endl;
             u.tflgtst <<= 1;
         }
@@ -575,6 +726,17 @@ int run_test_set( ifstream& f2proc, int start_str_num )
           sizeof(md5_rcrd_type)  <<
           " and the size of the sha1_rcrd_type is " <<
           sizeof(sha1_rcrd_type) << endl;
+#ifdef USEcompact_utf8_rcrd
+        drsiz << dec <<
+          "The compact utf8_rcrd_type record is in use, with " <<
+          sizeof(utf8_rcrd_type) << " bytes per node and no order statistics";
+#else
+        drsiz << dec << "The full utf8_rcrd_type record is in use, with " <<
+          sizeof(utf8_rcrd_type) << " bytes per node";
+#endif  //  #ifdef USEcompact_utf8_rcrd
+        drsiz << ", and the records take " <<
+          sizeof(utf8_rcrd_type) * ptr_tbl_max_rcrd << " bytes for " <<
+          ptr_tbl_max_rcrd << " names." << endl;
         // Show utilization of the data structures
         drsiz << "The next free element in the name_string_rcrds vector is " <<
           gbst_iface.nxt_tbl_index << endl <<
@@ -594,7 +756,21 @@ int run_test_set( ifstream& f2proc, int start_str_num )
           dbgs << "Calling gbst_iface.test_btree_bsv()" << endl;
 #endif  //  #ifdef INdevel
 
-        gbst_iface.test_btree_bsv();
+        gbst_iface.test_btree_bsv( bsv_test_lvls );
+        return 0;
+    }
+    if ( pflg.bench_base_search_depth )
+    {
+        //
+        // The walks need a btree with nothing else in it, the same as the
+        //   base search variable test.
+        utf8_rcrd_type depth_hndl;
+        if ( pflg.byte_order_collation )
+          depth_hndl.set_collation( utf8_rcrd_type::byte_order_coll );
+        else if ( pflg.uca_collation )
+          depth_hndl.set_collation( utf8_rcrd_type::uca_shifted_coll );
+        if ( pflg.sort_key_cmps ) depth_hndl.use_sort_keys( true );
+        bench_bss_depth( depth_hndl );
         return 0;
     }
 
@@ -631,6 +807,129 @@ int run_test_set( ifstream& f2proc, int start_str_num )
     inf_wid = term_wind_sizes.ws_col;
 #endif   //  #ifdef USEncurses
 
+    if ( pflg.derive_balance_points )
+    {
+        //
+        // Sample the whole input for the balance points, then start over
+        //   at the beginning of the file for the real run.  The profile is
+        //   saved with the other run output so it can be reused.
+        vector<string> bal_sample;
+        string smpl_name;
+        while ( getline( f2proc, smpl_name ) &&
+          bal_sample.size() < static_cast<size_t>( siz_index_list ) )
+          bal_sample.push_back( smpl_name );
+        f2proc.clear();
+        f2proc.seekg( 0 );
+        if ( gbst_iface.derive_balance_points( bal_sample ) )
+        {
+            iout << "Balance points derived from " << bal_sample.size() <<
+              " names:";
+            for ( int idx = 0; idx < ggg_bal_lst_siz; idx++ )
+              iout << ( idx % 8 == 0 ? "\n    " : " " ) <<
+              ggguniq_str_bal_list[ idx ];
+            iout << endl;
+            //
+            // The profile is loaded back, which has to give the same
+            //   points, and it must be refused in the C locale when it
+            //   was made in another one.
+            const string prof_file = "temp/gbst-bal-profile.txt";
+            vector<string> bal_strs( ggguniq_str_bal_list,
+              ggguniq_str_bal_list + ggg_bal_lst_siz );
+            if ( gbst_iface.save_balance_points( prof_file ) &&
+              ( !gbst_iface.load_balance_points( prof_file ) ||
+              !equal( bal_strs.begin(), bal_strs.end(),
+              ggguniq_str_bal_list ) ) )
+              errs << "The balance profile did not load back the same." <<
+              endl;
+            const char *loc_name = setlocale( LC_COLLATE, nullptr );
+            string run_locale = loc_name != nullptr ? loc_name : "C";
+            if ( run_locale != "C" )
+            {
+                setlocale( LC_COLLATE, "C" );
+                ostringstream load_errs;
+                streambuf *errs_buf = errs.rdbuf( load_errs.rdbuf() );
+                bool c_loaded = gbst_iface.load_balance_points( prof_file );
+                errs.rdbuf( errs_buf );
+                setlocale( LC_COLLATE, run_locale.c_str() );
+                iout << "The balance profile of the " << run_locale <<
+                  " locale was " << ( c_loaded ? "LOADED" : "refused" ) <<
+                  " in the C locale" << endl;
+                if ( c_loaded )
+                  errs << "The balance profile made in the " << run_locale <<
+                  " locale was loaded in the C locale." << endl;
+            }
+        }
+    }
+
+    //
+    // The rebalancer works on the UTF-8 name records since they are the
+    //   ones whose base search variables can be unbalanced by the data.
+    //   A pass over the tree is done a little at a time after each name
+    //   is placed, and a new pass is started when the last one finishes.
+    utf8_rcrd_type rebal_hndl;
+    gbtree_rebalancer rebal( rebal_hndl, rebal_ht_limit );
+    if ( pflg.byte_order_collation )
+      rebal_hndl.set_collation( utf8_rcrd_type::byte_order_coll );
+    else if ( pflg.uca_collation )
+      rebal_hndl.set_collation( utf8_rcrd_type::uca_shifted_coll );
+    if ( pflg.sort_key_cmps ) rebal_hndl.use_sort_keys( true );
+    if ( pflg.memo_base_search_vars ) rebal_hndl.use_bsv_memo( true );
+
+    //
+    // With the lookup benchmark, reader threads do lookups in snapshots of
+    //   the UTF-8 btree while the names are being added.  A new snapshot
+    //   is published after each batch of snap_batch_size names.  Half of
+    //   the lookups are for keys that are not in the snapshot.
+    const int snap_batch_size = 128;
+    const int num_snap_readers = 4;
+    gbtree_snap_pub snap_pub;
+    atomic<bool> rdrs_stop( false );
+    vector<long> rdr_lookups( num_snap_readers, 0 );
+    vector<thread> rdr_threads;
+    auto snap_reader = [ &snap_pub, &rdrs_stop ]( long& num_lookups )
+    {
+        int reader_id = snap_pub.register_reader();
+        mt19937 rank_gen( 7919 * ( reader_id + 1 ) );
+        long lookup_cnt = 0;
+        while ( !rdrs_stop.load( memory_order_relaxed ) )
+        {
+            const gbtree_frozen *snap = snap_pub.pin( reader_id );
+            if ( snap != nullptr && snap->size() > 0 )
+            {
+                for ( int idx = 0; idx < 64; idx++ )
+                {
+                    string skey =
+                      snap->key_at_rank( rank_gen() % snap->size() );
+                    if ( idx & 1 ) skey += '~';
+                    if ( snap->find_sort_key( skey ) >= 0 ) lookup_cnt++;
+                }
+            }
+            snap_pub.unpin( reader_id );
+            if ( snap == nullptr ) this_thread::yield();
+        }
+        snap_pub.release_reader( reader_id );
+        num_lookups = lookup_cnt;
+    };
+#ifdef USEmerkle_dgst
+    //
+    // The digests are turned on before the names are added so that the
+    //   digests kept by the inserts get tested.
+    if ( pflg.merkle_diff )
+    {
+        md5_rcrd_type mrkl_md5;
+        rebal_hndl.start_merkle_dgsts();
+        mrkl_md5.start_merkle_dgsts();
+    }
+#endif  //  #ifdef USEmerkle_dgst
+    if ( pflg.normalize_names )
+      gbst_iface.start_name_norm( name_normalizer::nfc, true );
+    chrono::steady_clock::duration publish_time{ 0 };
+    long place_allocs = 0;
+    auto ingest_start = chrono::steady_clock::now();
+    if ( pflg.benchmark_lookups )
+      for ( int rdr = 0; rdr < num_snap_readers; rdr++ )
+        rdr_threads.emplace_back( snap_reader, ref( rdr_lookups[ rdr ] ) );
+
     // When getting lines from an actual file system, a delimiter
     //   character will need to be set reflecting the file system
     //   name string delimiter (for linux ext - '\0')
@@ -649,7 +948,9 @@ int run_test_set( ifstream& f2proc, int start_str_num )
           ( pflg.change_start_str_num && ++lines_read > start_str_num )  )
         // hold -- if ( true )
         {
+            long allocs_before = num_heap_allocs;
             int stind = gbst_iface.search_place_name( nm_frm_file );
+            place_allocs += num_heap_allocs - allocs_before;
             if ( stind > 0 )
             {
                 // Now done in file gbtree.cc in the do_node_info_update()
@@ -657,14 +958,124 @@ int run_test_set( ifstream& f2proc, int start_str_num )
                 //      if ( pflg.play_back_names_read )
                 index_list[ line_no ] = stind;
                 line_no++;
+                if ( pflg.rebalance_btree && !rebal.step( rebal_step_size ) )
+                  rebal.start_pass();
+                if ( pflg.benchmark_lookups && line_no % snap_batch_size == 0 )
+                {
+                    auto pub_start = chrono::steady_clock::now();
+                    gbtree_frozen *new_snap = new gbtree_frozen;
+                    new_snap->freeze( rebal_hndl );
+                    snap_pub.publish( new_snap );
+                    publish_time += chrono::steady_clock::now() - pub_start;
+                }
             }
             else errs << "Invalid input line detected" << endl;
         }
     }
+    if ( pflg.sort_key_cmps )
+      iout << "The " << line_no << " names were placed with " <<
+      rebal_hndl.get_name_cmp_cnt() << " sort key compares, " <<
+      100.0 * rebal_hndl.get_abbr_cmp_cnt() /
+      max( 1L, rebal_hndl.get_name_cmp_cnt() ) <<
+      "% of them settled by the key abbreviation" << endl;
+    else if ( pflg.byte_order_collation )
+      iout << "The " << line_no << " names were placed with " <<
+      rebal_hndl.get_name_cmp_cnt() << " byte order compares" << endl;
+    else if ( pflg.uca_collation )
+      iout << "The " << line_no << " names were placed with " <<
+      rebal_hndl.get_name_cmp_cnt() << " UCA collation compares" << endl;
+    else
+      iout << "The " << line_no << " names were placed with " <<
+      rebal_hndl.get_name_cmp_cnt() << " compares, " <<
+      100.0 * rebal_hndl.get_ascii_cmp_cnt() /
+      max( 1L, rebal_hndl.get_name_cmp_cnt() ) <<
+      "% of them done with the ASCII collation tables" << endl;
+#ifdef INFOdisplay
+    bool search_lines = gbtree::get_search_info();
+#else
+    bool search_lines = false;
+#endif // #ifdef INFOdisplay
+    double allocs_per_name = double( place_allocs ) / max( 1, line_no );
+    iout << "  " << allocs_per_name << " heap allocations per name placed" <<
+      ( search_lines ? ", with the info display lines of the searches" : "" ) <<
+      endl;
+    //
+    // Without the info display lines, the allocations left are the copy of
+    //   the name and the new records for it, and on each level of the
+    //   UTF-8 btree search at most the name strings of the base search
+    //   variable and of its minimum and maximum, the ones that are too long
+    //   to be kept in the string itself.  The hash btrees make none.
+    double max_place_allocs = max_allocs_per_name + max_allocs_per_level *
+      double( rebal_hndl.get_bsv_set_cnt() ) / max( 1, line_no );
+    if ( !search_lines && allocs_per_name > max_place_allocs )
+      errs << "The names were placed with " << allocs_per_name <<
+      " heap allocations each, more than the " << max_place_allocs <<
+      " expected for the levels they were placed on." << endl;
+    iout << "  " << double( rebal_hndl.get_bsv_set_nsec() ) /
+      max( 1, line_no ) << " nsec per name placed setting the base search" <<
+      " variables of " << double( rebal_hndl.get_bsv_set_cnt() ) /
+      max( 1, line_no ) << " levels, " << 100.0 *
+      rebal_hndl.get_bsv_memo_hits() /
+      max( 1L, rebal_hndl.get_bsv_set_cnt() ) << "% of them from the memo" <<
+      endl;
+    if ( pflg.byte_order_collation )
+    {
+        //
+        // The in order walk of the gbtree has to give the names in the
+        //   order of their bytes, which std::string compares in.
+        gbtree_name_index tree_walk;
+        vector<int> name_ids;
+        tree_walk.list_in_order( name_ids );
+        long num_out = 0;
+        for ( size_t idx = 1; idx < name_ids.size(); idx++ )
+          if ( rebal_hndl.get_node_name_view( name_ids[ idx - 1 ] ) >=
+            rebal_hndl.get_node_name_view( name_ids[ idx ] ) ) num_out++;
+        iout << "  The " << name_ids.size() << " names of the gbtree have " <<
+          num_out << " out of byte order" << endl;
+        if ( num_out != 0 )
+          errs << num_out << " names of the gbtree are out of byte order." <<
+          endl;
+    }
+    if ( pflg.benchmark_lookups )
+    {
+        //
+        // Publish the final snapshot and give the readers a quiet period
+        //   so the read rate can be seen without the writer too.
+        auto ingest_end = chrono::steady_clock::now();
+        gbtree_frozen *new_snap = new gbtree_frozen;
+        new_snap->freeze( rebal_hndl );
+        snap_pub.publish( new_snap );
+        long lookups_at_end = 0;
+        this_thread::sleep_for( chrono::milliseconds( 200 ) );
+        rdrs_stop = true;
+        for ( auto& rdr_thrd : rdr_threads ) rdr_thrd.join();
+        auto quiet_end = chrono::steady_clock::now();
+        for ( long rdr_cnt : rdr_lookups ) lookups_at_end += rdr_cnt;
+        snap_pub.reclaim();
+        double ingest_sec =
+          chrono::duration<double>( ingest_end - ingest_start ).count();
+        double total_sec =
+          chrono::duration<double>( quiet_end - ingest_start ).count();
+        iout << "Snapshot publishing with " << num_snap_readers <<
+          " reader threads:" << endl << "  The writer added " << line_no <<
+          " names in " << ingest_sec << " sec, " << line_no / ingest_sec <<
+          " names/sec, with " << chrono::duration<double>( publish_time )
+          .count() << " sec spent making and publishing " <<
+          snap_pub.get_version() - 1 << " snapshots" << endl <<
+          "  The readers did " << lookups_at_end << " lookups in " <<
+          total_sec << " sec, " << lookups_at_end / total_sec <<
+          " lookups/sec" << endl << "  Old snapshots freed " <<
+          snap_pub.get_freed_cnt() << ", still waiting for readers " <<
+          snap_pub.get_retired_cnt() << endl;
+    }
+
+#ifdef INFOdisplay
     if ( pflg.play_back_names_read && plbck_strg.numsym > 5 )
       // There is at least one name string left that needs to be
       //   displayed for completeness.
       iout << plbck_strg.target << endl;
+#endif // #ifdef INFOdisplay
+
     bool dup_found = false;
     int last_nondup = 0;
     for ( int idx = 1; idx <line_no; idx++ )
@@ -693,6 +1104,59 @@ int run_test_set( ifstream& f2proc, int start_str_num )
     {
         iout << endl;
     }
+    if ( pflg.derive_balance_points && !pflg.rebalance_btree )
+    {
+        int num_nodes, max_depth;
+        double avg_depth;
+        rebal_hndl.get_depth_stats( num_nodes, max_depth, avg_depth );
+        iout << "With the derived balance points the UTF-8 btree has " <<
+          num_nodes << " nodes, max depth " << max_depth <<
+          " and average depth " << avg_depth << endl;
+    }
+    if ( pflg.rebalance_btree )
+    {
+        int num_nodes, max_depth;
+        double avg_depth;
+        rebal_hndl.get_depth_stats( num_nodes, max_depth, avg_depth );
+        iout << "Before the final rebalance pass the UTF-8 btree has " <<
+          num_nodes << " nodes, max depth " << max_depth <<
+          " and average depth " << avg_depth << endl;
+        rebal.start_pass();
+        while ( rebal.step( rebal_step_size ) );
+        rebal_hndl.get_depth_stats( num_nodes, max_depth, avg_depth );
+        iout << "After the final rebalance pass the UTF-8 btree has " <<
+          num_nodes << " nodes, max depth " << max_depth <<
+          " and average depth " << avg_depth << endl << "The rebalancer " <<
+          "rebuilt " << rebal.get_rebuild_cnt() << " subtrees with a total "
+          "of " << rebal.get_rebuilt_nodes() << " nodes." << endl;
+        //
+        // Names added below a pinned position only go into a chain until
+        //   the next pass (see gbtree-rebal.h).  Put a batch of names into
+        //   one gap of the rebuilt tree with no steps in between, then
+        //   check that one pass takes the tree back under the limit.
+        if ( line_no > 0 )
+        {
+            string gap_name( rebal_hndl.get_node_name_view(
+              index_list[ line_no / 2 ] ) );
+            int num_gap = 0;
+            for ( int idx = 1; idx <= 4 * rebal_ht_limit &&
+              line_no + num_gap < siz_index_list; idx++ )
+              if ( gbst_iface.search_place_name( gap_name + "." +
+                to_string( 1000 + idx ) ) > 0 ) num_gap++;
+            rebal_hndl.get_depth_stats( num_nodes, max_depth, avg_depth );
+            iout << "After " << num_gap << " names put in one gap with no " <<
+              "steps the max depth is " << max_depth;
+            rebal.start_pass();
+            while ( rebal.step( rebal_step_size ) );
+            rebal_hndl.get_depth_stats( num_nodes, max_depth, avg_depth );
+            int best_ht = 0;
+            while ( ( 1 << best_ht ) - 1 < num_nodes ) best_ht++;
+            iout << ", and after one more pass it is " << max_depth << endl;
+            if ( max_depth > max( rebal_ht_limit, best_ht + 1 ) )
+              errs << "The rebalance pass left a max depth of " <<
+              max_depth << ", over the limit of " << rebal_ht_limit << endl;
+        }
+    }
     if ( pflg.show_gbtree_traverse )
     {
         iout << endl << "Show gbtree traverse for UTF-8, sha-1,"
@@ -704,6 +1168,81 @@ int run_test_set( ifstream& f2proc, int start_str_num )
         md5_rcrd_type md5_rec;
         md5_rec.traverse_hash_records();
     }
+#ifdef USEorder_stats
+    if ( pflg.show_gbtree_traverse )
+    {
+        //
+        // Check the subtree counts by asking for each rank in turn and
+        //   getting the rank of the name back, then show the quartiles.
+        int num_items = rebal_hndl.get_item_cnt();
+        int rank_errs = 0;
+        for ( int kth = 0; kth < num_items; kth++ )
+        {
+            string kth_name =
+              rebal_hndl.get_node_name( rebal_hndl.select( kth ) );
+            if ( rebal_hndl.rank( kth_name ) != kth ) rank_errs++;
+        }
+        iout << endl << "The UTF-8 btree order statistics found " <<
+          rank_errs << " rank errors in " << num_items << " items." << endl;
+        for ( int qrtr = 0; qrtr <= 4 && num_items > 0; qrtr++ )
+        {
+            int kth = min( qrtr * num_items / 4, num_items - 1 );
+            iout << "  Rank " << kth << " is " <<
+              rebal_hndl.get_node_name( rebal_hndl.select( kth ) ) << endl;
+        }
+        if ( num_items > 0 )
+        {
+            string lo_name = rebal_hndl.get_node_name( rebal_hndl.select( 0 ) );
+            string hi_name =
+              rebal_hndl.get_node_name( rebal_hndl.select( num_items / 2 ) );
+            iout << "  The lower half range count is " <<
+              rebal_hndl.count_range( lo_name, hi_name ) << endl;
+        }
+    }
+#endif  //  #ifdef USEorder_stats
+#ifdef USEmerkle_dgst
+    if ( pflg.merkle_diff ) test_merkle_diff( rebal_hndl );
+#endif  //  #ifdef USEmerkle_dgst
+    if ( pflg.ext_ingest ) test_ext_ingest( f2proc, rebal_hndl );
+    if ( pflg.normalize_names ) test_name_norm( f2proc, gbst_iface, line_no );
+    if ( pflg.benchmark_lookups )
+    {
+        //
+        // This goes first since with the radix tree backend it places the
+        //   names in the UTF-8 btree, which the ones below then use.
+        bench_name_index( f2proc, gbst_iface, line_no );
+        test_ascii_collation( f2proc );
+        test_uca_collation( f2proc, gbst_iface );
+        //
+        // The UTF-8 names are looked up by name and the hash records by
+        //   digest, and both have the keys in the sorted order of a
+        //   snapshot to begin with.
+        gbtree_frozen key_src;
+        vector<string> qkeys;
+        if ( key_src.freeze( rebal_hndl ) )
+        {
+            for ( int rank_idx = 0; rank_idx < key_src.size(); rank_idx++ )
+              qkeys.push_back( rebal_hndl.get_node_name(
+              key_src.node_at_rank( rank_idx ) ) );
+            bench_lookups( rebal_hndl, qkeys, "UTF-8" );
+            bench_sort_keys( rebal_hndl, qkeys );
+            bench_defrag( rebal_hndl, qkeys, "UTF-8" );
+            test_succinct( rebal_hndl, qkeys, "UTF-8",
+              sizeof( utf8_rcrd_type ) );
+        }
+        md5_rcrd_type md5_hndl;
+        qkeys.clear();
+        if ( key_src.freeze( md5_hndl ) )
+        {
+            for ( int rank_idx = 0; rank_idx < key_src.size(); rank_idx++ )
+              qkeys.push_back( key_src.key_at_rank( rank_idx ) );
+            bench_lookups( md5_hndl, qkeys, "MD5" );
+            stress_conc_writers( qkeys );
+            bench_defrag( md5_hndl, qkeys, "MD5" );
+            test_succinct( md5_hndl, qkeys, "MD5", sizeof( md5_rcrd_type ) );
+            bench_dgst_table( qkeys );
+        }
+    }
 
 #ifdef USEncurses
     fo_io.manage_main_win();
@@ -767,3 +1306,1364 @@ int run_test_set( ifstream& f2proc, int start_str_num )
     }
     return 0;
 }
+
+//
+// Times the lookup of each key in the live btree and in a frozen snapshot
+//   of it.  The keys are shuffled so the lookups don't get any help from
+//   the caches by going in order, and each key is also looked up with a
+//   '~' added to it to have lookups that are not found.
+void bench_lookups( gbtree& tree_hndl, vector<string> qkeys,
+  const string& tree_typ )
+{
+    if ( qkeys.empty() ) return;
+    size_t num_keys = qkeys.size();
+    for ( size_t idx = 0; idx < num_keys; idx++ )
+      qkeys.push_back( qkeys[ idx ] + '~' );
+    mt19937 shfl_gen( 20221 );
+    shuffle( qkeys.begin(), qkeys.end(), shfl_gen );
+    const int num_rounds = max( 1, int( 400000 / qkeys.size() ) );
+
+    auto frz_start = chrono::steady_clock::now();
+    gbtree_frozen frzn;
+    frzn.freeze( tree_hndl );
+    auto frz_end = chrono::steady_clock::now();
+
+    long live_sum = 0;
+    int num_found = 0;
+    auto live_start = chrono::steady_clock::now();
+    for ( int rnd = 0; rnd < num_rounds; rnd++ )
+      for ( auto& qkey : qkeys )
+        live_sum += tree_hndl.find_node( qkey );
+    auto live_end = chrono::steady_clock::now();
+    long frzn_sum = 0;
+    for ( int rnd = 0; rnd < num_rounds; rnd++ )
+      for ( auto& qkey : qkeys )
+        frzn_sum += frzn.find( qkey );
+    auto frzn_end = chrono::steady_clock::now();
+    //
+    // The lookups that only use the sort keys leave out the strxfrm() of
+    //   the UTF-8 names, which is the cost a caller that keeps its keys in
+    //   sort key form doesn't pay.
+    vector<string> skeys;
+    for ( auto& qkey : qkeys )
+      skeys.push_back( tree_hndl.make_sort_key( qkey ) );
+    long skey_sum = 0;
+    auto skey_start = chrono::steady_clock::now();
+    for ( int rnd = 0; rnd < num_rounds; rnd++ )
+      for ( auto& skey : skeys )
+        skey_sum += frzn.find_sort_key( skey );
+    auto skey_end = chrono::steady_clock::now();
+    for ( auto& qkey : qkeys )
+      if ( frzn.find( qkey ) != 0 ) num_found++;
+    //
+    // The batched lookups of the live btree, for a few batch sizes
+    vector<int> batch_sizes = { 4, 8, 16, 32, 64 };
+    vector<double> batch_nsec;
+    vector<int> batch_found;
+    for ( int batch_size : batch_sizes )
+    {
+        long batch_sum = 0;
+        auto batch_start = chrono::steady_clock::now();
+        for ( int rnd = 0; rnd < num_rounds; rnd++ )
+        {
+            tree_hndl.find_nodes( qkeys, batch_found, batch_size );
+            for ( int fnd_id : batch_found ) batch_sum += fnd_id;
+        }
+        auto batch_end = chrono::steady_clock::now();
+        batch_nsec.push_back( chrono::duration<double, nano>(
+          batch_end - batch_start ).count() / ( double( num_rounds ) *
+          qkeys.size() ) );
+        if ( batch_sum != live_sum )
+          errs << "The batched lookups with a batch size of " << batch_size <<
+          " did not find the same nodes as the single lookups of the " <<
+          tree_typ << " btree." << endl;
+    }
+
+    double num_lookups = double( num_rounds ) * qkeys.size();
+    auto nsec_per = [ num_lookups ]( chrono::steady_clock::duration dur )
+    {
+        return chrono::duration<double, nano>( dur ).count() / num_lookups;
+    };
+    iout << endl << "Lookup benchmark for the " << tree_typ << " btree, " <<
+      qkeys.size() << " keys with " << num_found << " found, " <<
+      num_rounds << " rounds" << endl << "  The frozen snapshot took " <<
+      chrono::duration<double, micro>( frz_end - frz_start ).count() <<
+      " usec to build and uses " << frzn.get_mem_bytes() << " bytes" <<
+      endl << "  Live btree lookups:         " <<
+      nsec_per( live_end - live_start ) << " nsec each" << endl <<
+      "  Frozen snapshot lookups:    " << nsec_per( frzn_end - live_end ) <<
+      " nsec each" << endl << "  Frozen sort key lookups:    " <<
+      nsec_per( skey_end - skey_start ) << " nsec each" << endl;
+    double live_nsec = nsec_per( live_end - live_start );
+    iout << "  Live btree lookups one at a time: " << 1.0e9 / live_nsec <<
+      " lookups/sec" << endl;
+    for ( size_t idx = 0; idx < batch_sizes.size(); idx++ )
+      iout << "  Live batched lookups, batch of " << setw( 2 ) <<
+      batch_sizes[ idx ] << ": " << batch_nsec[ idx ] << " nsec each, " <<
+      1.0e9 / batch_nsec[ idx ] << " lookups/sec, " <<
+      live_nsec / batch_nsec[ idx ] << " times one at a time" << endl;
+    if ( live_sum != frzn_sum || live_sum != skey_sum )
+      errs << "The frozen snapshot lookups did not find the same nodes as " <<
+      "the live " << tree_typ << " btree." << endl;
+}
+
+//
+// Builds the MD5 btree again from the digests with 1 to 16 writer threads
+//   and checks each result against the btree built by one thread with
+//   place_new_node().  The shape of the btree only depends on the set of
+//   digests and not the order they were added in, so the trees must come
+//   out the same, which is checked by comparing their preorder sequences.
+//   Each thread also adds every eighth digest of the thread after it so
+//   the duplicate handling gets tested.
+void stress_conc_writers( vector<string> dgsts )
+{
+    md5_rcrd_type md5_hndl;
+    auto preorder_keys = [ &md5_hndl ]()
+    {
+        string pre_keys;
+        vector<int> walk_stk;
+        int head_id = md5_hndl.get_node( 0 ).get_child_right_idx();
+        if ( head_id != 0 ) walk_stk.push_back( head_id );
+        while ( !walk_stk.empty() )
+        {
+            int nd_id = walk_stk.back();
+            walk_stk.pop_back();
+            pre_keys += md5_hndl.get_sort_key( nd_id );
+            md5_rcrd_type& nd_rcrd = md5_hndl.get_node( nd_id );
+            if ( nd_rcrd.get_child_right_idx() != 0 )
+              walk_stk.push_back( nd_rcrd.get_child_right_idx() );
+            if ( nd_rcrd.get_child_left_idx() != 0 )
+              walk_stk.push_back( nd_rcrd.get_child_left_idx() );
+        }
+        return pre_keys;
+    };
+    auto add_digest = []( const string& dgst, bool conc_writer )
+    {
+        md5dgstArrayType dgst_ary;
+        memcpy( dgst_ary.data(), dgst.data(), dgst_ary.size() );
+        md5_rcrd_type new_rcrd( dgst_ary );
+        return conc_writer ? new_rcrd.place_new_node_conc() :
+          new_rcrd.place_new_node();
+    };
+    mt19937 shfl_gen( 31337 );
+    shuffle( dgsts.begin(), dgsts.end(), shfl_gen );
+    //
+    // prep4search() keeps room for 64 more records while there can be
+    //   concurrent writers, even for an add of a digest that is already
+    //   there, so a set that nearly fills the record array is cut down to
+    //   leave that room after the head record and all of the set.  The
+    //   whole set is put back at the end for the tests that follow.
+    vector<string> all_dgsts( dgsts );
+    const size_t conc_room = max_num_rcrd - siz_buffer - 64 - 2;
+    if ( dgsts.size() > conc_room ) dgsts.resize( conc_room );
+    md5_hndl.clear_dgst_vector();
+    for ( auto& dgst : dgsts ) add_digest( dgst, false );
+    string ref_keys = preorder_keys();
+
+    iout << endl << "Concurrent writers building the MD5 btree of " <<
+      dgsts.size() << " digests";
+    if ( dgsts.size() < all_dgsts.size() )
+      iout << ", " << all_dgsts.size() - dgsts.size() << " of the " <<
+        all_dgsts.size() << " left out for the room the writers need";
+    iout << ":" << endl;
+    double one_wrtr_rate = 0;
+    for ( int num_wrtrs = 1; num_wrtrs <= 16; num_wrtrs *= 2 )
+    {
+        shuffle( dgsts.begin(), dgsts.end(), shfl_gen );
+        md5_hndl.clear_dgst_vector();
+        atomic<int> num_fails( 0 );
+        atomic<long> num_adds( 0 );
+        vector<thread> wrtr_thrds;
+        auto bld_start = chrono::steady_clock::now();
+        for ( int wrtr = 0; wrtr < num_wrtrs; wrtr++ )
+          wrtr_thrds.emplace_back( [ &, wrtr ]()
+        {
+            int nxt_wrtr = ( wrtr + 1 ) % num_wrtrs;
+            long add_cnt = 0;
+            for ( size_t idx = 0; idx < dgsts.size(); idx++ )
+            {
+                bool mine = int( idx % num_wrtrs ) == wrtr;
+                bool dup = int( idx % num_wrtrs ) == nxt_wrtr && idx % 8 == 0;
+                if ( !mine && !dup ) continue;
+                if ( add_digest( dgsts[ idx ], true ) <= 0 ) num_fails++;
+                add_cnt++;
+            }
+            num_adds += add_cnt;
+        } );
+        for ( auto& wrtr_thrd : wrtr_thrds ) wrtr_thrd.join();
+        auto bld_end = chrono::steady_clock::now();
+        int num_nodes, max_depth;
+        double avg_depth;
+        md5_hndl.get_depth_stats( num_nodes, max_depth, avg_depth );
+        bool same_tree = preorder_keys() == ref_keys;
+        double bld_sec = chrono::duration<double>( bld_end - bld_start ).count();
+        double add_rate = num_adds / bld_sec;
+        if ( num_wrtrs == 1 ) one_wrtr_rate = add_rate;
+        iout << "  " << setw( 2 ) << num_wrtrs << " writers: " <<
+          num_adds << " adds in " << bld_sec * 1000.0 << " msec, " <<
+          add_rate << " adds/sec, " << add_rate / one_wrtr_rate <<
+          " of 1 writer, " << num_nodes << " nodes, " <<
+          ( same_tree ? "same tree" : "DIFFERENT TREE" ) << endl;
+        if ( !same_tree || num_fails > 0 || num_nodes != int( dgsts.size() ) )
+          errs << "The " << num_wrtrs << " writer MD5 btree has " <<
+          num_nodes << " nodes and " << num_fails << " failed adds and " <<
+          ( same_tree ? "matches" : "does not match" ) <<
+          " the single writer btree." << endl;
+    }
+    if ( dgsts.size() < all_dgsts.size() )
+    {
+        md5_hndl.clear_dgst_vector();
+        for ( auto& dgst : all_dgsts ) add_digest( dgst, false );
+    }
+#ifdef USEorder_stats
+    md5_hndl.recount_subtrees();
+#endif  //  #ifdef USEorder_stats
+#ifdef USEmerkle_dgst
+    merkle_dgst_type head_dgst;
+    if ( md5_hndl.get_merkle_dgst(
+      md5_hndl.get_node( 0 ).get_child_right_idx(), head_dgst ) )
+      md5_hndl.start_merkle_dgsts();
+#endif  //  #ifdef USEmerkle_dgst
+}
+
+//
+// Renumbers the records of the btree into the breadth first order and then
+//   the van Emde Boas order, and times the live lookups before and after
+//   each one.  The node ID found for each key before the first renumber is
+//   kept as its external ID, and each lookup afterwards must find the
+//   node that the remap table gives for it.
+void bench_defrag( gbtree& tree_hndl, vector<string> qkeys,
+  const string& tree_typ )
+{
+    if ( qkeys.empty() ) return;
+    //
+    // Every renumber has to keep the order of the keys of the btree and
+    //   the shape of it, so the in order keys and the depths are taken
+    //   before and after each one.
+    auto get_shape = [ &tree_hndl ]( vector<string>& in_order_keys,
+      int& num_nodes, int& max_depth )
+    {
+        double avg_depth;
+        tree_hndl.get_depth_stats( num_nodes, max_depth, avg_depth );
+        in_order_keys.clear();
+        vector<int> walk_stk;
+        int nd_id = tree_hndl.get_node( 0 ).get_child_right_idx();
+        while ( nd_id != 0 || !walk_stk.empty() )
+        {
+            while ( nd_id != 0 )
+            {
+                walk_stk.push_back( nd_id );
+                nd_id = tree_hndl.get_node( nd_id ).get_child_left_idx();
+            }
+            nd_id = walk_stk.back();
+            walk_stk.pop_back();
+            in_order_keys.push_back( tree_hndl.get_node_key( nd_id ) );
+            nd_id = tree_hndl.get_node( nd_id ).get_child_right_idx();
+        }
+    };
+    vector<string> base_keys;
+    int base_nodes, base_depth;
+    get_shape( base_keys, base_nodes, base_depth );
+    mt19937 shfl_gen( 20223 );
+    shuffle( qkeys.begin(), qkeys.end(), shfl_gen );
+    vector<int> ext_ids;
+    for ( auto& qkey : qkeys ) ext_ids.push_back( tree_hndl.find_node( qkey ) );
+    const int num_rounds = max( 1, int( 400000 / qkeys.size() ) );
+    auto time_lookups = [ & ]()
+    {
+        long fnd_sum = 0;
+        auto lkup_start = chrono::steady_clock::now();
+        for ( int rnd = 0; rnd < num_rounds; rnd++ )
+          for ( auto& qkey : qkeys )
+            fnd_sum += tree_hndl.find_node( qkey );
+        auto lkup_end = chrono::steady_clock::now();
+        if ( fnd_sum == 0 ) iout << "  No keys were found." << endl;
+        return chrono::duration<double, nano>( lkup_end - lkup_start ).count()
+          / ( double( num_rounds ) * qkeys.size() );
+    };
+
+    gbtree_defrag dfrg( tree_hndl );
+    double base_nsec = time_lookups();
+    iout << endl << "Renumbering the " << tree_typ << " btree records, " <<
+      qkeys.size() << " keys, max depth " << base_depth << ", " <<
+      num_rounds << " rounds" << endl <<
+      "  Arrival order:       average link distance " << setw( 8 ) <<
+      dfrg.get_avg_link_dist() << ", " << base_nsec << " nsec per lookup" <<
+      endl;
+    vector<pair<gbtree_defrag::defrag_order, string> > orders = {
+      { gbtree_defrag::bfs_order, "Breadth first order:" },
+      { gbtree_defrag::veb_order, "van Emde Boas order:" } };
+    for ( auto& ordr : orders )
+    {
+        auto rnum_start = chrono::steady_clock::now();
+        if ( !dfrg.renumber( ordr.first ) ) return;
+        auto rnum_end = chrono::steady_clock::now();
+        int num_bad = 0;
+        for ( size_t idx = 0; idx < qkeys.size(); idx++ )
+        {
+            int cur_id = tree_hndl.find_node( qkeys[ idx ] );
+            if ( cur_id != dfrg.get_cur_id( ext_ids[ idx ] ) ||
+              dfrg.get_ext_id( cur_id ) != ext_ids[ idx ] ) num_bad++;
+        }
+        double ordr_nsec = time_lookups();
+        iout << "  " << left << setw( 21 ) << ordr.second << right <<
+          "average link distance " << setw( 8 ) << dfrg.get_avg_link_dist() <<
+          ", " << ordr_nsec << " nsec per lookup, " << base_nsec / ordr_nsec <<
+          " times arrival order, renumbered in " <<
+          chrono::duration<double, micro>( rnum_end - rnum_start ).count() <<
+          " usec" << endl;
+        if ( num_bad != 0 )
+          errs << num_bad << " of the " << tree_typ << " keys were not found " <<
+          "at the remapped node IDs after the renumber." << endl;
+        vector<string> ordr_keys;
+        int num_nodes, max_depth;
+        get_shape( ordr_keys, num_nodes, max_depth );
+        if ( ordr_keys != base_keys || num_nodes != base_nodes ||
+          max_depth != base_depth )
+          errs << "The " << ordr.second.substr( 0, ordr.second.size() - 1 ) <<
+          " renumber of the " << tree_typ << " btree changed its order or " <<
+          "shape." << endl;
+    }
+}
+
+//
+// Builds the succinct archive of a btree and checks that the in order
+//   scan gives back the keys, which come in sorted order, that each key
+//   is found at its rank and the keys with a '~' added are not found, and
+//   that the shape is the same as the live btree, both before and after
+//   it is saved and loaded.  The size of the archive is shown in bits per
+//   node next to the size of the records, plus the names for the UTF-8
+//   btree since they are kept in the name store apart from the records.
+void test_succinct( gbtree& tree_hndl, const vector<string>& qkeys,
+  const string& tree_typ, size_t rcrd_bytes )
+{
+    if ( qkeys.empty() ) return;
+    //
+    // The live shape, as the in order ranks of the nodes in preorder and
+    //   the rank of the parent of each one
+    vector<int> live_pre;
+    vector<int> live_parent;
+    {
+        map<int, int> rank_of;
+        vector<int> walk_stk;
+        int nd_id = tree_hndl.get_node( 0 ).get_child_right_idx();
+        while ( nd_id != 0 || !walk_stk.empty() )
+        {
+            while ( nd_id != 0 )
+            {
+                walk_stk.push_back( nd_id );
+                nd_id = tree_hndl.get_node( nd_id ).get_child_left_idx();
+            }
+            nd_id = walk_stk.back();
+            walk_stk.pop_back();
+            rank_of[ nd_id ] = int( rank_of.size() );
+            nd_id = tree_hndl.get_node( nd_id ).get_child_right_idx();
+        }
+        vector<pair<int, int> > pre_stk;
+        int head_id = tree_hndl.get_node( 0 ).get_child_right_idx();
+        if ( head_id != 0 ) pre_stk.push_back( { head_id, -1 } );
+        while ( !pre_stk.empty() )
+        {
+            auto nd_ent = pre_stk.back();
+            pre_stk.pop_back();
+            gbtree& nd_rcrd = tree_hndl.get_node( nd_ent.first );
+            live_pre.push_back( rank_of[ nd_ent.first ] );
+            live_parent.push_back( nd_ent.second );
+            int right_id = nd_rcrd.get_child_right_idx();
+            int left_id = nd_rcrd.get_child_left_idx();
+            if ( right_id != 0 )
+              pre_stk.push_back( { right_id, rank_of[ nd_ent.first ] } );
+            if ( left_id != 0 )
+              pre_stk.push_back( { left_id, rank_of[ nd_ent.first ] } );
+        }
+    }
+    auto check_archive = [ & ]( const gbtree_succinct& arch, const string& when )
+    {
+        int num_bad = 0;
+        gbtree_succinct::scan_pos pos;
+        size_t num_scanned = 0;
+        for ( bool more = arch.scan_start( pos ); more;
+          more = arch.scan_next( pos ) )
+        {
+            if ( num_scanned >= qkeys.size() || pos.key != qkeys[ num_scanned ] )
+              num_bad++;
+            num_scanned++;
+        }
+        if ( num_scanned != qkeys.size() ) num_bad++;
+        for ( size_t idx = 0; idx < qkeys.size(); idx++ )
+        {
+            if ( arch.find( qkeys[ idx ] ) != int( idx ) ) num_bad++;
+            if ( arch.find( qkeys[ idx ] + '~' ) != -1 ) num_bad++;
+        }
+        vector<int> pre_ranks;
+        vector<int> parent_ranks;
+        arch.get_shape( pre_ranks, parent_ranks );
+        if ( pre_ranks != live_pre || parent_ranks != live_parent ) num_bad++;
+        if ( num_bad != 0 )
+          errs << "The " << tree_typ << " succinct archive had " << num_bad <<
+          " errors " << when << "." << endl;
+        return num_bad == 0;
+    };
+
+    gbtree_succinct arch;
+    auto bld_start = chrono::steady_clock::now();
+    if ( !arch.build( tree_hndl ) ) return;
+    auto bld_end = chrono::steady_clock::now();
+    if ( !check_archive( arch, "after the build" ) ) return;
+    string arch_file = "temp/gbst-succinct-" + tree_typ + ".bin";
+    gbtree_succinct loaded;
+    if ( !arch.save( arch_file ) || !loaded.load( arch_file, tree_hndl ) ||
+      !check_archive( loaded, "after it was loaded" ) ) return;
+    //
+    // An archive in the strcoll() order of a locale must not be loaded
+    //   while another locale is in use.  The C locale is always there, so
+    //   the archive is loaded again in it, with the error of the refused
+    //   load kept out of the run errors.
+    string arch_locale = loaded.get_collation_locale();
+    bool c_refused = false;
+    if ( !arch_locale.empty() && arch_locale != "C" )
+    {
+        setlocale( LC_COLLATE, "C" );
+        ostringstream load_errs;
+        streambuf *errs_buf = errs.rdbuf( load_errs.rdbuf() );
+        gbtree_succinct c_loaded;
+        c_refused = !c_loaded.load( arch_file, tree_hndl );
+        errs.rdbuf( errs_buf );
+        setlocale( LC_COLLATE, arch_locale.c_str() );
+        if ( !c_refused )
+          errs << "The " << tree_typ << " succinct archive made in the " <<
+          arch_locale << " locale was loaded in the C locale." << endl;
+    }
+
+    vector<string> shfl_keys = qkeys;
+    mt19937 shfl_gen( 20224 );
+    shuffle( shfl_keys.begin(), shfl_keys.end(), shfl_gen );
+    const int num_rounds = max( 1, int( 200000 / shfl_keys.size() ) );
+    long fnd_sum = 0;
+    auto lkup_start = chrono::steady_clock::now();
+    for ( int rnd = 0; rnd < num_rounds; rnd++ )
+      for ( auto& qkey : shfl_keys ) fnd_sum += loaded.find( qkey );
+    auto lkup_end = chrono::steady_clock::now();
+    if ( fnd_sum == 0 ) iout << "  No keys were found." << endl;
+    double lkup_nsec = chrono::duration<double, nano>( lkup_end -
+      lkup_start ).count() / ( double( num_rounds ) * shfl_keys.size() );
+
+    size_t key_bytes = 0;
+    for ( auto& qkey : qkeys ) key_bytes += qkey.size();
+    double num_nodes = double( qkeys.size() );
+    double live_bits = 8.0 * rcrd_bytes;
+    if ( tree_typ == "UTF-8" ) live_bits += 8.0 * key_bytes / num_nodes;
+    double arch_bits = 8.0 * arch.get_mem_bytes() / num_nodes;
+    iout << endl << "Succinct archive of the " << tree_typ << " btree, " <<
+      qkeys.size() << " nodes, built in " <<
+      chrono::duration<double, micro>( bld_end - bld_start ).count() <<
+      " usec" << endl << "  " << arch_bits << " bits per node against " <<
+      live_bits << " in memory, " << arch_bits / live_bits * 100.0 <<
+      "% of the size, " << lkup_nsec << " nsec per lookup" << endl;
+    if ( c_refused )
+      iout << "  The archive is in the order of the " << arch_locale <<
+        " locale, and a load of it in the C locale was refused" << endl;
+}
+
+//
+// Builds the MD5 records from the same shuffled digests with the btree
+//   and then with the digest table, and times the places and the lookups
+//   for both.  Half of the lookups are for digests with the last byte
+//   changed so they are not found.  Placing the digests a second time
+//   must give back the same IDs, and the sorted export must be in digest
+//   order.  The btree is built again at the end for the code that follows.
+void bench_dgst_table( vector<string> dgsts )
+{
+    if ( dgsts.empty() ) return;
+    md5_rcrd_type md5_hndl;
+    auto add_digest = []( const string& dgst )
+    {
+        md5dgstArrayType dgst_ary;
+        memcpy( dgst_ary.data(), dgst.data(), dgst_ary.size() );
+        md5_rcrd_type new_rcrd( dgst_ary );
+        return new_rcrd.place_new_node();
+    };
+    mt19937 shfl_gen( 20226 );
+    shuffle( dgsts.begin(), dgsts.end(), shfl_gen );
+    vector<string> qkeys = dgsts;
+    for ( auto& dgst : dgsts )
+    {
+        qkeys.push_back( dgst );
+        qkeys.back().back() ^= 0x5a;
+    }
+    shuffle( qkeys.begin(), qkeys.end(), shfl_gen );
+    vector<string> sorted_dgsts = dgsts;
+    sort( sorted_dgsts.begin(), sorted_dgsts.end() );
+    const int num_rounds = max( 1, int( 200000 / qkeys.size() ) );
+    iout << endl << "MD5 digest btree against the digest table, " <<
+      dgsts.size() << " digests, " << num_rounds << " rounds" << endl;
+    double btree_nsec[ 2 ] = { 0, 0 };
+    for ( int use_tbl = 0; use_tbl < 2; use_tbl++ )
+    {
+        md5_hndl.clear_dgst_vector();
+        md5_hndl.use_dgst_table( use_tbl == 1 );
+        int num_bad = 0;
+        auto place_start = chrono::steady_clock::now();
+        for ( size_t idx = 0; idx < dgsts.size(); idx++ )
+          if ( add_digest( dgsts[ idx ] ) != int( idx + 1 ) ) num_bad++;
+        auto place_end = chrono::steady_clock::now();
+        for ( size_t idx = 0; idx < dgsts.size(); idx++ )
+          if ( add_digest( dgsts[ idx ] ) != int( idx + 1 ) ) num_bad++;
+        long fnd_sum = 0;
+        auto lkup_start = chrono::steady_clock::now();
+        for ( int rnd = 0; rnd < num_rounds; rnd++ )
+          for ( auto& qkey : qkeys ) fnd_sum += md5_hndl.find_node( qkey );
+        auto lkup_end = chrono::steady_clock::now();
+        if ( fnd_sum == 0 ) iout << "  No digests were found." << endl;
+        vector<int> sorted_ids;
+        md5_hndl.export_sorted( sorted_ids );
+        if ( sorted_ids.size() != sorted_dgsts.size() ) num_bad++;
+        else
+          for ( size_t idx = 0; idx < sorted_ids.size(); idx++ )
+            if ( md5_hndl.get_sort_key( sorted_ids[ idx ] ) !=
+              sorted_dgsts[ idx ] ) num_bad++;
+        double place_nsec = chrono::duration<double, nano>( place_end -
+          place_start ).count() / dgsts.size();
+        double lkup_nsec = chrono::duration<double, nano>( lkup_end -
+          lkup_start ).count() / ( double( num_rounds ) * qkeys.size() );
+        iout << "  " << ( use_tbl ? "Digest table: " : "Btree:        " ) <<
+          place_nsec << " nsec per place, " << lkup_nsec <<
+          " nsec per lookup";
+        if ( use_tbl )
+          iout << ", " << btree_nsec[ 0 ] / place_nsec << " and " <<
+          btree_nsec[ 1 ] / lkup_nsec << " times the btree";
+        else
+        {
+            btree_nsec[ 0 ] = place_nsec;
+            btree_nsec[ 1 ] = lkup_nsec;
+        }
+        iout << endl;
+        if ( num_bad != 0 )
+          errs << "The MD5 " << ( use_tbl ? "digest table" : "btree" ) <<
+          " had " << num_bad << " wrong IDs or sorted digests." << endl;
+    }
+    md5_hndl.clear_dgst_vector();
+    md5_hndl.use_dgst_table( false );
+    for ( auto& dgst : dgsts ) add_digest( dgst );
+#ifdef USEorder_stats
+    md5_hndl.recount_subtrees();
+#endif  //  #ifdef USEorder_stats
+#ifdef USEmerkle_dgst
+    merkle_dgst_type head_dgst;
+    if ( md5_hndl.get_merkle_dgst(
+      md5_hndl.get_node( 0 ).get_child_right_idx(), head_dgst ) )
+      md5_hndl.start_merkle_dgsts();
+#endif  //  #ifdef USEmerkle_dgst
+}
+
+//
+// Looks up the names with the compares done by strcoll() on copies of the
+//   names and then by memcmp() on their sort keys.  Half of the lookups
+//   are for names that are not in the btree.  The compares a second take
+//   in the time to make the key of each name looked up, since an insert
+//   has to make one for its new name as well.
+void bench_sort_keys( utf8_rcrd_type& utf8_hndl, vector<string> qkeys )
+{
+    if ( qkeys.empty() ) return;
+    bool keys_were_on = utf8_hndl.sort_keys_used();
+    size_t name_bytes = 0;
+    for ( auto& qkey : qkeys ) name_bytes += qkey.size() + 1;
+    size_t num_names = qkeys.size();
+    for ( size_t idx = 0; idx < num_names; idx++ )
+      qkeys.push_back( qkeys[ idx ] + '~' );
+    mt19937 shfl_gen( 20227 );
+    shuffle( qkeys.begin(), qkeys.end(), shfl_gen );
+    const int num_rounds = max( 1, int( 200000 / qkeys.size() ) );
+    iout << endl << "UTF-8 name compares by strcoll() against sort keys, " <<
+      num_names << " names, " << num_rounds << " rounds" << endl;
+    vector<vector<int> > found_ids( 2 );
+    double cmp_rate[ 2 ] = { 0, 0 };
+    for ( int use_keys = 0; use_keys < 2; use_keys++ )
+    {
+        utf8_hndl.use_sort_keys( use_keys == 1 );
+        for ( auto& qkey : qkeys )
+          found_ids[ use_keys ].push_back( utf8_hndl.find_node( qkey ) );
+        long start_cmps = utf8_hndl.get_name_cmp_cnt();
+        long start_abbr = utf8_hndl.get_abbr_cmp_cnt();
+        auto lkup_start = chrono::steady_clock::now();
+        long fnd_sum = 0;
+        for ( int rnd = 0; rnd < num_rounds; rnd++ )
+          for ( auto& qkey : qkeys ) fnd_sum += utf8_hndl.find_node( qkey );
+        auto lkup_end = chrono::steady_clock::now();
+        if ( fnd_sum == 0 ) iout << "  No names were found." << endl;
+        double num_cmps = utf8_hndl.get_name_cmp_cnt() - start_cmps;
+        double lkup_sec = chrono::duration<double>( lkup_end -
+          lkup_start ).count();
+        double num_lkups = double( num_rounds ) * qkeys.size();
+        cmp_rate[ use_keys ] = num_cmps / lkup_sec;
+        iout << "  " << ( use_keys ? "Sort keys: " : "strcoll(): " ) <<
+          lkup_sec * 1e9 / num_lkups << " nsec per lookup, " <<
+          num_cmps / num_lkups << " compares per lookup, " <<
+          cmp_rate[ use_keys ] / 1e6 << " million compares a second";
+        double abbr_pct = 100.0 * ( utf8_hndl.get_abbr_cmp_cnt() -
+          start_abbr ) / max( 1.0, num_cmps );
+        if ( use_keys )
+          iout << ", " << cmp_rate[ 1 ] / cmp_rate[ 0 ] <<
+          " times strcoll()" << endl << "  " << abbr_pct <<
+          "% of the compares were settled by the key abbreviation" <<
+          endl << "  The sort keys take " <<
+          utf8_hndl.get_sort_key_bytes() << " bytes, " <<
+          double( utf8_hndl.get_sort_key_bytes() ) / num_names <<
+          " a name, for names that take " << name_bytes <<
+          " bytes in the name store";
+        iout << endl;
+    }
+    if ( found_ids[ 0 ] != found_ids[ 1 ] )
+      errs << "The lookups by sort key found different names than the" <<
+      " lookups by strcoll()." << endl;
+    utf8_hndl.use_sort_keys( keys_were_on );
+}
+
+//
+// Walks random paths down the UTF-8 btree as deep as a btree of each size
+//   would be, working out the base search variables of every level, to
+//   show how long they take, how long their scc strings get, whether each
+//   one still falls between the min and max of its level, and how big the
+//   memo entries of the nodes are.  The name store only has room for
+//   max_num_rcrd names, so the depths of the bigger btrees are worked out
+//   instead of made.  A balanced btree of n names is ceil( log2( n + 1 ) )
+//   levels deep, and one that the names went into in random order is
+//   about 4.311 ln n - 1.953 ln ln n levels deep.
+void bench_bss_depth( utf8_rcrd_type& utf8_hndl )
+{
+    const long tree_sizes[] = { 1000, 10000, 100000, 1000000, 10000000,
+      50000000 };
+    const int num_paths = 200;
+    mt19937 path_gen( 20249 );
+    vector<utf8_rcrd_type::bss_walk_lvl> lvl_info;
+    utf8_hndl.use_bsv_memo( true );
+    iout << endl << dec << setfill( ' ' ) <<
+      "Base search variables by btree depth, " << num_paths <<
+      " random paths down each depth, each walked twice so the second" <<
+      " walk is from the memo" << endl << "     names shape    depth" <<
+      " nsec/lvl memo nsec/lvl scc digits outside memo bytes/node" <<
+      " (deltas, whole strings) memo MB" << endl;
+    for ( long num_names : tree_sizes )
+    {
+        for ( int shape = 0; shape < 2; shape++ )
+        {
+            double ln_names = log( double( num_names ) );
+            int depth = shape == 0 ? ceil( log2( num_names + 1.0 ) ) :
+              lround( 4.311 * ln_names - 1.953 * log( ln_names ) );
+            double walk_nsec[ 2 ] = { 0, 0 };
+            long walk_cnt[ 2 ] = { 0, 0 };
+            long memo_miss = 0;
+            long num_outside = 0;
+            size_t max_digits = 0;
+            double entry_sum = 0, delta_sum = 0, whole_sum = 0;
+            for ( int path_num = 0; path_num < num_paths; path_num++ )
+            {
+                string path = "r";
+                while ( path.size() < static_cast<size_t>( depth ) )
+                  path.push_back( path_gen() & 1 ? 'r' : 'l' );
+                for ( int walk = 0; walk < 2; walk++ )
+                {
+                    long start_nsec = utf8_hndl.get_bsv_set_nsec();
+                    long start_cnt = utf8_hndl.get_bsv_set_cnt();
+                    long start_hits = utf8_hndl.get_bsv_memo_hits();
+                    utf8_hndl.walk_bss_path( path, lvl_info );
+                    walk_nsec[ walk ] += utf8_hndl.get_bsv_set_nsec() -
+                      start_nsec;
+                    walk_cnt[ walk ] += utf8_hndl.get_bsv_set_cnt() -
+                      start_cnt;
+                    if ( walk == 1 ) memo_miss += depth -
+                      ( utf8_hndl.get_bsv_memo_hits() - start_hits );
+                }
+                for ( auto& lvl : lvl_info )
+                {
+                    if ( !lvl.in_range ) num_outside++;
+                    entry_sum += lvl.entry_bytes;
+                    delta_sum += lvl.delta_bytes;
+                    whole_sum += lvl.whole_bytes;
+                }
+                max_digits = max( max_digits, lvl_info.back().scc_digits );
+            }
+            if ( memo_miss > 0 )
+              errs << memo_miss << " levels of the second walks at depth " <<
+              depth << " were not found in the memo." << endl;
+            double num_lvls = double( num_paths ) * depth;
+            iout << setw( 10 ) << num_names <<
+              ( shape == 0 ? " balanced " : " random   " ) << setw( 5 ) <<
+              depth << setw( 9 ) << lround( walk_nsec[ 0 ] /
+              max( 1L, walk_cnt[ 0 ] ) ) << setw( 14 ) <<
+              lround( walk_nsec[ 1 ] / max( 1L, walk_cnt[ 1 ] ) ) <<
+              setw( 11 ) << max_digits << setw( 8 ) << num_outside <<
+              setw( 16 ) << lround( entry_sum / num_lvls ) << " (" <<
+              delta_sum / num_lvls << ", " << whole_sum / num_lvls << ")" <<
+              "  " << entry_sum / num_lvls * num_names / 1e6 << endl;
+        }
+    }
+    utf8_hndl.use_bsv_memo( false );
+}
+
+//
+// Checks the ASCII collation tables against strcoll() for every pair of
+//   the ASCII names of the file, both ways around, and times the two ways
+//   of comparing them.  The tables are then made for each of the UTF-8
+//   locales below that is installed, and the same pairs are checked in
+//   each one, since the locale the test runs in may be one where the
+//   weights of the ASCII bytes are all simple.
+void test_ascii_collation( ifstream& f2proc )
+{
+    ascii_collator ascii_coll;
+    bool coll_usable = ascii_coll.setup();
+    iout << endl << "ASCII collation tables for the " <<
+      ascii_coll.get_locale() << " locale, " << ascii_coll.get_level_cnt() <<
+      " levels, " << ascii_coll.get_fast_ch_cnt() <<
+      " of the 127 ASCII bytes in the tables, " <<
+      ascii_coll.get_sample_cnt() << " sample pairs checked by setup()" <<
+      endl;
+    if ( !coll_usable )
+    {
+        if ( ascii_coll.get_sample_fail_cnt() > 0 )
+          iout << "  The tables were not used since " <<
+          ascii_coll.get_sample_fail_cnt() << " of the sample pairs, " <<
+          "the first " << ascii_coll.get_fail_sample() <<
+          ", are not in the order strcoll() gives" << endl;
+        return;
+    }
+    vector<string> ascii_names;
+    vector<string> names;
+    int num_lines = 0;
+    string nm_frm_file;
+    f2proc.clear();
+    f2proc.seekg( 0 );
+    while ( getline( f2proc, nm_frm_file ) )
+    {
+        num_lines++;
+        if ( all_of( nm_frm_file.begin(), nm_frm_file.end(), []( char nm_ch )
+          { return nm_ch > 0; } ) ) ascii_names.push_back( nm_frm_file );
+        if ( ascii_coll.can_compare( nm_frm_file.data(),
+          nm_frm_file.size() ) ) names.push_back( nm_frm_file );
+    }
+    auto cmp_sign = []( int cmp_rslt )
+      { return cmp_rslt < 0 ? -1 : ( cmp_rslt > 0 ? 1 : 0 ); };
+    auto count_bad = [ &cmp_sign ]( const ascii_collator& tbl_coll,
+      const vector<string>& chk_names )
+    {
+        long num_bad = 0;
+        for ( auto& name_a : chk_names )
+        {
+            for ( auto& name_b : chk_names )
+            {
+                int tbl_sign = cmp_sign( tbl_coll.compare( name_a.data(),
+                  name_a.size(), name_b.data(), name_b.size() ) );
+                if ( tbl_sign == cmp_sign( strcoll( name_a.c_str(),
+                  name_b.c_str() ) ) ) continue;
+                if ( num_bad++ < 5 )
+                  errs << "The ASCII collation tables for the " <<
+                  tbl_coll.get_locale() << " locale give " << tbl_sign <<
+                  " for [" << name_a << "] to [" << name_b <<
+                  "] which strcoll() does not." << endl;
+            }
+        }
+        return num_bad;
+    };
+    long sign_sum[ 2 ] = { 0, 0 };
+    auto coll_start = chrono::steady_clock::now();
+    for ( auto& name_a : names )
+      for ( auto& name_b : names )
+        sign_sum[ 0 ] += cmp_sign( strcoll( name_a.c_str(), name_b.c_str() ) );
+    auto tbl_start = chrono::steady_clock::now();
+    for ( auto& name_a : names )
+      for ( auto& name_b : names )
+        sign_sum[ 1 ] += cmp_sign( ascii_coll.compare( name_a.data(),
+          name_a.size(), name_b.data(), name_b.size() ) );
+    auto tbl_end = chrono::steady_clock::now();
+    long num_bad = count_bad( ascii_coll, names );
+    double num_pairs = double( names.size() ) * names.size();
+    double coll_nsec = chrono::duration<double, nano>( tbl_start -
+      coll_start ).count() / max( 1.0, num_pairs );
+    double tbl_nsec = chrono::duration<double, nano>( tbl_end -
+      tbl_start ).count() / max( 1.0, num_pairs );
+    iout << "  " << names.size() << " of the " << num_lines <<
+      " names are ASCII, and all " << long( num_pairs ) <<
+      " pairs of them were checked against strcoll(), " << num_bad <<
+      " differed" << endl << "  strcoll(): " << coll_nsec <<
+      " nsec per compare, tables: " << tbl_nsec << " nsec per compare, " <<
+      coll_nsec / max( 1e-9, tbl_nsec ) << " times faster" << endl;
+    if ( sign_sum[ 0 ] != sign_sum[ 1 ] && num_bad == 0 )
+      errs << "The ASCII collation compare timing sums differ." << endl;
+
+    //
+    // The locales with the most rules for the ASCII letters and the
+    //   punctuation, the contractions of Danish and the accents of French
+    //   among them.  Those that aren't installed are passed over.
+    const char *const utf8_locales[] = { "en_US.UTF-8", "de_DE.UTF-8",
+      "fr_FR.UTF-8", "da_DK.UTF-8", "sv_SE.UTF-8", "cs_CZ.UTF-8",
+      "C.UTF-8" };
+    const char *run_locale = setlocale( LC_COLLATE, nullptr );
+    string saved_locale = run_locale != nullptr ? run_locale : "C";
+    int num_tried = 0;
+    iout << "  ASCII collation tables checked in each UTF-8 locale:" << endl;
+    for ( const char *loc_name : utf8_locales )
+    {
+        if ( setlocale( LC_COLLATE, loc_name ) == nullptr )
+        {
+            iout << "    " << left << setw( 12 ) << loc_name << right <<
+              " not installed" << endl;
+            continue;
+        }
+        num_tried++;
+        ascii_collator loc_coll;
+        bool loc_usable = loc_coll.setup();
+        vector<string> loc_names;
+        for ( auto& ascii_name : ascii_names )
+          if ( loc_coll.can_compare( ascii_name.data(), ascii_name.size() ) )
+            loc_names.push_back( ascii_name );
+        long loc_bad = loc_usable ? count_bad( loc_coll, loc_names ) : 0;
+        iout << "    " << left << setw( 12 ) << loc_name << right << " " <<
+          loc_coll.get_level_cnt() << " levels, " <<
+          loc_coll.get_fast_ch_cnt() << " bytes in the tables, " <<
+          loc_coll.get_sample_fail_cnt() << " of " <<
+          loc_coll.get_sample_cnt() << " sample pairs failed";
+        if ( loc_usable )
+          iout << ", " << loc_bad << " of the " <<
+            long( loc_names.size() * loc_names.size() ) <<
+            " name pairs differed" << endl;
+        else iout << ( loc_coll.get_sample_fail_cnt() > 0 ? ", " +
+          loc_coll.get_fail_sample() + " was the first" : string() ) <<
+          ", so strcoll() is used" << endl;
+    }
+    setlocale( LC_COLLATE, saved_locale.c_str() );
+    if ( num_tried == 0 )
+      errs << "None of the UTF-8 locales for the ASCII collation check " <<
+      "are installed." << endl;
+}
+
+//
+// Times the UCA collation against strcoll() for every pair of the names of
+//   the file, and checks that its compares are antisymmetric and that its
+//   sort keys order every pair the same way with memcmp().  The pairs that
+//   strcoll() puts in the other order are only counted, since the locale
+//   doesn't have to agree with the DUCET.  When the names were placed
+//   with the UCA collation, the gbtree has to list them in its order.
+void test_uca_collation( ifstream& f2proc, gbst_interface_type& gbst_iface )
+{
+    uca_collator uca_coll;
+    uca_coll.setup();
+    vector<string> names;
+    int num_non_ascii = 0;
+    string nm_frm_file;
+    f2proc.clear();
+    f2proc.seekg( 0 );
+    while ( getline( f2proc, nm_frm_file ) )
+    {
+        names.push_back( nm_frm_file );
+        for ( unsigned char nm_ch : nm_frm_file )
+        {
+            if ( nm_ch < 0x80 ) continue;
+            num_non_ascii++;
+            break;
+        }
+    }
+    auto cmp_sign = []( int cmp_rslt )
+      { return cmp_rslt < 0 ? -1 : ( cmp_rslt > 0 ? 1 : 0 ); };
+    long sign_sum[ 2 ] = { 0, 0 };
+    auto coll_start = chrono::steady_clock::now();
+    for ( auto& name_a : names )
+      for ( auto& name_b : names )
+        sign_sum[ 0 ] += cmp_sign( strcoll( name_a.c_str(), name_b.c_str() ) );
+    auto uca_start = chrono::steady_clock::now();
+    for ( auto& name_a : names )
+      for ( auto& name_b : names )
+        sign_sum[ 1 ] += cmp_sign( uca_coll.compare( name_a, name_b ) );
+    auto uca_end = chrono::steady_clock::now();
+    vector<string> sort_keys;
+    for ( auto& name : names ) sort_keys.push_back( uca_coll.sort_key( name ) );
+    long num_bad = 0, num_diff = 0;
+    for ( size_t idx_a = 0; idx_a < names.size(); idx_a++ )
+    {
+        for ( size_t idx_b = 0; idx_b < names.size(); idx_b++ )
+        {
+            int uca_sign = cmp_sign( uca_coll.compare( names[ idx_a ],
+              names[ idx_b ] ) );
+            if ( uca_sign != cmp_sign( strcoll( names[ idx_a ].c_str(),
+              names[ idx_b ].c_str() ) ) ) num_diff++;
+            if ( uca_sign == cmp_sign( sort_keys[ idx_a ].compare(
+              sort_keys[ idx_b ] ) ) && uca_sign == -cmp_sign(
+              uca_coll.compare( names[ idx_b ], names[ idx_a ] ) ) &&
+              ( uca_sign == 0 ) == ( names[ idx_a ] == names[ idx_b ] ) )
+              continue;
+            if ( num_bad++ < 5 )
+              errs << "The UCA collation gives " << uca_sign << " for [" <<
+              names[ idx_a ] << "] to [" << names[ idx_b ] <<
+              "] which its sort keys or the reverse compare do not." << endl;
+        }
+    }
+    double num_pairs = double( names.size() ) * names.size();
+    double coll_nsec = chrono::duration<double, nano>( uca_start -
+      coll_start ).count() / max( 1.0, num_pairs );
+    double uca_nsec = chrono::duration<double, nano>( uca_end -
+      uca_start ).count() / max( 1.0, num_pairs );
+    iout << endl << "UCA collation with the DUCET " << uca_coll.get_version() <<
+      ", " << ( uca_coll.get_variable_wgt() == uca_collator::shifted ?
+      "shifted" : "non-ignorable" ) << " variable weighting, " <<
+      uca_coll.get_level_cnt() << " levels" << endl << "  " <<
+      names.size() << " names, " << num_non_ascii << " of them not ASCII, " <<
+      long( num_pairs ) << " pairs, " << num_bad <<
+      " pairs had sort keys or reverse compares that did not agree" << endl <<
+      "  strcoll(): " << coll_nsec << " nsec per compare, UCA: " <<
+      uca_nsec << " nsec per compare, " << coll_nsec / max( 1e-9, uca_nsec ) <<
+      " times faster" << endl << "  " << num_diff <<
+      " pairs are in another order than strcoll() puts them in" << endl;
+    //
+    // Each pair is compared both ways around, so the signs add up to 0
+    if ( sign_sum[ 0 ] != 0 || sign_sum[ 1 ] != 0 )
+      errs << "The compares of the timing loops were not antisymmetric." <<
+      endl;
+    if ( !pflg.uca_collation || pflg.byte_order_collation ) return;
+    //
+    // The names of the gbtree, whichever backend the main loop used
+    gbtree_name_index tree_walk;
+    utf8_rcrd_type utf8_hndl;
+    vector<int> name_ids;
+    tree_walk.list_in_order( name_ids );
+    long num_out = 0;
+    for ( size_t idx = 1; idx < name_ids.size(); idx++ )
+      if ( uca_coll.compare( utf8_hndl.get_node_name( name_ids[ idx - 1 ] ),
+        utf8_hndl.get_node_name( name_ids[ idx ] ) ) >= 0 ) num_out++;
+    iout << "  The " << name_ids.size() << " names of the gbtree were " <<
+      "placed with the UCA collation, " << num_out <<
+      " of them out of order" << endl;
+    if ( num_out != 0 )
+      errs << num_out << " names of the gbtree are out of UCA order." << endl;
+    if ( gbst_iface.get_name_index().size() != int( name_ids.size() ) &&
+      !pflg.art_name_index )
+      errs << "The gbtree walk found " << name_ids.size() <<
+      " names for an index of " << gbst_iface.get_name_index().size() << endl;
+}
+
+//
+// Looks up the names of the file in the secondary index of the normalized
+//   names with the NFD and the upper case ASCII forms of each name, which
+//   have to find the ID the name was given, and times that against a scan
+//   of the name index that normalizes each name.  The four forms are also
+//   checked on the names, since the normalized form of a name has to be
+//   its own normalized form, and the NFC and NFD of a name have to give
+//   the same NFC.
+void test_name_norm( ifstream& f2proc, gbst_interface_type& gbst_iface,
+  int num_lines )
+{
+    norm_name_index *norm_idx = gbst_iface.get_norm_index();
+    if ( norm_idx == nullptr ) return;
+    name_normalizer& main_nmzr = norm_idx->get_normalizer();
+    name_index_type& main_idx = gbst_iface.get_name_index();
+    vector<string> names;
+    string nm_frm_file;
+    f2proc.clear();
+    f2proc.seekg( 0 );
+    while ( int( names.size() ) < num_lines && getline( f2proc, nm_frm_file ) )
+    {
+        //
+        // The ISO-8859-1 names were placed as UTF-8
+        styp_flags flg_idd = identify_encoding( nm_frm_file, default_flg_set );
+        names.push_back( flg_idd.UTF_8_orig == 1 ? nm_frm_file :
+          utf8from8859_1( nm_frm_file ) );
+    }
+    if ( names.empty() ) return;
+    long ascii_cnt = main_nmzr.get_ascii_cnt();
+    long latin1_cnt = main_nmzr.get_latin1_cnt();
+    long full_cnt = main_nmzr.get_full_cnt();
+    name_normalizer forms[ 4 ];
+    for ( int form_num = 0; form_num < 4; form_num++ )
+      forms[ form_num ].setup( name_normalizer::norm_form( form_num ) );
+    name_normalizer& nfd_nmzr = forms[ name_normalizer::nfd ];
+    name_normalizer& nfc_nmzr = forms[ name_normalizer::nfc ];
+    vector<string> qnames;
+    vector<int> qids;
+    int num_bad = 0, num_nfd_diff = 0;
+    for ( auto& name : names )
+    {
+        int name_id = main_idx.find_name( name );
+        string nfd_name = nfd_nmzr.normalize( name );
+        string upr_name = name;
+        for ( auto& name_ch : upr_name )
+          if ( name_ch >= 'a' && name_ch <= 'z' ) name_ch += 'A' - 'a';
+        if ( nfd_name != name ) num_nfd_diff++;
+        qnames.push_back( nfd_name );
+        qids.push_back( name_id );
+        qnames.push_back( upr_name );
+        qids.push_back( name_id );
+        for ( int form_num = 0; form_num < 4; form_num++ )
+        {
+            string norm_name = forms[ form_num ].normalize( name );
+            if ( forms[ form_num ].normalize( norm_name ) != norm_name )
+              num_bad++;
+        }
+        if ( nfc_nmzr.normalize( nfd_name ) != nfc_nmzr.normalize( name ) )
+          num_bad++;
+    }
+    if ( num_bad != 0 )
+      errs << num_bad << " names did not normalize the same way twice." <<
+      endl;
+    //
+    // The lookups go through the name normalizer of the index too, so its
+    //   counts are taken before them.
+    int num_missed = 0;
+    long num_equiv = 0;
+    auto lkup_start = chrono::steady_clock::now();
+    for ( size_t qry = 0; qry < qnames.size(); qry++ )
+    {
+        const vector<int>& equiv_ids = norm_idx->find_equiv( qnames[ qry ] );
+        num_equiv += equiv_ids.size();
+        if ( find( equiv_ids.begin(), equiv_ids.end(), qids[ qry ] ) ==
+          equiv_ids.end() ) num_missed++;
+    }
+    auto lkup_end = chrono::steady_clock::now();
+    if ( num_missed != 0 )
+      errs << num_missed << " NFD or upper case names did not find their " <<
+      "name in the normalized name index." << endl;
+    //
+    // Without the secondary index each lookup has to normalize every name
+    //   of the name index, so only a few of those are done.
+    const int num_scans = min( int( qnames.size() ), 50 );
+    long scan_equiv = 0;
+    string qry_key, name_key;
+    auto scan_start = chrono::steady_clock::now();
+    for ( int qry = 0; qry < num_scans; qry++ )
+    {
+        main_nmzr.normalize( qnames[ qry ].data(), qnames[ qry ].size(),
+          qry_key );
+        for ( int name_id = 1; name_id <= main_idx.size(); name_id++ )
+        {
+            string name = main_idx.get_name( name_id );
+            main_nmzr.normalize( name.data(), name.size(), name_key );
+            if ( name_key == qry_key ) scan_equiv++;
+        }
+    }
+    auto scan_end = chrono::steady_clock::now();
+    long indx_equiv = 0;
+    for ( int qry = 0; qry < num_scans; qry++ )
+      indx_equiv += norm_idx->find_equiv( qnames[ qry ] ).size();
+    if ( scan_equiv != indx_equiv )
+      errs << "The scan found " << scan_equiv << " equivalent names where " <<
+      "the normalized name index found " << indx_equiv << endl;
+    int num_shared = 0;
+    for ( int name_id = 1; name_id <= main_idx.size(); name_id++ )
+      if ( norm_idx->find_equiv( main_idx.get_name( name_id ) ).size() > 1 )
+        num_shared++;
+    double num_added = max( 1, norm_idx->size() );
+    iout << endl << dec << setfill( ' ' ) << "Normalized name index, " <<
+      main_nmzr.get_form_name() << " with the Unicode " << main_nmzr.get_version() << " tables" << endl <<
+      "  " << norm_idx->size() << " names, " << norm_idx->key_cnt() <<
+      " normalized names, " << num_shared << " names with an equivalent " <<
+      "name, " << norm_idx->get_mem_bytes() / num_added << " bytes/name" <<
+      endl << "  " << 100.0 * ascii_cnt / num_added << "% of the names " <<
+      "done by the ASCII table, " << 100.0 * latin1_cnt / num_added <<
+      "% by the Latin-1 table, " << 100.0 * full_cnt / num_added <<
+      "% in full, " << chrono::duration<double, nano>(
+      gbst_iface.norm_time ).count() / num_added << " nsec per name added" <<
+      endl << "  " << qnames.size() << " NFD and upper case lookups, " <<
+      num_nfd_diff << " of the NFD names not the same as the name, " <<
+      num_missed << " missed, " << double( num_equiv ) / qnames.size() <<
+      " equivalent names each" << endl << "  Index: " <<
+      chrono::duration<double, nano>( lkup_end - lkup_start ).count() /
+      qnames.size() << " nsec per lookup, scan of the names: " <<
+      chrono::duration<double, nano>( scan_end - scan_start ).count() /
+      num_scans << " nsec per lookup" << endl;
+    for ( int form_num = 0; form_num < 4; form_num++ )
+    {
+        name_normalizer& form_nmzr = forms[ form_num ];
+        for ( int fold = 0; fold < 2; fold++ )
+        {
+            form_nmzr.setup( name_normalizer::norm_form( form_num ),
+              fold == 1 );
+            string norm_name;
+            auto form_start = chrono::steady_clock::now();
+            for ( auto& name : names )
+              form_nmzr.normalize( name.data(), name.size(), norm_name );
+            auto form_end = chrono::steady_clock::now();
+            iout << "  " << left << setw( 24 ) << form_nmzr.get_form_name() <<
+              right << setw( 10 ) << chrono::duration<double, nano>(
+              form_end - form_start ).count() / names.size() <<
+              " nsec per name" << endl;
+        }
+    }
+}
+
+//
+// Compares the name index the names were placed in by the main loop with
+//   a new index of the other backend that the same names are placed in
+//   here.  The place time of the main loop only counts the time in the
+//   index, and the new index is timed the same way.  Both indexes must
+//   give the same ID for each name and list the names in the same order.
+void bench_name_index( ifstream& f2proc, gbst_interface_type& gbst_iface,
+  int num_lines )
+{
+    vector<string> names;
+    string nm_frm_file;
+    f2proc.clear();
+    f2proc.seekg( 0 );
+    while ( int( names.size() ) < num_lines && getline( f2proc, nm_frm_file ) )
+      names.push_back( nm_frm_file );
+    if ( names.empty() ) return;
+    name_index_type& main_idx = gbst_iface.get_name_index();
+    unique_ptr<name_index_type> new_idx( make_name_index(
+      pflg.art_name_index ? gbtree_backend : art_backend ) );
+    chrono::steady_clock::duration new_place_time{ 0 };
+    int num_bad = 0;
+    for ( auto& name : names )
+    {
+        styp_flags flg_idd = identify_encoding( name, default_flg_set );
+        auto place_start = chrono::steady_clock::now();
+        int name_id = new_idx->place_name( name, flg_idd );
+        new_place_time += chrono::steady_clock::now() - place_start;
+        if ( name_id != main_idx.find_name( name ) ) num_bad++;
+    }
+
+    vector<string> shfl_names = names;
+    for ( auto& name : names ) shfl_names.push_back( name + '~' );
+    mt19937 shfl_gen( 20225 );
+    shuffle( shfl_names.begin(), shfl_names.end(), shfl_gen );
+    const int num_rounds = max( 1, int( 200000 / shfl_names.size() ) );
+    iout << endl << "Name index backends, " << names.size() << " names, " <<
+      main_idx.size() << " unique, " << num_rounds << " rounds" << endl <<
+      "  " << left << setw( 22 ) << "backend" << right << setw( 13 ) <<
+      "insert nsec" << setw( 13 ) << "lookup nsec" << setw( 15 ) <<
+      "scan nsec/name" << setw( 12 ) << "bytes/name" << setw( 13 ) <<
+      "allocs/find" << endl;
+    vector<vector<int> > scan_ids( 2 );
+    vector<name_index_type *> idxs = { &main_idx, new_idx.get() };
+    for ( int idx_num = 0; idx_num < 2; idx_num++ )
+    {
+        name_index_type& name_idx = *idxs[ idx_num ];
+        double place_nsec = idx_num == 0 ?
+          chrono::duration<double, nano>( gbst_iface.idx_place_time ).count() /
+          max( 1L, gbst_iface.idx_place_cnt ) :
+          chrono::duration<double, nano>( new_place_time ).count() /
+          names.size();
+        long fnd_sum = 0;
+        long allocs_before = num_heap_allocs;
+        auto lkup_start = chrono::steady_clock::now();
+        for ( int rnd = 0; rnd < num_rounds; rnd++ )
+          for ( auto& name : shfl_names ) fnd_sum += name_idx.find_name( name );
+        auto lkup_end = chrono::steady_clock::now();
+        double find_allocs = double( num_heap_allocs - allocs_before ) /
+          ( double( num_rounds ) * shfl_names.size() );
+        if ( fnd_sum == 0 ) iout << "  No names were found." << endl;
+        auto scan_start = chrono::steady_clock::now();
+        for ( int rnd = 0; rnd < num_rounds; rnd++ )
+          name_idx.list_in_order( scan_ids[ idx_num ] );
+        auto scan_end = chrono::steady_clock::now();
+        double num_unique = max( 1, name_idx.size() );
+        iout << "  " << left << setw( 22 ) << name_idx.get_backend_name() <<
+          right << setw( 13 ) << place_nsec << setw( 13 ) <<
+          chrono::duration<double, nano>( lkup_end - lkup_start ).count() /
+          ( double( num_rounds ) * shfl_names.size() ) << setw( 15 ) <<
+          chrono::duration<double, nano>( scan_end - scan_start ).count() /
+          ( num_rounds * num_unique ) << setw( 12 ) <<
+          name_idx.get_mem_bytes() / num_unique << setw( 13 ) << find_allocs <<
+          endl;
+    }
+    //
+    // The radix tree keys are the sort keys of the collation in use, so
+    //   the order is the same with every collation.
+    if ( scan_ids[ 0 ] != scan_ids[ 1 ] ) num_bad++;
+    if ( num_bad != 0 )
+      errs << "The two name index backends differed " << num_bad <<
+      " times in their IDs or order." << endl;
+}
+
+//
+// Streams many more names and digests than the record vectors can hold
+//   through the external memory ingest with a small budget so that there
+//   are many runs and more than one merge pass.  Each name of the input
+//   file is taken as is and with 20 numbered suffixes, and each name is
+//   given twice so there are duplicates in and across the runs.  The
+//   digests are of the numbers up to ext_dgst_cnt, with a third of them
+//   given twice.  Each archive is loaded and checked against the same
+//   items sorted in memory.
+void test_ext_ingest( ifstream& f2proc, gbtree& utf8_hndl )
+{
+    const int name_sfx_cnt = 20;
+    const int ext_dgst_cnt = 60000;
+    md5_rcrd_type md5_hndl;
+    struct ingest_case {
+        string name;
+        gbtree& tree;
+        size_t budget;
+        uint32_t item_len;
+        vector<string> items;
+    };
+    vector<ingest_case> icases = {
+      { "UTF-8", utf8_hndl, 64 * 1024, 0, {} },
+      { "MD5", md5_hndl, 256 * 1024, MD5_DIGEST_LENGTH, {} } };
+    f2proc.clear();
+    f2proc.seekg( 0 );
+    string nm_frm_file;
+    while ( getline( f2proc, nm_frm_file ) )
+    {
+        for ( int rpt = 0; rpt < 2; rpt++ )
+        {
+            icases[ 0 ].items.push_back( nm_frm_file );
+            for ( int sfx = 0; sfx < name_sfx_cnt; sfx++ )
+              icases[ 0 ].items.push_back( nm_frm_file + "/" +
+              to_string( sfx ) );
+        }
+    }
+    for ( int idx = 0; idx < ext_dgst_cnt + ext_dgst_cnt / 3; idx++ )
+    {
+        string dgst_src = to_string( idx % ext_dgst_cnt );
+        md5dgstArrayType dgst_ary;
+        EVP_Digest( dgst_src.data(), dgst_src.size(), dgst_ary.data(),
+          nullptr, EVP_md5(), nullptr );
+        icases[ 1 ].items.push_back( string( dgst_ary.begin(),
+          dgst_ary.end() ) );
+    }
+    for ( auto& icase : icases )
+    {
+        gbtree_ext_ingest ingest( icase.tree, icase.budget, "temp",
+          icase.item_len );
+        string arch_file = "temp/gbst-ingest-" + icase.name + ".bin";
+        auto ingst_start = chrono::steady_clock::now();
+        bool ingst_ok = true;
+        for ( auto& item : icase.items )
+          ingst_ok = ingest.add( item ) && ingst_ok;
+        ingst_ok = ingest.finish( arch_file ) && ingst_ok;
+        auto ingst_end = chrono::steady_clock::now();
+        gbtree_succinct arch;
+        if ( !ingst_ok || !arch.load( arch_file, icase.tree ) ) continue;
+
+        vector<string> sorted_items = icase.items;
+        sort( sorted_items.begin(), sorted_items.end(),
+          [ &icase ]( const string& item_a, const string& item_b )
+          { return icase.tree.cmp_keys( item_a, item_b ) < 0; } );
+        sorted_items.erase( unique( sorted_items.begin(), sorted_items.end(),
+          [ &icase ]( const string& item_a, const string& item_b )
+          { return icase.tree.cmp_keys( item_a, item_b ) == 0; } ),
+          sorted_items.end() );
+        int num_bad = arch.size() == int( sorted_items.size() ) ? 0 : 1;
+        gbtree_succinct::scan_pos pos;
+        for ( bool more = arch.scan_start( pos ); more;
+          more = arch.scan_next( pos ) )
+          if ( size_t( pos.rank ) >= sorted_items.size() ||
+            pos.key != sorted_items[ pos.rank ] ) num_bad++;
+        for ( size_t idx = 0; idx < sorted_items.size(); idx += 7 )
+          if ( arch.find( sorted_items[ idx ] ) != int( idx ) ) num_bad++;
+        vector<int> pre_ranks;
+        vector<int> parent_ranks;
+        arch.get_shape( pre_ranks, parent_ranks );
+        if ( !pre_ranks.empty() && pre_ranks[ 0 ] != arch.size() / 2 ) num_bad++;
+        iout << endl << "External ingest of " << icase.items.size() << " " <<
+          icase.name << " items with a " << icase.budget / 1024 <<
+          " KB budget" << endl << "  " << ingest.get_run_cnt() <<
+          " runs, " << ingest.get_merge_passes() << " extra merges, " <<
+          arch.size() << " unique items archived in " <<
+          chrono::duration<double, milli>( ingst_end - ingst_start ).count() <<
+          " msec, " << 8.0 * arch.get_mem_bytes() / max( 1, arch.size() ) <<
+          " bits per item, collation " << arch.get_collation_id() << endl;
+        if ( num_bad != 0 )
+          errs << "The " << icase.name << " ingest archive had " << num_bad <<
+          " errors against the sorted items." << endl;
+    }
+}
+
+#ifdef USEmerkle_dgst
+//
+// Checks the subtree digests that were kept by the inserts against ones
+//   computed from scratch.  Then the MD5 btree is saved to a file, some
+//   more digests are added to it and saved to a second file, and the live
+//   btree and the two files are diffed against each other.
+void test_merkle_diff( gbtree& utf8_hndl )
+{
+    md5_rcrd_type md5_hndl;
+    auto bfs_dgsts = []( gbtree& tree_hndl )
+    {
+        vector<merkle_dgst_type> tree_dgsts;
+        vector<int> walk_que;
+        int head_id = tree_hndl.get_node( 0 ).get_child_right_idx();
+        if ( head_id != 0 ) walk_que.push_back( head_id );
+        for ( size_t idx = 0; idx < walk_que.size(); idx++ )
+        {
+            gbtree& nd_rcrd = tree_hndl.get_node( walk_que[ idx ] );
+            merkle_dgst_type nd_dgst{};
+            tree_hndl.get_merkle_dgst( walk_que[ idx ], nd_dgst );
+            tree_dgsts.push_back( nd_dgst );
+            if ( nd_rcrd.get_child_left_idx() != 0 )
+              walk_que.push_back( nd_rcrd.get_child_left_idx() );
+            if ( nd_rcrd.get_child_right_idx() != 0 )
+              walk_que.push_back( nd_rcrd.get_child_right_idx() );
+        }
+        return tree_dgsts;
+    };
+    iout << endl << "Merkle subtree digests:" << endl;
+    vector<pair<gbtree *, string> > trees = {
+      { &utf8_hndl, "UTF-8" }, { &md5_hndl, "MD5" } };
+    for ( auto& tree : trees )
+    {
+        vector<merkle_dgst_type> kept_dgsts = bfs_dgsts( *tree.first );
+        tree.first->start_merkle_dgsts();
+        bool same_dgsts = bfs_dgsts( *tree.first ) == kept_dgsts;
+        iout << "  The digests kept for the " << kept_dgsts.size() << " node " <<
+          tree.second << " btree " << ( same_dgsts ? "match" : "DO NOT MATCH" ) <<
+          " a full recompute" << endl;
+        if ( !same_dgsts )
+          errs << "The Merkle digests kept by the inserts of the " <<
+          tree.second << " btree do not match a full recompute." << endl;
+    }
+
+    const string file_a = "temp/gbst-merkle-a.bin";
+    const string file_b = "temp/gbst-merkle-b.bin";
+    if ( !gbtree_merkle_file::save( md5_hndl, file_a ) ) return;
+    vector<string> extra_keys;
+    for ( int idx = 0; idx < 20; idx++ )
+    {
+        string extra_name = "merkle diff extra name " + to_string( idx );
+        md5dgstArrayType extra_dgst;
+        EVP_Digest( extra_name.data(), extra_name.size(), extra_dgst.data(),
+          nullptr, EVP_md5(), nullptr );
+        md5_rcrd_type extra_rcrd( extra_dgst );
+        if ( extra_rcrd.place_new_node() <= 0 ) continue;
+        extra_keys.push_back( string( reinterpret_cast<const char *>(
+          extra_dgst.data() ), extra_dgst.size() ) );
+    }
+    sort( extra_keys.begin(), extra_keys.end() );
+    if ( !gbtree_merkle_file::save( md5_hndl, file_b ) ) return;
+    int num_nodes, max_depth;
+    double avg_depth;
+    md5_hndl.get_depth_stats( num_nodes, max_depth, avg_depth );
+
+    gbtree_merkle_live md5_live( md5_hndl );
+    gbtree_merkle_file mrkl_a, mrkl_b;
+    if ( !mrkl_a.open( file_a ) || !mrkl_b.open( file_b ) ) return;
+    gbtree_merkle_diff mrkl_diff;
+    struct diff_case {
+        gbtree_merkle_src *src_a;
+        gbtree_merkle_src *src_b;
+        string name;
+        size_t num_only_a;
+        size_t num_only_b;
+    };
+    vector<diff_case> cases = {
+      { &mrkl_a, &md5_live, "saved file to the live btree", 0,
+        extra_keys.size() },
+      { &mrkl_b, &mrkl_a, "second file to the first file",
+        extra_keys.size(), 0 },
+      { &md5_live, &mrkl_b, "live btree to the second file", 0, 0 } };
+    iout << "  Diffs of the " << num_nodes << " node MD5 btree after " <<
+      extra_keys.size() << " digests were added:" << endl;
+    for ( auto& dcase : cases )
+    {
+        bool diff_ok = mrkl_diff.run( *dcase.src_a, *dcase.src_b );
+        const vector<string>& only_a = mrkl_diff.get_only_in_a();
+        const vector<string>& only_b = mrkl_diff.get_only_in_b();
+        bool as_expected = diff_ok && only_a.size() == dcase.num_only_a &&
+          only_b.size() == dcase.num_only_b &&
+          ( only_a.empty() || only_a == extra_keys ) &&
+          ( only_b.empty() || only_b == extra_keys );
+        iout << "    " << dcase.name << ": " << only_a.size() << " only in " <<
+          "the first and " << only_b.size() << " only in the second, " <<
+          mrkl_diff.get_read_cnt() << " nodes read" <<
+          ( as_expected ? "" : ", NOT AS EXPECTED" ) << endl;
+        if ( !as_expected )
+          errs << "The Merkle diff of the " << dcase.name <<
+          " did not find the added digests." << endl;
+    }
+}
+#endif  //  #ifdef USEmerkle_dgst
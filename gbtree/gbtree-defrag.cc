@@ -0,0 +1,220 @@
+//
+// This file contains the code to implement the gbtree_defrag class
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// Use the following commands to build this object, save it to the library,
+//    and display the library contents:
+//
+//   g++ -std=c++17 -c gbtree-defrag.cc
+//   ar -Prs ~/data/lib/libfoutil.a gbtree-defrag.o
+//   ar -Ptv ~/data/lib/libfoutil.a
+
+#include "gbtree-defrag.h"
+#include <cstdlib>
+#include <iostream>
+
+gbtree_defrag::gbtree_defrag( gbtree& tree_hndl )
+  : tree( tree_hndl ), num_renumbers( 0 )
+{
+}
+
+int gbtree_defrag::subtree_height( int sub_root )
+{
+    //
+    // The levels are counted one at a time with the nodes of each level
+    //   kept in a vector instead of on the call stack, since a skewed
+    //   btree can be a chain as long as the record array.
+    int sub_ht = 0;
+    vector<int> lvl_ids;
+    vector<int> nxt_ids;
+    if ( sub_root != 0 ) lvl_ids.push_back( sub_root );
+    while ( !lvl_ids.empty() )
+    {
+        sub_ht++;
+        nxt_ids.clear();
+        for ( int nd_id : lvl_ids )
+        {
+            gbtree& nd_rcrd = tree.get_node( nd_id );
+            if ( nd_rcrd.btree_child_left != 0 )
+              nxt_ids.push_back( nd_rcrd.btree_child_left );
+            if ( nd_rcrd.btree_child_right != 0 )
+              nxt_ids.push_back( nd_rcrd.btree_child_right );
+        }
+        lvl_ids.swap( nxt_ids );
+    }
+    return sub_ht;
+}
+
+void gbtree_defrag::collect_at_depth( int sub_root, int depth,
+  vector<int>& sub_roots )
+{
+    //
+    // Goes down a level at a time, so the nodes at each level stay in
+    //   their order from left to right.
+    sub_roots.clear();
+    if ( sub_root == 0 ) return;
+    sub_roots.push_back( sub_root );
+    vector<int> nxt_ids;
+    for ( int lvl = 0; lvl < depth && !sub_roots.empty(); lvl++ )
+    {
+        nxt_ids.clear();
+        for ( int nd_id : sub_roots )
+        {
+            gbtree& nd_rcrd = tree.get_node( nd_id );
+            if ( nd_rcrd.btree_child_left != 0 )
+              nxt_ids.push_back( nd_rcrd.btree_child_left );
+            if ( nd_rcrd.btree_child_right != 0 )
+              nxt_ids.push_back( nd_rcrd.btree_child_right );
+        }
+        sub_roots.swap( nxt_ids );
+    }
+}
+
+void gbtree_defrag::collect_veb( int sub_root, int height,
+  vector<int>& new_order )
+{
+    //
+    // Lays out the top height levels of the subtree.  The top half is done
+    //   first, and then each subtree hanging below it from left to right.
+    //   The btree is not perfectly balanced, so the height used is the
+    //   height of the whole subtree, and the parts that end early just
+    //   come out smaller.
+    // The parts still to be laid out are kept on veb_stk as pairs of the
+    //   part root and its height, with the next one to do on the top, so
+    //   the bottom subtrees of a split are pushed from right to left
+    //   after the top half.
+    vector<int> veb_stk;
+    vector<int> sub_roots;
+    veb_stk.push_back( sub_root );
+    veb_stk.push_back( height );
+    while ( !veb_stk.empty() )
+    {
+        int part_ht = veb_stk.back();
+        veb_stk.pop_back();
+        int part_root = veb_stk.back();
+        veb_stk.pop_back();
+        if ( part_root == 0 || part_ht == 0 ) continue;
+        if ( part_ht == 1 )
+        {
+            new_order.push_back( part_root );
+            continue;
+        }
+        int top_ht = part_ht / 2;
+        collect_at_depth( part_root, top_ht, sub_roots );
+        for ( auto bot_it = sub_roots.rbegin(); bot_it != sub_roots.rend();
+          ++bot_it )
+        {
+            veb_stk.push_back( *bot_it );
+            veb_stk.push_back( part_ht - top_ht );
+        }
+        veb_stk.push_back( part_root );
+        veb_stk.push_back( top_ht );
+    }
+}
+
+bool gbtree_defrag::renumber( defrag_order order )
+{
+    //
+    // new_order lists the old IDs in their new order
+    vector<int> new_order = { 0 };
+    int head_id = tree.get_node( 0 ).btree_child_right;
+    if ( head_id != 0 )
+    {
+        if ( order == bfs_order )
+        {
+            new_order.push_back( head_id );
+            for ( size_t idx = 1; idx < new_order.size(); idx++ )
+            {
+                gbtree& nd_rcrd = tree.get_node( new_order[ idx ] );
+                if ( nd_rcrd.btree_child_left != 0 )
+                  new_order.push_back( nd_rcrd.btree_child_left );
+                if ( nd_rcrd.btree_child_right != 0 )
+                  new_order.push_back( nd_rcrd.btree_child_right );
+            }
+        }
+        else collect_veb( head_id, subtree_height( head_id ), new_order );
+    }
+    vector<int> new_id_of;
+    if ( !tree.move_records( new_order, new_id_of ) )
+    {
+        errs << "gbtree_defrag::renumber() was called for a record type " <<
+          "that does not support moving its records." << endl;
+        return false;
+    }
+    //
+    // The records are in their new places but still hold the old IDs in
+    //   their links.
+    int num_rcrds = int( new_id_of.size() );
+    for ( int cur_id = 0; cur_id < num_rcrds; cur_id++ )
+    {
+        gbtree& nd_rcrd = tree.get_node( cur_id );
+        if ( nd_rcrd.btree_parent < unsigned( num_rcrds ) )
+          nd_rcrd.btree_parent = new_id_of[ nd_rcrd.btree_parent ];
+        if ( nd_rcrd.btree_child_left < unsigned( num_rcrds ) )
+          nd_rcrd.btree_child_left = new_id_of[ nd_rcrd.btree_child_left ];
+        if ( nd_rcrd.btree_child_right < unsigned( num_rcrds ) )
+          nd_rcrd.btree_child_right = new_id_of[ nd_rcrd.btree_child_right ];
+    }
+    //
+    // The records added since the last renumber are their own external IDs
+    for ( int ext_id = int( cur_of_ext.size() ); ext_id < num_rcrds; ext_id++ )
+      cur_of_ext.push_back( ext_id );
+    ext_of_cur.assign( num_rcrds, 0 );
+    for ( size_t ext_id = 0; ext_id < cur_of_ext.size(); ext_id++ )
+    {
+        cur_of_ext[ ext_id ] = new_id_of[ cur_of_ext[ ext_id ] ];
+        ext_of_cur[ cur_of_ext[ ext_id ] ] = ext_id;
+    }
+    num_renumbers++;
+    return true;
+}
+
+int gbtree_defrag::get_cur_id( int ext_id )
+{
+    if ( ext_id < 0 || ext_id >= int( cur_of_ext.size() ) ) return ext_id;
+    return cur_of_ext[ ext_id ];
+}
+
+int gbtree_defrag::get_ext_id( int cur_id )
+{
+    if ( cur_id < 0 || cur_id >= int( ext_of_cur.size() ) ) return cur_id;
+    return ext_of_cur[ cur_id ];
+}
+
+double gbtree_defrag::get_avg_link_dist()
+{
+    double dist_sum = 0.0;
+    int num_links = 0;
+    vector<int> walk_que;
+    int head_id = tree.get_node( 0 ).btree_child_right;
+    if ( head_id != 0 ) walk_que.push_back( head_id );
+    for ( size_t idx = 0; idx < walk_que.size(); idx++ )
+    {
+        int nd_id = walk_que[ idx ];
+        gbtree& nd_rcrd = tree.get_node( nd_id );
+        for ( int chld_id : { int( nd_rcrd.btree_child_left ),
+          int( nd_rcrd.btree_child_right ) } )
+        {
+            if ( chld_id == 0 ) continue;
+            dist_sum += abs( chld_id - nd_id );
+            num_links++;
+            walk_que.push_back( chld_id );
+        }
+    }
+    return num_links == 0 ? 0.0 : dist_sum / num_links;
+}
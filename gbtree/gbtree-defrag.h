@@ -0,0 +1,100 @@
+//
+// The gbtree_defrag class renumbers the records of a gbtree derived btree
+//   so that the nodes near each other in the tree are also near each
+//   other in the record array.  add_new_node() hands out the IDs in the
+//   order the data items arrive, and a replace sends the old item of a
+//   node down the tree while it keeps its ID, so after a while a parent
+//   and its children are almost never in the same cache line or even
+//   the same page, and every step down the tree is a miss.
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// Two orders are supported.  The breadth first order puts the top levels
+//   of the tree together at the front of the array where they stay in
+//   the cache, and the two children of a node are always next to each
+//   other.  The van Emde Boas order splits the tree at half of its height
+//   and lays out the top part and then each of the bottom subtrees, each
+//   of them split the same way in turn, so any subtree of height h is
+//   in about 2^h records that are together no matter what the cache
+//   line or page size is.
+//
+// The derived class does the moving of its records through the
+//   gbtree::move_records() virtual method, and this class then rewrites
+//   the parent and child links, including the head link of record 0,
+//   for the new IDs.  The record 0 base parent always keeps ID 0, and
+//   any records that are not reachable from the head stay after the ones
+//   in the tree in their old order.
+//
+// Everything that holds a node ID from before a renumber has to be told
+//   about the change.  The remap table is kept from the IDs that were in
+//   use before the first renumber, the external IDs, to the current ones
+//   and it is updated by each renumber, so a caller can keep its IDs and
+//   translate them with get_cur_id() when it needs the record.  IDs added
+//   after a renumber are their own external IDs until the next one.  The
+//   frozen snapshots of gbtree-frozen.h hold node IDs as well, so they
+//   must be made again after a renumber.  The btree must not be used by
+//   any other thread while renumber() runs.
+//
+
+#ifndef GBTREE_DEFRAG_H
+#define GBTREE_DEFRAG_H
+
+#include "gbtree.h"
+#include <vector>
+
+using namespace std;
+
+class gbtree_defrag
+{
+public:
+    enum defrag_order { bfs_order, veb_order };
+
+private:
+    //
+    // Any record of the derived class can be used as the tree handle, the
+    //   same as for gbtree_rebalancer.
+    gbtree& tree;
+    // Indexed by external ID, and the reverse of it
+    vector<int> cur_of_ext;
+    vector<int> ext_of_cur;
+    int num_renumbers;
+
+    int subtree_height( int sub_root );
+    void collect_at_depth( int sub_root, int depth, vector<int>& sub_roots );
+    void collect_veb( int sub_root, int height, vector<int>& new_order );
+
+public:
+    gbtree_defrag( gbtree& tree_hndl );
+    //
+    // Moves the records into the order and rewrites the links.  Returns
+    //   false, and leaves the tree as it was, if the record type does not
+    //   support being moved.
+    bool renumber( defrag_order order );
+    //
+    // Translate between the external IDs and the current ones.  An ID
+    //   that has not been through a renumber is returned as is.
+    int get_cur_id( int ext_id );
+    int get_ext_id( int cur_id );
+    const vector<int>& get_remap_table() { return cur_of_ext; };
+    int get_renumber_cnt() { return num_renumbers; };
+    //
+    // The average distance in records between a node and its children,
+    //   which tells how well the layout keeps the search paths together.
+    double get_avg_link_dist();
+};
+
+#endif  //  GBTREE_DEFRAG_H
@@ -0,0 +1,219 @@
+//
+// This file contains the code to implement the gbtree_frozen class
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// Use the following commands to build this object, save it to the library,
+//    and display the library contents:
+//
+//   g++ -std=c++17 -c gbtree-frozen.cc
+//   ar -Prs ~/data/lib/libfoutil.a gbtree-frozen.o
+//   ar -Ptv ~/data/lib/libfoutil.a
+
+#include "gbtree-frozen.h"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+gbtree_frozen::gbtree_frozen()
+  : tree( nullptr ), slots( nullptr ), num_slots( 0 )
+{
+}
+
+gbtree_frozen::~gbtree_frozen()
+{
+    clear();
+}
+
+void gbtree_frozen::clear()
+{
+    free( slots );
+    slots = nullptr;
+    num_slots = 0;
+    rank_node.clear();
+    rank_key_off.clear();
+    key_blob.clear();
+}
+
+uint64_t gbtree_frozen::get_key_pfx( const string& sort_key )
+{
+    //
+    // Short keys are padded with zero bytes.  That can make a short key
+    //   have the same prefix as a longer one, but never a greater one, so
+    //   the prefix order still agrees with the sort key order.
+    uint64_t key_pfx = 0;
+    size_t pfx_len = sort_key.size() < 8 ? sort_key.size() : 8;
+    for ( size_t idx = 0; idx < 8; idx++ )
+    {
+        key_pfx <<= 8;
+        if ( idx < pfx_len ) key_pfx |= uint8_t( sort_key[ idx ] );
+    }
+    return key_pfx;
+}
+
+int gbtree_frozen::fill_slots( int slot_idx, int nxt_rank,
+  const vector<uint64_t>& pfx )
+{
+    //
+    // An in order walk of the implicit tree hands out the ranks in order.
+    //   The recursion is only as deep as the balanced tree is high.
+    if ( slot_idx > num_slots ) return nxt_rank;
+    nxt_rank = fill_slots( 2 * slot_idx, nxt_rank, pfx );
+    slots[ slot_idx ].key_pfx = pfx[ nxt_rank ];
+    slots[ slot_idx ].rank = nxt_rank;
+    slots[ slot_idx ].key_len =
+      rank_key_off[ nxt_rank + 1 ] - rank_key_off[ nxt_rank ];
+    return fill_slots( 2 * slot_idx + 1, nxt_rank + 1, pfx );
+}
+
+bool gbtree_frozen::freeze( gbtree& tree_hndl )
+{
+    clear();
+    tree = &tree_hndl;
+    //
+    // Collect the items in sorted order with an in order walk of the live
+    //   btree, and check that the sort keys agree with that order.
+    vector<uint64_t> pfx;
+    vector<int> walk_stk;
+    string prev_key;
+    rank_key_off.push_back( 0 );
+    int nd_id = tree_hndl.get_node( 0 ).get_child_right_idx();
+    while ( nd_id != 0 || !walk_stk.empty() )
+    {
+        while ( nd_id != 0 )
+        {
+            walk_stk.push_back( nd_id );
+            nd_id = tree_hndl.get_node( nd_id ).get_child_left_idx();
+        }
+        nd_id = walk_stk.back();
+        walk_stk.pop_back();
+        string sort_key = tree_hndl.get_sort_key( nd_id );
+        if ( !rank_node.empty() && prev_key.compare( sort_key ) >= 0 )
+        {
+            errs << "gbtree_frozen::freeze() found the sort key of node " <<
+              nd_id << " out of order, so the snapshot was not made." << endl;
+            clear();
+            return false;
+        }
+        rank_node.push_back( nd_id );
+        pfx.push_back( get_key_pfx( sort_key ) );
+        key_blob += sort_key;
+        rank_key_off.push_back( key_blob.size() );
+        prev_key.swap( sort_key );
+        nd_id = tree_hndl.get_node( nd_id ).get_child_right_idx();
+    }
+    num_slots = int( rank_node.size() );
+    size_t alloc_bytes = ( ( num_slots + 1 ) * sizeof( eytz_slot ) + 63 ) & ~63;
+    slots = static_cast<eytz_slot *>( aligned_alloc( 64, alloc_bytes ) );
+    if ( slots == nullptr )
+    {
+        errs << "gbtree_frozen::freeze() could not allocate " <<
+          alloc_bytes << " bytes for the snapshot." << endl;
+        clear();
+        return false;
+    }
+    slots[ 0 ] = { 0, 0, 0 };
+    fill_slots( 1, 0, pfx );
+    return true;
+}
+
+size_t gbtree_frozen::get_mem_bytes() const
+{
+    return ( num_slots + 1 ) * sizeof( eytz_slot ) +
+      rank_node.capacity() * sizeof( int ) +
+      rank_key_off.capacity() * sizeof( uint32_t ) + key_blob.capacity();
+}
+
+int gbtree_frozen::descend( uint64_t srch_pfx ) const
+{
+    //
+    // Returns the slot of the first item whose prefix is not less than
+    //   srch_pfx, or 0 when there isn't one.  Going left or right is just
+    //   the low bit of the next slot index, and when the walk falls off
+    //   the bottom the trailing 1 bits of the index are the right turns
+    //   taken since the last left turn, which was at the wanted slot.
+    unsigned int slot_idx = 1;
+    while ( slot_idx <= unsigned( num_slots ) )
+    {
+        __builtin_prefetch( slots + 4 * slot_idx );
+        slot_idx = 2 * slot_idx + ( slots[ slot_idx ].key_pfx < srch_pfx );
+    }
+    slot_idx >>= __builtin_ffs( ~slot_idx );
+    return slot_idx;
+}
+
+int gbtree_frozen::cmp_rank_key( int rank_idx, const string& sort_key ) const
+{
+    size_t key_off = rank_key_off[ rank_idx ];
+    size_t key_len = rank_key_off[ rank_idx + 1 ] - key_off;
+    return key_blob.compare( key_off, key_len, sort_key );
+}
+
+int gbtree_frozen::lower_rank( const string& sort_key ) const
+{
+    int slot_idx = descend( get_key_pfx( sort_key ) );
+    int rank_idx = slot_idx == 0 ? size() : int( slots[ slot_idx ].rank );
+    //
+    // Every item before rank_idx has a smaller prefix, so only the items
+    //   with the same prefix need the full compare.
+    while ( rank_idx < size() && cmp_rank_key( rank_idx, sort_key ) < 0 )
+      rank_idx++;
+    return rank_idx;
+}
+
+int gbtree_frozen::find_sort_key( const string& sort_key ) const
+{
+    uint64_t srch_pfx = get_key_pfx( sort_key );
+    int slot_idx = descend( srch_pfx );
+    if ( slot_idx == 0 || slots[ slot_idx ].key_pfx != srch_pfx ) return 0;
+    //
+    // Keys of up to 8 bytes are all in the prefix, so the length is the
+    //   only thing left to check.
+    if ( sort_key.size() <= 8 )
+    {
+        const eytz_slot& fnd_slot = slots[ slot_idx ];
+        return fnd_slot.key_len == sort_key.size() ?
+          rank_node[ fnd_slot.rank ] : 0;
+    }
+    for ( int rank_idx = slots[ slot_idx ].rank; rank_idx < size();
+      rank_idx++ )
+    {
+        int key_vs_item = cmp_rank_key( rank_idx, sort_key );
+        if ( key_vs_item == 0 ) return rank_node[ rank_idx ];
+        if ( key_vs_item > 0 ) break;
+    }
+    return 0;
+}
+
+int gbtree_frozen::find( const string& key ) const
+{
+    if ( tree == nullptr ) return 0;
+    return find_sort_key( tree->make_sort_key( key ) );
+}
+
+int gbtree_frozen::node_at_rank( int rank_idx ) const
+{
+    if ( rank_idx < 0 || rank_idx >= size() ) return 0;
+    return rank_node[ rank_idx ];
+}
+
+string gbtree_frozen::key_at_rank( int rank_idx ) const
+{
+    if ( rank_idx < 0 || rank_idx >= size() ) return "";
+    return key_blob.substr( rank_key_off[ rank_idx ],
+      rank_key_off[ rank_idx + 1 ] - rank_key_off[ rank_idx ] );
+}
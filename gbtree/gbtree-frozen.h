@@ -0,0 +1,108 @@
+//
+// The gbtree_frozen class holds a read only snapshot of a gbtree derived
+//   btree that is laid out for fast lookups.  Once the names of a file
+//   system have been added, most of the work is looking them up, and the
+//   live btree is not good at that.  Each step down the live btree goes
+//   to a record that can be anywhere in the record vector, and then the
+//   name for the compare has to be put together from the name store, so
+//   nearly every step is one or more cache misses.
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// The snapshot keeps the items in the Eytzinger (breadth first) order of
+//   a perfectly balanced tree, so the children of slot k are the slots 2k
+//   and 2k+1 and no links are needed.  Each slot is 16 bytes, so a 64 byte
+//   cache line holds four slots, and the four slots two levels further
+//   down the search path, 4k to 4k+3, are all in one line that can be
+//   prefetched while the current level is being compared.  The slot array
+//   is allocated on a cache line boundary so that this holds.  A slot
+//   holds the first 8 bytes of the sort key of the item as a big endian
+//   integer, so the search down the tree is one integer compare per level
+//   with no branch on the result.  Only the items that share the same 8
+//   byte prefix as the search key are then checked against the full sort
+//   keys, which are kept packed together in one string in sorted order.
+//
+// The sort keys come from the gbtree::get_sort_key() and make_sort_key()
+//   methods of the derived class, so for the UTF-8 names they are only
+//   good for the locale that was in effect when the snapshot was made.
+//   The snapshot does not follow later changes to the btree, freeze() has
+//   to be called again to pick them up.
+//   Once it is made, a snapshot is never changed by the lookup methods,
+//   so any number of threads can use it at the same time.
+//
+
+#ifndef GBTREE_FROZEN_H
+#define GBTREE_FROZEN_H
+
+#include "gbtree.h"
+#include <vector>
+
+using namespace std;
+
+class gbtree_frozen
+{
+    struct eytz_slot {
+        uint64_t key_pfx;
+        // The rank of the item, which indexes the sorted order vectors
+        uint32_t rank;
+        uint32_t key_len;
+    };
+
+    //
+    // The tree handle is kept to make the sort keys of the search keys
+    gbtree *tree;
+    // slots[ 0 ] is not used so the children arithmetic works out
+    eytz_slot *slots;
+    int num_slots;
+    // These are in sorted order
+    vector<int> rank_node;
+    vector<uint32_t> rank_key_off;
+    string key_blob;
+
+    static uint64_t get_key_pfx( const string& sort_key );
+    int fill_slots( int slot_idx, int nxt_rank, const vector<uint64_t>& pfx );
+    int descend( uint64_t srch_pfx ) const;
+    int cmp_rank_key( int rank_idx, const string& sort_key ) const;
+
+public:
+    gbtree_frozen();
+    ~gbtree_frozen();
+    // The slot array is owned by the snapshot
+    gbtree_frozen( const gbtree_frozen& ) = delete;
+    gbtree_frozen& operator=( const gbtree_frozen& ) = delete;
+    //
+    // Builds the snapshot from the current contents of the btree that
+    //   tree_hndl is a record of.  Returns false, and leaves the snapshot
+    //   empty, if the sort keys don't come out in the btree order.
+    bool freeze( gbtree& tree_hndl );
+    void clear();
+    int size() const { return int( rank_node.size() ); };
+    size_t get_mem_bytes() const;
+    //
+    // find() takes the same kind of search key as gbtree::find_node() and
+    //   find_sort_key() takes a key made by make_sort_key().  Both return
+    //   the node ID of the matching item or 0 when there isn't one.
+    int find( const string& key ) const;
+    int find_sort_key( const string& sort_key ) const;
+    //
+    // Returns the number of items whose sort key is less than sort_key
+    int lower_rank( const string& sort_key ) const;
+    int node_at_rank( int rank_idx ) const;
+    string key_at_rank( int rank_idx ) const;
+};
+
+#endif  //  GBTREE_FROZEN_H
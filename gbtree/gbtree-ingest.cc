@@ -0,0 +1,216 @@
+//
+// This file contains the code to implement the gbtree_ext_ingest class
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// Use the following commands to build this object, save it to the library,
+//    and display the library contents:
+//
+//   g++ -std=c++17 -c gbtree-ingest.cc
+//   ar -Prs ~/data/lib/libfoutil.a gbtree-ingest.o
+//   ar -Ptv ~/data/lib/libfoutil.a
+
+#include "gbtree-ingest.h"
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <unistd.h>
+
+namespace {
+
+void write_item( ofstream& out_file, const string& item )
+{
+    uint32_t item_len = item.size();
+    out_file.write( reinterpret_cast<const char *>( &item_len ),
+      sizeof( item_len ) );
+    out_file.write( item.data(), item_len );
+}
+
+bool read_item( ifstream& in_file, string& item )
+{
+    uint32_t item_len;
+    if ( !in_file.read( reinterpret_cast<char *>( &item_len ),
+      sizeof( item_len ) ) ) return false;
+    item.resize( item_len );
+    return bool( in_file.read( &item[ 0 ], item_len ) );
+}
+
+}  //  namespace
+
+gbtree_ext_ingest::gbtree_ext_ingest( gbtree& tree_hndl,
+  size_t mem_budget_bytes, const string& run_directory, uint32_t item_len )
+  : tree( tree_hndl ), mem_budget( mem_budget_bytes ),
+    run_dir( run_directory ), fixed_len( item_len ), held_bytes( 0 ),
+    run_serial( 0 ), num_run_files( 0 ), num_merge_passes( 0 ),
+    num_added( 0 ), ingest_ok( true )
+{
+}
+
+gbtree_ext_ingest::~gbtree_ext_ingest()
+{
+    for ( auto& run_name : run_names ) remove( run_name.c_str() );
+}
+
+string gbtree_ext_ingest::next_run_name()
+{
+    //
+    // The process ID keeps two programs that share a run directory apart
+    return run_dir + "/gbst-run-" + to_string( getpid() ) + "-" +
+      to_string( run_serial++ ) + ".bin";
+}
+
+bool gbtree_ext_ingest::add( const string& item )
+{
+    if ( !ingest_ok ) return false;
+    if ( fixed_len != 0 && item.size() != fixed_len )
+    {
+        errs << "gbtree_ext_ingest::add() was given an item of " <<
+          item.size() << " bytes when they should be " << fixed_len <<
+          " bytes, so it was not added." << endl;
+        return false;
+    }
+    held_items.push_back( item );
+    held_bytes += sizeof( string ) + item.capacity();
+    num_added++;
+    if ( held_bytes >= mem_budget ) return spill_run();
+    return true;
+}
+
+bool gbtree_ext_ingest::spill_run()
+{
+    sort( held_items.begin(), held_items.end(),
+      [ this ]( const string& item_a, const string& item_b )
+      { return tree.cmp_keys( item_a, item_b ) < 0; } );
+    auto uniq_end = unique( held_items.begin(), held_items.end(),
+      [ this ]( const string& item_a, const string& item_b )
+      { return tree.cmp_keys( item_a, item_b ) == 0; } );
+    string run_name = next_run_name();
+    ofstream run_file( run_name, ios::binary | ios::trunc );
+    for ( auto item_it = held_items.begin(); item_it != uniq_end; ++item_it )
+      write_item( run_file, *item_it );
+    run_file.close();
+    //
+    // swap() gives back the memory, which clear() does not
+    vector<string>().swap( held_items );
+    held_bytes = 0;
+    if ( !run_file )
+    {
+        errs << "gbtree_ext_ingest::spill_run() could not write " <<
+          run_name << ", so the ingest has stopped." << endl;
+        remove( run_name.c_str() );
+        ingest_ok = false;
+        return false;
+    }
+    run_names.push_back( run_name );
+    num_run_files++;
+    return true;
+}
+
+long gbtree_ext_ingest::merge_runs( const vector<string>& in_names,
+  const string& out_name, gbtree_succinct_writer *arch_wrtr )
+{
+    //
+    // The heap holds the next item of each run with the run it came from.
+    //   The comparison is reversed to have the least item on top.
+    vector<ifstream> in_files( in_names.size() );
+    vector<pair<string, size_t> > merge_heap;
+    auto heap_cmp = [ this ]( const pair<string, size_t>& ent_a,
+      const pair<string, size_t>& ent_b )
+      { return tree.cmp_keys( ent_a.first, ent_b.first ) > 0; };
+    string item;
+    for ( size_t run_idx = 0; run_idx < in_names.size(); run_idx++ )
+    {
+        in_files[ run_idx ].open( in_names[ run_idx ], ios::binary );
+        if ( read_item( in_files[ run_idx ], item ) )
+          merge_heap.push_back( { item, run_idx } );
+    }
+    make_heap( merge_heap.begin(), merge_heap.end(), heap_cmp );
+    ofstream out_file;
+    if ( arch_wrtr == nullptr )
+      out_file.open( out_name, ios::binary | ios::trunc );
+    long num_out = 0;
+    string last_out;
+    while ( !merge_heap.empty() )
+    {
+        pop_heap( merge_heap.begin(), merge_heap.end(), heap_cmp );
+        auto& low_ent = merge_heap.back();
+        if ( num_out == 0 || tree.cmp_keys( low_ent.first, last_out ) != 0 )
+        {
+            if ( arch_wrtr != nullptr )
+            {
+                if ( !arch_wrtr->add( low_ent.first ) ) return -1;
+            }
+            else write_item( out_file, low_ent.first );
+            last_out = low_ent.first;
+            num_out++;
+        }
+        if ( read_item( in_files[ low_ent.second ], low_ent.first ) )
+          push_heap( merge_heap.begin(), merge_heap.end(), heap_cmp );
+        else merge_heap.pop_back();
+    }
+    for ( size_t run_idx = 0; run_idx < in_names.size(); run_idx++ )
+    {
+        if ( !in_files[ run_idx ].eof() )
+        {
+            errs << "gbtree_ext_ingest::merge_runs() could not read " <<
+              in_names[ run_idx ] << "." << endl;
+            return -1;
+        }
+    }
+    if ( arch_wrtr == nullptr )
+    {
+        out_file.close();
+        if ( !out_file )
+        {
+            errs << "gbtree_ext_ingest::merge_runs() could not write " <<
+              out_name << "." << endl;
+            return -1;
+        }
+    }
+    return num_out;
+}
+
+bool gbtree_ext_ingest::finish( const string& archive_file )
+{
+    bool fin_ok = ingest_ok && ( held_items.empty() || spill_run() );
+    //
+    // The groups are taken from the front and the merged run goes on the
+    //   end, so each item is merged about the same number of times.
+    while ( fin_ok && run_names.size() > size_t( max_merge_ways ) )
+    {
+        vector<string> grp_names( run_names.begin(),
+          run_names.begin() + max_merge_ways );
+        run_names.erase( run_names.begin(),
+          run_names.begin() + max_merge_ways );
+        string merged_name = next_run_name();
+        fin_ok = merge_runs( grp_names, merged_name, nullptr ) >= 0;
+        for ( auto& grp_name : grp_names ) remove( grp_name.c_str() );
+        if ( fin_ok ) run_names.push_back( merged_name );
+        else remove( merged_name.c_str() );
+        num_merge_passes++;
+    }
+    gbtree_succinct_writer arch_wrtr;
+    fin_ok = fin_ok && arch_wrtr.start( archive_file, fixed_len,
+      tree.get_collation_id(), tree.get_collation_locale() ) &&
+      merge_runs( run_names, "", &arch_wrtr ) >= 0 && arch_wrtr.finish();
+    for ( auto& run_name : run_names ) remove( run_name.c_str() );
+    run_names.clear();
+    vector<string>().swap( held_items );
+    held_bytes = 0;
+    ingest_ok = true;
+    return fin_ok;
+}
@@ -0,0 +1,107 @@
+//
+// The gbtree_ext_ingest class takes in a stream of names or digests that
+//   can be bigger than the memory of the machine and makes a succinct
+//   archive of them.  The live btrees can't do that since the records
+//   are in vectors sized by max_num_rcrd and the names are in the fixed
+//   name store, which is fine for a drive that is being worked on but not
+//   for putting together the catalog of a whole collection of old drives.
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// The items are held in memory until they reach the memory budget, then
+//   they are sorted, the duplicates are taken out, and they are written
+//   to a run file in the run directory.  When the stream is done the runs
+//   are merged a group of up to max_merge_ways at a time, with the
+//   duplicates between runs taken out as well, until the last merge can
+//   take all of the runs that are left.  The last merge writes the items
+//   straight to a gbtree_succinct_writer, so the archive is built in the
+//   one sequential pass over the runs.
+//
+// The budget only counts the items held for a run, with the string
+//   overhead.  The merge holds one item of each run it reads, and the
+//   archive writer holds 2 bits a node for the shape and a bucket offset
+//   for each bucket_size names, which is far less than the items.
+//
+// The order is the order of the record type given, the same as the live
+//   btree of that type, so the archive is loaded with a record of the
+//   same type.  A run file is a list of items, each a 4 byte length in
+//   the byte order of the machine followed by the item.
+//
+
+#ifndef GBTREE_INGEST_H
+#define GBTREE_INGEST_H
+
+#include "gbtree.h"
+#include "gbtree-succinct.h"
+#include <fstream>
+#include <vector>
+
+using namespace std;
+
+class gbtree_ext_ingest
+{
+public:
+    static const int max_merge_ways = 32;
+    static const size_t dflt_mem_budget = 64 * 1024 * 1024;
+
+private:
+    //
+    // The record handle is only used for its cmp_keys() method
+    gbtree& tree;
+    size_t mem_budget;
+    string run_dir;
+    uint32_t fixed_len;
+    vector<string> held_items;
+    size_t held_bytes;
+    vector<string> run_names;
+    int run_serial;
+    int num_run_files;
+    int num_merge_passes;
+    long num_added;
+    bool ingest_ok;
+
+    string next_run_name();
+    bool spill_run();
+    //
+    // Merges the runs into either a new run or the archive writer when
+    //   arch_wrtr is not null.  Returns the number of items written.
+    long merge_runs( const vector<string>& in_names, const string& out_name,
+      gbtree_succinct_writer *arch_wrtr );
+
+public:
+    //
+    // The runs are written to run_directory, which must already be
+    //   there.  When item_len is not 0 all of the items must be that long,
+    //   which is the case for the digests.
+    gbtree_ext_ingest( gbtree& tree_hndl, size_t mem_budget_bytes =
+      dflt_mem_budget, const string& run_directory = "temp",
+      uint32_t item_len = 0 );
+    ~gbtree_ext_ingest();
+    bool add( const string& item );
+    //
+    // Merges the runs and writes the archive.  The ingest is empty again
+    //   after this and can be used for another stream, though the counts
+    //   below go on from the last one.
+    bool finish( const string& archive_file );
+    long get_added_cnt() { return num_added; };
+    // The number of runs spilled by the stream, not counting the merges
+    int get_run_cnt() { return num_run_files; };
+    // The number of merges that were needed to get down to the last one
+    int get_merge_passes() { return num_merge_passes; };
+};
+
+#endif  //  GBTREE_INGEST_H
@@ -0,0 +1,237 @@
+//
+// This file contains the code to implement the Merkle btree diff classes
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// Use the following commands to build this object, save it to the library,
+//    and display the library contents:
+//
+//   g++ -std=c++17 -c gbtree-merkle.cc
+//   ar -Prs ~/data/lib/libfoutil.a gbtree-merkle.o
+//   ar -Ptv ~/data/lib/libfoutil.a
+
+#include "gbtree-merkle.h"
+#include <iostream>
+
+#ifdef USEmerkle_dgst
+
+namespace {
+
+const char mrkl_magic[] = "gbmerkl1";
+const int mrkl_magic_len = 8;
+
+void put_be( ofstream& out_file, uint64_t val, int num_bytes )
+{
+    for ( int shft = 8 * ( num_bytes - 1 ); shft >= 0; shft -= 8 )
+      out_file.put( char( val >> shft ) );
+}
+
+bool get_be( ifstream& in_file, uint64_t& val, int num_bytes )
+{
+    val = 0;
+    for ( int idx = 0; idx < num_bytes; idx++ )
+    {
+        int in_byte = in_file.get();
+        if ( in_byte == EOF ) return false;
+        val = ( val << 8 ) | uint8_t( in_byte );
+    }
+    return true;
+}
+
+}  //  namespace
+
+int64_t gbtree_merkle_live::get_head()
+{
+    int head_id = tree.get_node( 0 ).get_child_right_idx();
+    return head_id == 0 ? -1 : head_id;
+}
+
+bool gbtree_merkle_live::read_node( int64_t node_hndl, merkle_node& node )
+{
+    if ( !tree.get_merkle_dgst( int( node_hndl ), node.dgst ) ) return false;
+    gbtree& node_rcrd = tree.get_node( int( node_hndl ) );
+    node.key = tree.get_node_key( int( node_hndl ) );
+    node.left = node_rcrd.get_child_left_idx();
+    node.right = node_rcrd.get_child_right_idx();
+    if ( node.left == 0 ) node.left = -1;
+    if ( node.right == 0 ) node.right = -1;
+    return true;
+}
+
+int64_t gbtree_merkle_file::write_subtree( ofstream& out_file,
+  gbtree& tree_hndl, int node_id )
+{
+    //
+    // Returns the number of bytes written for the subtree, or -1 when a
+    //   digest is missing.
+    merkle_dgst_type node_dgst;
+    if ( !tree_hndl.get_merkle_dgst( node_id, node_dgst ) ) return -1;
+    gbtree& node_rcrd = tree_hndl.get_node( node_id );
+    int left_id = node_rcrd.get_child_left_idx();
+    int right_id = node_rcrd.get_child_right_idx();
+    string node_key = tree_hndl.get_node_key( node_id );
+    int64_t start_pos = out_file.tellp();
+    out_file.put( char( ( left_id != 0 ? 1 : 0 ) | ( right_id != 0 ? 2 : 0 ) ) );
+    out_file.write( reinterpret_cast<const char *>( node_dgst.data() ),
+      node_dgst.size() );
+    put_be( out_file, node_key.size(), 4 );
+    out_file.write( node_key.data(), node_key.size() );
+    int64_t left_sz_pos = out_file.tellp();
+    if ( left_id != 0 && right_id != 0 ) put_be( out_file, 0, 8 );
+    if ( left_id != 0 )
+    {
+        int64_t left_sz = write_subtree( out_file, tree_hndl, left_id );
+        if ( left_sz < 0 ) return -1;
+        if ( right_id != 0 )
+        {
+            // Go back and fill in the size now that it is known
+            int64_t end_pos = out_file.tellp();
+            out_file.seekp( left_sz_pos );
+            put_be( out_file, left_sz, 8 );
+            out_file.seekp( end_pos );
+        }
+    }
+    if ( right_id != 0 && write_subtree( out_file, tree_hndl, right_id ) < 0 )
+      return -1;
+    return int64_t( out_file.tellp() ) - start_pos;
+}
+
+bool gbtree_merkle_file::save( gbtree& tree_hndl, const string& file_name )
+{
+    ofstream out_file( file_name, ios::binary | ios::trunc );
+    if ( !out_file )
+    {
+        errs << "gbtree_merkle_file::save() could not open " << file_name <<
+          " for writing." << endl;
+        return false;
+    }
+    out_file.write( mrkl_magic, mrkl_magic_len );
+    int head_id = tree_hndl.get_node( 0 ).get_child_right_idx();
+    if ( head_id != 0 && write_subtree( out_file, tree_hndl, head_id ) < 0 )
+    {
+        errs << "gbtree_merkle_file::save() found a node without a digest, " <<
+          "so " << file_name << " was not finished." << endl;
+        return false;
+    }
+    return bool( out_file );
+}
+
+bool gbtree_merkle_file::open( const string& file_name )
+{
+    if ( mrkl_file.is_open() ) mrkl_file.close();
+    head_off = -1;
+    mrkl_file.open( file_name, ios::binary );
+    char magic_in[ mrkl_magic_len ];
+    if ( !mrkl_file.read( magic_in, mrkl_magic_len ) ||
+      string( magic_in, mrkl_magic_len ) != mrkl_magic )
+    {
+        errs << "gbtree_merkle_file::open() could not read a Merkle btree " <<
+          "file from " << file_name << "." << endl;
+        mrkl_file.close();
+        return false;
+    }
+    if ( mrkl_file.peek() != EOF ) head_off = mrkl_magic_len;
+    mrkl_file.clear();
+    return true;
+}
+
+int64_t gbtree_merkle_file::get_head()
+{
+    return head_off;
+}
+
+bool gbtree_merkle_file::read_node( int64_t node_hndl, merkle_node& node )
+{
+    if ( !mrkl_file.is_open() || node_hndl < 0 ) return false;
+    mrkl_file.clear();
+    mrkl_file.seekg( node_hndl );
+    int chld_flgs = mrkl_file.get();
+    if ( chld_flgs == EOF ) return false;
+    if ( !mrkl_file.read( reinterpret_cast<char *>( node.dgst.data() ),
+      node.dgst.size() ) ) return false;
+    uint64_t key_len;
+    if ( !get_be( mrkl_file, key_len, 4 ) ) return false;
+    node.key.resize( key_len );
+    if ( !mrkl_file.read( &node.key[ 0 ], key_len ) ) return false;
+    uint64_t left_sz = 0;
+    if ( ( chld_flgs & 3 ) == 3 && !get_be( mrkl_file, left_sz, 8 ) )
+      return false;
+    int64_t chld_off = mrkl_file.tellg();
+    node.left = ( chld_flgs & 1 ) ? chld_off : -1;
+    node.right = ( chld_flgs & 2 ) ? chld_off + int64_t( left_sz ) : -1;
+    return true;
+}
+
+void gbtree_merkle_diff::add_pending( const string& key, char side )
+{
+    auto pend_it = pending.find( key );
+    if ( pend_it == pending.end() ) pending[ key ] = side;
+    else if ( pend_it->second != side ) pending.erase( pend_it );
+}
+
+void gbtree_merkle_diff::diff_subtrees( gbtree_merkle_src& src_a,
+  int64_t a_hndl, gbtree_merkle_src& src_b, int64_t b_hndl )
+{
+    if ( ( a_hndl < 0 && b_hndl < 0 ) || !read_ok ) return;
+    merkle_node a_node = { {}, "", -1, -1 };
+    merkle_node b_node = { {}, "", -1, -1 };
+    if ( a_hndl >= 0 )
+    {
+        read_ok = read_ok && src_a.read_node( a_hndl, a_node );
+        num_reads++;
+    }
+    if ( b_hndl >= 0 )
+    {
+        read_ok = read_ok && src_b.read_node( b_hndl, b_node );
+        num_reads++;
+    }
+    if ( !read_ok ) return;
+    if ( a_hndl >= 0 && b_hndl >= 0 && a_node.dgst == b_node.dgst ) return;
+    //
+    // Each side is its node item plus its two child subtrees, which don't
+    //   overlap, so the items that differ are the ones that are left after
+    //   the pieces of both sides are matched up.
+    if ( a_hndl >= 0 ) add_pending( a_node.key, 'a' );
+    if ( b_hndl >= 0 ) add_pending( b_node.key, 'b' );
+    diff_subtrees( src_a, a_node.left, src_b, b_node.left );
+    diff_subtrees( src_a, a_node.right, src_b, b_node.right );
+}
+
+bool gbtree_merkle_diff::run( gbtree_merkle_src& src_a,
+  gbtree_merkle_src& src_b )
+{
+    pending.clear();
+    only_in_a.clear();
+    only_in_b.clear();
+    num_reads = 0;
+    read_ok = true;
+    diff_subtrees( src_a, src_a.get_head(), src_b, src_b.get_head() );
+    if ( !read_ok )
+    {
+        errs << "gbtree_merkle_diff::run() could not read a btree node, so " <<
+          "the diff is not complete." << endl;
+        return false;
+    }
+    for ( auto& pend_item : pending )
+    {
+        if ( pend_item.second == 'a' ) only_in_a.push_back( pend_item.first );
+        else only_in_b.push_back( pend_item.first );
+    }
+    return true;
+}
+
+#endif  //  #ifdef USEmerkle_dgst
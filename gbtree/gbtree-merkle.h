@@ -0,0 +1,153 @@
+//
+// The Merkle classes compare two btrees using the subtree digests that
+//   gbtree keeps when USEmerkle_dgst is defined.  The digest of a node
+//   covers its own item and the digests of its two children, so when two
+//   subtrees have the same digest they hold the same items, and the diff
+//   can skip them without looking inside.  The cost of a diff is then
+//   about the number of changed items times the depth of the tree, not
+//   the size of the catalogs.
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// The diff walks the two trees by position.  The hash btrees have a shape
+//   that only depends on their set of items, and each position stands for
+//   a fixed range of digests, so the same items are at the same positions
+//   in both trees and matching digests show up where the trees agree.
+//   The walk doesn't depend on that to be right though.  At a position
+//   where the digests differ, the items of each subtree are split into
+//   the node item and the two child subtrees, and an item found on one
+//   side only is held as pending until it either turns up on the other
+//   side somewhere else or the walk ends.  Trees with different shapes,
+//   such as UTF-8 trees with different balance points, still give the
+//   right answer, only with more of the trees read.
+//
+// A btree is read through the gbtree_merkle_src interface, either from
+//   the live records, or from a file written by gbtree_merkle_file::save()
+//   so the catalog of another machine can be compared.  The file holds
+//   the nodes in preorder with the offset of each right child, so a diff
+//   against a file only reads the nodes it visits.  The file is:
+//
+//     8 bytes          "gbmerkl1"
+//     for each node in preorder:
+//       1 byte         bit 0 set for a left child, bit 1 for a right child
+//       16 bytes       subtree digest
+//       4 bytes        item length, big endian
+//       n bytes        item, the search key of the node
+//       8 bytes        size of the left subtree, big endian, only there
+//                        when the node has both children
+//
+// The two live trees in a diff can't be of the same record type since
+//   the records of a type are all in one static array, so one side is a
+//   file in that case.
+//
+
+#ifndef GBTREE_MERKLE_H
+#define GBTREE_MERKLE_H
+
+#include "gbtree.h"
+#include <fstream>
+#include <map>
+#include <vector>
+
+using namespace std;
+
+#ifdef USEmerkle_dgst
+
+struct merkle_node {
+    merkle_dgst_type dgst;
+    string key;
+    // The handles of the children, or -1 when there isn't one
+    int64_t left;
+    int64_t right;
+};
+
+class gbtree_merkle_src
+{
+public:
+    virtual ~gbtree_merkle_src() {}
+    // Returns the handle of the head node, or -1 for an empty btree
+    virtual int64_t get_head() = 0;
+    virtual bool read_node( int64_t node_hndl, merkle_node& node ) = 0;
+};
+
+//
+// The handles are the node IDs.  The digests must have been turned on
+//   with gbtree::start_merkle_dgsts().
+class gbtree_merkle_live : public gbtree_merkle_src
+{
+    gbtree& tree;
+
+public:
+    gbtree_merkle_live( gbtree& tree_hndl ) : tree( tree_hndl ) { };
+    int64_t get_head();
+    bool read_node( int64_t node_hndl, merkle_node& node );
+};
+
+//
+// The handles are the offsets of the nodes in the file
+class gbtree_merkle_file : public gbtree_merkle_src
+{
+    ifstream mrkl_file;
+    int64_t head_off;
+
+    static int64_t write_subtree( ofstream& out_file, gbtree& tree_hndl,
+      int node_id );
+
+public:
+    gbtree_merkle_file() : head_off( -1 ) { };
+    //
+    // Writes the digests and items of the btree that tree_hndl is a record
+    //   of.  Returns false if the digests are not on or the file can not
+    //   be written.
+    static bool save( gbtree& tree_hndl, const string& file_name );
+    bool open( const string& file_name );
+    int64_t get_head();
+    bool read_node( int64_t node_hndl, merkle_node& node );
+};
+
+class gbtree_merkle_diff
+{
+    //
+    // The items found on one side only so far, with 'a' or 'b' for the
+    //   side.  An item found on the other side later is taken out again.
+    map<string, char> pending;
+    int num_reads;
+    bool read_ok;
+    vector<string> only_in_a;
+    vector<string> only_in_b;
+
+    void diff_subtrees( gbtree_merkle_src& src_a, int64_t a_hndl,
+      gbtree_merkle_src& src_b, int64_t b_hndl );
+    void add_pending( const string& key, char side );
+
+public:
+    gbtree_merkle_diff() : num_reads( 0 ), read_ok( true ) { };
+    //
+    // Finds the items that are only in one of the btrees.  Returns false
+    //   if a node could not be read, and the results are not complete.
+    bool run( gbtree_merkle_src& src_a, gbtree_merkle_src& src_b );
+    //
+    // The results, as search keys in byte order
+    const vector<string>& get_only_in_a() { return only_in_a; };
+    const vector<string>& get_only_in_b() { return only_in_b; };
+    // The number of nodes read from the two btrees by the last run()
+    int get_read_cnt() { return num_reads; };
+};
+
+#endif  //  #ifdef USEmerkle_dgst
+
+#endif  //  GBTREE_MERKLE_H
@@ -0,0 +1,258 @@
+//
+// This file contains the code to implement the gbtree_rebalancer class
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// Use the following commands to build this object, save it to the library,
+//    and display the library contents:
+//
+//   g++ -std=c++17 -c gbtree-rebal.cc
+//   ar -Prs ~/data/lib/libfoutil.a gbtree-rebal.o
+//   ar -Ptv ~/data/lib/libfoutil.a
+
+#include "gbtree-rebal.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+gbtree_rebalancer::gbtree_rebalancer( gbtree& tree_hndl, int height_limit )
+  : tree( tree_hndl ), max_height( height_limit ), in_pass( false )
+  , pins_supported( true ), rebuild_cnt( 0 ), rebuilt_nodes( 0 )
+  , stop_req( false )
+{
+}
+
+gbtree_rebalancer::~gbtree_rebalancer()
+{
+    stop_background();
+}
+
+void gbtree_rebalancer::start_pass()
+{
+    scan_stk.clear();
+    int head_id = tree.get_node( 0 ).btree_child_right;
+    if ( pins_supported && head_id != 0 ) scan_stk.emplace_back( head_id );
+    in_pass = !scan_stk.empty();
+}
+
+bool gbtree_rebalancer::step( int budget )
+{
+    //
+    // The scan is a post order walk, so a node is finished after both of
+    //   its children have reported their height and node count to it.
+    //   Inserts done between steps may have changed the links of a node
+    //   already on the stack, but the links are always read fresh as the
+    //   walk proceeds and the heights are only used to pick candidates, so
+    //   a slightly stale value just delays a rebuild to the next pass.
+    // The frames really stand for btree positions though.  An insert that
+    //   replaces a node moves the old one further down, so the node IDs
+    //   of the frames are read again from the links of the parent frames
+    //   before the walk is resumed.
+    if ( in_pass )
+    {
+        scan_stk[ 0 ].node_id = tree.get_node( 0 ).btree_child_right;
+        for ( size_t idx = 1; idx < scan_stk.size(); idx++ )
+        {
+            gbtree& prnt_rcrd = tree.get_node( scan_stk[ idx - 1 ].node_id );
+            scan_stk[ idx ].node_id = scan_stk[ idx - 1 ].stage == 1 ?
+              prnt_rcrd.btree_child_left : prnt_rcrd.btree_child_right;
+        }
+    }
+    while ( in_pass && budget > 0 )
+    {
+        scan_frame& frm = scan_stk.back();
+        gbtree& nd_rcrd = tree.get_node( frm.node_id );
+        budget--;
+        if ( frm.stage == 0 )
+        {
+            frm.stage = 1;
+            if ( nd_rcrd.btree_child_left != 0 )
+            {
+                scan_stk.emplace_back( int( nd_rcrd.btree_child_left ) );
+                continue;
+            }
+        }
+        if ( frm.stage == 1 )
+        {
+            frm.stage = 2;
+            if ( nd_rcrd.btree_child_right != 0 )
+            {
+                scan_stk.emplace_back( int( nd_rcrd.btree_child_right ) );
+                continue;
+            }
+        }
+        int sub_ht = max( frm.left_ht, frm.right_ht ) + 1;
+        int sub_cnt = frm.left_cnt + frm.right_cnt + 1;
+        int best_ht = 0;
+        while ( ( 1 << best_ht ) - 1 < sub_cnt ) best_ht++;
+        if ( sub_ht > max_height && sub_ht > best_ht + 1 )
+        {
+            sub_ht = rebuild_subtree( frm.node_id, sub_cnt );
+            if ( sub_ht == 0 )
+            {
+                // The record type can't hold pins so there is nothing
+                //   more that can be done.
+                scan_stk.clear();
+                in_pass = false;
+                break;
+            }
+            budget -= sub_cnt;
+        }
+        scan_stk.pop_back();
+        if ( scan_stk.empty() )
+        {
+            in_pass = false;
+            break;
+        }
+        scan_frame& prnt = scan_stk.back();
+        if ( prnt.stage == 1 )
+        {
+            prnt.left_ht = sub_ht;
+            prnt.left_cnt = sub_cnt;
+        }
+        else
+        {
+            prnt.right_ht = sub_ht;
+            prnt.right_cnt = sub_cnt;
+        }
+    }
+    return in_pass;
+}
+
+int gbtree_rebalancer::rebuild_subtree( int sub_root, int sub_cnt )
+{
+    //
+    // Returns the height of the rebuilt subtree, or 0 if the record type
+    //   does not support pinned base search variables.
+    gbtree& root_rcrd = tree.get_node( sub_root );
+    int top_parent = root_rcrd.btree_parent;
+    bool top_is_right = root_rcrd.rt_chld_flg;
+    //
+    // The path to the subtree root, built from the bottom up and then
+    //   reversed.  The head of the tree is always the right child of the
+    //   base parent record so every path begins with 'r'.
+    string top_path;
+    for ( int nd_id = sub_root; nd_id != 0;
+      nd_id = tree.get_node( nd_id ).btree_parent )
+      top_path.push_back( tree.get_node( nd_id ).rt_chld_flg ? 'r' : 'l' );
+    reverse( top_path.begin(), top_path.end() );
+    if ( !tree.set_bsv_pin( top_path, 0 ) )
+    {
+        pins_supported = false;
+        return 0;
+    }
+    //
+    // Collect the subtree node IDs in sorted order
+    vector<int> ids;
+    ids.reserve( sub_cnt );
+    vector<int> walk_stk;
+    int nd_id = sub_root;
+    while ( nd_id != 0 || !walk_stk.empty() )
+    {
+        while ( nd_id != 0 )
+        {
+            walk_stk.push_back( nd_id );
+            nd_id = tree.get_node( nd_id ).btree_child_left;
+        }
+        nd_id = walk_stk.back();
+        walk_stk.pop_back();
+        ids.push_back( nd_id );
+        nd_id = tree.get_node( nd_id ).btree_child_right;
+    }
+    //
+    // Now place the median of each range at the position and pin it as
+    //   the base search variable.  The node is then the least item that
+    //   is not less than the base search variable, so the placement rules
+    //   are satisfied and new items will find their way correctly.  Since
+    //   the node equals the base search variable nod2bas can be set to
+    //   the "equal" value directly.
+    int new_ht = 0;
+    vector<build_item> bld_stk;
+    bld_stk.push_back( { 0, int( ids.size() ), top_parent, top_is_right,
+      top_path } );
+    while ( !bld_stk.empty() )
+    {
+        build_item itm = bld_stk.back();
+        bld_stk.pop_back();
+        gbtree& prnt_rcrd = tree.get_node( itm.parent_id );
+        if ( itm.lo >= itm.hi )
+        {
+            if ( itm.is_right ) prnt_rcrd.btree_child_right = 0;
+            else prnt_rcrd.btree_child_left = 0;
+            continue;
+        }
+        int mid = itm.lo + ( itm.hi - itm.lo ) / 2;
+        int mid_id = ids[ mid ];
+        gbtree& mid_rcrd = tree.get_node( mid_id );
+        mid_rcrd.btree_parent = itm.parent_id;
+        mid_rcrd.rt_chld_flg = itm.is_right ? 1 : 0;
+        mid_rcrd.nod2bas = 0;
+        mid_rcrd.asn_cur_search_node = 0;
+        mid_rcrd.verify_base_srch_var = 0;
+#ifdef USEorder_stats
+        mid_rcrd.subtree_cnt = itm.hi - itm.lo;
+#endif  //  #ifdef USEorder_stats
+        if ( itm.is_right ) prnt_rcrd.btree_child_right = mid_id;
+        else prnt_rcrd.btree_child_left = mid_id;
+        tree.set_bsv_pin( itm.path, mid_id );
+        int rel_lvl = int( itm.path.size() - top_path.size() ) + 1;
+        if ( rel_lvl > new_ht ) new_ht = rel_lvl;
+        bld_stk.push_back( { itm.lo, mid, mid_id, false, itm.path + 'l' } );
+        bld_stk.push_back( { mid + 1, itm.hi, mid_id, true, itm.path + 'r' } );
+    }
+#ifdef USEmerkle_dgst
+    //
+    // The items in the subtree are the same but its shape is not, so the
+    //   digests of the subtree and of the path above it have changed.
+    gbtree& top_rcrd = tree.get_node( top_parent );
+    tree.calc_merkle_subtree( top_is_right ? top_rcrd.btree_child_right :
+      top_rcrd.btree_child_left );
+    tree.refresh_merkle_path( top_parent );
+#endif  //  #ifdef USEmerkle_dgst
+    rebuild_cnt++;
+    rebuilt_nodes += ids.size();
+    return new_ht;
+}
+
+void gbtree_rebalancer::start_background( mutex& tree_mtx, int slice_budget )
+{
+    stop_background();
+    stop_req = false;
+    bg_thread = thread( [ this, &tree_mtx, slice_budget ]()
+    {
+        while ( !stop_req )
+        {
+            bool more_work;
+            {
+                lock_guard<mutex> tree_lck( tree_mtx );
+                if ( !in_pass ) start_pass();
+                more_work = step( slice_budget );
+            }
+            //
+            // Between passes there is nothing to do until more items get
+            //   added, so don't spin on the mutex.
+            if ( more_work ) this_thread::yield();
+            else this_thread::sleep_for( chrono::milliseconds( 20 ) );
+        }
+    } );
+}
+
+void gbtree_rebalancer::stop_background()
+{
+    stop_req = true;
+    if ( bg_thread.joinable() ) bg_thread.join();
+}
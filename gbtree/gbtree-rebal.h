@@ -0,0 +1,143 @@
+//
+// The gbtree_rebalancer class provides an incremental rebalancing
+//   capability for the gbtree derived classes.  The base search variable
+//   placement rule keeps the btree reasonably balanced as long as the data
+//   items are well distributed over the range that the base search
+//   variables were designed for.  A skewed set, such as thousands of
+//   camera file names like IMG_0001.JPG, all share a long common prefix
+//   and end up in a long chain of positions whose base search variables
+//   don't split the set at all.
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// Since the base search variable for a position is determined only by the
+//   path to the position, the shape of the btree is fixed by the set of
+//   data items, and no amount of rotating nodes can change it.  What the
+//   rebalancer does instead is to pin a data driven base search variable
+//   to each position of a subtree that is too deep.  The subtree is
+//   rebuilt with the median item of each part of it as the base search
+//   variable of the position, which by the placement rule also makes that
+//   median the item held by the position.  The result is a perfectly
+//   balanced subtree, and any items added later are placed by the normal
+//   rules using the pinned values.  The derived class supplies the pin
+//   storage through the gbtree::set_bsv_pin() virtual method.
+//
+// The work is done in small steps so it can be called between inserts.
+//   A step walks the tree depth first computing subtree heights, and when
+//   it finds the smallest subtree that is taller than the threshold and
+//   can be made shorter, that subtree is rebuilt at that point.  The walk
+//   continues with the new height so that ancestor subtrees are judged
+//   correctly.  Since the smallest qualifying subtree is always chosen,
+//   the rebuilds are usually only slightly larger than the threshold.
+//   Records are never moved in the record arrays, so all IDs held by the
+//   callers remain valid.
+//
+// A rebuilt subtree is only balanced for the items it held at the time.
+//   The positions below a pinned one keep the scc values of the pin, so
+//   the items added under the bottom of a rebuilt subtree all see the
+//   same base search variable and go into a chain, one level deeper for
+//   each item, until a later pass finds the subtree too tall and rebuilds
+//   it with them.  Calling step() between inserts keeps those chains
+//   short.  With a batch of inserts and no steps, the depth below a
+//   rebuilt subtree grows with the batch, and a full pass afterwards is
+//   what brings it back under the height limit.
+// The pins are kept in memory only, the same as the records.  Nothing
+//   saves them, so a tree that is loaded again from its names has the
+//   shape the base search variables give it and needs a new pass.
+//
+// The rebalancer can also run on its own thread.  Since the gbtree
+//   classes keep their search state in static members, the thread must
+//   share a mutex with the code doing the inserts, and it only touches
+//   the tree while it holds that mutex for one step at a time.
+//
+
+#ifndef GBTREE_REBAL_H
+#define GBTREE_REBAL_H
+
+#include "gbtree.h"
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+
+using namespace std;
+
+class gbtree_rebalancer
+{
+    struct scan_frame {
+        int node_id;
+        // 0 -> left child not yet visited, 1 -> right child not yet
+        //   visited, 2 -> both children done
+        int stage;
+        int left_ht;
+        int left_cnt;
+        int right_ht;
+        int right_cnt;
+
+        scan_frame( int nd_id )
+          : node_id( nd_id ), stage( 0 ), left_ht( 0 ), left_cnt( 0 )
+          , right_ht( 0 ), right_cnt( 0 )
+        { }
+    };
+
+    struct build_item {
+        int lo;
+        int hi;
+        int parent_id;
+        bool is_right;
+        string path;
+    };
+
+    //
+    // Any record of the derived class can be used as the tree handle since
+    //   get_node() reaches the records of the class through its static
+    //   record array.
+    gbtree& tree;
+    int max_height;
+    bool in_pass;
+    bool pins_supported;
+    vector<scan_frame> scan_stk;
+    int rebuild_cnt;
+    int rebuilt_nodes;
+    atomic<bool> stop_req;
+    thread bg_thread;
+
+    int rebuild_subtree( int sub_root, int sub_cnt );
+
+public:
+    gbtree_rebalancer( gbtree& tree_hndl, int height_limit );
+    ~gbtree_rebalancer();
+    //
+    // Begin a new pass over the whole tree.  A pass is needed after a
+    //   batch of inserts since they can make new subtrees too deep.
+    void start_pass();
+    //
+    // Do at most about budget node visits of the current pass, plus the
+    //   rebuild of a subtree if one is found.  Returns true while the pass
+    //   still has work to do.
+    bool step( int budget );
+    //
+    // Run passes on a separate thread, one step at a time while holding
+    //   tree_mtx.  The inserting code must hold the same mutex while it
+    //   calls place_new_node() or anything that uses it.
+    void start_background( mutex& tree_mtx, int slice_budget );
+    void stop_background();
+    int get_rebuild_cnt() { return rebuild_cnt; };
+    int get_rebuilt_nodes() { return rebuilt_nodes; };
+};
+
+#endif  //  GBTREE_REBAL_H
@@ -0,0 +1,111 @@
+//
+// This file contains the code to implement the gbtree_snap_pub class
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// Use the following commands to build this object, save it to the library,
+//    and display the library contents:
+//
+//   g++ -std=c++17 -c gbtree-snap.cc
+//   ar -Prs ~/data/lib/libfoutil.a gbtree-snap.o
+//   ar -Ptv ~/data/lib/libfoutil.a
+
+#include "gbtree-snap.h"
+
+gbtree_snap_pub::gbtree_snap_pub()
+  : cur_snap( nullptr ), global_epoch( 1 ), version( 0 ), num_freed( 0 )
+{
+    for ( auto& slot : rdr_slots )
+    {
+        slot.epoch.store( 0 );
+        slot.in_use.store( false );
+    }
+}
+
+gbtree_snap_pub::~gbtree_snap_pub()
+{
+    for ( auto& old_snap : retired ) delete old_snap.snap;
+    delete cur_snap.load();
+}
+
+int gbtree_snap_pub::register_reader()
+{
+    for ( int reader_id = 0; reader_id < max_readers; reader_id++ )
+    {
+        bool was_used = false;
+        if ( rdr_slots[ reader_id ].in_use.compare_exchange_strong(
+          was_used, true ) ) return reader_id;
+    }
+    return -1;
+}
+
+void gbtree_snap_pub::release_reader( int reader_id )
+{
+    rdr_slots[ reader_id ].epoch.store( 0 );
+    rdr_slots[ reader_id ].in_use.store( false );
+}
+
+const gbtree_frozen *gbtree_snap_pub::pin( int reader_id )
+{
+    //
+    // The store of the epoch has to be seen before the pointer is read,
+    //   so both use the default sequentially consistent order.  If the
+    //   writer looks at the slot before the store is seen, then the swap
+    //   came before the read of the pointer and the reader gets the new
+    //   snapshot.
+    rdr_slots[ reader_id ].epoch.store( global_epoch.load() );
+    return cur_snap.load();
+}
+
+void gbtree_snap_pub::unpin( int reader_id )
+{
+    rdr_slots[ reader_id ].epoch.store( 0, memory_order_release );
+}
+
+uint64_t gbtree_snap_pub::publish( gbtree_frozen *new_snap )
+{
+    gbtree_frozen *old_snap = cur_snap.exchange( new_snap );
+    uint64_t retire_epoch = global_epoch.fetch_add( 1 );
+    if ( old_snap != nullptr ) retired.push_back( { retire_epoch, old_snap } );
+    version++;
+    reclaim();
+    return version;
+}
+
+int gbtree_snap_pub::reclaim()
+{
+    uint64_t oldest_pin = UINT64_MAX;
+    for ( auto& slot : rdr_slots )
+    {
+        uint64_t pin_epoch = slot.epoch.load();
+        if ( pin_epoch != 0 && pin_epoch < oldest_pin ) oldest_pin = pin_epoch;
+    }
+    int freed_now = 0;
+    size_t keep_idx = 0;
+    for ( size_t idx = 0; idx < retired.size(); idx++ )
+    {
+        if ( retired[ idx ].epoch < oldest_pin )
+        {
+            delete retired[ idx ].snap;
+            freed_now++;
+        }
+        else retired[ keep_idx++ ] = retired[ idx ];
+    }
+    retired.resize( keep_idx );
+    num_freed += freed_now;
+    return freed_now;
+}
@@ -0,0 +1,106 @@
+//
+// The gbtree_snap_pub class publishes gbtree_frozen snapshots to reader
+//   threads in the read, copy, update (RCU) style.  The thread that adds
+//   the names makes a new snapshot at the end of each batch and publishes
+//   it by swapping a pointer, so the readers do their lookups without
+//   taking any lock and never wait for the writer.  A reader pins the
+//   current snapshot for as long as it is using it, and an old snapshot is
+//   only freed when no reader can still be holding it.
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// The live record vectors and the utf8_name_store can't be shared this
+//   way since they are changed in place and can be moved when they grow.
+//   The snapshots hold everything a lookup needs though, the sort keys and
+//   the node IDs, and the node IDs of a record never change, so they are
+//   good handles to give back to the readers.
+//
+// The reclaiming uses epochs.  Each reader has its own slot, on its own
+//   cache line, where it stores the epoch it started in while it has a
+//   snapshot pinned, and 0 when it doesn't.  When the writer swaps in a
+//   new snapshot it retires the old one with the epoch of the swap and
+//   then starts a new epoch.  Any reader that stored a later epoch read
+//   the pointer after the swap, so the old snapshot can be freed as soon
+//   as all of the pinned readers are past its epoch.  Pinning is one store
+//   and two loads, and no reader ever writes to memory that another
+//   thread reads often.
+//
+
+#ifndef GBTREE_SNAP_H
+#define GBTREE_SNAP_H
+
+#include "gbtree-frozen.h"
+#include <atomic>
+#include <vector>
+
+using namespace std;
+
+class gbtree_snap_pub
+{
+public:
+    static const int max_readers = 64;
+
+private:
+    struct alignas( 64 ) reader_slot {
+        atomic<uint64_t> epoch;
+        atomic<bool> in_use;
+    };
+
+    struct retired_snap {
+        uint64_t epoch;
+        gbtree_frozen *snap;
+    };
+
+    reader_slot rdr_slots[ max_readers ];
+    alignas( 64 ) atomic<gbtree_frozen *> cur_snap;
+    atomic<uint64_t> global_epoch;
+    //
+    // These are only used by the writer
+    vector<retired_snap> retired;
+    uint64_t version;
+    int num_freed;
+
+public:
+    gbtree_snap_pub();
+    //
+    // All readers must have been released before the publisher goes away
+    ~gbtree_snap_pub();
+    gbtree_snap_pub( const gbtree_snap_pub& ) = delete;
+    gbtree_snap_pub& operator=( const gbtree_snap_pub& ) = delete;
+    //
+    // Each reader thread gets a slot ID to pin with.  register_reader()
+    //   returns -1 when all of the slots are taken.
+    int register_reader();
+    void release_reader( int reader_id );
+    //
+    // Returns the current snapshot, which stays valid until unpin() is
+    //   called with the same reader ID.  It is nullptr until the first
+    //   snapshot is published.  A reader only holds one pin at a time.
+    const gbtree_frozen *pin( int reader_id );
+    void unpin( int reader_id );
+    //
+    // The writer side, which must only be called from one thread at a
+    //   time.  publish() takes ownership of the snapshot, returns its
+    //   version number and frees any old snapshots that it can.
+    uint64_t publish( gbtree_frozen *new_snap );
+    int reclaim();
+    uint64_t get_version() { return version; };
+    int get_retired_cnt() { return int( retired.size() ); };
+    int get_freed_cnt() { return num_freed; };
+};
+
+#endif  //  GBTREE_SNAP_H
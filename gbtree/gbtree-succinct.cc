@@ -0,0 +1,529 @@
+//
+// This file contains the code to implement the gbtree_succinct class
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// Use the following commands to build this object, save it to the library,
+//    and display the library contents:
+//
+//   g++ -std=c++17 -c gbtree-succinct.cc
+//   ar -Prs ~/data/lib/libfoutil.a gbtree-succinct.o
+//   ar -Ptv ~/data/lib/libfoutil.a
+
+#include "gbtree-succinct.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+namespace {
+
+//
+// The first archives had no collation ID in the header, and they were all
+//   of the order that is ID 0.  The second ones had no name of the
+//   LC_COLLATE locale after it, so the locale they were made in isn't
+//   known and they are read in any locale, as they always were.
+const char sccnt_magic[] = "gbsccnt3";
+const char sccnt_magic_v2[] = "gbsccnt2";
+const char sccnt_magic_v1[] = "gbsccnt1";
+const int sccnt_magic_len = 8;
+
+//
+// The archive is written in the byte order of the machine, the same as
+//   the rest of the data files of the file organizer.
+template<class T>
+void write_vec( ofstream& out_file, const vector<T>& vec )
+{
+    uint64_t vec_len = vec.size();
+    out_file.write( reinterpret_cast<const char *>( &vec_len ),
+      sizeof( vec_len ) );
+    out_file.write( reinterpret_cast<const char *>( vec.data() ),
+      vec_len * sizeof( T ) );
+}
+
+template<class T>
+bool read_vec( ifstream& in_file, vector<T>& vec )
+{
+    uint64_t vec_len;
+    if ( !in_file.read( reinterpret_cast<char *>( &vec_len ),
+      sizeof( vec_len ) ) ) return false;
+    vec.resize( vec_len );
+    return bool( in_file.read( reinterpret_cast<char *>( vec.data() ),
+      vec_len * sizeof( T ) ) );
+}
+
+void put_shape_bit( vector<uint64_t>& shape_bits, size_t bit_idx,
+  bool is_open )
+{
+    if ( ( bit_idx >> 6 ) >= shape_bits.size() ) shape_bits.push_back( 0 );
+    if ( is_open )
+      shape_bits[ bit_idx >> 6 ] |= uint64_t( 1 ) << ( bit_idx & 63 );
+}
+
+//
+// The shape of a balanced btree of num_nodes nodes, with the middle item
+//   at the head and the same split all the way down
+void put_balanced_shape( vector<uint64_t>& shape_bits, size_t& bit_idx,
+  uint32_t num_nodes )
+{
+    while ( num_nodes > 0 )
+    {
+        uint32_t left_nodes = num_nodes / 2;
+        put_shape_bit( shape_bits, bit_idx++, true );
+        put_balanced_shape( shape_bits, bit_idx, left_nodes );
+        put_shape_bit( shape_bits, bit_idx++, false );
+        num_nodes -= left_nodes + 1;
+    }
+}
+
+}  //  namespace
+
+gbtree_succinct::gbtree_succinct()
+  : tree( nullptr ), num_items( 0 ), fixed_len( 0 ), coll_id( 0 )
+{
+}
+
+void gbtree_succinct::put_varint( string& out_bytes, uint32_t val )
+{
+    while ( val >= 0x80 )
+    {
+        out_bytes.push_back( char( 0x80 | ( val & 0x7f ) ) );
+        val >>= 7;
+    }
+    out_bytes.push_back( char( val ) );
+}
+
+uint32_t gbtree_succinct::get_varint( size_t& byte_off ) const
+{
+    uint32_t val = 0;
+    for ( int shft = 0; byte_off < item_bytes.size(); shft += 7 )
+    {
+        uint8_t in_byte = item_bytes[ byte_off++ ];
+        val |= uint32_t( in_byte & 0x7f ) << shft;
+        if ( ( in_byte & 0x80 ) == 0 ) break;
+    }
+    return val;
+}
+
+bool gbtree_succinct::shape_bit( size_t bit_idx ) const
+{
+    return ( shape_bits[ bit_idx >> 6 ] >> ( bit_idx & 63 ) ) & 1;
+}
+
+void gbtree_succinct::add_shape_bit( size_t bit_idx, bool is_open )
+{
+    put_shape_bit( shape_bits, bit_idx, is_open );
+}
+
+bool gbtree_succinct::build( gbtree& tree_hndl )
+{
+    tree = &tree_hndl;
+    num_items = 0;
+    shape_bits.clear();
+    bucket_off.clear();
+    item_bytes.clear();
+    fixed_len = 0;
+    coll_id = tree_hndl.get_collation_id();
+    coll_locale = tree_hndl.get_collation_locale();
+    //
+    // The in order walk writes the open of a node on the way down to its
+    //   left child and the close when it comes back up, which is when the
+    //   item is taken.
+    vector<string> items;
+    vector<int> walk_stk;
+    size_t bit_idx = 0;
+    int nd_id = tree_hndl.get_node( 0 ).get_child_right_idx();
+    while ( nd_id != 0 || !walk_stk.empty() )
+    {
+        while ( nd_id != 0 )
+        {
+            add_shape_bit( bit_idx++, true );
+            walk_stk.push_back( nd_id );
+            nd_id = tree_hndl.get_node( nd_id ).get_child_left_idx();
+        }
+        nd_id = walk_stk.back();
+        walk_stk.pop_back();
+        add_shape_bit( bit_idx++, false );
+        items.push_back( tree_hndl.get_node_key( nd_id ) );
+        if ( items.size() > 1 &&
+          tree_hndl.cmp_keys( items[ items.size() - 2 ], items.back() ) >= 0 )
+        {
+            errs << "gbtree_succinct::build() found the item of node " <<
+              nd_id << " out of order, so the archive was not made." << endl;
+            shape_bits.clear();
+            return false;
+        }
+        nd_id = tree_hndl.get_node( nd_id ).get_child_right_idx();
+    }
+    num_items = int( items.size() );
+
+    bool same_len = !items.empty();
+    for ( auto& item : items )
+      if ( item.size() != items[ 0 ].size() ) same_len = false;
+    if ( same_len )
+    {
+        fixed_len = items[ 0 ].size();
+        for ( auto& item : items ) item_bytes += item;
+        return true;
+    }
+    for ( int rank = 0; rank < num_items; rank++ )
+    {
+        const string& item = items[ rank ];
+        if ( rank % bucket_size == 0 )
+        {
+            bucket_off.push_back( item_bytes.size() );
+            put_varint( item_bytes, item.size() );
+            item_bytes += item;
+            continue;
+        }
+        const string& prev_item = items[ rank - 1 ];
+        size_t pfx_len = 0;
+        while ( pfx_len < item.size() && pfx_len < prev_item.size() &&
+          item[ pfx_len ] == prev_item[ pfx_len ] ) pfx_len++;
+        put_varint( item_bytes, pfx_len );
+        put_varint( item_bytes, item.size() - pfx_len );
+        item_bytes.append( item, pfx_len, string::npos );
+    }
+    return true;
+}
+
+bool gbtree_succinct::save( const string& file_name ) const
+{
+    ofstream out_file( file_name, ios::binary | ios::trunc );
+    if ( !out_file )
+    {
+        errs << "gbtree_succinct::save() could not open " << file_name <<
+          " for writing." << endl;
+        return false;
+    }
+    out_file.write( sccnt_magic, sccnt_magic_len );
+    uint32_t hdr[ 3 ] = { uint32_t( num_items ), fixed_len, coll_id };
+    out_file.write( reinterpret_cast<const char *>( hdr ), sizeof( hdr ) );
+    write_vec( out_file, vector<char>( coll_locale.begin(),
+      coll_locale.end() ) );
+    write_vec( out_file, shape_bits );
+    write_vec( out_file, bucket_off );
+    write_vec( out_file, vector<char>( item_bytes.begin(), item_bytes.end() ) );
+    return bool( out_file );
+}
+
+bool gbtree_succinct::load( const string& file_name, gbtree& tree_hndl )
+{
+    ifstream in_file( file_name, ios::binary );
+    char magic_in[ sccnt_magic_len ];
+    uint32_t hdr[ 3 ] = { 0, 0, 0 };
+    vector<char> locale_vec;
+    vector<char> item_vec;
+    bool read_ok = bool( in_file.read( magic_in, sccnt_magic_len ) );
+    string magic_str( magic_in, sccnt_magic_len );
+    bool is_v1 = read_ok && magic_str == sccnt_magic_v1;
+    bool has_locale = read_ok && magic_str == sccnt_magic;
+    read_ok = read_ok && ( is_v1 || has_locale ||
+      magic_str == sccnt_magic_v2 ) &&
+      in_file.read( reinterpret_cast<char *>( hdr ),
+      ( is_v1 ? 2 : 3 ) * sizeof( uint32_t ) ) &&
+      ( !has_locale || read_vec( in_file, locale_vec ) ) &&
+      read_vec( in_file, shape_bits ) && read_vec( in_file, bucket_off ) &&
+      read_vec( in_file, item_vec );
+    string arch_locale( locale_vec.begin(), locale_vec.end() );
+    if ( read_ok && hdr[ 2 ] != tree_hndl.get_collation_id() )
+    {
+        errs << "gbtree_succinct::load() found the archive " << file_name <<
+          " in collation " << hdr[ 2 ] << " order, but the record is set" <<
+          " to collation " << tree_hndl.get_collation_id() << "." << endl;
+        read_ok = false;
+    }
+    else if ( read_ok && has_locale &&
+      arch_locale != tree_hndl.get_collation_locale() )
+    {
+        errs << "gbtree_succinct::load() found the archive " << file_name <<
+          " in the order of the [" << arch_locale << "] locale, but the" <<
+          " record is in the order of the [" <<
+          tree_hndl.get_collation_locale() << "] locale." << endl;
+        read_ok = false;
+    }
+    else if ( !read_ok )
+      errs << "gbtree_succinct::load() could not read an archive from " <<
+      file_name << "." << endl;
+    if ( !read_ok )
+    {
+        num_items = 0;
+        shape_bits.clear();
+        bucket_off.clear();
+        item_bytes.clear();
+        return false;
+    }
+    tree = &tree_hndl;
+    num_items = hdr[ 0 ];
+    fixed_len = hdr[ 1 ];
+    coll_id = hdr[ 2 ];
+    coll_locale = has_locale ? arch_locale : tree_hndl.get_collation_locale();
+    item_bytes.assign( item_vec.begin(), item_vec.end() );
+    return true;
+}
+
+size_t gbtree_succinct::get_mem_bytes() const
+{
+    return shape_bits.size() * sizeof( uint64_t ) +
+      bucket_off.size() * sizeof( uint32_t ) + item_bytes.size();
+}
+
+string gbtree_succinct::bucket_head( int bucket_idx ) const
+{
+    size_t byte_off = bucket_off[ bucket_idx ];
+    uint32_t item_len = get_varint( byte_off );
+    return item_bytes.substr( byte_off, item_len );
+}
+
+bool gbtree_succinct::scan_start( scan_pos& pos ) const
+{
+    pos.rank = -1;
+    pos.byte_off = 0;
+    pos.key.clear();
+    return scan_next( pos );
+}
+
+bool gbtree_succinct::scan_next( scan_pos& pos ) const
+{
+    if ( pos.rank + 1 >= num_items ) return false;
+    pos.rank++;
+    if ( fixed_len != 0 )
+    {
+        pos.key.assign( item_bytes, pos.byte_off, fixed_len );
+        pos.byte_off += fixed_len;
+        return true;
+    }
+    size_t pfx_len = 0;
+    if ( pos.rank % bucket_size != 0 ) pfx_len = get_varint( pos.byte_off );
+    uint32_t sfx_len = get_varint( pos.byte_off );
+    pos.key.resize( pfx_len );
+    pos.key.append( item_bytes, pos.byte_off, sfx_len );
+    pos.byte_off += sfx_len;
+    return true;
+}
+
+string gbtree_succinct::key_at( int rank ) const
+{
+    if ( rank < 0 || rank >= num_items ) return "";
+    if ( fixed_len != 0 ) return item_bytes.substr( rank * fixed_len, fixed_len );
+    scan_pos pos = { rank - rank % bucket_size - 1,
+      bucket_off[ rank / bucket_size ], "" };
+    while ( pos.rank < rank ) scan_next( pos );
+    return pos.key;
+}
+
+int gbtree_succinct::find( const string& key ) const
+{
+    if ( num_items == 0 || tree == nullptr ) return -1;
+    if ( fixed_len != 0 )
+    {
+        if ( key.size() != fixed_len ) return -1;
+        int lo = 0;
+        int hi = num_items - 1;
+        while ( lo <= hi )
+        {
+            int mid = lo + ( hi - lo ) / 2;
+            int key_vs_item = tree->cmp_keys( key,
+              item_bytes.substr( size_t( mid ) * fixed_len, fixed_len ) );
+            if ( key_vs_item == 0 ) return mid;
+            if ( key_vs_item < 0 ) hi = mid - 1;
+            else lo = mid + 1;
+        }
+        return -1;
+    }
+    //
+    // Find the last bucket whose first item is not greater than the key,
+    //   then go through that bucket.
+    int lo = 0;
+    int hi = int( bucket_off.size() ) - 1;
+    int fnd_bucket = -1;
+    while ( lo <= hi )
+    {
+        int mid = lo + ( hi - lo ) / 2;
+        int key_vs_head = tree->cmp_keys( key, bucket_head( mid ) );
+        if ( key_vs_head == 0 ) return mid * bucket_size;
+        if ( key_vs_head < 0 ) hi = mid - 1;
+        else
+        {
+            fnd_bucket = mid;
+            lo = mid + 1;
+        }
+    }
+    if ( fnd_bucket < 0 ) return -1;
+    scan_pos pos = { fnd_bucket * bucket_size - 1, bucket_off[ fnd_bucket ], "" };
+    int bucket_end = min( num_items, ( fnd_bucket + 1 ) * bucket_size );
+    scan_next( pos );
+    while ( pos.rank + 1 < bucket_end && scan_next( pos ) )
+    {
+        int key_vs_item = tree->cmp_keys( key, pos.key );
+        if ( key_vs_item == 0 ) return pos.rank;
+        if ( key_vs_item < 0 ) break;
+    }
+    return -1;
+}
+
+void gbtree_succinct::get_shape( vector<int>& pre_ranks,
+  vector<int>& parent_ranks ) const
+{
+    //
+    // An open that follows an open is the left child of that node, and an
+    //   open that follows a close is the right child of the node that was
+    //   just closed, so last_pre is the parent either way.  The closes
+    //   come in the in order of the nodes.
+    pre_ranks.assign( num_items, -1 );
+    vector<int> parent_pre( num_items, -1 );
+    vector<int> open_stk;
+    int nxt_pre = 0;
+    int nxt_rank = 0;
+    int last_pre = -1;
+    for ( size_t bit_idx = 0; bit_idx < 2 * size_t( num_items ); bit_idx++ )
+    {
+        if ( shape_bit( bit_idx ) )
+        {
+            parent_pre[ nxt_pre ] = last_pre;
+            open_stk.push_back( nxt_pre );
+            last_pre = nxt_pre++;
+        }
+        else
+        {
+            last_pre = open_stk.back();
+            open_stk.pop_back();
+            pre_ranks[ last_pre ] = nxt_rank++;
+        }
+    }
+    parent_ranks.assign( num_items, -1 );
+    for ( int pre_idx = 0; pre_idx < num_items; pre_idx++ )
+      if ( parent_pre[ pre_idx ] >= 0 )
+        parent_ranks[ pre_idx ] = pre_ranks[ parent_pre[ pre_idx ] ];
+}
+
+gbtree_succinct_writer::gbtree_succinct_writer()
+  : fixed_len( 0 ), coll_id( 0 ), num_items( 0 ), items_len( 0 ),
+  write_ok( false )
+{
+}
+
+gbtree_succinct_writer::~gbtree_succinct_writer()
+{
+    if ( items_file.is_open() )
+    {
+        items_file.close();
+        remove( items_name.c_str() );
+    }
+}
+
+bool gbtree_succinct_writer::start( const string& file_name,
+  uint32_t item_len, uint32_t coll_set, const string& locale_set )
+{
+    if ( items_file.is_open() )
+    {
+        items_file.close();
+        remove( items_name.c_str() );
+    }
+    arch_name = file_name;
+    items_name = file_name + ".items";
+    fixed_len = item_len;
+    coll_id = coll_set;
+    coll_locale = locale_set;
+    num_items = 0;
+    items_len = 0;
+    bucket_off.clear();
+    prev_item.clear();
+    items_file.open( items_name, ios::binary | ios::trunc );
+    write_ok = bool( items_file );
+    if ( !write_ok )
+      errs << "gbtree_succinct_writer::start() could not open " <<
+      items_name << " for writing." << endl;
+    return write_ok;
+}
+
+bool gbtree_succinct_writer::add( const string& item )
+{
+    if ( !write_ok ) return false;
+    if ( fixed_len != 0 && item.size() != fixed_len )
+    {
+        errs << "gbtree_succinct_writer::add() was given an item of " <<
+          item.size() << " bytes for an archive of " << fixed_len <<
+          " byte items." << endl;
+        write_ok = false;
+        return false;
+    }
+    if ( num_items == UINT32_MAX || items_len > UINT32_MAX - item.size() - 10 )
+    {
+        errs << "gbtree_succinct_writer::add() has reached the limit of " <<
+          "the archive format." << endl;
+        write_ok = false;
+        return false;
+    }
+    string enc_item;
+    if ( fixed_len != 0 ) enc_item = item;
+    else if ( num_items % gbtree_succinct::bucket_size == 0 )
+    {
+        bucket_off.push_back( uint32_t( items_len ) );
+        gbtree_succinct::put_varint( enc_item, item.size() );
+        enc_item += item;
+    }
+    else
+    {
+        size_t pfx_len = 0;
+        while ( pfx_len < item.size() && pfx_len < prev_item.size() &&
+          item[ pfx_len ] == prev_item[ pfx_len ] ) pfx_len++;
+        gbtree_succinct::put_varint( enc_item, pfx_len );
+        gbtree_succinct::put_varint( enc_item, item.size() - pfx_len );
+        enc_item.append( item, pfx_len, string::npos );
+    }
+    items_file.write( enc_item.data(), enc_item.size() );
+    items_len += enc_item.size();
+    prev_item = item;
+    num_items++;
+    return true;
+}
+
+bool gbtree_succinct_writer::finish()
+{
+    if ( !items_file.is_open() ) return false;
+    items_file.close();
+    write_ok = write_ok && bool( items_file );
+    if ( write_ok )
+    {
+        vector<uint64_t> shape_bits;
+        size_t bit_idx = 0;
+        put_balanced_shape( shape_bits, bit_idx, num_items );
+        //
+        // An archive of all one length items is written without the
+        //   bucket offsets the same as build() does, and that includes an
+        //   empty one.
+        uint32_t hdr[ 3 ] = { num_items, fixed_len, coll_id };
+        ofstream out_file( arch_name, ios::binary | ios::trunc );
+        ifstream items_in( items_name, ios::binary );
+        out_file.write( sccnt_magic, sccnt_magic_len );
+        out_file.write( reinterpret_cast<const char *>( hdr ), sizeof( hdr ) );
+        write_vec( out_file, vector<char>( coll_locale.begin(),
+          coll_locale.end() ) );
+        write_vec( out_file, shape_bits );
+        write_vec( out_file, bucket_off );
+        out_file.write( reinterpret_cast<const char *>( &items_len ),
+          sizeof( items_len ) );
+        if ( items_len > 0 ) out_file << items_in.rdbuf();
+        write_ok = bool( out_file ) && bool( items_in );
+        if ( !write_ok )
+          errs << "gbtree_succinct_writer::finish() could not write " <<
+          arch_name << "." << endl;
+    }
+    remove( items_name.c_str() );
+    return write_ok;
+}
@@ -0,0 +1,170 @@
+//
+// The gbtree_succinct class holds a finished btree in a compact read only
+//   form for archiving the catalogs of old drives.  Once a drive is put
+//   away its catalog is only looked at now and then, so the size in
+//   memory and on disk counts for much more than the insert speed, and
+//   the records with their links and flags and the name store are far
+//   bigger than the items they hold.
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// The shape of the btree is kept as balanced parentheses, 2 bits a node.
+//   Each node is written as an open parenthesis, its left subtree, a close
+//   parenthesis and its right subtree.  The opens come in preorder and
+//   the closes in the in order of the nodes, so the shape can be walked
+//   with a stack to get back the whole btree, and a node has a left child
+//   when its open is followed by another open and a right child when its
+//   close is.
+//
+// The items are kept in their in order, which is the sorted order of the
+//   btree, so a lookup is a binary search and iterating is just reading
+//   them from the front.  When all of the items are the same length, as
+//   the digests of the hash records are, they are packed end to end with
+//   nothing else.  Otherwise they are front coded in buckets of
+//   bucket_size items.  The first item of a bucket is whole, and each of
+//   the others is the length of the prefix it shares with the item before
+//   it and the rest of the item, with the lengths as 7 bit varints.  The
+//   byte offset of each bucket is kept so the binary search only has to
+//   decode the first items of the buckets it looks at and then one bucket.
+//
+// The order of the items is the order of the record type, the collation
+//   the UTF-8 names are set to, so a lookup compares the keys with the
+//   cmp_keys() method of a record of the same type.  An archive read back
+//   with load() is given that record as well.  The get_collation_id() of
+//   the record is saved in the archive, and load() won't take a record
+//   whose order is set some other way, such as a UTF-8 name archive made
+//   in byte order being read back with the names in UCA order.  The
+//   get_collation_locale() is saved as well, since the strcoll() order
+//   of one locale is not that of another, and an archive of the names
+//   made in en_US.UTF-8 is not read back in da_DK.UTF-8.
+//
+// An archive can also be written straight from items that are already in
+//   order with the gbtree_succinct_writer class, without there being a
+//   btree of records at all, which is how the external memory ingest
+//   builds one for a catalog that is too big for the record vectors.  The
+//   items go to a side file as they come, and the shape is the balanced
+//   one for the number of items, so only the shape and the bucket offsets
+//   are held in memory until the end.
+//
+
+#ifndef GBTREE_SUCCINCT_H
+#define GBTREE_SUCCINCT_H
+
+#include "gbtree.h"
+#include <fstream>
+#include <vector>
+
+using namespace std;
+
+class gbtree_succinct
+{
+public:
+    static const int bucket_size = 16;
+    //
+    // A position in an in order scan of the items
+    struct scan_pos {
+        int rank;
+        size_t byte_off;
+        string key;
+    };
+
+private:
+    //
+    // The record handle is only used for its cmp_keys() method
+    gbtree *tree;
+    int num_items;
+    // The balanced parentheses, 1 for an open, from the low bit up
+    vector<uint64_t> shape_bits;
+    // 0 when the items are front coded
+    uint32_t fixed_len;
+    uint32_t coll_id;
+    string coll_locale;
+    vector<uint32_t> bucket_off;
+    string item_bytes;
+
+    static void put_varint( string& out_bytes, uint32_t val );
+    uint32_t get_varint( size_t& byte_off ) const;
+    bool shape_bit( size_t bit_idx ) const;
+    void add_shape_bit( size_t bit_idx, bool is_open );
+    string bucket_head( int bucket_idx ) const;
+
+    friend class gbtree_succinct_writer;
+
+public:
+    gbtree_succinct();
+    //
+    // Encodes the btree that tree_hndl is a record of
+    bool build( gbtree& tree_hndl );
+    bool save( const string& file_name ) const;
+    bool load( const string& file_name, gbtree& tree_hndl );
+    int size() const { return num_items; };
+    uint32_t get_collation_id() const { return coll_id; };
+    string get_collation_locale() const { return coll_locale; };
+    //
+    // The bytes used by the encoded shape and items, which is also about
+    //   the size of the saved file.
+    size_t get_mem_bytes() const;
+    //
+    // Returns the in order rank of the item equal to key, or -1 when there
+    //   isn't one.
+    int find( const string& key ) const;
+    string key_at( int rank ) const;
+    //
+    // The in order scan.  scan_start() gets the first item, and both
+    //   return false when there are no more items.
+    bool scan_start( scan_pos& pos ) const;
+    bool scan_next( scan_pos& pos ) const;
+    //
+    // Rebuilds the shape of the btree as the in order ranks of the nodes
+    //   in preorder, with the rank of the parent of each node.  The head
+    //   has a parent of -1.
+    void get_shape( vector<int>& pre_ranks, vector<int>& parent_ranks ) const;
+};
+
+//
+// Writes an archive file from items given in order.  The items must be in
+//   the order of the record type that will be given to load() and have no
+//   duplicates, and when item_len is not 0 they must all be that long.
+//   coll_id and coll_locale are the get_collation_id() and the
+//   get_collation_locale() of that record type.
+class gbtree_succinct_writer
+{
+    string arch_name;
+    string items_name;
+    ofstream items_file;
+    uint32_t fixed_len;
+    uint32_t coll_id;
+    string coll_locale;
+    uint32_t num_items;
+    uint64_t items_len;
+    vector<uint32_t> bucket_off;
+    string prev_item;
+    bool write_ok;
+
+public:
+    gbtree_succinct_writer();
+    ~gbtree_succinct_writer();
+    bool start( const string& file_name, uint32_t item_len,
+      uint32_t coll_set, const string& locale_set );
+    bool add( const string& item );
+    //
+    // Writes the archive file and removes the side file
+    bool finish();
+    uint32_t size() const { return num_items; };
+};
+
+#endif  //  GBTREE_SUCCINCT_H
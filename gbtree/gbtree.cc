@@ -26,7 +26,13 @@
 //   ar -Ptv ~/data/lib/libfoutil.a
 
 #include "gbtree.h"
+#include <algorithm>
 #include <iostream>
+#include <vector>
+
+#ifdef USEmerkle_dgst
+#include <openssl/evp.h>
+#endif  //  #ifdef USEmerkle_dgst
 
 #ifdef USEncurses
 #include "ncursio.h"
@@ -37,7 +43,12 @@ void atexit_handl_7()
     cout << "at exit handler number 7." << endl;
 }
 
-uint16_t gbtree::btree_level = 0;
+thread_local uint16_t gbtree::btree_level = 0;
+thread_local vector<int> gbtree::conc_held;
+thread_local bool gbtree::conc_search = false;
+#ifdef USEmerkle_dgst
+thread_local int gbtree::last_attached = 0;
+#endif  //  #ifdef USEmerkle_dgst
 
 #ifdef INFOdisplay
 uint16_t gbtree::lm_nm_str_sz = 20;
@@ -62,12 +73,18 @@ int gbtree::attach_to_leaf( int search_node_id )
         btree_parent = search_node_id;
         parent_is_self = 0;
         b_srch_cnt = 7;
+#ifdef USEorder_stats
+        bump_subtree_cnts( search_node_id );
+#endif  //  #ifdef USEorder_stats
     }
     else if ( new_no_parent )
     {
         btree_parent = search_node_id;
         new_no_parent = 0;  // This was the last place it was needed
         my_node_id = add_new_node();
+#ifdef USEorder_stats
+        bump_subtree_cnts( search_node_id );
+#endif  //  #ifdef USEorder_stats
     }
     else
     {
@@ -84,6 +101,9 @@ int gbtree::attach_to_leaf( int search_node_id )
 #endif  //  #ifdef INdevel    // Declarations for development only
 
     }
+#ifdef USEmerkle_dgst
+    last_attached = my_node_id;
+#endif  //  #ifdef USEmerkle_dgst
     return my_node_id;
 }
 
@@ -127,6 +147,14 @@ int gbtree::replace_node( int idx2replac )
     btree_child_right = node2replace.btree_child_right;
     b_srch_cnt = node2replace.b_srch_cnt;
     verify_base_srch_var = node2replace.verify_base_srch_var;
+#ifdef USEorder_stats
+    //
+    // The replacing node takes over the subtree of the replaced one, which
+    //   gets one more node when the replaced node finds its new place
+    //   below and the counts up the path are bumped.
+    subtree_cnt = node2replace.subtree_cnt;
+    node2replace.subtree_cnt = 1;
+#endif  //  #ifdef USEorder_stats
     //
     // The parent situation is dependent on the status of the replacing
     //   node.  If it is an existing node, it will have the parent_is_self
@@ -176,6 +204,10 @@ int gbtree::replace_node( int idx2replac )
       ", and replacing_node_id is " << replacing_node_id << "." << endl;
 #endif // #ifdef INdevel
 
+    //
+    // A concurrent writer takes the lock of the replacing node before it
+    //   is linked in, so the other writers will wait for it to be done.
+    conc_take( replacing_node_id );
     gbtree& replacing_node = get_node( replacing_node_id ); // In the fail
                         // condition, a reference to the maximum node index
                         // is returned with an error flag set
@@ -192,10 +224,22 @@ int gbtree::replace_node( int idx2replac )
     node2replace.btree_child_right = 0;
     node2replace.b_srch_cnt = 0;  // GGG - I think this should be set to 7 ??
         // but it doesn't make any difference until the related code is written
-    if ( replacing_node.btree_child_left != 0 ) get_node(
-      replacing_node.btree_child_left ).btree_parent = replacing_node_id;
-    if ( replacing_node.btree_child_right != 0 ) get_node(
-      replacing_node.btree_child_right ).btree_parent = replacing_node_id;
+    //
+    // The children are locked by a concurrent writer before their parent
+    //   links are changed, since a writer that is further down may be
+    //   changing their child links.
+    if ( replacing_node.btree_child_left != 0 )
+    {
+        conc_take( replacing_node.btree_child_left );
+        get_node( replacing_node.btree_child_left ).btree_parent =
+          replacing_node_id;
+    }
+    if ( replacing_node.btree_child_right != 0 )
+    {
+        conc_take( replacing_node.btree_child_right );
+        get_node( replacing_node.btree_child_right ).btree_parent =
+          replacing_node_id;
+    }
     if ( replacing_node.rt_chld_flg ) get_node(
       replacing_node.btree_parent ).btree_child_right = replacing_node_id;
     else get_node( replacing_node.btree_parent ).btree_child_left =
@@ -207,12 +251,24 @@ int gbtree::replace_node( int idx2replac )
       replacing_node_id << " after processing the node2replace." << endl;
 #endif // #ifdef INdevel
 
+    //
+    // This is done before node2replace goes on with its search, since a
+    //   concurrent writer no longer holds the lock of the replacing node
+    //   once node2replace has gone further down.
+    replacing_node.verify_base_srch_var = 0;
     if ( node2replace.rt_chld_flg )
     {
         if ( replacing_node.btree_child_right == 0 )
         {
             replacing_node.btree_child_right = idx2replac;
             node2replace.btree_parent = replacing_node_id;
+            node2replace.parent_is_self = 0;
+#ifdef USEorder_stats
+            bump_subtree_cnts( replacing_node_id );
+#endif  //  #ifdef USEorder_stats
+#ifdef USEmerkle_dgst
+            last_attached = idx2replac;
+#endif  //  #ifdef USEmerkle_dgst
             //
             // GGG - Needed for btree graph - At this point, the
             //   idx2replac node is placed at its destination.
@@ -235,6 +291,7 @@ int gbtree::replace_node( int idx2replac )
             // GGG - Needed for btree graph - At this point, the
             //   idx2replac node is sent to the next level.
             btree_level++;
+            conc_hand_over( replacing_node_id, replacing_node.btree_child_right );
             node2replace.find_my_place( replacing_node.btree_child_right );
         }
     }
@@ -244,6 +301,13 @@ int gbtree::replace_node( int idx2replac )
         {
             replacing_node.btree_child_left = idx2replac;
             node2replace.btree_parent = replacing_node_id;
+            node2replace.parent_is_self = 0;
+#ifdef USEorder_stats
+            bump_subtree_cnts( replacing_node_id );
+#endif  //  #ifdef USEorder_stats
+#ifdef USEmerkle_dgst
+            last_attached = idx2replac;
+#endif  //  #ifdef USEmerkle_dgst
             //
             // GGG - Needed for btree graph - At this point, the
             //   idx2replac node is placed at its destination.
@@ -266,11 +330,14 @@ int gbtree::replace_node( int idx2replac )
             // GGG - Needed for btree graph - At this point, the
             //   idx2replac node is sent to the next level.
             btree_level++;
+            conc_hand_over( replacing_node_id, replacing_node.btree_child_left );
             node2replace.find_my_place( replacing_node.btree_child_left );
         }
     }
-    replacing_node.verify_base_srch_var = 0;
-    node2replace.parent_is_self = 0;
+    //
+    // The flag is already clear once node2replace has found its place, and
+    //   by then another concurrent writer may hold its lock.
+    if ( !conc_search ) node2replace.parent_is_self = 0;
     return replacing_node_id;
 }
 
@@ -297,13 +364,17 @@ int gbtree::find_my_place( int init_srch_node )
     int cur_node_id = init_srch_node;
     bool searching = true;
     int found_index = 0;
+    //
+    // The search key of this record is made once here for the compares
+    //   of all of the levels of the searching while loop below.
+    push_search_key( parent_is_self ? get_parent_idx() : -1 );
 
 #ifdef INFOdisplay  //  {
     //
     // GGG - Push this name string onto the name string vector stack to
-    //   be used for the necessary display and compares instead of
-    //   continually looking it up multiple times for each pass of the
-    //   searching while loop below.
+    //   be used for the necessary display instead of continually looking
+    //   it up multiple times for each pass of the searching while loop
+    //   below.
 #ifdef INdevel    // Declarations for development only
     bool first_out = true;
   if ( dbgf.a4 )
@@ -318,7 +389,8 @@ int gbtree::find_my_place( int init_srch_node )
   }
 #endif // #ifdef INdevel
 
-    push_name_struct( parent_is_self ? get_parent_idx() : -1 );
+    if ( show_search_info() )
+      push_name_struct( parent_is_self ? get_parent_idx() : -1 );
 
 #ifdef INdevel    // Declarations for development only
   if ( dbgf.a4 )
@@ -358,6 +430,7 @@ int gbtree::find_my_place( int init_srch_node )
             // exit( 1 );
 #endif // #ifdef INdevel
 
+            pop_search_key();
             return -1;
         }
 
@@ -391,15 +464,18 @@ int gbtree::find_my_place( int init_srch_node )
         //   level and needs initialized for the current condition
 
 #ifdef INFOdisplay
-        string id_strng;
-        if ( new_no_parent ) id_strng = "new";
-        else if ( parent_is_self )
+        if ( show_search_info() )
         {
-            id_strng = to_string( get_parent_idx() );
+            string id_strng;
+            if ( new_no_parent ) id_strng = "new";
+            else if ( parent_is_self )
+            {
+                id_strng = to_string( get_parent_idx() );
+            }
+            int16_t tmp = id_str_siz - id_strng.size();
+            if ( tmp > 0 ) id_strng.insert( 0, tmp, ' ' );
+            get_name_io( id_strng );
         }
-        int16_t tmp = id_str_siz - id_strng.size();
-        if ( tmp > 0 ) id_strng.insert( 0, tmp, ' ' );
-        get_name_io( id_strng );
 #endif // #ifdef INFOdisplay
 
         int base_search_var_result = node_rcrd.set_base_srch_var();
@@ -408,7 +484,7 @@ int gbtree::find_my_place( int init_srch_node )
         //
         // Send the line just built by get_name_io and set_base_srch_var
         //   and then hold it in case a test below needs to edit it.
-        bsvistrm << info_add << endl;
+        if ( show_search_info() ) bsvistrm << info_add << endl;
         if ( bsv_carry )
         {
             errs << bsv_note;
@@ -565,6 +641,7 @@ int gbtree::find_my_place( int init_srch_node )
                     //   searching node is sent to the next level.
                     node_rcrd.asn_cur_search_node = 0;
                     node_rcrd.verify_base_srch_var = 0;
+                    conc_hand_over( cur_node_id, nodrec_lfchld );
                     cur_node_id = nodrec_lfchld;
                     btree_level++;
                 }
@@ -653,6 +730,7 @@ int gbtree::find_my_place( int init_srch_node )
                     //   searching node is sent to the next level.
                     node_rcrd.asn_cur_search_node = 0;
                     node_rcrd.verify_base_srch_var = 0;
+                    conc_hand_over( cur_node_id, nodrec_rtchld );
                     cur_node_id = nodrec_rtchld;
                     btree_level++;
                 }
@@ -738,6 +816,7 @@ int gbtree::find_my_place( int init_srch_node )
                     //   searching node is sent to the next level.
                     node_rcrd.asn_cur_search_node = 0;
                     node_rcrd.verify_base_srch_var = 0;
+                    conc_hand_over( cur_node_id, nodrec_lfchld );
                     cur_node_id = nodrec_lfchld;
                     btree_level++;
                 }
@@ -754,7 +833,7 @@ int gbtree::find_my_place( int init_srch_node )
         }
 
 #ifdef USEncurses
-        if (foiorf != nullptr ) foiorf->manage_debug_win();
+        if ( foiorf != nullptr && !conc_search ) foiorf->manage_debug_win();
 #endif   //  #ifdef USEncurses
 
     }
@@ -774,7 +853,7 @@ int gbtree::find_my_place( int init_srch_node )
   }
 #endif // #ifdef INdevel
 
-    pop_name_struct();
+    if ( show_search_info() ) pop_name_struct();
 
 #ifdef INdevel    // Declarations for development only
   if ( dbgf.a4 )
@@ -791,14 +870,16 @@ int gbtree::find_my_place( int init_srch_node )
 #endif // #ifdef INdevel
 #endif // #ifdef INFOdisplay  }
 
+    pop_search_key();
     return found_index;
 }
 
 #ifdef INFOdisplay
 string gbtree::bsv_note = "";
 bool gbtree::bsv_carry = false;
+bool gbtree::search_info_on = true;
 
-void gbtree::do_node_info_update( int nde_id, string updat_str,
+void gbtree::do_node_info_update( int nde_id, const char *updat_txt,
   bool replaced_node2leaf )
 {
     // This will update the pattern string saved earlier at static var
@@ -827,6 +908,11 @@ void gbtree::do_node_info_update( int nde_id, string updat_str,
     //           01234567890123456789012345678901234567890
     //             > sam4cmp         3 nldbl-fprintf.c
     //
+    // The info display is not thread safe, so the concurrent writers
+    //   leave it out, and it is also left out when the search lines are.
+    //   The update text is only made into a string past this point.
+    if ( !show_search_info() ) return;
+    string updat_str = updat_txt;
     str_utf8 info_st( info_add, info_add.size(), fit_wht_trim );
     string& info_cp = info_st.target;
     const index_vec& inf_vec = info_st.get_idxvec();
@@ -988,8 +1074,14 @@ void gbtree::traverse_records()
           counter << endl;
 #endif  //  #ifdef INdevel
 
+        //
+        // The display line is wanted here even when the search lines are
+        //   left out.
+        bool info_was_on = search_info_on;
+        search_info_on = true;
         info_add = " ";
         int sbsv_result = set_base_srch_var();
+        search_info_on = info_was_on;
         bsv_test_disp << info_add;
         info_add = "";
 
@@ -1125,6 +1217,9 @@ gbtree::gbtree()
     b_srch_cnt = 7;     // 7 indicates that the base search string needs work
     spare24flg = 0;  // This is a spare for now
     btree_child_right = 0;
+#ifdef USEorder_stats
+    subtree_cnt = 1;
+#endif  //  #ifdef USEorder_stats
 }
 
 int gbtree::get_level()
@@ -1156,6 +1251,8 @@ int gbtree::place_new_node()
     // Initialize the variables that must be maintained throughout
     //   the search process
     // GGG - There may need to be more variables added to this list
+    int alt_id;
+    if ( alt_index_place( alt_id ) ) return alt_id;
     btree_level = 1;
     gbtree& base_parent = get_node( 0 );
     if ( base_parent.btree_child_right == 0 )
@@ -1169,11 +1266,14 @@ int gbtree::place_new_node()
         btree_parent = 0;
 
 #ifdef INFOdisplay
-        base_parent.push_name_struct( 0 );
-        iout << "The " << get_type_strng() <<
-          " base parent display name is [" <<
-          get_rcrd_display_name().target << "]." << endl;
-        base_parent.pop_name_struct();
+        if ( !conc_search )
+        {
+            base_parent.push_name_struct( 0 );
+            iout << "The " << get_type_strng() <<
+              " base parent display name is [" <<
+              get_rcrd_display_name().target << "]." << endl;
+            base_parent.pop_name_struct();
+        }
 #endif  //  #ifdef INFOdisplay
 
         rt_chld_flg = 1;
@@ -1189,7 +1289,12 @@ int gbtree::place_new_node()
         //  errs << "This is a test to see if errs will be displayed!" << endl;
 #endif // #ifdef INdevel
 
+#ifdef USEmerkle_dgst
+        if ( !conc_search ) refresh_merkle_path( base_parent.btree_child_right );
+#endif  //  #ifdef USEmerkle_dgst
+
 #ifdef INFOdisplay
+        if ( conc_search ) return base_parent.btree_child_right;
         push_name_struct( base_parent.btree_child_right );
         if ( pflg.play_back_names_read )
         {
@@ -1254,16 +1359,26 @@ int gbtree::place_new_node()
         return 0;
     }
     int search_node_idx = base_parent.btree_child_right;
+    conc_take( search_node_idx );
     //
     // OK, all set up so call the generic node placement method which
     //   can find the proper place for either new records or replaced
     //   records.
 
 #ifdef USEncurses
-    if (foiorf != nullptr ) foiorf->manage_debug_win();
+    if ( foiorf != nullptr && !conc_search ) foiorf->manage_debug_win();
 #endif   //  #ifdef USEncurses
 
+#ifdef USEmerkle_dgst
+    last_attached = 0;
+#endif  //  #ifdef USEmerkle_dgst
     int found_index = find_my_place( search_node_idx );
+#ifdef USEmerkle_dgst
+    //
+    // A duplicate doesn't attach anything, and the concurrent writers
+    //   would need the locks of the whole path.
+    if ( !conc_search && last_attached > 0 ) refresh_merkle_path( last_attached );
+#endif  //  #ifdef USEmerkle_dgst
 
 #ifdef INdevel    // Declarations for development only
     if ( dbgf.b1 ) dbgs << "Finished finding a place for found_index = " <<
@@ -1286,7 +1401,7 @@ bool test_bsv_debug = false;
 void gbtree::test_bsv_compute( int nlvl )
 {
     static string position = "";
-    static int counter = 0;
+    static long counter = 0;
     counter++;
 
 #ifdef INdevel
@@ -1294,10 +1409,14 @@ void gbtree::test_bsv_compute( int nlvl )
       dbgs << "Entered test_bsv_compute() with counter = " << counter << endl;
 #endif  //  #ifdef INdevel
 
-    if ( counter > 20000 )
+    //
+    // Each position is visited once, and there are twice as many on each
+    //   level as on the one above it.
+    long max_count = 2L << min( nlvl, 40 );
+    if ( counter > max_count )
     {
-        my_exit_msg = "test_bsv_compute exceeded the max count of 10000 so "
-          "exiting the program.";
+        my_exit_msg = "test_bsv_compute exceeded the max count of " +
+          to_string( max_count ) + " so exiting the program.";
         myexit();
     }
     if ( btree_level > 0 )
@@ -1315,8 +1434,12 @@ void gbtree::test_bsv_compute( int nlvl )
           counter << endl;
 #endif  //  #ifdef INdevel
 
+        // The display line is wanted, as in traverse_records()
+        bool info_was_on = search_info_on;
+        search_info_on = true;
         info_add = " ";
         set_base_srch_var();
+        search_info_on = info_was_on;
         bsv_test_disp << info_add;
         info_add = "";
 
@@ -1400,6 +1523,333 @@ void gbtree::test_bsv_compute( int nlvl )
 }
 #endif // #ifdef INFOdisplay
 
+int gbtree::walk_bsv_chain( int lvl, bool right_chld )
+{
+    //
+    // The first node is the one above the head, with both child links of
+    //   each node going to the node of the next level.
+    static vector<int> chain_ids;
+    while ( chain_ids.size() <= static_cast<size_t>( lvl ) )
+    {
+        int nxt_idx = add_new_node();
+        if ( !chain_ids.empty() )
+        {
+            get_node( nxt_idx ).btree_parent = chain_ids.back();
+            gbtree& parent_node = get_node( chain_ids.back() );
+            parent_node.btree_child_left = nxt_idx;
+            parent_node.btree_child_right = nxt_idx;
+        }
+        chain_ids.push_back( nxt_idx );
+    }
+    gbtree& lvl_node = get_node( chain_ids[ lvl ] );
+    lvl_node.rt_chld_flg = right_chld ? 1 : 0;
+    if ( lvl == 1 ) prep4search();
+    btree_level = lvl;
+    lvl_node.set_base_srch_var();
+#ifdef INFOdisplay
+    // Nothing is shown for the walk
+    info_add = "";
+#endif // #ifdef INFOdisplay
+    return chain_ids[ lvl ];
+}
+
+bool gbtree::set_bsv_pin( const string& path, int node_id )
+{
+    //
+    // Record types that compute their base search variable purely from
+    //   the btree position (the hash types for example) have no use for
+    //   pinned values, so they just keep this default.
+    return false;
+}
+
+bool gbtree::move_records( const vector<int>& new_order,
+  vector<int>& new_id_of )
+{
+    return false;
+}
+
+#ifdef USEmerkle_dgst
+bool gbtree::keep_merkle_dgsts( bool keep )
+{
+    return false;
+}
+
+merkle_dgst_type *gbtree::get_merkle_slot( int node_idx )
+{
+    return nullptr;
+}
+#endif  //  #ifdef USEmerkle_dgst
+
+void gbtree::get_depth_stats( int& num_nodes, int& max_depth,
+  double& avg_depth )
+{
+    //
+    // A plain depth first walk using a local stack of node IDs and their
+    //   levels so that very deep trees don't run out of call stack.
+    num_nodes = 0;
+    max_depth = 0;
+    avg_depth = 0.0;
+    double level_sum = 0.0;
+    vector<pair<int, int> > walk_stk;
+    int head_id = get_node( 0 ).btree_child_right;
+    if ( head_id != 0 ) walk_stk.emplace_back( head_id, 1 );
+    while ( !walk_stk.empty() )
+    {
+        int nd_id = walk_stk.back().first;
+        int nd_lvl = walk_stk.back().second;
+        walk_stk.pop_back();
+        gbtree& nd_rcrd = get_node( nd_id );
+        num_nodes++;
+        level_sum += nd_lvl;
+        if ( nd_lvl > max_depth ) max_depth = nd_lvl;
+        if ( nd_rcrd.btree_child_left != 0 )
+          walk_stk.emplace_back( int( nd_rcrd.btree_child_left ), nd_lvl + 1 );
+        if ( nd_rcrd.btree_child_right != 0 )
+          walk_stk.emplace_back( int( nd_rcrd.btree_child_right ), nd_lvl + 1 );
+    }
+    if ( num_nodes > 0 ) avg_depth = level_sum / num_nodes;
+}
+
+int gbtree::find_node( const string& key )
+{
+    int alt_id;
+    if ( alt_index_find( key, alt_id ) ) return alt_id;
+    int cur_node_id = get_node( 0 ).btree_child_right;
+    while ( cur_node_id != 0 )
+    {
+        int key_vs_node = cmp_key2node( key, cur_node_id );
+        if ( key_vs_node == 0 ) break;
+        gbtree& node_rcrd = get_node( cur_node_id );
+        cur_node_id = key_vs_node < 0 ? node_rcrd.btree_child_left :
+          node_rcrd.btree_child_right;
+    }
+    return cur_node_id;
+}
+
+void gbtree::prefetch_node( int node_idx )
+{
+    //
+    // get_node() only works out the address, so it doesn't touch the
+    //   record itself.
+    __builtin_prefetch( &get_node( node_idx ) );
+}
+
+void gbtree::find_nodes( const vector<string>& keys, vector<int>& found,
+  int batch_size )
+{
+    found.assign( keys.size(), 0 );
+    int alt_id;
+    if ( !keys.empty() && alt_index_find( keys[ 0 ], alt_id ) )
+    {
+        for ( size_t idx = 0; idx < keys.size(); idx++ )
+          alt_index_find( keys[ idx ], found[ idx ] );
+        return;
+    }
+    if ( batch_size < 1 ) batch_size = 1;
+    int head_id = get_node( 0 ).btree_child_right;
+    vector<int> cur_node( batch_size );
+    vector<int> live_keys( batch_size );
+    for ( size_t batch_start = 0; batch_start < keys.size();
+      batch_start += batch_size )
+    {
+        int num_live = int( min( keys.size() - batch_start,
+          size_t( batch_size ) ) );
+        for ( int idx = 0; idx < num_live; idx++ )
+        {
+            cur_node[ idx ] = head_id;
+            live_keys[ idx ] = batch_start + idx;
+        }
+        if ( head_id == 0 ) num_live = 0;
+        else prefetch_node( head_id );
+        //
+        // Each pass takes every search that is still going one level down.
+        //   The searches that are done are dropped by moving the last one
+        //   into their place, so a pass only looks at the live ones.
+        while ( num_live > 0 )
+        {
+            int idx = 0;
+            while ( idx < num_live )
+            {
+                int key_idx = live_keys[ idx ];
+                int node_id = cur_node[ idx ];
+                int key_vs_node = cmp_key2node( keys[ key_idx ], node_id );
+                gbtree& node_rcrd = get_node( node_id );
+                int nxt_id = key_vs_node < 0 ? node_rcrd.btree_child_left :
+                  node_rcrd.btree_child_right;
+                if ( key_vs_node == 0 || nxt_id == 0 )
+                {
+                    if ( key_vs_node == 0 ) found[ key_idx ] = node_id;
+                    num_live--;
+                    live_keys[ idx ] = live_keys[ num_live ];
+                    cur_node[ idx ] = cur_node[ num_live ];
+                    continue;
+                }
+                prefetch_node( nxt_id );
+                cur_node[ idx ] = nxt_id;
+                idx++;
+            }
+        }
+    }
+}
+
+int gbtree::place_new_node_conc()
+{
+    if ( !supports_conc_writers() )
+    {
+        errs << "place_new_node_conc() was called for a record type that "
+          "does not support concurrent writers." << endl;
+        return 0;
+    }
+    //
+    // The base parent record is locked first since the head of the tree
+    //   can be replaced.  From there the locks are passed down the search
+    //   path by find_my_place() and replace_node().
+    conc_search = true;
+    conc_take( 0 );
+    int found_index = place_new_node();
+    conc_release_all();
+    conc_search = false;
+    return found_index;
+}
+
+void gbtree::conc_take( int node_id )
+{
+    if ( !conc_search ) return;
+    for ( int held_id : conc_held ) if ( held_id == node_id ) return;
+    lock_node( node_id );
+    conc_held.push_back( node_id );
+}
+
+void gbtree::conc_hand_over( int cur_node_id, int nxt_node_id )
+{
+    if ( !conc_search ) return;
+    conc_take( nxt_node_id );
+    size_t keep_cnt = 0;
+    for ( size_t idx = 0; idx < conc_held.size(); idx++ )
+    {
+        int held_id = conc_held[ idx ];
+        if ( held_id == cur_node_id || held_id == nxt_node_id )
+          conc_held[ keep_cnt++ ] = held_id;
+        else unlock_node( held_id );
+    }
+    conc_held.resize( keep_cnt );
+}
+
+void gbtree::conc_release_all()
+{
+    for ( int held_id : conc_held ) unlock_node( held_id );
+    conc_held.clear();
+}
+
+#ifdef USEorder_stats
+void gbtree::bump_subtree_cnts( int node_id )
+{
+    //
+    // The walk up would need the locks of all of the ancestors, so the
+    //   concurrent writers leave the counts to recount_subtrees().
+    if ( conc_search ) return;
+    while ( node_id != 0 )
+    {
+        gbtree& node_rcrd = get_node( node_id );
+        node_rcrd.subtree_cnt++;
+        node_id = node_rcrd.btree_parent;
+    }
+}
+
+int gbtree::get_subtree_cnt()
+{
+    return subtree_cnt;
+}
+
+int gbtree::get_item_cnt()
+{
+    int head_id = get_node( 0 ).btree_child_right;
+    return head_id == 0 ? 0 : get_node( head_id ).subtree_cnt;
+}
+
+int gbtree::count_below( const string& key, bool or_equal )
+{
+    //
+    // The in order sequence of the btree is sorted, so this is the usual
+    //   descent where every step to the right passes over the left
+    //   subtree and the node itself.
+    int below_cnt = 0;
+    int cur_node_id = get_node( 0 ).btree_child_right;
+    while ( cur_node_id != 0 )
+    {
+        gbtree& node_rcrd = get_node( cur_node_id );
+        int key_vs_node = cmp_key2node( key, cur_node_id );
+        if ( key_vs_node > 0 || ( or_equal && key_vs_node == 0 ) )
+        {
+            below_cnt += 1 + ( node_rcrd.btree_child_left == 0 ? 0 :
+              get_node( node_rcrd.btree_child_left ).subtree_cnt );
+            cur_node_id = node_rcrd.btree_child_right;
+        }
+        else cur_node_id = node_rcrd.btree_child_left;
+    }
+    return below_cnt;
+}
+
+int gbtree::rank( const string& key )
+{
+    return count_below( key, false );
+}
+
+int gbtree::select( int kth )
+{
+    int cur_node_id = get_node( 0 ).btree_child_right;
+    while ( cur_node_id != 0 )
+    {
+        gbtree& node_rcrd = get_node( cur_node_id );
+        int left_cnt = node_rcrd.btree_child_left == 0 ? 0 :
+          get_node( node_rcrd.btree_child_left ).subtree_cnt;
+        if ( kth < left_cnt ) cur_node_id = node_rcrd.btree_child_left;
+        else if ( kth == left_cnt ) return cur_node_id;
+        else
+        {
+            kth -= left_cnt + 1;
+            cur_node_id = node_rcrd.btree_child_right;
+        }
+    }
+    return 0;
+}
+
+void gbtree::recount_subtrees()
+{
+    //
+    // A post order walk, so the children are counted before the parent
+    vector<pair<int, bool> > walk_stk;
+    int head_id = get_node( 0 ).btree_child_right;
+    if ( head_id != 0 ) walk_stk.emplace_back( head_id, false );
+    while ( !walk_stk.empty() )
+    {
+        int nd_id = walk_stk.back().first;
+        gbtree& nd_rcrd = get_node( nd_id );
+        if ( !walk_stk.back().second )
+        {
+            walk_stk.back().second = true;
+            if ( nd_rcrd.btree_child_left != 0 )
+              walk_stk.emplace_back( int( nd_rcrd.btree_child_left ), false );
+            if ( nd_rcrd.btree_child_right != 0 )
+              walk_stk.emplace_back( int( nd_rcrd.btree_child_right ), false );
+            continue;
+        }
+        walk_stk.pop_back();
+        nd_rcrd.subtree_cnt = 1 +
+          ( nd_rcrd.btree_child_left == 0 ? 0 :
+          get_node( nd_rcrd.btree_child_left ).subtree_cnt ) +
+          ( nd_rcrd.btree_child_right == 0 ? 0 :
+          get_node( nd_rcrd.btree_child_right ).subtree_cnt );
+    }
+}
+
+int gbtree::count_range( const string& lo_key, const string& hi_key )
+{
+    int range_cnt = count_below( hi_key, true ) - count_below( lo_key, false );
+    return range_cnt > 0 ? range_cnt : 0;
+}
+#endif  //  #ifdef USEorder_stats
+
 int gbtree::get_rt_child_flg()
 {
     return rt_chld_flg;
@@ -1435,3 +1885,73 @@ int gbtree::get_new_no_parent()
     return new_no_parent;
 }
 
+#ifdef USEmerkle_dgst
+void gbtree::calc_merkle_dgst( int node_id )
+{
+    //
+    // The digest is of the length of the item as 4 big endian bytes, the
+    //   item, and then the digests of the left and right children, which
+    //   are all zero for a missing child.  The length keeps the item from
+    //   running into the child digests.
+    gbtree& node_rcrd = get_node( node_id );
+    string node_key = get_node_key( node_id );
+    string dgst_input;
+    uint32_t key_len = node_key.size();
+    for ( int shft = 24; shft >= 0; shft -= 8 )
+      dgst_input.push_back( char( key_len >> shft ) );
+    dgst_input += node_key;
+    for ( int chld_id : { int( node_rcrd.btree_child_left ),
+      int( node_rcrd.btree_child_right ) } )
+    {
+        merkle_dgst_type chld_dgst{};
+        if ( chld_id != 0 ) chld_dgst = *get_merkle_slot( chld_id );
+        dgst_input.append( reinterpret_cast<const char *>( chld_dgst.data() ),
+          chld_dgst.size() );
+    }
+    //
+    // The slot is asked for last since asking can grow the storage, which
+    //   would leave an earlier pointer dangling.
+    EVP_Digest( dgst_input.data(), dgst_input.size(),
+      get_merkle_slot( node_id )->data(), nullptr, EVP_md5(), nullptr );
+}
+
+void gbtree::calc_merkle_subtree( int sub_root )
+{
+    if ( sub_root == 0 || get_merkle_slot( sub_root ) == nullptr ) return;
+    gbtree& sub_rcrd = get_node( sub_root );
+    calc_merkle_subtree( sub_rcrd.btree_child_left );
+    calc_merkle_subtree( sub_rcrd.btree_child_right );
+    calc_merkle_dgst( sub_root );
+}
+
+void gbtree::refresh_merkle_path( int node_id )
+{
+    if ( node_id == 0 || get_merkle_slot( node_id ) == nullptr ) return;
+    while ( node_id != 0 )
+    {
+        calc_merkle_dgst( node_id );
+        node_id = get_node( node_id ).btree_parent;
+    }
+}
+
+bool gbtree::start_merkle_dgsts()
+{
+    if ( !keep_merkle_dgsts( true ) ) return false;
+    calc_merkle_subtree( get_node( 0 ).btree_child_right );
+    return true;
+}
+
+void gbtree::stop_merkle_dgsts()
+{
+    keep_merkle_dgsts( false );
+}
+
+bool gbtree::get_merkle_dgst( int node_idx, merkle_dgst_type& dgst )
+{
+    if ( node_idx == 0 ) return false;
+    merkle_dgst_type *node_dgst = get_merkle_slot( node_idx );
+    if ( node_dgst == nullptr ) return false;
+    dgst = *node_dgst;
+    return true;
+}
+#endif  //  #ifdef USEmerkle_dgst
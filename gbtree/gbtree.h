@@ -72,7 +72,9 @@ using namespace std;
 #include "fo-utils.h"
 #endif  //  defined (INFOdisplay) || defined (INdevel)
 
+#include <array>
 #include <cstdint>
+#include <vector>
 
 // If the number bar28 is subtracted from one of the three node IDs (I. E. -
 //   See the bit field declarations below for 28 bit uint32_t variables)
@@ -82,9 +84,28 @@ using namespace std;
 const int bar28 = 0x10000000;
 const int maxid = 0x0ffffbff;  // 268,434,431 decimal
 
+#ifdef USEmerkle_dgst
+// The subtree digests are MD5 digests, see gbtree-merkle.h
+typedef array<unsigned char, 16> merkle_dgst_type;
+#endif  //  #ifdef USEmerkle_dgst
+
 class gbtree
 {
-    static uint16_t btree_level;
+    //
+    // The rebalancer needs to read and rewrite the child and parent links
+    //   of whole subtrees, so it is given access to the private members.
+    friend class gbtree_rebalancer;
+    // The same goes for the renumbering of gbtree-defrag.h
+    friend class gbtree_defrag;
+
+    //
+    // The search level is kept for each thread so that the writer threads
+    //   of place_new_node_conc() each have their own.
+    static thread_local uint16_t btree_level;
+    //
+    // The node locks held by this thread while it is placing a node with
+    //   place_new_node_conc().
+    static thread_local vector<int> conc_held;
 
     //
     // There may be a question about why to do this bit field stuff.  The
@@ -121,14 +142,51 @@ class gbtree
     uint32_t b_srch_cnt : 3;
     uint32_t spare24flg : 1;
     uint32_t btree_child_right : 28;
+#ifdef USEorder_stats
+    //
+    // The number of nodes in the subtree headed by this node including
+    //   itself.  It is kept by attach_to_leaf() and replace_node() so the
+    //   order statistics methods below can work in a single pass down the
+    //   tree.  On 64 bit builds it mostly fits in the space left after
+    //   the bit fields and the virtual table pointer.
+    uint32_t subtree_cnt;
+#endif  //  #ifdef USEorder_stats
 
     //
     // Move these methods to be private as only class members should be
     //   calling the methods.
     int attach_to_leaf( int search_node_id );
     int replace_node( int node_idx );
+#ifdef USEorder_stats
+    // Adds one to the subtree_cnt of node_id and all of its ancestors
+    void bump_subtree_cnts( int node_id );
+    // Number of nodes that are less than the key, or not greater than the
+    //   key when or_equal is true
+    int count_below( const string& key, bool or_equal );
+#endif  //  #ifdef USEorder_stats
+#ifdef USEmerkle_dgst
+    //
+    // The record that the current place_new_node() attached to a leaf.
+    //   The subtrees that got a new item are all on the path from it up to
+    //   the head, even when nodes were replaced on the way down, so that
+    //   path is all that needs new digests.
+    static thread_local int last_attached;
+    // Computes the digest of one node from its item and its child digests
+    void calc_merkle_dgst( int node_id );
+    void calc_merkle_subtree( int sub_root );
+    void refresh_merkle_path( int node_id );
+#endif  //  #ifdef USEmerkle_dgst
     int find_my_place( int init_srch_node );
-    void do_node_info_update( int nde_id, string updat_str,
+    //
+    // The hand over hand locking for the concurrent writers.  A writer
+    //   holds the locks of the search node and its parent, since a
+    //   replace changes the child link of the parent.  conc_hand_over()
+    //   takes the lock of the next search node and then lets go of all of
+    //   the others except the current one.
+    void conc_take( int node_id );
+    void conc_hand_over( int cur_node_id, int nxt_node_id );
+    void conc_release_all();
+    void do_node_info_update( int nde_id, const char *updat_txt,
       bool replaced_node2leaf = false );
     inline int get_id_value( int raw_idx )
     {
@@ -166,6 +224,13 @@ protected:
 
     static string bsv_note;
     static bool bsv_carry;
+    //
+    // The lines of the info display for each level of a search are only
+    //   made while search_info_on is set, since they cost several hundred
+    //   heap allocations for each name placed.  The concurrent writers
+    //   never make them.
+    static bool search_info_on;
+    bool show_search_info() { return search_info_on && !conc_search; };
 #endif // #ifdef INFOdisplay
 
 #ifdef INdevel
@@ -190,6 +255,68 @@ protected:
     virtual int save_bsv_state() = 0;
     virtual void restore_bsv_state( int sv_idx ) = 0;
     virtual void release_bsv_state( int sv_idx ) = 0;
+    //
+    // A derived class that can hold a base search variable pinned to a
+    //   btree position (see gbtree-rebal.h) overrides this method.  The
+    //   position is given by its path from the head of the tree as a
+    //   string of 'l' and 'r' characters, and the base search variable
+    //   for that position becomes the data item of record node_id.  A
+    //   node_id of 0 removes all pins at and below the position.  The
+    //   default returns false which tells the caller that pins are not
+    //   supported for the record type.
+    virtual bool set_bsv_pin( const string& path, int node_id );
+    //
+    // A derived class whose records can be renumbered by gbtree_defrag
+    //   overrides this method.  new_order lists the IDs of the records in
+    //   the order they are to be in, and the records that aren't in it
+    //   are to be put after those in their present order.  new_id_of gets
+    //   the new ID of each record indexed by its old ID.  The links in the
+    //   records are left alone since the caller rewrites them, but any
+    //   node IDs that the derived class holds itself must be updated.  The
+    //   default returns false which tells the caller that the records can
+    //   not be moved.
+    virtual bool move_records( const vector<int>& new_order,
+      vector<int>& new_id_of );
+#ifdef USEmerkle_dgst
+    //
+    // A derived class that can keep the Merkle subtree digests supplies
+    //   the storage for them through these.  keep_merkle_dgsts() turns the
+    //   storage on or off, and get_merkle_slot() returns the place for the
+    //   digest of a node, or nullptr when the digests are not being kept.
+    //   The defaults return false and nullptr, which tells the caller the
+    //   record type doesn't support them.
+    virtual bool keep_merkle_dgsts( bool keep );
+    virtual merkle_dgst_type *get_merkle_slot( int node_idx );
+#endif  //  #ifdef USEmerkle_dgst
+    //
+    // A derived class that can be used by several writer threads at once
+    //   overrides these.  It must keep all of its search state in
+    //   thread_local members, must not move its records when new ones are
+    //   added, and must supply a lock for each record.  conc_search is set
+    //   while this thread is doing a concurrent placement, and the info
+    //   display and the order statistics upkeep are skipped then, since
+    //   they are not thread safe.
+    static thread_local bool conc_search;
+    virtual bool supports_conc_writers() { return false; };
+    virtual void lock_node( int node_idx ) { };
+    virtual void unlock_node( int node_idx ) { };
+    //
+    // A derived class can keep its records in an index of its own in
+    //   place of the btree, as the hash records can with a hash table
+    //   when only exact lookups are needed.  These return true when they
+    //   took care of the place or find, with the ID of the record.
+    virtual bool alt_index_place( int& node_id ) { return false; };
+    virtual bool alt_index_find( const string& key, int& node_id )
+      { return false; };
+    //
+    // Sets up the search key of the record being placed, which
+    //   cmp_rcrd2base() and cmp_rcrd2node() compare with, once before its
+    //   search starts, and drops it when the search is done.  The record
+    //   ID is that of the record when it is already in the tree, or -1
+    //   for a new one.  The display names of push_name_struct() are only
+    //   made for the info display.
+    virtual void push_search_key( int rcrd_id ) { };
+    virtual void pop_search_key() { };
 
 public:
     int get_parent_idx();
@@ -205,9 +332,35 @@ public:
     gbtree();
     int get_level();
     int place_new_node();
+    //
+    // The same as place_new_node() but it can be called by several writer
+    //   threads at the same time for a record type that supports it.  It
+    //   returns 0 for the other record types.  The subtree counts of the
+    //   order statistics are not kept by it, so recount_subtrees() needs
+    //   to be called once the writers are done.
+    int place_new_node_conc();
+    //
+    // Walks the whole btree and reports the number of nodes, the deepest
+    //   level and the average level of the nodes.  The level of the head
+    //   of the tree is 1.
+    void get_depth_stats( int& num_nodes, int& max_depth, double& avg_depth );
 #ifdef INFOdisplay  // test_bsv_compute will only work with this set
     void test_bsv_compute( int nlvl );
+    //
+    // Turns the info display lines of the searches on or off.  They are
+    //   on to start with, and the ncurses info window needs them, but a
+    //   run that doesn't save the info stream can leave them out.
+    static void set_search_info( bool show ) { search_info_on = show; };
+    static bool get_search_info() { return search_info_on; };
 #endif // #ifdef INFOdisplay
+    //
+    // Works out the base search variables of the node at level lvl of a
+    //   chain of one node for each level, as a search that went to it by
+    //   the right or the left child link would, and gives its ID.  The
+    //   levels of a path have to be done in order from 1.  The chain is
+    //   made as deep as it is needed the same way as by test_bsv_compute(),
+    //   so it can only be used on a btree with nothing else in it.
+    int walk_bsv_chain( int lvl, bool right_chld );
 
     int get_rt_child_flg();
     int get_b_srch_cnt();
@@ -233,6 +386,82 @@ public:
     //   replaced
     virtual gbtree& replace_node_derived( int node_idx ) = 0;
     virtual int add_new_node() = 0;
+    //
+    // Compares a search key to the data item of a node in the same way
+    //   the btree is ordered.  The key is a UTF-8 name string for the name
+    //   records, and the raw digest bytes for the hash records.
+    virtual int cmp_key2node( const string& key, int node_idx ) = 0;
+    //
+    // Starts bringing the parts of a record that a search reads into the
+    //   cache.  This is only a hint, and it must not read the record.
+    virtual void prefetch_node( int node_idx );
+    //
+    // The sort key of a node or of a search key is a byte string whose
+    //   memcmp() order is the order of the btree.  The frozen snapshots of
+    //   gbtree-frozen.h are built from them.
+    virtual string get_sort_key( int node_idx ) = 0;
+    virtual string make_sort_key( const string& key ) = 0;
+    //
+    // Returns the data item of a node in the form of a search key, the
+    //   same form that cmp_key2node() takes.
+    virtual string get_node_key( int node_idx ) = 0;
+    // Compares two search keys in the order of the btree
+    virtual int cmp_keys( const string& key_a, const string& key_b ) = 0;
+    //
+    // Tells which order cmp_keys() puts the keys in, for a record type
+    //   that can be set to more than one.  It is saved with an archive of
+    //   the btree so the archive is only read back in the same order.  The
+    //   default of 0 is the one order the other record types have.
+    virtual uint32_t get_collation_id() { return 0; };
+    //
+    // The name of the LC_COLLATE locale whose strcoll() order the keys are
+    //   in, for an order that depends on the locale, and empty for the
+    //   others.  It is saved with the archives along with the collation ID.
+    virtual string get_collation_locale() { return ""; };
+    //
+    // Looks up a search key in the live btree and returns the node ID of
+    //   the matching item, or 0 when the key is not in the tree.
+    int find_node( const string& key );
+    //
+    // Looks up a batch of keys at the same time.  The searches go down the
+    //   btree together one level at a time, and the record each one needs
+    //   next is prefetched before any of them are compared, so the cache
+    //   misses of the different keys overlap instead of coming one after
+    //   the other.  found gets the node ID for each key, or 0, in the
+    //   order of the keys.  batch_size is how many keys are in flight at
+    //   once, and somewhere between 16 and 64 is good.
+    void find_nodes( const vector<string>& keys, vector<int>& found,
+      int batch_size = default_batch_size );
+    static const int default_batch_size = 32;
+#ifdef USEorder_stats
+    int get_subtree_cnt();
+    // The number of items in the whole btree
+    int get_item_cnt();
+    //
+    // The order statistics.  rank() returns the number of items that are
+    //   less than the key, select() returns the node ID of the item with
+    //   the zero based rank kth or 0 when kth is out of range, and
+    //   count_range() returns the number of items from lo_key to hi_key
+    //   inclusive.  They take time proportional to the depth of the tree.
+    int rank( const string& key );
+    int select( int kth );
+    int count_range( const string& lo_key, const string& hi_key );
+    void recount_subtrees();
+#endif  //  #ifdef USEorder_stats
+#ifdef USEmerkle_dgst
+    //
+    // The Merkle digest of a subtree covers the items of all of its nodes
+    //   and its shape.  start_merkle_dgsts() turns them on and computes
+    //   them for the whole btree, and from then on place_new_node() and
+    //   the rebalancer keep them up to date.  The concurrent writers of
+    //   place_new_node_conc() don't, so start_merkle_dgsts() has to be
+    //   called again after them.  It returns false when the record type
+    //   doesn't support the digests.  get_merkle_dgst() returns false when
+    //   there is no digest for the node.
+    bool start_merkle_dgsts();
+    void stop_merkle_dgsts();
+    bool get_merkle_dgst( int node_idx, merkle_dgst_type& dgst );
+#endif  //  #ifdef USEmerkle_dgst
 };
 
 #endif //GBTREE_H
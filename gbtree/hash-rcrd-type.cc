@@ -33,6 +33,8 @@
 //
 #include "hash-rcrd-type.h"
 #include <cstring>
+#include <algorithm>
+#include <thread>
 
 #ifdef USEncurses
 #include "ncursio.h"
@@ -65,12 +67,32 @@ vector<name_string_hold> hash_rcrd_type<N_array >::h_nmst_hld = {};
 template<class N_array >
 vector<hash_rcrd_type<N_array > > hash_rcrd_type<N_array >::dgst_rcrds = {};
 
+#ifdef USEmerkle_dgst
 template<class N_array >
-N_array hash_rcrd_type<N_array >::base_sea_var_min;
+vector<merkle_dgst_type> hash_rcrd_type<N_array >::merkle_dgsts = {};
 template<class N_array >
-N_array hash_rcrd_type<N_array >::base_sea_var_max;
+bool hash_rcrd_type<N_array >::merkle_kept = false;
+#endif  //  #ifdef USEmerkle_dgst
+
+template<class N_array >
+thread_local N_array hash_rcrd_type<N_array >::base_sea_var_min;
+template<class N_array >
+thread_local N_array hash_rcrd_type<N_array >::base_sea_var_max;
 template<class N_array >
-N_array hash_rcrd_type<N_array >::base_sea_var;
+thread_local N_array hash_rcrd_type<N_array >::base_sea_var;
+
+template<class N_array >
+atomic<bool> hash_rcrd_type<N_array >::node_lcks[ max_num_rcrd ];
+template<class N_array >
+mutex hash_rcrd_type<N_array >::add_mtx;
+template<class N_array >
+atomic<int> hash_rcrd_type<N_array >::dgst_rcrd_cnt( 0 );
+template<class N_array >
+bool hash_rcrd_type<N_array >::dgst_tbl_on = false;
+template<class N_array >
+vector<int> hash_rcrd_type<N_array >::dgst_tbl = {};
+template<class N_array >
+int hash_rcrd_type<N_array >::dgst_tbl_used = 0;
 
 template<class N_array > struct
 hash_rcrd_type<N_array >::test_local hash_rcrd_type<N_array >::loc_var;
@@ -92,6 +114,27 @@ vector<sha1_rcrd_type::spr_bsv_state> sha1_rcrd_type::bsv_state_vec = {};
 template<>
 vector<md5_rcrd_type::spr_bsv_state> md5_rcrd_type::bsv_state_vec = {};
 
+template<class N_array >
+hash_rcrd_type<N_array >::spr_bsv_state::spr_bsv_state()
+{
+    if ( in_main == false )
+    {
+        const int result_6 = atexit( atexit_handl_6 );
+        if ( result_6 != 0 ) errs << "atexit reg hdlr 6 fail." << endl;
+    }
+    bsv_min = base_sea_var_min;
+    bsv_max = base_sea_var_max;
+    bsv_var = base_sea_var;
+}
+
+template<class N_array >
+void hash_rcrd_type<N_array >::spr_bsv_state::restore_state()
+{
+    base_sea_var_min = bsv_min;
+    base_sea_var_max = bsv_max;
+    base_sea_var = bsv_var;
+}
+
 template<class N_array > struct
 hash_rcrd_type<N_array >::spr_bsv_state hash_rcrd_type<N_array >::init_state;
 
@@ -117,7 +160,13 @@ void hash_rcrd_type<N_array >::dgstHexOut(N_array& dgstAry, string& rstr)
 template<class N_array >
 bool hash_rcrd_type<N_array >::prep4search()
 {
-    bool ready = dgst_rcrds.capacity() > dgst_rcrds.size() + siz_buffer;
+    //
+    // The other concurrent writers may each add a record before this one
+    //   gets to, so they need room as well.
+    const int max_conc_writers = 64;
+    bool ready = dgst_rcrds.capacity() > size_t( dgst_rcrd_cnt.load(
+      memory_order_acquire ) + siz_buffer +
+      ( conc_search ? max_conc_writers : 0 ) );
     //
     // There may be more that needs to be done, but for now, this will
     //   do.
@@ -155,6 +204,27 @@ void hash_rcrd_type<N_array >::release_bsv_state( int sv_idx )
     }
 }
 
+template<class N_array >
+void hash_rcrd_type<N_array >::lock_node( int node_idx )
+{
+    //
+    // The locks are only held for one step of a search, so spin on them,
+    //   but give the processor up when the spin goes on for a while in
+    //   case the holder is waiting to run.
+    int spin_cnt = 0;
+    while ( node_lcks[ node_idx ].exchange( true, memory_order_acquire ) )
+    {
+        while ( node_lcks[ node_idx ].load( memory_order_relaxed ) )
+          if ( ++spin_cnt > 64 ) this_thread::yield();
+    }
+}
+
+template<class N_array >
+void hash_rcrd_type<N_array >::unlock_node( int node_idx )
+{
+    node_lcks[ node_idx ].store( false, memory_order_release );
+}
+
 #ifdef INFOdisplay  //  {
 template<class N_array >
 void hash_rcrd_type<N_array >::push_name_struct( int nm_rc_id )
@@ -270,22 +340,20 @@ template<class N_array >
 hash_rcrd_type<N_array >::hash_rcrd_type( N_array& a_dgst )
 {
     hashVal = a_dgst;
-    string parm;
-    dgstHexOut( a_dgst, parm );
 }
 
 template<class N_array>
 hash_rcrd_type<N_array>& hash_rcrd_type<N_array>::get_node( int node_idx )
 {
-    if ( node_idx < 0 ||
-      static_cast<size_t>( node_idx ) >= dgst_rcrds.size() )
+    int rcrd_cnt = dgst_rcrd_cnt.load( memory_order_acquire );
+    if ( node_idx < 0 || node_idx >= rcrd_cnt )
     {
         iout << "Invalid node index for vector with size " <<
-          dgst_rcrds.size() << " records requested by "
+          rcrd_cnt << " records requested by "
           "get_node( " << node_idx << " ) method, exiting." << endl;
         myexit ();
     }
-    return dgst_rcrds.at( node_idx );
+    return dgst_rcrds.data()[ node_idx ];
 }
 
 template<class N_array >
@@ -322,6 +390,119 @@ int hash_rcrd_type<N_array >::cmp_rcrd2node( int node_idx )
     return cmp_rslt;
 }
 
+template<class N_array >
+int hash_rcrd_type<N_array >::cmp_key2node( const string& key, int node_idx )
+{
+    //
+    // The key holds the raw digest bytes.  A short key compares as a
+    //   prefix, so it is less than any digest that it is a prefix of.
+    hash_rcrd_type<N_array >& node_ref = get_node( node_idx );
+    size_t cmp_len = min( key.size(), node_ref.hashVal.size() );
+    int cmp_rslt = memcmp( key.data(), node_ref.hashVal.data(), cmp_len );
+    if ( cmp_rslt == 0 && key.size() != node_ref.hashVal.size() )
+      cmp_rslt = key.size() < node_ref.hashVal.size() ? -1 : 1;
+    return cmp_rslt;
+}
+
+template<class N_array >
+void hash_rcrd_type<N_array >::prefetch_node( int node_idx )
+{
+    //
+    // A record is not a whole number of cache lines long, so it can be
+    //   split across two of them.  The search needs the links at the front
+    //   and the digest at the back.
+    const char *rcrd_ptr = reinterpret_cast<const char *>(
+      dgst_rcrds.data() + node_idx );
+    __builtin_prefetch( rcrd_ptr );
+    __builtin_prefetch( rcrd_ptr + sizeof( hash_rcrd_type<N_array > ) - 1 );
+}
+
+template<class N_array >
+bool hash_rcrd_type<N_array >::move_records( const vector<int>& new_order,
+  vector<int>& new_id_of )
+{
+    //
+    // The records in the digest table are not in the btree, so they
+    //   would be lost by a renumber of the btree nodes.
+    if ( dgst_tbl_on ) return false;
+    //
+    // The capacity is kept the same since prep4search() depends on it
+    vector<hash_rcrd_type<N_array > > moved_rcrds;
+    moved_rcrds.reserve( dgst_rcrds.capacity() );
+    new_id_of.assign( dgst_rcrds.size(), -1 );
+    for ( int old_id : new_order )
+    {
+        new_id_of[ old_id ] = moved_rcrds.size();
+        moved_rcrds.push_back( dgst_rcrds[ old_id ] );
+    }
+    for ( size_t old_id = 0; old_id < dgst_rcrds.size(); old_id++ )
+    {
+        if ( new_id_of[ old_id ] >= 0 ) continue;
+        new_id_of[ old_id ] = moved_rcrds.size();
+        moved_rcrds.push_back( dgst_rcrds[ old_id ] );
+    }
+    dgst_rcrds.swap( moved_rcrds );
+#ifdef USEmerkle_dgst
+    if ( merkle_kept )
+    {
+        vector<merkle_dgst_type> moved_dgsts( dgst_rcrds.size() );
+        for ( size_t old_id = 0; old_id < merkle_dgsts.size(); old_id++ )
+          moved_dgsts[ new_id_of[ old_id ] ] = merkle_dgsts[ old_id ];
+        merkle_dgsts.swap( moved_dgsts );
+    }
+#endif  //  #ifdef USEmerkle_dgst
+    return true;
+}
+
+template<class N_array >
+string hash_rcrd_type<N_array >::get_sort_key( int node_idx )
+{
+    hash_rcrd_type<N_array >& node_ref = get_node( node_idx );
+    return string( reinterpret_cast<const char *>( node_ref.hashVal.data() ),
+      node_ref.hashVal.size() );
+}
+
+template<class N_array >
+string hash_rcrd_type<N_array >::get_node_key( int node_idx )
+{
+    return get_sort_key( node_idx );
+}
+
+template<class N_array >
+int hash_rcrd_type<N_array >::cmp_keys( const string& key_a,
+  const string& key_b )
+{
+    // string::compare() orders the bytes as unsigned, the same as memcmp()
+    return key_a.compare( key_b );
+}
+
+#ifdef USEmerkle_dgst
+template<class N_array >
+bool hash_rcrd_type<N_array >::keep_merkle_dgsts( bool keep )
+{
+    merkle_kept = keep;
+    merkle_dgsts.clear();
+    if ( keep ) merkle_dgsts.resize( dgst_rcrds.size() );
+    return true;
+}
+
+template<class N_array >
+merkle_dgst_type *hash_rcrd_type<N_array >::get_merkle_slot( int node_idx )
+{
+    if ( !merkle_kept ) return nullptr;
+    if ( size_t( node_idx ) >= merkle_dgsts.size() )
+      merkle_dgsts.resize( max( size_t( node_idx ) + 1, dgst_rcrds.size() ) );
+    return &merkle_dgsts[ node_idx ];
+}
+#endif  //  #ifdef USEmerkle_dgst
+
+template<class N_array >
+string hash_rcrd_type<N_array >::make_sort_key( const string& key )
+{
+    // The digest bytes already compare with memcmp()
+    return key;
+}
+
 template<class N_array >
 int hash_rcrd_type<N_array >::set_base_srch_var()
 {
@@ -360,6 +541,12 @@ int hash_rcrd_type<N_array >::set_base_srch_var()
             base_sea_var[ c_byt_no ] |= c_bit_msk;
         }
     }
+
+#ifdef INFOdisplay    // Declarations for development only
+    //
+    // The str_utf8 strings are not thread safe, and the hex strings of the
+    //   digests are only made for the display.
+    if ( !show_search_info() ) return 0;
     string min_strng;
     dgstHexOut( base_sea_var_min, min_strng );
     string max_strng;
@@ -372,7 +559,6 @@ int hash_rcrd_type<N_array >::set_base_srch_var()
       dbgs << "return base search var |" << base_sea_strng << "|." << endl;
 #endif // #ifdef INdevel
 
-#ifdef INFOdisplay    // Declarations for development only
     //
     // First define the strings
     str_utf8 bsmin( min_strng.substr( 0, 7 ) + "…", infsea_str_siz,
@@ -419,13 +605,13 @@ hash_rcrd_type<N_array>&
     // So far there is nothing to be done other than returning the
     //   reference to the node
     if ( node_idx < 0 ||
-      static_cast<size_t>( node_idx ) >= dgst_rcrds.size() )
+      node_idx >= dgst_rcrd_cnt.load( memory_order_acquire ) )
     {
         iout << "Invalid sha1 records node index requested by the "
           "replace_node_derived() method, exiting." << endl;
         myexit ();
     }
-    return dgst_rcrds.at( node_idx );
+    return dgst_rcrds.data()[ node_idx ];
 }
 
 // This can't be done here as it requires the abstract template class
@@ -433,8 +619,127 @@ hash_rcrd_type<N_array>&
 template<class N_array>
 int hash_rcrd_type<N_array>::add_new_node()
 {
+    lock_guard<mutex> add_lck( add_mtx );
+    if ( dgst_rcrds.size() == dgst_rcrds.capacity() )
+    {
+        //
+        // The records would be moved, which the other writers can't see
+        my_exit_msg = "The digest record vector is full in add_new_node()";
+        myexit();
+    }
     dgst_rcrds.push_back( *this );
-    return dgst_rcrds.size() - 1;
+    int new_id = dgst_rcrds.size() - 1;
+    dgst_rcrd_cnt.store( new_id + 1, memory_order_release );
+    return new_id;
+}
+
+template<class N_array>
+void hash_rcrd_type<N_array>::clear_dgst_vector()
+{
+    dgst_rcrds.resize( 1 );
+    dgst_rcrds[ 0 ] = hash_rcrd_type<N_array >();
+    dgst_rcrd_cnt.store( 1, memory_order_release );
+    fill( dgst_tbl.begin(), dgst_tbl.end(), 0 );
+    dgst_tbl_used = 0;
+}
+
+template<class N_array >
+bool hash_rcrd_type<N_array >::use_dgst_table( bool use_tbl )
+{
+    if ( dgst_rcrds.size() > 1 )
+    {
+        errs << "The digest table can only be turned " <<
+          ( use_tbl ? "on" : "off" ) << " when there are no records." << endl;
+        return false;
+    }
+    dgst_tbl_on = use_tbl;
+    if ( use_tbl ) rebuild_dgst_table( 2 * size_t( max_num_rcrd ) );
+    else
+    {
+        vector<int>().swap( dgst_tbl );
+        dgst_tbl_used = 0;
+    }
+    return true;
+}
+
+template<class N_array >
+size_t hash_rcrd_type<N_array >::dgst_tbl_slot( const N_array& dgst )
+{
+    uint64_t dgst_bits;
+    memcpy( &dgst_bits, dgst.data(), sizeof( dgst_bits ) );
+    return dgst_bits & ( dgst_tbl.size() - 1 );
+}
+
+template<class N_array >
+void hash_rcrd_type<N_array >::rebuild_dgst_table( size_t tbl_size )
+{
+    //
+    // The size is rounded up to a power of 2 so the slot is a mask
+    size_t new_size = 16;
+    while ( new_size < tbl_size ) new_size <<= 1;
+    dgst_tbl.assign( new_size, 0 );
+    dgst_tbl_used = 0;
+    for ( size_t rcrd_id = 1; rcrd_id < dgst_rcrds.size(); rcrd_id++ )
+    {
+        size_t slot = dgst_tbl_slot( dgst_rcrds[ rcrd_id ].hashVal );
+        while ( dgst_tbl[ slot ] != 0 ) slot = ( slot + 1 ) & ( new_size - 1 );
+        dgst_tbl[ slot ] = rcrd_id;
+        dgst_tbl_used++;
+    }
+}
+
+template<class N_array >
+bool hash_rcrd_type<N_array >::alt_index_place( int& node_id )
+{
+    if ( !dgst_tbl_on ) return false;
+    if ( 2 * size_t( dgst_tbl_used + 1 ) > dgst_tbl.size() )
+      rebuild_dgst_table( 2 * dgst_tbl.size() );
+    size_t slot = dgst_tbl_slot( hashVal );
+    while ( dgst_tbl[ slot ] != 0 )
+    {
+        if ( dgst_rcrds[ dgst_tbl[ slot ] ].hashVal == hashVal )
+        {
+            node_id = dgst_tbl[ slot ];
+            return true;
+        }
+        slot = ( slot + 1 ) & ( dgst_tbl.size() - 1 );
+    }
+    node_id = add_new_node();
+    dgst_tbl[ slot ] = node_id;
+    dgst_tbl_used++;
+    return true;
+}
+
+template<class N_array >
+bool hash_rcrd_type<N_array >::alt_index_find( const string& key,
+  int& node_id )
+{
+    if ( !dgst_tbl_on ) return false;
+    node_id = 0;
+    if ( key.size() != hashVal.size() ) return true;
+    N_array key_dgst;
+    memcpy( key_dgst.data(), key.data(), key_dgst.size() );
+    size_t slot = dgst_tbl_slot( key_dgst );
+    while ( dgst_tbl[ slot ] != 0 )
+    {
+        if ( dgst_rcrds[ dgst_tbl[ slot ] ].hashVal == key_dgst )
+        {
+            node_id = dgst_tbl[ slot ];
+            return true;
+        }
+        slot = ( slot + 1 ) & ( dgst_tbl.size() - 1 );
+    }
+    return true;
+}
+
+template<class N_array >
+void hash_rcrd_type<N_array >::export_sorted( vector<int>& node_ids )
+{
+    node_ids.resize( dgst_rcrds.size() - 1 );
+    for ( size_t idx = 0; idx < node_ids.size(); idx++ )
+      node_ids[ idx ] = idx + 1;
+    sort( node_ids.begin(), node_ids.end(), []( int id_a, int id_b )
+      { return dgst_rcrds[ id_a ].hashVal < dgst_rcrds[ id_b ].hashVal; } );
 }
 
 template<class N_array>
@@ -447,6 +752,7 @@ void hash_rcrd_type<N_array>::init_dgst_vector( char rec_typ )
     }
     dgst_rcrds.reserve( max_num_rcrd );
     if ( dgst_rcrds.size() == 0 ) dgst_rcrds.push_back( *this );
+    dgst_rcrd_cnt.store( dgst_rcrds.size(), memory_order_release );
     h_nmst_hld.reserve( 8 );
     bsv_state_vec.reserve( 10 );
 #ifdef INFOdisplay
@@ -46,6 +46,9 @@
 // #include <cstdint>   included by fo-utils
 #include "fo-utils.h"
 #include "gbtree.h"
+#include <array>
+#include <atomic>
+#include <mutex>
 #include <openssl/sha.h>
 #include <openssl/md5.h>
 
@@ -115,34 +118,56 @@ class hash_rcrd_type : public gbtree
         N_array bsv_max;
         N_array bsv_var;
 
-        spr_bsv_state()
-        {
-            if ( in_main == false )
-            {
-                const int result_6 = atexit( atexit_handl_6 );
-                if ( result_6 != 0 ) errs << "atexit reg hdlr 6 fail." << endl;
-            }
-            bsv_min = base_sea_var_min;
-            bsv_max = base_sea_var_max;
-            bsv_var = base_sea_var;
-        }
-        void restore_state()
-        {
-            base_sea_var_min = bsv_min;
-            base_sea_var_max = bsv_max;
-            base_sea_var = bsv_var;
-        }
+        //
+        // These are defined in hash-rcrd-type.cc since the thread_local
+        //   search vars must only be reached from the file that defines
+        //   them.  The compiler does not check for a missing TLS init
+        //   function for a template member, so an inline copy of these in
+        //   another file would call through a null pointer.
+        spr_bsv_state();
+        void restore_state();
     };
 
     static vector<name_string_hold > h_nmst_hld;
     //    static vector<spr_bsv_state<N_array > > bsv_state_vec;
     static vector<hash_rcrd_type<N_array > > dgst_rcrds;
-    static N_array base_sea_var_min;
-    static N_array base_sea_var_max;
-    static N_array base_sea_var;
+#ifdef USEmerkle_dgst
+    //
+    // The Merkle subtree digests indexed by node ID, which are only kept
+    //   while merkle_kept is set
+    static vector<merkle_dgst_type> merkle_dgsts;
+    static bool merkle_kept;
+#endif  //  #ifdef USEmerkle_dgst
+    //
+    // The search state is kept for each thread, and each record has a
+    //   lock, so that several threads can add records at the same time
+    //   with place_new_node_conc().  The capacity of dgst_rcrds is
+    //   reserved up front so the records never move, and add_mtx keeps
+    //   the adds to the vector one at a time.
+    // The size of the vector is changed by each add, so it isn't read
+    //   while there can be concurrent writers.  The record count is
+    //   published in dgst_rcrd_cnt instead, with a release store after
+    //   the record is made, and get_node() reaches the records through it
+    //   with an acquire load and the data pointer of the vector, which
+    //   never changes once the capacity is reserved.
+    static atomic<int> dgst_rcrd_cnt;
+    static thread_local N_array base_sea_var_min;
+    static thread_local N_array base_sea_var_max;
+    static thread_local N_array base_sea_var;
     static test_local loc_var;
     static vector<spr_bsv_state> bsv_state_vec;
+    static atomic<bool> node_lcks[ max_num_rcrd ];
+    static mutex add_mtx;
     static spr_bsv_state init_state;
+    //
+    // The digest table, used in place of the btree while dgst_tbl_on is
+    //   set.  It is open addressed with linear probing and holds the
+    //   record IDs, with 0 for an empty slot.  The digests are already
+    //   uniform, so the first 8 bytes of one are its hash and nothing
+    //   more is computed.  The table is kept at least half empty.
+    static bool dgst_tbl_on;
+    static vector<int> dgst_tbl;
+    static int dgst_tbl_used;
 
 protected:
     // uint16_t reserv01;
@@ -154,6 +179,13 @@ protected:
     int save_bsv_state();
     void restore_bsv_state( int sv_idx );
     void release_bsv_state( int sv_idx );
+    bool supports_conc_writers() { return !dgst_tbl_on; };
+    void lock_node( int node_idx );
+    void unlock_node( int node_idx );
+    bool alt_index_place( int& node_id );
+    bool alt_index_find( const string& key, int& node_id );
+    size_t dgst_tbl_slot( const N_array& dgst );
+    void rebuild_dgst_table( size_t tbl_size );
 
 #ifdef INFOdisplay
 
@@ -195,6 +227,18 @@ public:
     //   described above.
     int cmp_rcrd2base( int node_idx );
     int cmp_rcrd2node( int node_idx );
+    // Compares a search key to the node, used by the order statistics
+    int cmp_key2node( const string& key, int node_idx );
+    void prefetch_node( int node_idx );
+    bool move_records( const vector<int>& new_order, vector<int>& new_id_of );
+    string get_sort_key( int node_idx );
+    string make_sort_key( const string& key );
+    string get_node_key( int node_idx );
+    int cmp_keys( const string& key_a, const string& key_b );
+#ifdef USEmerkle_dgst
+    bool keep_merkle_dgsts( bool keep );
+    merkle_dgst_type *get_merkle_slot( int node_idx );
+#endif  //  #ifdef USEmerkle_dgst
 
     // This method is now driven by the base class management of the binary
     //   tree and as such, the base class knows when the base search variable
@@ -218,6 +262,22 @@ public:
     //   id of the new data base node created.
     virtual int add_new_node();
     void init_dgst_vector( char rec_typ );
+    //
+    // Removes all of the records from the btree so it can be built again.
+    //   No other thread may be using the btree when this is called.
+    void clear_dgst_vector();
+    //
+    // Selects the digest table in place of the btree for this record
+    //   type.  Both keep the same IDs and place_new_node() and find_node()
+    //   work the same way, but the table has no order, so the btree
+    //   features like the snapshots and the traverse see an empty tree.
+    //   It can only be changed while there are no records.
+    bool use_dgst_table( bool use_tbl );
+    bool dgst_table_on() { return dgst_tbl_on; };
+    //
+    // The IDs of all of the records in digest order, sorted when asked
+    //   for, which works with either the btree or the table.
+    void export_sorted( vector<int>& node_ids );
 
 };
 
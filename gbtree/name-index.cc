@@ -0,0 +1,107 @@
+//
+// This file contains the code to implement the gbtree name index and the
+//   name index factory
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// Use the following commands to build this object, save it to the library,
+//    and display the library contents:
+//
+//   g++ -std=c++17 -c name-index.cc
+//   ar -Prs ~/data/lib/libfoutil.a name-index.o
+//   ar -Ptv ~/data/lib/libfoutil.a
+
+#include "name-index.h"
+#include "art-name-index.h"
+
+int gbtree_name_index::place_name( const string& utf8name,
+  styp_flags flg_idd )
+{
+    //
+    // Create the new record as a temp to get the defaults set correctly
+    //   then copy to new_str_ptr so it can be referenced when needed.
+    utf8_rcrd_type tmp_spr( utf8name, flg_idd );
+    new_str_ptr = tmp_spr;
+
+#ifdef INdevel    // Declarations for development only
+  if ( dbgf.a3 )
+  {
+    tmp_spr.shossp( "Disp static search parms and tmp_spr "
+      "before call to place_new_node:" );
+    new_str_ptr.shossp( "Disp static search parms and new_str_ptr "
+      "before call to place_new_node:" );
+  }
+#endif // #ifdef INdevel
+
+    int name_id = new_str_ptr.place_new_node();
+    if ( name_id > num_names ) num_names = name_id;
+    return name_id;
+}
+
+int gbtree_name_index::find_name( const string& utf8name )
+{
+    return new_str_ptr.find_node( utf8name );
+}
+
+string gbtree_name_index::get_name( int name_id )
+{
+    if ( name_id <= 0 || name_id > num_names ) return "";
+    return new_str_ptr.get_node_name( name_id );
+}
+
+int gbtree_name_index::size()
+{
+    return num_names;
+}
+
+void gbtree_name_index::list_in_order( vector<int>& name_ids )
+{
+    name_ids.clear();
+    name_ids.reserve( num_names );
+    vector<int> walk_stk;
+    int nd_id = new_str_ptr.get_node( 0 ).get_child_right_idx();
+    while ( nd_id != 0 || !walk_stk.empty() )
+    {
+        while ( nd_id != 0 )
+        {
+            walk_stk.push_back( nd_id );
+            nd_id = new_str_ptr.get_node( nd_id ).get_child_left_idx();
+        }
+        nd_id = walk_stk.back();
+        walk_stk.pop_back();
+        name_ids.push_back( nd_id );
+        nd_id = new_str_ptr.get_node( nd_id ).get_child_right_idx();
+    }
+}
+
+size_t gbtree_name_index::get_mem_bytes()
+{
+    //
+    // The records in use, with record 0 that holds the head, and the
+    //   names with their null ends in the name store.  The records that
+    //   were reserved up front and not used yet are not counted.
+    size_t mem_bytes = ( num_names + 1 ) * sizeof( utf8_rcrd_type );
+    for ( int name_id = 1; name_id <= num_names; name_id++ )
+      mem_bytes += get_name( name_id ).size() + 1;
+    return mem_bytes;
+}
+
+name_index_type *make_name_index( name_index_backend bknd )
+{
+    if ( bknd == art_backend ) return new art_name_index;
+    return new gbtree_name_index;
+}
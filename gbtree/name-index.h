@@ -0,0 +1,89 @@
+//
+// The name_index_type class is the interface that the gbst_interface_type
+//   uses to place the UTF-8 names, so that other index structures can be
+//   tried against the gbtree for the name workload without any change to
+//   the callers of search_place_name().
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// Every backend has to keep the semantics of the gbtree for a name.  The
+//   IDs start at 1 and go up by one for each new name in the order they
+//   were placed, and placing a name that is already there returns the ID
+//   it was given the first time.  Two names are the same when strcoll()
+//   finds them equal, and the in order list is in strcoll() order.
+//
+// The gbtree backend is the utf8_rcrd_type btree with its names in the
+//   utf8_name_store.  Those are static, so there can only be one gbtree
+//   backend that holds names in a program.  The other backends are plain
+//   objects.
+//
+
+#ifndef NAME_INDEX_H
+#define NAME_INDEX_H
+
+#include "utf8-rcrd-type.h"
+#include <vector>
+
+using namespace std;
+
+enum name_index_backend { gbtree_backend, art_backend };
+
+class name_index_type
+{
+public:
+    virtual ~name_index_type() {}
+    //
+    // Returns the ID of the name, or 0 or less when the index is full
+    virtual int place_name( const string& utf8name, styp_flags flg_idd ) = 0;
+    //
+    // Returns the ID of the name, or 0 when it isn't in the index
+    virtual int find_name( const string& utf8name ) = 0;
+    virtual string get_name( int name_id ) = 0;
+    virtual int size() = 0;
+    //
+    // Gives the IDs of all of the names in their sorted order
+    virtual void list_in_order( vector<int>& name_ids ) = 0;
+    //
+    // The bytes of memory used for the index and the names it holds
+    virtual size_t get_mem_bytes() = 0;
+    virtual string get_backend_name() = 0;
+};
+
+class gbtree_name_index : public name_index_type
+{
+    //
+    // The last record placed, the same as gbst_interface_type used to
+    //   keep, so it can be looked at when debugging.
+    utf8_rcrd_type new_str_ptr;
+    int num_names;
+
+public:
+    gbtree_name_index() : num_names( 0 ) { };
+    int place_name( const string& utf8name, styp_flags flg_idd );
+    int find_name( const string& utf8name );
+    string get_name( int name_id );
+    int size();
+    void list_in_order( vector<int>& name_ids );
+    size_t get_mem_bytes();
+    string get_backend_name() { return "gbtree"; };
+};
+
+//
+// Makes a new index of the type asked for.  The caller owns it.
+name_index_type *make_name_index( name_index_backend bknd );
+
+#endif  //  NAME_INDEX_H
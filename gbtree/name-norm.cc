@@ -0,0 +1,407 @@
+//
+// This file contains the code to implement the Unicode normalization and
+//   case folding of the UTF-8 name strings with the compiled in tables,
+//   and the secondary index of the names by their normalized strings
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// Use the following commands to build this object, save it to the library,
+//    and display the library contents:
+//
+//   g++ -std=c++17 -c name-norm.cc
+//   ar -Prs ~/data/lib/libfoutil.a name-norm.o
+//   ar -Ptv ~/data/lib/libfoutil.a
+
+#include "name-norm.h"
+#include "norm-table.h"
+#include <algorithm>
+
+//
+// The Hangul syllables and the jamo they are made of, as in uca-collate.cc
+//   but with the counts that the composition needs too
+static const uint32_t hangul_first = 0xac00;
+static const uint32_t hangul_last = 0xd7a3;
+static const uint32_t jamo_l_first = 0x1100;
+static const uint32_t jamo_v_first = 0x1161;
+static const uint32_t jamo_t_first = 0x11a7;
+static const uint32_t jamo_l_cnt = 19;
+static const uint32_t jamo_v_cnt = 21;
+static const uint32_t jamo_t_cnt = 28;
+
+static void append_utf8( uint32_t code_pt, string& utf8_str )
+{
+    if ( code_pt < 0x80 ) utf8_str += char( code_pt );
+    else if ( code_pt < 0x800 )
+    {
+        utf8_str += char( 0xc0 | code_pt >> 6 );
+        utf8_str += char( 0x80 | ( code_pt & 0x3f ) );
+    }
+    else if ( code_pt < 0x10000 )
+    {
+        utf8_str += char( 0xe0 | code_pt >> 12 );
+        utf8_str += char( 0x80 | ( code_pt >> 6 & 0x3f ) );
+        utf8_str += char( 0x80 | ( code_pt & 0x3f ) );
+    }
+    else
+    {
+        utf8_str += char( 0xf0 | code_pt >> 18 );
+        utf8_str += char( 0x80 | ( code_pt >> 12 & 0x3f ) );
+        utf8_str += char( 0x80 | ( code_pt >> 6 & 0x3f ) );
+        utf8_str += char( 0x80 | ( code_pt & 0x3f ) );
+    }
+}
+
+name_normalizer::name_normalizer()
+  : tables_made( false )
+  , form( nfc )
+  , case_fold( false )
+  , ascii_cnt( 0 )
+  , latin1_cnt( 0 )
+  , full_cnt( 0 )
+{
+    for ( int idx = 0; idx < 128; idx++ ) ascii_map[ idx ] = char( idx );
+}
+
+string name_normalizer::get_form_name() const
+{
+    static const char *const form_names[] = { "NFD", "NFC", "NFKD", "NFKC" };
+    return string( form_names[ form ] ) +
+      ( case_fold ? " with case folding" : "" );
+}
+
+string name_normalizer::get_version() const
+{
+    return norm_version;
+}
+
+uint8_t name_normalizer::find_ccc( uint32_t code_pt ) const
+{
+    if ( code_pt < fast_cp_lim ) return fast_cccs[ code_pt ];
+    const uint32_t *cccs_end = norm_cccs + norm_ccc_cnt;
+    const uint32_t *found = lower_bound( norm_cccs, cccs_end, code_pt << 8 );
+    if ( found == cccs_end || *found >> 8 != code_pt ) return 0;
+    return *found & 0xff;
+}
+
+uint32_t name_normalizer::find_comp( uint32_t cp_1, uint32_t cp_2 ) const
+{
+    if ( cp_1 >= jamo_l_first && cp_1 < jamo_l_first + jamo_l_cnt &&
+      cp_2 >= jamo_v_first && cp_2 < jamo_v_first + jamo_v_cnt )
+      return hangul_first + ( ( cp_1 - jamo_l_first ) * jamo_v_cnt +
+      cp_2 - jamo_v_first ) * jamo_t_cnt;
+    if ( cp_1 >= hangul_first && cp_1 <= hangul_last &&
+      ( cp_1 - hangul_first ) % jamo_t_cnt == 0 && cp_2 > jamo_t_first &&
+      cp_2 < jamo_t_first + jamo_t_cnt )
+      return cp_1 + cp_2 - jamo_t_first;
+    int lo = 0, hi = norm_comp_cnt;
+    while ( lo < hi )
+    {
+        int mid = lo + ( hi - lo ) / 2;
+        const uint32_t *comp = &norm_comps[ mid * 3 ];
+        bool less = comp[ 0 ] != cp_1 ? comp[ 0 ] < cp_1 : comp[ 1 ] < cp_2;
+        if ( less ) lo = mid + 1;
+        else hi = mid;
+    }
+    if ( lo < norm_comp_cnt && norm_comps[ lo * 3 ] == cp_1 &&
+      norm_comps[ lo * 3 + 1 ] == cp_2 ) return norm_comps[ lo * 3 + 2 ];
+    return 0;
+}
+
+void name_normalizer::add_decomp( uint32_t code_pt, bool fold_it )
+{
+    if ( code_pt >= hangul_first && code_pt <= hangul_last )
+    {
+        uint32_t s_idx = code_pt - hangul_first;
+        cp_buf.push_back( jamo_l_first + s_idx / ( jamo_v_cnt * jamo_t_cnt ) );
+        cp_buf.push_back( jamo_v_first + s_idx % ( jamo_v_cnt * jamo_t_cnt ) /
+          jamo_t_cnt );
+        if ( s_idx % jamo_t_cnt != 0 )
+          cp_buf.push_back( jamo_t_first + s_idx % jamo_t_cnt );
+        return;
+    }
+    const uint32_t *cps_end = norm_decomp_cps + norm_decomp_cnt;
+    const uint32_t *found = lower_bound( norm_decomp_cps, cps_end, code_pt );
+    uint32_t cp_ref = 0;
+    if ( found != cps_end && *found == code_pt )
+      cp_ref = compat_form() ? norm_compat_refs[ found - norm_decomp_cps ] :
+      norm_canon_refs[ found - norm_decomp_cps ];
+    if ( cp_ref != 0 )
+    {
+        //
+        // The decompositions are already in full, so this only goes one
+        //   more level down for the case folding.
+        for ( uint32_t idx = 0; idx < ( cp_ref & 0x1f ); idx++ )
+          add_decomp( norm_cps_data[ ( cp_ref >> 5 ) + idx ], fold_it );
+        return;
+    }
+    //
+    // The case folding of a combining mark can change its class, so it is
+    //   left for fold_marks() until the marks are in order.
+    if ( fold_it && !binary_search( mark_folds.begin(), mark_folds.end(),
+      code_pt ) && add_fold( code_pt ) ) return;
+    cp_buf.push_back( code_pt );
+}
+
+void name_normalizer::put_in_order()
+{
+    ccc_buf.resize( cp_buf.size() );
+    for ( size_t idx = 0; idx < cp_buf.size(); idx++ )
+      ccc_buf[ idx ] = find_ccc( cp_buf[ idx ] );
+    //
+    // An insertion sort of each run of combining marks by their class,
+    //   which keeps the marks of the same class in their order and stops
+    //   at the starter since its class is 0.
+    for ( size_t idx = 1; idx < cp_buf.size(); idx++ )
+    {
+        uint8_t ccc = ccc_buf[ idx ];
+        if ( ccc == 0 || ccc_buf[ idx - 1 ] <= ccc ) continue;
+        uint32_t code_pt = cp_buf[ idx ];
+        size_t pos = idx;
+        while ( pos > 0 && ccc_buf[ pos - 1 ] > ccc )
+        {
+            cp_buf[ pos ] = cp_buf[ pos - 1 ];
+            ccc_buf[ pos ] = ccc_buf[ pos - 1 ];
+            pos--;
+        }
+        cp_buf[ pos ] = code_pt;
+        ccc_buf[ pos ] = ccc;
+    }
+}
+
+bool name_normalizer::add_fold( uint32_t code_pt )
+{
+    const uint32_t *folds_end = norm_fold_cps + norm_fold_cnt;
+    const uint32_t *found = lower_bound( norm_fold_cps, folds_end, code_pt );
+    if ( found == folds_end || *found != code_pt ) return false;
+    uint32_t cp_ref = norm_fold_refs[ found - norm_fold_cps ];
+    for ( uint32_t idx = 0; idx < ( cp_ref & 0x1f ); idx++ )
+      add_decomp( norm_cps_data[ ( cp_ref >> 5 ) + idx ], false );
+    return true;
+}
+
+void name_normalizer::fold_marks()
+{
+    size_t idx = 0;
+    while ( idx < cp_buf.size() && ( ccc_buf[ idx ] == 0 || !binary_search(
+      mark_folds.begin(), mark_folds.end(), cp_buf[ idx ] ) ) ) idx++;
+    if ( idx == cp_buf.size() ) return;
+    fold_buf.swap( cp_buf );
+    cp_buf.clear();
+    for ( idx = 0; idx < fold_buf.size(); idx++ )
+      if ( ccc_buf[ idx ] == 0 || !binary_search( mark_folds.begin(),
+        mark_folds.end(), fold_buf[ idx ] ) || !add_fold( fold_buf[ idx ] ) )
+        cp_buf.push_back( fold_buf[ idx ] );
+    put_in_order();
+}
+
+void name_normalizer::compose()
+{
+    if ( cp_buf.empty() ) return;
+    //
+    // A mark can go into the starter before it when no mark between them
+    //   has the same or a higher class, and a starter only when it is
+    //   right after the other one.  The last class is made 256 when the
+    //   name starts with a mark so nothing goes into that.
+    size_t starter_pos = 0;
+    size_t comp_pos = 1;
+    int last_ccc = ccc_buf[ 0 ] == 0 ? 0 : 256;
+    for ( size_t idx = 1; idx < cp_buf.size(); idx++ )
+    {
+        uint32_t code_pt = cp_buf[ idx ];
+        int ccc = ccc_buf[ idx ];
+        if ( last_ccc < ccc || last_ccc == 0 )
+        {
+            uint32_t comp = find_comp( cp_buf[ starter_pos ], code_pt );
+            if ( comp != 0 )
+            {
+                cp_buf[ starter_pos ] = comp;
+                continue;
+            }
+        }
+        if ( ccc == 0 ) starter_pos = comp_pos;
+        last_ccc = ccc;
+        cp_buf[ comp_pos ] = code_pt;
+        ccc_buf[ comp_pos ] = ccc;
+        comp_pos++;
+    }
+    cp_buf.resize( comp_pos );
+}
+
+void name_normalizer::full_normalize( const char *str, size_t len,
+  string& norm_str )
+{
+    cp_buf.clear();
+    size_t pos = 0;
+    while ( pos < len )
+    {
+        uint8_t lead = str[ pos ];
+        int nfollow = lead < 0x80 ? 0 : ( lead & 0xe0 ) == 0xc0 ? 1 :
+          ( lead & 0xf0 ) == 0xe0 ? 2 : ( lead & 0xf8 ) == 0xf0 ? 3 : -1;
+        if ( nfollow < 0 || pos + nfollow >= len )
+        {
+            norm_str.assign( str, len );
+            return;
+        }
+        uint32_t code_pt = nfollow == 0 ? lead : lead & ( 0x3f >> nfollow );
+        for ( int idx = 1; idx <= nfollow; idx++ )
+        {
+            uint8_t follow = str[ pos + idx ];
+            if ( ( follow & 0xc0 ) != 0x80 )
+            {
+                norm_str.assign( str, len );
+                return;
+            }
+            code_pt = code_pt << 6 | ( follow & 0x3f );
+        }
+        pos += nfollow + 1;
+        if ( code_pt >= fast_cp_lim ) add_decomp( code_pt, case_fold );
+        else if ( fast_refs[ code_pt ] == 0 ) cp_buf.push_back( code_pt );
+        else
+        {
+            uint32_t cp_ref = fast_refs[ code_pt ];
+            cp_buf.insert( cp_buf.end(), fast_cps.begin() + ( cp_ref >> 5 ),
+              fast_cps.begin() + ( cp_ref >> 5 ) + ( cp_ref & 0x1f ) );
+        }
+    }
+    put_in_order();
+    if ( case_fold && !mark_folds.empty() ) fold_marks();
+    if ( composed_form() ) compose();
+    norm_str.clear();
+    for ( uint32_t code_pt : cp_buf ) append_utf8( code_pt, norm_str );
+}
+
+void name_normalizer::setup( norm_form form_set, bool fold_set )
+{
+    form = form_set;
+    case_fold = fold_set;
+    fast_cccs.assign( fast_cp_lim, 0 );
+    for ( int idx = 0; idx < norm_ccc_cnt; idx++ )
+      if ( norm_cccs[ idx ] >> 8 < fast_cp_lim )
+        fast_cccs[ norm_cccs[ idx ] >> 8 ] = norm_cccs[ idx ] & 0xff;
+    mark_folds.clear();
+    for ( int idx = 0; idx < norm_fold_cnt; idx++ )
+      if ( find_ccc( norm_fold_cps[ idx ] ) != 0 )
+        mark_folds.push_back( norm_fold_cps[ idx ] );
+    fast_refs.assign( fast_cp_lim, 0 );
+    fast_cps.clear();
+    for ( uint32_t code_pt = 0; code_pt < fast_cp_lim; code_pt++ )
+    {
+        cp_buf.clear();
+        add_decomp( code_pt, case_fold );
+        if ( cp_buf.size() == 1 && cp_buf[ 0 ] == code_pt ) continue;
+        fast_refs[ code_pt ] = fast_cps.size() << 5 | cp_buf.size();
+        fast_cps.insert( fast_cps.end(), cp_buf.begin(), cp_buf.end() );
+    }
+    //
+    // Only the letters change in the ASCII range, and only with the case
+    //   folding.  The Latin-1 characters go through the full normalization
+    //   one at a time, which needs the tables above.
+    for ( int idx = 0; idx < 128; idx++ )
+      ascii_map[ idx ] = char( case_fold && idx >= 'A' && idx <= 'Z' ?
+      idx - 'A' + 'a' : idx );
+    for ( uint32_t code_pt = 0; code_pt < 256; code_pt++ )
+    {
+        string cp_str;
+        append_utf8( code_pt, cp_str );
+        full_normalize( cp_str.data(), cp_str.size(), latin1_strs[ code_pt ] );
+    }
+    ascii_cnt = 0;
+    latin1_cnt = 0;
+    full_cnt = 0;
+    tables_made = true;
+}
+
+void name_normalizer::normalize( const char *str, size_t len,
+  string& norm_str )
+{
+    size_t pos = 0;
+    while ( pos < len && uint8_t( str[ pos ] ) < 0x80 ) pos++;
+    if ( pos == len )
+    {
+        ascii_cnt++;
+        norm_str.resize( len );
+        for ( pos = 0; pos < len; pos++ )
+          norm_str[ pos ] = ascii_map[ uint8_t( str[ pos ] ) ];
+        return;
+    }
+    //
+    // The Latin-1 characters past the ASCII ones are the two byte
+    //   sequences that start with 0xc2 or 0xc3.
+    size_t scan_pos = pos;
+    while ( scan_pos < len )
+    {
+        uint8_t lead = str[ scan_pos ];
+        if ( lead < 0x80 ) scan_pos++;
+        else if ( ( lead == 0xc2 || lead == 0xc3 ) && scan_pos + 1 < len &&
+          ( uint8_t( str[ scan_pos + 1 ] ) & 0xc0 ) == 0x80 ) scan_pos += 2;
+        else break;
+    }
+    if ( scan_pos < len )
+    {
+        full_cnt++;
+        full_normalize( str, len, norm_str );
+        return;
+    }
+    latin1_cnt++;
+    norm_str.clear();
+    for ( size_t idx = 0; idx < pos; idx++ )
+      norm_str += ascii_map[ uint8_t( str[ idx ] ) ];
+    while ( pos < len )
+    {
+        uint8_t lead = str[ pos ];
+        if ( lead < 0x80 )
+        {
+            norm_str += ascii_map[ lead ];
+            pos++;
+            continue;
+        }
+        norm_str += latin1_strs[ ( lead & 0x1f ) << 6 |
+          ( uint8_t( str[ pos + 1 ] ) & 0x3f ) ];
+        pos += 2;
+    }
+}
+
+void norm_name_index::add_name( const string& utf8name, int name_id )
+{
+    normzr.normalize( utf8name.data(), utf8name.size(), norm_key );
+    key_ids[ norm_key ].push_back( name_id );
+    num_names++;
+}
+
+const vector<int>& norm_name_index::find_equiv( const string& utf8name )
+{
+    normzr.normalize( utf8name.data(), utf8name.size(), norm_key );
+    auto found = key_ids.find( norm_key );
+    return found == key_ids.end() ? no_ids : found->second;
+}
+
+size_t norm_name_index::get_mem_bytes() const
+{
+    //
+    // Each key is a node of the unordered_map with its next pointer and
+    //   its hash, and the key bytes and the IDs when they don't fit in the
+    //   node.
+    size_t mem_bytes = key_ids.bucket_count() * sizeof( void * );
+    for ( auto& key_id : key_ids )
+    {
+        mem_bytes += sizeof( key_id ) + 2 * sizeof( void * ) +
+          key_id.second.capacity() * sizeof( int );
+        if ( key_id.first.capacity() > 15 )
+          mem_bytes += key_id.first.capacity() + 1;
+    }
+    return mem_bytes;
+}
@@ -0,0 +1,168 @@
+//
+// The name_normalizer class puts UTF-8 name strings in a Unicode
+//   normalization form, NFC or NFKC, with the case folding as an option,
+//   so that names that only differ in the way their characters are
+//   encoded, or in their case, give the same string.  The same file name
+//   is often NFC on a Linux file system and NFD when it came from a
+//   macOS one, and the utf8_rcrd_type btree keeps the bytes of the names,
+//   so it holds those as two names.  The norm_name_index class keeps the
+//   IDs of the names by their normalized strings, so the names that are
+//   equivalent to a name are found with one search of it.
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// A name is normalized as UAX #15 describes, with the tables of
+//   norm-table.h.  Each code point is given its full canonical, or for
+//   NFKC its compatibility, decomposition, and the Hangul syllables are
+//   split into their jamo.  With the case folding each of those code
+//   points is then given its full case folding, which is decomposed
+//   again, so the key of a name is the NFC or NFKC of the case folded
+//   decomposition of the name, the same as the canonical caseless match
+//   of the Unicode standard has for NFC.  The combining marks are put in
+//   canonical order, and for the composed forms the primary composites
+//   are put back together.  The decomposed forms, NFD and NFKD, are there
+//   too, mostly so the equivalence lookups can be tried with them.
+//
+// Most of the names are ASCII, which every form leaves as it is and the
+//   case folding only takes to lower case, so those go through a 128 byte
+//   table.  The names with only Latin-1 characters are the next most
+//   common, and each of those is normalized on its own when the tables
+//   are made.  None of the results has a combining mark that can be put
+//   in another order or composed with the character after it, so a
+//   Latin-1 name is normalized by putting the results for its characters
+//   together.  The decompositions of the code points below fast_cp_lim
+//   are kept by code point, with the case folding already done, the same
+//   way the uca_collator keeps its elements, and the rest are found with
+//   a binary search of the tables.
+//
+
+#ifndef NAME_NORM_H
+#define NAME_NORM_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+class name_normalizer
+{
+public:
+    enum norm_form { nfd, nfc, nfkd, nfkc };
+    static const uint32_t fast_cp_lim = 0x3000;
+
+private:
+    bool tables_made;
+    norm_form form;
+    bool case_fold;
+    //
+    // The cp_ref into fast_cps of the decomposition of each code point
+    //   below fast_cp_lim, or 0 when it is the code point itself, and the
+    //   canonical combining class of each of them
+    vector<uint32_t> fast_refs;
+    vector<uint32_t> fast_cps;
+    vector<uint8_t> fast_cccs;
+    //
+    // The bytes of the ASCII characters and the UTF-8 strings of the
+    //   Latin-1 characters in the form asked for
+    char ascii_map[ 128 ];
+    string latin1_strs[ 256 ];
+    //
+    // The code points of the name being normalized with their classes
+    vector<uint32_t> cp_buf;
+    vector<uint8_t> ccc_buf;
+    vector<uint32_t> fold_buf;
+    //
+    // The combining marks that have a case folding, which is only U+0345
+    //   since its folding is the Greek iota that is not a mark
+    vector<uint32_t> mark_folds;
+    long ascii_cnt;
+    long latin1_cnt;
+    long full_cnt;
+
+    bool compat_form() const { return form == nfkd || form == nfkc; };
+    bool composed_form() const { return form == nfc || form == nfkc; };
+    uint8_t find_ccc( uint32_t code_pt ) const;
+    uint32_t find_comp( uint32_t cp_1, uint32_t cp_2 ) const;
+    //
+    // Adds the decomposition of code_pt to cp_buf, with the case folding
+    //   of each code point of it when fold_it is set
+    void add_decomp( uint32_t code_pt, bool fold_it );
+    bool add_fold( uint32_t code_pt );
+    void put_in_order();
+    //
+    // Does the case folding of the marks after they are put in order
+    void fold_marks();
+    void compose();
+    void full_normalize( const char *str, size_t len, string& norm_str );
+
+public:
+    name_normalizer();
+    //
+    // Makes the lookup tables.  It has to be done before the first name
+    //   is normalized, and again to change the form or the case folding.
+    void setup( norm_form form_set = nfc, bool fold_set = false );
+    bool is_set_up() const { return tables_made; };
+    norm_form get_form() const { return form; };
+    bool get_case_fold() const { return case_fold; };
+    string get_form_name() const;
+    string get_version() const;
+    //
+    // Puts the normalized str in norm_str.  A str that isn't valid UTF-8
+    //   is given back as it is.
+    void normalize( const char *str, size_t len, string& norm_str );
+    string normalize( const string& str )
+      { string norm_str; normalize( str.data(), str.size(), norm_str );
+      return norm_str; };
+    //
+    // The number of names that were done by the ASCII table, the Latin-1
+    //   table and the full normalization
+    long get_ascii_cnt() const { return ascii_cnt; };
+    long get_latin1_cnt() const { return latin1_cnt; };
+    long get_full_cnt() const { return full_cnt; };
+};
+
+//
+// The secondary index of the names by their normalized strings.  Every
+//   name that has an ID in the name index is added with its ID, and the
+//   IDs of the names with the same normalized string are kept together in
+//   the order they were added.
+class norm_name_index
+{
+    name_normalizer normzr;
+    unordered_map<string, vector<int> > key_ids;
+    vector<int> no_ids;
+    string norm_key;
+    int num_names;
+
+public:
+    norm_name_index() : num_names( 0 ) { };
+    void setup( name_normalizer::norm_form form_set, bool fold_set )
+      { normzr.setup( form_set, fold_set ); };
+    void add_name( const string& utf8name, int name_id );
+    //
+    // The IDs of the names that normalize to the same string as utf8name,
+    //   which need not be a name of the index itself
+    const vector<int>& find_equiv( const string& utf8name );
+    int size() const { return num_names; };
+    int key_cnt() const { return int( key_ids.size() ); };
+    size_t get_mem_bytes() const;
+    name_normalizer& get_normalizer() { return normzr; };
+};
+
+#endif  //  NAME_NORM_H
@@ -0,0 +1,5869 @@
+//
+// The normalization and case folding tables of the name_normalizer
+//   class, made from the 14.0.0 Unicode Character Database files by
+//   the mk-norm-table program of the uni-utils folder.  Do not edit, make
+//   it again instead.
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    The UCD is Copyright Unicode, Inc., for its terms of use see
+//    http://www.unicode.org/terms_of_use.html
+//
+// Use the following commands to build this object, save it to the library,
+//    and display the library contents:
+//
+//   g++ -std=c++17 -c norm-table.cc
+//   ar -Prs ~/data/lib/libfoutil.a norm-table.o
+//   ar -Ptv ~/data/lib/libfoutil.a
+
+#include "norm-table.h"
+
+const char *const norm_version = "14.0.0";
+const int norm_ccc_cnt = 912;
+const int norm_decomp_cnt = 5795;
+const int norm_comp_cnt = 941;
+const int norm_fold_cnt = 1530;
+
+const uint32_t norm_cps_data[ 10729 ] = {
+    0x20, 0x20, 0x308, 0x61, 0x20, 0x304,
+    0x32, 0x33, 0x20, 0x301, 0x3bc, 0x20,
+    0x327, 0x31, 0x6f, 0x31, 0x2044, 0x34,
+    0x31, 0x2044, 0x32, 0x33, 0x2044, 0x34,
+    0x41, 0x300, 0x41, 0x301, 0x41, 0x302,
+    0x41, 0x303, 0x41, 0x308, 0x41, 0x30a,
+    0x43, 0x327, 0x45, 0x300, 0x45, 0x301,
+    0x45, 0x302, 0x45, 0x308, 0x49, 0x300,
+    0x49, 0x301, 0x49, 0x302, 0x49, 0x308,
+    0x4e, 0x303, 0x4f, 0x300, 0x4f, 0x301,
+    0x4f, 0x302, 0x4f, 0x303, 0x4f, 0x308,
+    0x55, 0x300, 0x55, 0x301, 0x55, 0x302,
+    0x55, 0x308, 0x59, 0x301, 0x61, 0x300,
+    0x61, 0x301, 0x61, 0x302, 0x61, 0x303,
+    0x61, 0x308, 0x61, 0x30a, 0x63, 0x327,
+    0x65, 0x300, 0x65, 0x301, 0x65, 0x302,
+    0x65, 0x308, 0x69, 0x300, 0x69, 0x301,
+    0x69, 0x302, 0x69, 0x308, 0x6e, 0x303,
+    0x6f, 0x300, 0x6f, 0x301, 0x6f, 0x302,
+    0x6f, 0x303, 0x6f, 0x308, 0x75, 0x300,
+    0x75, 0x301, 0x75, 0x302, 0x75, 0x308,
+    0x79, 0x301, 0x79, 0x308, 0x41, 0x304,
+    0x61, 0x304, 0x41, 0x306, 0x61, 0x306,
+    0x41, 0x328, 0x61, 0x328, 0x43, 0x301,
+    0x63, 0x301, 0x43, 0x302, 0x63, 0x302,
+    0x43, 0x307, 0x63, 0x307, 0x43, 0x30c,
+    0x63, 0x30c, 0x44, 0x30c, 0x64, 0x30c,
+    0x45, 0x304, 0x65, 0x304, 0x45, 0x306,
+    0x65, 0x306, 0x45, 0x307, 0x65, 0x307,
+    0x45, 0x328, 0x65, 0x328, 0x45, 0x30c,
+    0x65, 0x30c, 0x47, 0x302, 0x67, 0x302,
+    0x47, 0x306, 0x67, 0x306, 0x47, 0x307,
+    0x67, 0x307, 0x47, 0x327, 0x67, 0x327,
+    0x48, 0x302, 0x68, 0x302, 0x49, 0x303,
+    0x69, 0x303, 0x49, 0x304, 0x69, 0x304,
+    0x49, 0x306, 0x69, 0x306, 0x49, 0x328,
+    0x69, 0x328, 0x49, 0x307, 0x49, 0x4a,
+    0x69, 0x6a, 0x4a, 0x302, 0x6a, 0x302,
+    0x4b, 0x327, 0x6b, 0x327, 0x4c, 0x301,
+    0x6c, 0x301, 0x4c, 0x327, 0x6c, 0x327,
+    0x4c, 0x30c, 0x6c, 0x30c, 0x4c, 0xb7,
+    0x6c, 0xb7, 0x4e, 0x301, 0x6e, 0x301,
+    0x4e, 0x327, 0x6e, 0x327, 0x4e, 0x30c,
+    0x6e, 0x30c, 0x2bc, 0x6e, 0x4f, 0x304,
+    0x6f, 0x304, 0x4f, 0x306, 0x6f, 0x306,
+    0x4f, 0x30b, 0x6f, 0x30b, 0x52, 0x301,
+    0x72, 0x301, 0x52, 0x327, 0x72, 0x327,
+    0x52, 0x30c, 0x72, 0x30c, 0x53, 0x301,
+    0x73, 0x301, 0x53, 0x302, 0x73, 0x302,
+    0x53, 0x327, 0x73, 0x327, 0x53, 0x30c,
+    0x73, 0x30c, 0x54, 0x327, 0x74, 0x327,
+    0x54, 0x30c, 0x74, 0x30c, 0x55, 0x303,
+    0x75, 0x303, 0x55, 0x304, 0x75, 0x304,
+    0x55, 0x306, 0x75, 0x306, 0x55, 0x30a,
+    0x75, 0x30a, 0x55, 0x30b, 0x75, 0x30b,
+    0x55, 0x328, 0x75, 0x328, 0x57, 0x302,
+    0x77, 0x302, 0x59, 0x302, 0x79, 0x302,
+    0x59, 0x308, 0x5a, 0x301, 0x7a, 0x301,
+    0x5a, 0x307, 0x7a, 0x307, 0x5a, 0x30c,
+    0x7a, 0x30c, 0x73, 0x4f, 0x31b, 0x6f,
+    0x31b, 0x55, 0x31b, 0x75, 0x31b, 0x44,
+    0x5a, 0x30c, 0x44, 0x7a, 0x30c, 0x64,
+    0x7a, 0x30c, 0x4c, 0x4a, 0x4c, 0x6a,
+    0x6c, 0x6a, 0x4e, 0x4a, 0x4e, 0x6a,
+    0x6e, 0x6a, 0x41, 0x30c, 0x61, 0x30c,
+    0x49, 0x30c, 0x69, 0x30c, 0x4f, 0x30c,
+    0x6f, 0x30c, 0x55, 0x30c, 0x75, 0x30c,
+    0x55, 0x308, 0x304, 0x75, 0x308, 0x304,
+    0x55, 0x308, 0x301, 0x75, 0x308, 0x301,
+    0x55, 0x308, 0x30c, 0x75, 0x308, 0x30c,
+    0x55, 0x308, 0x300, 0x75, 0x308, 0x300,
+    0x41, 0x308, 0x304, 0x61, 0x308, 0x304,
+    0x41, 0x307, 0x304, 0x61, 0x307, 0x304,
+    0xc6, 0x304, 0xe6, 0x304, 0x47, 0x30c,
+    0x67, 0x30c, 0x4b, 0x30c, 0x6b, 0x30c,
+    0x4f, 0x328, 0x6f, 0x328, 0x4f, 0x328,
+    0x304, 0x6f, 0x328, 0x304, 0x1b7, 0x30c,
+    0x292, 0x30c, 0x6a, 0x30c, 0x44, 0x5a,
+    0x44, 0x7a, 0x64, 0x7a, 0x47, 0x301,
+    0x67, 0x301, 0x4e, 0x300, 0x6e, 0x300,
+    0x41, 0x30a, 0x301, 0x61, 0x30a, 0x301,
+    0xc6, 0x301, 0xe6, 0x301, 0xd8, 0x301,
+    0xf8, 0x301, 0x41, 0x30f, 0x61, 0x30f,
+    0x41, 0x311, 0x61, 0x311, 0x45, 0x30f,
+    0x65, 0x30f, 0x45, 0x311, 0x65, 0x311,
+    0x49, 0x30f, 0x69, 0x30f, 0x49, 0x311,
+    0x69, 0x311, 0x4f, 0x30f, 0x6f, 0x30f,
+    0x4f, 0x311, 0x6f, 0x311, 0x52, 0x30f,
+    0x72, 0x30f, 0x52, 0x311, 0x72, 0x311,
+    0x55, 0x30f, 0x75, 0x30f, 0x55, 0x311,
+    0x75, 0x311, 0x53, 0x326, 0x73, 0x326,
+    0x54, 0x326, 0x74, 0x326, 0x48, 0x30c,
+    0x68, 0x30c, 0x41, 0x307, 0x61, 0x307,
+    0x45, 0x327, 0x65, 0x327, 0x4f, 0x308,
+    0x304, 0x6f, 0x308, 0x304, 0x4f, 0x303,
+    0x304, 0x6f, 0x303, 0x304, 0x4f, 0x307,
+    0x6f, 0x307, 0x4f, 0x307, 0x304, 0x6f,
+    0x307, 0x304, 0x59, 0x304, 0x79, 0x304,
+    0x68, 0x266, 0x6a, 0x72, 0x279, 0x27b,
+    0x281, 0x77, 0x79, 0x20, 0x306, 0x20,
+    0x307, 0x20, 0x30a, 0x20, 0x328, 0x20,
+    0x303, 0x20, 0x30b, 0x263, 0x6c, 0x73,
+    0x78, 0x295, 0x300, 0x301, 0x313, 0x308,
+    0x301, 0x2b9, 0x20, 0x345, 0x3b, 0x20,
+    0x301, 0xa8, 0x301, 0x20, 0x308, 0x301,
+    0x391, 0x301, 0xb7, 0x395, 0x301, 0x397,
+    0x301, 0x399, 0x301, 0x39f, 0x301, 0x3a5,
+    0x301, 0x3a9, 0x301, 0x3b9, 0x308, 0x301,
+    0x399, 0x308, 0x3a5, 0x308, 0x3b1, 0x301,
+    0x3b5, 0x301, 0x3b7, 0x301, 0x3b9, 0x301,
+    0x3c5, 0x308, 0x301, 0x3b9, 0x308, 0x3c5,
+    0x308, 0x3bf, 0x301, 0x3c5, 0x301, 0x3c9,
+    0x301, 0x3b2, 0x3b8, 0x3a5, 0x3d2, 0x301,
+    0x3a5, 0x301, 0x3d2, 0x308, 0x3a5, 0x308,
+    0x3c6, 0x3c0, 0x3ba, 0x3c1, 0x3c2, 0x398,
+    0x3b5, 0x3a3, 0x415, 0x300, 0x415, 0x308,
+    0x413, 0x301, 0x406, 0x308, 0x41a, 0x301,
+    0x418, 0x300, 0x423, 0x306, 0x418, 0x306,
+    0x438, 0x306, 0x435, 0x300, 0x435, 0x308,
+    0x433, 0x301, 0x456, 0x308, 0x43a, 0x301,
+    0x438, 0x300, 0x443, 0x306, 0x474, 0x30f,
+    0x475, 0x30f, 0x416, 0x306, 0x436, 0x306,
+    0x410, 0x306, 0x430, 0x306, 0x410, 0x308,
+    0x430, 0x308, 0x415, 0x306, 0x435, 0x306,
+    0x4d8, 0x308, 0x4d9, 0x308, 0x416, 0x308,
+    0x436, 0x308, 0x417, 0x308, 0x437, 0x308,
+    0x418, 0x304, 0x438, 0x304, 0x418, 0x308,
+    0x438, 0x308, 0x41e, 0x308, 0x43e, 0x308,
+    0x4e8, 0x308, 0x4e9, 0x308, 0x42d, 0x308,
+    0x44d, 0x308, 0x423, 0x304, 0x443, 0x304,
+    0x423, 0x308, 0x443, 0x308, 0x423, 0x30b,
+    0x443, 0x30b, 0x427, 0x308, 0x447, 0x308,
+    0x42b, 0x308, 0x44b, 0x308, 0x565, 0x582,
+    0x627, 0x653, 0x627, 0x654, 0x648, 0x654,
+    0x627, 0x655, 0x64a, 0x654, 0x627, 0x674,
+    0x648, 0x674, 0x6c7, 0x674, 0x64a, 0x674,
+    0x6d5, 0x654, 0x6c1, 0x654, 0x6d2, 0x654,
+    0x928, 0x93c, 0x930, 0x93c, 0x933, 0x93c,
+    0x915, 0x93c, 0x916, 0x93c, 0x917, 0x93c,
+    0x91c, 0x93c, 0x921, 0x93c, 0x922, 0x93c,
+    0x92b, 0x93c, 0x92f, 0x93c, 0x9c7, 0x9be,
+    0x9c7, 0x9d7, 0x9a1, 0x9bc, 0x9a2, 0x9bc,
+    0x9af, 0x9bc, 0xa32, 0xa3c, 0xa38, 0xa3c,
+    0xa16, 0xa3c, 0xa17, 0xa3c, 0xa1c, 0xa3c,
+    0xa2b, 0xa3c, 0xb47, 0xb56, 0xb47, 0xb3e,
+    0xb47, 0xb57, 0xb21, 0xb3c, 0xb22, 0xb3c,
+    0xb92, 0xbd7, 0xbc6, 0xbbe, 0xbc7, 0xbbe,
+    0xbc6, 0xbd7, 0xc46, 0xc56, 0xcbf, 0xcd5,
+    0xcc6, 0xcd5, 0xcc6, 0xcd6, 0xcc6, 0xcc2,
+    0xcc6, 0xcc2, 0xcd5, 0xd46, 0xd3e, 0xd47,
+    0xd3e, 0xd46, 0xd57, 0xdd9, 0xdca, 0xdd9,
+    0xdcf, 0xdd9, 0xdcf, 0xdca, 0xdd9, 0xddf,
+    0xe4d, 0xe32, 0xecd, 0xeb2, 0xeab, 0xe99,
+    0xeab, 0xea1, 0xf0b, 0xf42, 0xfb7, 0xf4c,
+    0xfb7, 0xf51, 0xfb7, 0xf56, 0xfb7, 0xf5b,
+    0xfb7, 0xf40, 0xfb5, 0xf71, 0xf72, 0xf71,
+    0xf74, 0xfb2, 0xf80, 0xfb2, 0xf71, 0xf80,
+    0xfb3, 0xf80, 0xfb3, 0xf71, 0xf80, 0xf71,
+    0xf80, 0xf92, 0xfb7, 0xf9c, 0xfb7, 0xfa1,
+    0xfb7, 0xfa6, 0xfb7, 0xfab, 0xfb7, 0xf90,
+    0xfb5, 0x1025, 0x102e, 0x10dc, 0x1b05, 0x1b35,
+    0x1b07, 0x1b35, 0x1b09, 0x1b35, 0x1b0b, 0x1b35,
+    0x1b0d, 0x1b35, 0x1b11, 0x1b35, 0x1b3a, 0x1b35,
+    0x1b3c, 0x1b35, 0x1b3e, 0x1b35, 0x1b3f, 0x1b35,
+    0x1b42, 0x1b35, 0x41, 0xc6, 0x42, 0x44,
+    0x45, 0x18e, 0x47, 0x48, 0x49, 0x4a,
+    0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x222,
+    0x50, 0x52, 0x54, 0x55, 0x57, 0x61,
+    0x250, 0x251, 0x1d02, 0x62, 0x64, 0x65,
+    0x259, 0x25b, 0x25c, 0x67, 0x6b, 0x6d,
+    0x14b, 0x6f, 0x254, 0x1d16, 0x1d17, 0x70,
+    0x74, 0x75, 0x1d1d, 0x26f, 0x76, 0x1d25,
+    0x3b2, 0x3b3, 0x3b4, 0x3c6, 0x3c7, 0x69,
+    0x72, 0x75, 0x76, 0x3b2, 0x3b3, 0x3c1,
+    0x3c6, 0x3c7, 0x43d, 0x252, 0x63, 0x255,
+    0xf0, 0x25c, 0x66, 0x25f, 0x261, 0x265,
+    0x268, 0x269, 0x26a, 0x1d7b, 0x29d, 0x26d,
+    0x1d85, 0x29f, 0x271, 0x270, 0x272, 0x273,
+    0x274, 0x275, 0x278, 0x282, 0x283, 0x1ab,
+    0x289, 0x28a, 0x1d1c, 0x28b, 0x28c, 0x7a,
+    0x290, 0x291, 0x292, 0x3b8, 0x41, 0x325,
+    0x61, 0x325, 0x42, 0x307, 0x62, 0x307,
+    0x42, 0x323, 0x62, 0x323, 0x42, 0x331,
+    0x62, 0x331, 0x43, 0x327, 0x301, 0x63,
+    0x327, 0x301, 0x44, 0x307, 0x64, 0x307,
+    0x44, 0x323, 0x64, 0x323, 0x44, 0x331,
+    0x64, 0x331, 0x44, 0x327, 0x64, 0x327,
+    0x44, 0x32d, 0x64, 0x32d, 0x45, 0x304,
+    0x300, 0x65, 0x304, 0x300, 0x45, 0x304,
+    0x301, 0x65, 0x304, 0x301, 0x45, 0x32d,
+    0x65, 0x32d, 0x45, 0x330, 0x65, 0x330,
+    0x45, 0x327, 0x306, 0x65, 0x327, 0x306,
+    0x46, 0x307, 0x66, 0x307, 0x47, 0x304,
+    0x67, 0x304, 0x48, 0x307, 0x68, 0x307,
+    0x48, 0x323, 0x68, 0x323, 0x48, 0x308,
+    0x68, 0x308, 0x48, 0x327, 0x68, 0x327,
+    0x48, 0x32e, 0x68, 0x32e, 0x49, 0x330,
+    0x69, 0x330, 0x49, 0x308, 0x301, 0x69,
+    0x308, 0x301, 0x4b, 0x301, 0x6b, 0x301,
+    0x4b, 0x323, 0x6b, 0x323, 0x4b, 0x331,
+    0x6b, 0x331, 0x4c, 0x323, 0x6c, 0x323,
+    0x4c, 0x323, 0x304, 0x6c, 0x323, 0x304,
+    0x4c, 0x331, 0x6c, 0x331, 0x4c, 0x32d,
+    0x6c, 0x32d, 0x4d, 0x301, 0x6d, 0x301,
+    0x4d, 0x307, 0x6d, 0x307, 0x4d, 0x323,
+    0x6d, 0x323, 0x4e, 0x307, 0x6e, 0x307,
+    0x4e, 0x323, 0x6e, 0x323, 0x4e, 0x331,
+    0x6e, 0x331, 0x4e, 0x32d, 0x6e, 0x32d,
+    0x4f, 0x303, 0x301, 0x6f, 0x303, 0x301,
+    0x4f, 0x303, 0x308, 0x6f, 0x303, 0x308,
+    0x4f, 0x304, 0x300, 0x6f, 0x304, 0x300,
+    0x4f, 0x304, 0x301, 0x6f, 0x304, 0x301,
+    0x50, 0x301, 0x70, 0x301, 0x50, 0x307,
+    0x70, 0x307, 0x52, 0x307, 0x72, 0x307,
+    0x52, 0x323, 0x72, 0x323, 0x52, 0x323,
+    0x304, 0x72, 0x323, 0x304, 0x52, 0x331,
+    0x72, 0x331, 0x53, 0x307, 0x73, 0x307,
+    0x53, 0x323, 0x73, 0x323, 0x53, 0x301,
+    0x307, 0x73, 0x301, 0x307, 0x53, 0x30c,
+    0x307, 0x73, 0x30c, 0x307, 0x53, 0x323,
+    0x307, 0x73, 0x323, 0x307, 0x54, 0x307,
+    0x74, 0x307, 0x54, 0x323, 0x74, 0x323,
+    0x54, 0x331, 0x74, 0x331, 0x54, 0x32d,
+    0x74, 0x32d, 0x55, 0x324, 0x75, 0x324,
+    0x55, 0x330, 0x75, 0x330, 0x55, 0x32d,
+    0x75, 0x32d, 0x55, 0x303, 0x301, 0x75,
+    0x303, 0x301, 0x55, 0x304, 0x308, 0x75,
+    0x304, 0x308, 0x56, 0x303, 0x76, 0x303,
+    0x56, 0x323, 0x76, 0x323, 0x57, 0x300,
+    0x77, 0x300, 0x57, 0x301, 0x77, 0x301,
+    0x57, 0x308, 0x77, 0x308, 0x57, 0x307,
+    0x77, 0x307, 0x57, 0x323, 0x77, 0x323,
+    0x58, 0x307, 0x78, 0x307, 0x58, 0x308,
+    0x78, 0x308, 0x59, 0x307, 0x79, 0x307,
+    0x5a, 0x302, 0x7a, 0x302, 0x5a, 0x323,
+    0x7a, 0x323, 0x5a, 0x331, 0x7a, 0x331,
+    0x68, 0x331, 0x74, 0x308, 0x77, 0x30a,
+    0x79, 0x30a, 0x61, 0x2be, 0x17f, 0x307,
+    0x73, 0x307, 0x41, 0x323, 0x61, 0x323,
+    0x41, 0x309, 0x61, 0x309, 0x41, 0x302,
+    0x301, 0x61, 0x302, 0x301, 0x41, 0x302,
+    0x300, 0x61, 0x302, 0x300, 0x41, 0x302,
+    0x309, 0x61, 0x302, 0x309, 0x41, 0x302,
+    0x303, 0x61, 0x302, 0x303, 0x41, 0x323,
+    0x302, 0x61, 0x323, 0x302, 0x41, 0x306,
+    0x301, 0x61, 0x306, 0x301, 0x41, 0x306,
+    0x300, 0x61, 0x306, 0x300, 0x41, 0x306,
+    0x309, 0x61, 0x306, 0x309, 0x41, 0x306,
+    0x303, 0x61, 0x306, 0x303, 0x41, 0x323,
+    0x306, 0x61, 0x323, 0x306, 0x45, 0x323,
+    0x65, 0x323, 0x45, 0x309, 0x65, 0x309,
+    0x45, 0x303, 0x65, 0x303, 0x45, 0x302,
+    0x301, 0x65, 0x302, 0x301, 0x45, 0x302,
+    0x300, 0x65, 0x302, 0x300, 0x45, 0x302,
+    0x309, 0x65, 0x302, 0x309, 0x45, 0x302,
+    0x303, 0x65, 0x302, 0x303, 0x45, 0x323,
+    0x302, 0x65, 0x323, 0x302, 0x49, 0x309,
+    0x69, 0x309, 0x49, 0x323, 0x69, 0x323,
+    0x4f, 0x323, 0x6f, 0x323, 0x4f, 0x309,
+    0x6f, 0x309, 0x4f, 0x302, 0x301, 0x6f,
+    0x302, 0x301, 0x4f, 0x302, 0x300, 0x6f,
+    0x302, 0x300, 0x4f, 0x302, 0x309, 0x6f,
+    0x302, 0x309, 0x4f, 0x302, 0x303, 0x6f,
+    0x302, 0x303, 0x4f, 0x323, 0x302, 0x6f,
+    0x323, 0x302, 0x4f, 0x31b, 0x301, 0x6f,
+    0x31b, 0x301, 0x4f, 0x31b, 0x300, 0x6f,
+    0x31b, 0x300, 0x4f, 0x31b, 0x309, 0x6f,
+    0x31b, 0x309, 0x4f, 0x31b, 0x303, 0x6f,
+    0x31b, 0x303, 0x4f, 0x31b, 0x323, 0x6f,
+    0x31b, 0x323, 0x55, 0x323, 0x75, 0x323,
+    0x55, 0x309, 0x75, 0x309, 0x55, 0x31b,
+    0x301, 0x75, 0x31b, 0x301, 0x55, 0x31b,
+    0x300, 0x75, 0x31b, 0x300, 0x55, 0x31b,
+    0x309, 0x75, 0x31b, 0x309, 0x55, 0x31b,
+    0x303, 0x75, 0x31b, 0x303, 0x55, 0x31b,
+    0x323, 0x75, 0x31b, 0x323, 0x59, 0x300,
+    0x79, 0x300, 0x59, 0x323, 0x79, 0x323,
+    0x59, 0x309, 0x79, 0x309, 0x59, 0x303,
+    0x79, 0x303, 0x3b1, 0x313, 0x3b1, 0x314,
+    0x3b1, 0x313, 0x300, 0x3b1, 0x314, 0x300,
+    0x3b1, 0x313, 0x301, 0x3b1, 0x314, 0x301,
+    0x3b1, 0x313, 0x342, 0x3b1, 0x314, 0x342,
+    0x391, 0x313, 0x391, 0x314, 0x391, 0x313,
+    0x300, 0x391, 0x314, 0x300, 0x391, 0x313,
+    0x301, 0x391, 0x314, 0x301, 0x391, 0x313,
+    0x342, 0x391, 0x314, 0x342, 0x3b5, 0x313,
+    0x3b5, 0x314, 0x3b5, 0x313, 0x300, 0x3b5,
+    0x314, 0x300, 0x3b5, 0x313, 0x301, 0x3b5,
+    0x314, 0x301, 0x395, 0x313, 0x395, 0x314,
+    0x395, 0x313, 0x300, 0x395, 0x314, 0x300,
+    0x395, 0x313, 0x301, 0x395, 0x314, 0x301,
+    0x3b7, 0x313, 0x3b7, 0x314, 0x3b7, 0x313,
+    0x300, 0x3b7, 0x314, 0x300, 0x3b7, 0x313,
+    0x301, 0x3b7, 0x314, 0x301, 0x3b7, 0x313,
+    0x342, 0x3b7, 0x314, 0x342, 0x397, 0x313,
+    0x397, 0x314, 0x397, 0x313, 0x300, 0x397,
+    0x314, 0x300, 0x397, 0x313, 0x301, 0x397,
+    0x314, 0x301, 0x397, 0x313, 0x342, 0x397,
+    0x314, 0x342, 0x3b9, 0x313, 0x3b9, 0x314,
+    0x3b9, 0x313, 0x300, 0x3b9, 0x314, 0x300,
+    0x3b9, 0x313, 0x301, 0x3b9, 0x314, 0x301,
+    0x3b9, 0x313, 0x342, 0x3b9, 0x314, 0x342,
+    0x399, 0x313, 0x399, 0x314, 0x399, 0x313,
+    0x300, 0x399, 0x314, 0x300, 0x399, 0x313,
+    0x301, 0x399, 0x314, 0x301, 0x399, 0x313,
+    0x342, 0x399, 0x314, 0x342, 0x3bf, 0x313,
+    0x3bf, 0x314, 0x3bf, 0x313, 0x300, 0x3bf,
+    0x314, 0x300, 0x3bf, 0x313, 0x301, 0x3bf,
+    0x314, 0x301, 0x39f, 0x313, 0x39f, 0x314,
+    0x39f, 0x313, 0x300, 0x39f, 0x314, 0x300,
+    0x39f, 0x313, 0x301, 0x39f, 0x314, 0x301,
+    0x3c5, 0x313, 0x3c5, 0x314, 0x3c5, 0x313,
+    0x300, 0x3c5, 0x314, 0x300, 0x3c5, 0x313,
+    0x301, 0x3c5, 0x314, 0x301, 0x3c5, 0x313,
+    0x342, 0x3c5, 0x314, 0x342, 0x3a5, 0x314,
+    0x3a5, 0x314, 0x300, 0x3a5, 0x314, 0x301,
+    0x3a5, 0x314, 0x342, 0x3c9, 0x313, 0x3c9,
+    0x314, 0x3c9, 0x313, 0x300, 0x3c9, 0x314,
+    0x300, 0x3c9, 0x313, 0x301, 0x3c9, 0x314,
+    0x301, 0x3c9, 0x313, 0x342, 0x3c9, 0x314,
+    0x342, 0x3a9, 0x313, 0x3a9, 0x314, 0x3a9,
+    0x313, 0x300, 0x3a9, 0x314, 0x300, 0x3a9,
+    0x313, 0x301, 0x3a9, 0x314, 0x301, 0x3a9,
+    0x313, 0x342, 0x3a9, 0x314, 0x342, 0x3b1,
+    0x300, 0x3b1, 0x301, 0x3b5, 0x300, 0x3b5,
+    0x301, 0x3b7, 0x300, 0x3b7, 0x301, 0x3b9,
+    0x300, 0x3b9, 0x301, 0x3bf, 0x300, 0x3bf,
+    0x301, 0x3c5, 0x300, 0x3c5, 0x301, 0x3c9,
+    0x300, 0x3c9, 0x301, 0x3b1, 0x313, 0x345,
+    0x3b1, 0x314, 0x345, 0x3b1, 0x313, 0x300,
+    0x345, 0x3b1, 0x314, 0x300, 0x345, 0x3b1,
+    0x313, 0x301, 0x345, 0x3b1, 0x314, 0x301,
+    0x345, 0x3b1, 0x313, 0x342, 0x345, 0x3b1,
+    0x314, 0x342, 0x345, 0x391, 0x313, 0x345,
+    0x391, 0x314, 0x345, 0x391, 0x313, 0x300,
+    0x345, 0x391, 0x314, 0x300, 0x345, 0x391,
+    0x313, 0x301, 0x345, 0x391, 0x314, 0x301,
+    0x345, 0x391, 0x313, 0x342, 0x345, 0x391,
+    0x314, 0x342, 0x345, 0x3b7, 0x313, 0x345,
+    0x3b7, 0x314, 0x345, 0x3b7, 0x313, 0x300,
+    0x345, 0x3b7, 0x314, 0x300, 0x345, 0x3b7,
+    0x313, 0x301, 0x345, 0x3b7, 0x314, 0x301,
+    0x345, 0x3b7, 0x313, 0x342, 0x345, 0x3b7,
+    0x314, 0x342, 0x345, 0x397, 0x313, 0x345,
+    0x397, 0x314, 0x345, 0x397, 0x313, 0x300,
+    0x345, 0x397, 0x314, 0x300, 0x345, 0x397,
+    0x313, 0x301, 0x345, 0x397, 0x314, 0x301,
+    0x345, 0x397, 0x313, 0x342, 0x345, 0x397,
+    0x314, 0x342, 0x345, 0x3c9, 0x313, 0x345,
+    0x3c9, 0x314, 0x345, 0x3c9, 0x313, 0x300,
+    0x345, 0x3c9, 0x314, 0x300, 0x345, 0x3c9,
+    0x313, 0x301, 0x345, 0x3c9, 0x314, 0x301,
+    0x345, 0x3c9, 0x313, 0x342, 0x345, 0x3c9,
+    0x314, 0x342, 0x345, 0x3a9, 0x313, 0x345,
+    0x3a9, 0x314, 0x345, 0x3a9, 0x313, 0x300,
+    0x345, 0x3a9, 0x314, 0x300, 0x345, 0x3a9,
+    0x313, 0x301, 0x345, 0x3a9, 0x314, 0x301,
+    0x345, 0x3a9, 0x313, 0x342, 0x345, 0x3a9,
+    0x314, 0x342, 0x345, 0x3b1, 0x306, 0x3b1,
+    0x304, 0x3b1, 0x300, 0x345, 0x3b1, 0x345,
+    0x3b1, 0x301, 0x345, 0x3b1, 0x342, 0x3b1,
+    0x342, 0x345, 0x391, 0x306, 0x391, 0x304,
+    0x391, 0x300, 0x391, 0x301, 0x391, 0x345,
+    0x20, 0x313, 0x3b9, 0x20, 0x313, 0x20,
+    0x342, 0xa8, 0x342, 0x20, 0x308, 0x342,
+    0x3b7, 0x300, 0x345, 0x3b7, 0x345, 0x3b7,
+    0x301, 0x345, 0x3b7, 0x342, 0x3b7, 0x342,
+    0x345, 0x395, 0x300, 0x395, 0x301, 0x397,
+    0x300, 0x397, 0x301, 0x397, 0x345, 0x1fbf,
+    0x300, 0x20, 0x313, 0x300, 0x1fbf, 0x301,
+    0x20, 0x313, 0x301, 0x1fbf, 0x342, 0x20,
+    0x313, 0x342, 0x3b9, 0x306, 0x3b9, 0x304,
+    0x3b9, 0x308, 0x300, 0x3b9, 0x308, 0x301,
+    0x3b9, 0x342, 0x3b9, 0x308, 0x342, 0x399,
+    0x306, 0x399, 0x304, 0x399, 0x300, 0x399,
+    0x301, 0x1ffe, 0x300, 0x20, 0x314, 0x300,
+    0x1ffe, 0x301, 0x20, 0x314, 0x301, 0x1ffe,
+    0x342, 0x20, 0x314, 0x342, 0x3c5, 0x306,
+    0x3c5, 0x304, 0x3c5, 0x308, 0x300, 0x3c5,
+    0x308, 0x301, 0x3c1, 0x313, 0x3c1, 0x314,
+    0x3c5, 0x342, 0x3c5, 0x308, 0x342, 0x3a5,
+    0x306, 0x3a5, 0x304, 0x3a5, 0x300, 0x3a5,
+    0x301, 0x3a1, 0x314, 0xa8, 0x300, 0x20,
+    0x308, 0x300, 0xa8, 0x301, 0x20, 0x308,
+    0x301, 0x60, 0x3c9, 0x300, 0x345, 0x3c9,
+    0x345, 0x3c9, 0x301, 0x345, 0x3c9, 0x342,
+    0x3c9, 0x342, 0x345, 0x39f, 0x300, 0x39f,
+    0x301, 0x3a9, 0x300, 0x3a9, 0x301, 0x3a9,
+    0x345, 0xb4, 0x20, 0x301, 0x20, 0x314,
+    0x2002, 0x20, 0x2003, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x2010, 0x20, 0x333, 0x2e, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x20, 0x2032,
+    0x2032, 0x2032, 0x2032, 0x2032, 0x2035, 0x2035,
+    0x2035, 0x2035, 0x2035, 0x21, 0x21, 0x20,
+    0x305, 0x3f, 0x3f, 0x3f, 0x21, 0x21,
+    0x3f, 0x2032, 0x2032, 0x2032, 0x2032, 0x20,
+    0x30, 0x69, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x2b, 0x2212, 0x3d, 0x28,
+    0x29, 0x6e, 0x30, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39,
+    0x2b, 0x2212, 0x3d, 0x28, 0x29, 0x61,
+    0x65, 0x6f, 0x78, 0x259, 0x68, 0x6b,
+    0x6c, 0x6d, 0x6e, 0x70, 0x73, 0x74,
+    0x52, 0x73, 0x61, 0x2f, 0x63, 0x61,
+    0x2f, 0x73, 0x43, 0xb0, 0x43, 0x63,
+    0x2f, 0x6f, 0x63, 0x2f, 0x75, 0x190,
+    0xb0, 0x46, 0x67, 0x48, 0x48, 0x48,
+    0x68, 0x127, 0x49, 0x49, 0x4c, 0x6c,
+    0x4e, 0x4e, 0x6f, 0x50, 0x51, 0x52,
+    0x52, 0x52, 0x53, 0x4d, 0x54, 0x45,
+    0x4c, 0x54, 0x4d, 0x5a, 0x3a9, 0x5a,
+    0x4b, 0x41, 0x30a, 0x42, 0x43, 0x65,
+    0x45, 0x46, 0x4d, 0x6f, 0x5d0, 0x5d1,
+    0x5d2, 0x5d3, 0x69, 0x46, 0x41, 0x58,
+    0x3c0, 0x3b3, 0x393, 0x3a0, 0x2211, 0x44,
+    0x64, 0x65, 0x69, 0x6a, 0x31, 0x2044,
+    0x37, 0x31, 0x2044, 0x39, 0x31, 0x2044,
+    0x31, 0x30, 0x31, 0x2044, 0x33, 0x32,
+    0x2044, 0x33, 0x31, 0x2044, 0x35, 0x32,
+    0x2044, 0x35, 0x33, 0x2044, 0x35, 0x34,
+    0x2044, 0x35, 0x31, 0x2044, 0x36, 0x35,
+    0x2044, 0x36, 0x31, 0x2044, 0x38, 0x33,
+    0x2044, 0x38, 0x35, 0x2044, 0x38, 0x37,
+    0x2044, 0x38, 0x31, 0x2044, 0x49, 0x49,
+    0x49, 0x49, 0x49, 0x49, 0x49, 0x56,
+    0x56, 0x56, 0x49, 0x56, 0x49, 0x49,
+    0x56, 0x49, 0x49, 0x49, 0x49, 0x58,
+    0x58, 0x58, 0x49, 0x58, 0x49, 0x49,
+    0x4c, 0x43, 0x44, 0x4d, 0x69, 0x69,
+    0x69, 0x69, 0x69, 0x69, 0x69, 0x76,
+    0x76, 0x76, 0x69, 0x76, 0x69, 0x69,
+    0x76, 0x69, 0x69, 0x69, 0x69, 0x78,
+    0x78, 0x78, 0x69, 0x78, 0x69, 0x69,
+    0x6c, 0x63, 0x64, 0x6d, 0x30, 0x2044,
+    0x33, 0x2190, 0x338, 0x2192, 0x338, 0x2194,
+    0x338, 0x21d0, 0x338, 0x21d4, 0x338, 0x21d2,
+    0x338, 0x2203, 0x338, 0x2208, 0x338, 0x220b,
+    0x338, 0x2223, 0x338, 0x2225, 0x338, 0x222b,
+    0x222b, 0x222b, 0x222b, 0x222b, 0x222e, 0x222e,
+    0x222e, 0x222e, 0x222e, 0x223c, 0x338, 0x2243,
+    0x338, 0x2245, 0x338, 0x2248, 0x338, 0x3d,
+    0x338, 0x2261, 0x338, 0x224d, 0x338, 0x3c,
+    0x338, 0x3e, 0x338, 0x2264, 0x338, 0x2265,
+    0x338, 0x2272, 0x338, 0x2273, 0x338, 0x2276,
+    0x338, 0x2277, 0x338, 0x227a, 0x338, 0x227b,
+    0x338, 0x2282, 0x338, 0x2283, 0x338, 0x2286,
+    0x338, 0x2287, 0x338, 0x22a2, 0x338, 0x22a8,
+    0x338, 0x22a9, 0x338, 0x22ab, 0x338, 0x227c,
+    0x338, 0x227d, 0x338, 0x2291, 0x338, 0x2292,
+    0x338, 0x22b2, 0x338, 0x22b3, 0x338, 0x22b4,
+    0x338, 0x22b5, 0x338, 0x3008, 0x3009, 0x31,
+    0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x31, 0x30, 0x31, 0x31,
+    0x31, 0x32, 0x31, 0x33, 0x31, 0x34,
+    0x31, 0x35, 0x31, 0x36, 0x31, 0x37,
+    0x31, 0x38, 0x31, 0x39, 0x32, 0x30,
+    0x28, 0x31, 0x29, 0x28, 0x32, 0x29,
+    0x28, 0x33, 0x29, 0x28, 0x34, 0x29,
+    0x28, 0x35, 0x29, 0x28, 0x36, 0x29,
+    0x28, 0x37, 0x29, 0x28, 0x38, 0x29,
+    0x28, 0x39, 0x29, 0x28, 0x31, 0x30,
+    0x29, 0x28, 0x31, 0x31, 0x29, 0x28,
+    0x31, 0x32, 0x29, 0x28, 0x31, 0x33,
+    0x29, 0x28, 0x31, 0x34, 0x29, 0x28,
+    0x31, 0x35, 0x29, 0x28, 0x31, 0x36,
+    0x29, 0x28, 0x31, 0x37, 0x29, 0x28,
+    0x31, 0x38, 0x29, 0x28, 0x31, 0x39,
+    0x29, 0x28, 0x32, 0x30, 0x29, 0x31,
+    0x2e, 0x32, 0x2e, 0x33, 0x2e, 0x34,
+    0x2e, 0x35, 0x2e, 0x36, 0x2e, 0x37,
+    0x2e, 0x38, 0x2e, 0x39, 0x2e, 0x31,
+    0x30, 0x2e, 0x31, 0x31, 0x2e, 0x31,
+    0x32, 0x2e, 0x31, 0x33, 0x2e, 0x31,
+    0x34, 0x2e, 0x31, 0x35, 0x2e, 0x31,
+    0x36, 0x2e, 0x31, 0x37, 0x2e, 0x31,
+    0x38, 0x2e, 0x31, 0x39, 0x2e, 0x32,
+    0x30, 0x2e, 0x28, 0x61, 0x29, 0x28,
+    0x62, 0x29, 0x28, 0x63, 0x29, 0x28,
+    0x64, 0x29, 0x28, 0x65, 0x29, 0x28,
+    0x66, 0x29, 0x28, 0x67, 0x29, 0x28,
+    0x68, 0x29, 0x28, 0x69, 0x29, 0x28,
+    0x6a, 0x29, 0x28, 0x6b, 0x29, 0x28,
+    0x6c, 0x29, 0x28, 0x6d, 0x29, 0x28,
+    0x6e, 0x29, 0x28, 0x6f, 0x29, 0x28,
+    0x70, 0x29, 0x28, 0x71, 0x29, 0x28,
+    0x72, 0x29, 0x28, 0x73, 0x29, 0x28,
+    0x74, 0x29, 0x28, 0x75, 0x29, 0x28,
+    0x76, 0x29, 0x28, 0x77, 0x29, 0x28,
+    0x78, 0x29, 0x28, 0x79, 0x29, 0x28,
+    0x7a, 0x29, 0x41, 0x42, 0x43, 0x44,
+    0x45, 0x46, 0x47, 0x48, 0x49, 0x4a,
+    0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0x53, 0x54, 0x55, 0x56,
+    0x57, 0x58, 0x59, 0x5a, 0x61, 0x62,
+    0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e,
+    0x6f, 0x70, 0x71, 0x72, 0x73, 0x74,
+    0x75, 0x76, 0x77, 0x78, 0x79, 0x7a,
+    0x30, 0x222b, 0x222b, 0x222b, 0x222b, 0x3a,
+    0x3a, 0x3d, 0x3d, 0x3d, 0x3d, 0x3d,
+    0x3d, 0x2add, 0x338, 0x6a, 0x56, 0x2d61,
+    0x6bcd, 0x9f9f, 0x4e00, 0x4e28, 0x4e36, 0x4e3f,
+    0x4e59, 0x4e85, 0x4e8c, 0x4ea0, 0x4eba, 0x513f,
+    0x5165, 0x516b, 0x5182, 0x5196, 0x51ab, 0x51e0,
+    0x51f5, 0x5200, 0x529b, 0x52f9, 0x5315, 0x531a,
+    0x5338, 0x5341, 0x535c, 0x5369, 0x5382, 0x53b6,
+    0x53c8, 0x53e3, 0x56d7, 0x571f, 0x58eb, 0x5902,
+    0x590a, 0x5915, 0x5927, 0x5973, 0x5b50, 0x5b80,
+    0x5bf8, 0x5c0f, 0x5c22, 0x5c38, 0x5c6e, 0x5c71,
+    0x5ddb, 0x5de5, 0x5df1, 0x5dfe, 0x5e72, 0x5e7a,
+    0x5e7f, 0x5ef4, 0x5efe, 0x5f0b, 0x5f13, 0x5f50,
+    0x5f61, 0x5f73, 0x5fc3, 0x6208, 0x6236, 0x624b,
+    0x652f, 0x6534, 0x6587, 0x6597, 0x65a4, 0x65b9,
+    0x65e0, 0x65e5, 0x66f0, 0x6708, 0x6728, 0x6b20,
+    0x6b62, 0x6b79, 0x6bb3, 0x6bcb, 0x6bd4, 0x6bdb,
+    0x6c0f, 0x6c14, 0x6c34, 0x706b, 0x722a, 0x7236,
+    0x723b, 0x723f, 0x7247, 0x7259, 0x725b, 0x72ac,
+    0x7384, 0x7389, 0x74dc, 0x74e6, 0x7518, 0x751f,
+    0x7528, 0x7530, 0x758b, 0x7592, 0x7676, 0x767d,
+    0x76ae, 0x76bf, 0x76ee, 0x77db, 0x77e2, 0x77f3,
+    0x793a, 0x79b8, 0x79be, 0x7a74, 0x7acb, 0x7af9,
+    0x7c73, 0x7cf8, 0x7f36, 0x7f51, 0x7f8a, 0x7fbd,
+    0x8001, 0x800c, 0x8012, 0x8033, 0x807f, 0x8089,
+    0x81e3, 0x81ea, 0x81f3, 0x81fc, 0x820c, 0x821b,
+    0x821f, 0x826e, 0x8272, 0x8278, 0x864d, 0x866b,
+    0x8840, 0x884c, 0x8863, 0x897e, 0x898b, 0x89d2,
+    0x8a00, 0x8c37, 0x8c46, 0x8c55, 0x8c78, 0x8c9d,
+    0x8d64, 0x8d70, 0x8db3, 0x8eab, 0x8eca, 0x8f9b,
+    0x8fb0, 0x8fb5, 0x9091, 0x9149, 0x91c6, 0x91cc,
+    0x91d1, 0x9577, 0x9580, 0x961c, 0x96b6, 0x96b9,
+    0x96e8, 0x9751, 0x975e, 0x9762, 0x9769, 0x97cb,
+    0x97ed, 0x97f3, 0x9801, 0x98a8, 0x98db, 0x98df,
+    0x9996, 0x9999, 0x99ac, 0x9aa8, 0x9ad8, 0x9adf,
+    0x9b25, 0x9b2f, 0x9b32, 0x9b3c, 0x9b5a, 0x9ce5,
+    0x9e75, 0x9e7f, 0x9ea5, 0x9ebb, 0x9ec3, 0x9ecd,
+    0x9ed1, 0x9ef9, 0x9efd, 0x9f0e, 0x9f13, 0x9f20,
+    0x9f3b, 0x9f4a, 0x9f52, 0x9f8d, 0x9f9c, 0x9fa0,
+    0x20, 0x3012, 0x5341, 0x5344, 0x5345, 0x304b,
+    0x3099, 0x304d, 0x3099, 0x304f, 0x3099, 0x3051,
+    0x3099, 0x3053, 0x3099, 0x3055, 0x3099, 0x3057,
+    0x3099, 0x3059, 0x3099, 0x305b, 0x3099, 0x305d,
+    0x3099, 0x305f, 0x3099, 0x3061, 0x3099, 0x3064,
+    0x3099, 0x3066, 0x3099, 0x3068, 0x3099, 0x306f,
+    0x3099, 0x306f, 0x309a, 0x3072, 0x3099, 0x3072,
+    0x309a, 0x3075, 0x3099, 0x3075, 0x309a, 0x3078,
+    0x3099, 0x3078, 0x309a, 0x307b, 0x3099, 0x307b,
+    0x309a, 0x3046, 0x3099, 0x20, 0x3099, 0x20,
+    0x309a, 0x309d, 0x3099, 0x3088, 0x308a, 0x30ab,
+    0x3099, 0x30ad, 0x3099, 0x30af, 0x3099, 0x30b1,
+    0x3099, 0x30b3, 0x3099, 0x30b5, 0x3099, 0x30b7,
+    0x3099, 0x30b9, 0x3099, 0x30bb, 0x3099, 0x30bd,
+    0x3099, 0x30bf, 0x3099, 0x30c1, 0x3099, 0x30c4,
+    0x3099, 0x30c6, 0x3099, 0x30c8, 0x3099, 0x30cf,
+    0x3099, 0x30cf, 0x309a, 0x30d2, 0x3099, 0x30d2,
+    0x309a, 0x30d5, 0x3099, 0x30d5, 0x309a, 0x30d8,
+    0x3099, 0x30d8, 0x309a, 0x30db, 0x3099, 0x30db,
+    0x309a, 0x30a6, 0x3099, 0x30ef, 0x3099, 0x30f0,
+    0x3099, 0x30f1, 0x3099, 0x30f2, 0x3099, 0x30fd,
+    0x3099, 0x30b3, 0x30c8, 0x1100, 0x1101, 0x11aa,
+    0x1102, 0x11ac, 0x11ad, 0x1103, 0x1104, 0x1105,
+    0x11b0, 0x11b1, 0x11b2, 0x11b3, 0x11b4, 0x11b5,
+    0x111a, 0x1106, 0x1107, 0x1108, 0x1121, 0x1109,
+    0x110a, 0x110b, 0x110c, 0x110d, 0x110e, 0x110f,
+    0x1110, 0x1111, 0x1112, 0x1161, 0x1162, 0x1163,
+    0x1164, 0x1165, 0x1166, 0x1167, 0x1168, 0x1169,
+    0x116a, 0x116b, 0x116c, 0x116d, 0x116e, 0x116f,
+    0x1170, 0x1171, 0x1172, 0x1173, 0x1174, 0x1175,
+    0x1160, 0x1114, 0x1115, 0x11c7, 0x11c8, 0x11cc,
+    0x11ce, 0x11d3, 0x11d7, 0x11d9, 0x111c, 0x11dd,
+    0x11df, 0x111d, 0x111e, 0x1120, 0x1122, 0x1123,
+    0x1127, 0x1129, 0x112b, 0x112c, 0x112d, 0x112e,
+    0x112f, 0x1132, 0x1136, 0x1140, 0x1147, 0x114c,
+    0x11f1, 0x11f2, 0x1157, 0x1158, 0x1159, 0x1184,
+    0x1185, 0x1188, 0x1191, 0x1192, 0x1194, 0x119e,
+    0x11a1, 0x4e00, 0x4e8c, 0x4e09, 0x56db, 0x4e0a,
+    0x4e2d, 0x4e0b, 0x7532, 0x4e59, 0x4e19, 0x4e01,
+    0x5929, 0x5730, 0x4eba, 0x28, 0x1100, 0x29,
+    0x28, 0x1102, 0x29, 0x28, 0x1103, 0x29,
+    0x28, 0x1105, 0x29, 0x28, 0x1106, 0x29,
+    0x28, 0x1107, 0x29, 0x28, 0x1109, 0x29,
+    0x28, 0x110b, 0x29, 0x28, 0x110c, 0x29,
+    0x28, 0x110e, 0x29, 0x28, 0x110f, 0x29,
+    0x28, 0x1110, 0x29, 0x28, 0x1111, 0x29,
+    0x28, 0x1112, 0x29, 0x28, 0x1100, 0x1161,
+    0x29, 0x28, 0x1102, 0x1161, 0x29, 0x28,
+    0x1103, 0x1161, 0x29, 0x28, 0x1105, 0x1161,
+    0x29, 0x28, 0x1106, 0x1161, 0x29, 0x28,
+    0x1107, 0x1161, 0x29, 0x28, 0x1109, 0x1161,
+    0x29, 0x28, 0x110b, 0x1161, 0x29, 0x28,
+    0x110c, 0x1161, 0x29, 0x28, 0x110e, 0x1161,
+    0x29, 0x28, 0x110f, 0x1161, 0x29, 0x28,
+    0x1110, 0x1161, 0x29, 0x28, 0x1111, 0x1161,
+    0x29, 0x28, 0x1112, 0x1161, 0x29, 0x28,
+    0x110c, 0x116e, 0x29, 0x28, 0x110b, 0x1169,
+    0x110c, 0x1165, 0x11ab, 0x29, 0x28, 0x110b,
+    0x1169, 0x1112, 0x116e, 0x29, 0x28, 0x4e00,
+    0x29, 0x28, 0x4e8c, 0x29, 0x28, 0x4e09,
+    0x29, 0x28, 0x56db, 0x29, 0x28, 0x4e94,
+    0x29, 0x28, 0x516d, 0x29, 0x28, 0x4e03,
+    0x29, 0x28, 0x516b, 0x29, 0x28, 0x4e5d,
+    0x29, 0x28, 0x5341, 0x29, 0x28, 0x6708,
+    0x29, 0x28, 0x706b, 0x29, 0x28, 0x6c34,
+    0x29, 0x28, 0x6728, 0x29, 0x28, 0x91d1,
+    0x29, 0x28, 0x571f, 0x29, 0x28, 0x65e5,
+    0x29, 0x28, 0x682a, 0x29, 0x28, 0x6709,
+    0x29, 0x28, 0x793e, 0x29, 0x28, 0x540d,
+    0x29, 0x28, 0x7279, 0x29, 0x28, 0x8ca1,
+    0x29, 0x28, 0x795d, 0x29, 0x28, 0x52b4,
+    0x29, 0x28, 0x4ee3, 0x29, 0x28, 0x547c,
+    0x29, 0x28, 0x5b66, 0x29, 0x28, 0x76e3,
+    0x29, 0x28, 0x4f01, 0x29, 0x28, 0x8cc7,
+    0x29, 0x28, 0x5354, 0x29, 0x28, 0x796d,
+    0x29, 0x28, 0x4f11, 0x29, 0x28, 0x81ea,
+    0x29, 0x28, 0x81f3, 0x29, 0x554f, 0x5e7c,
+    0x6587, 0x7b8f, 0x50, 0x54, 0x45, 0x32,
+    0x31, 0x32, 0x32, 0x32, 0x33, 0x32,
+    0x34, 0x32, 0x35, 0x32, 0x36, 0x32,
+    0x37, 0x32, 0x38, 0x32, 0x39, 0x33,
+    0x30, 0x33, 0x31, 0x33, 0x32, 0x33,
+    0x33, 0x33, 0x34, 0x33, 0x35, 0x1100,
+    0x1102, 0x1103, 0x1105, 0x1106, 0x1107, 0x1109,
+    0x110b, 0x110c, 0x110e, 0x110f, 0x1110, 0x1111,
+    0x1112, 0x1100, 0x1161, 0x1102, 0x1161, 0x1103,
+    0x1161, 0x1105, 0x1161, 0x1106, 0x1161, 0x1107,
+    0x1161, 0x1109, 0x1161, 0x110b, 0x1161, 0x110c,
+    0x1161, 0x110e, 0x1161, 0x110f, 0x1161, 0x1110,
+    0x1161, 0x1111, 0x1161, 0x1112, 0x1161, 0x110e,
+    0x1161, 0x11b7, 0x1100, 0x1169, 0x110c, 0x116e,
+    0x110b, 0x1174, 0x110b, 0x116e, 0x4e00, 0x4e8c,
+    0x4e09, 0x56db, 0x4e94, 0x516d, 0x4e03, 0x516b,
+    0x4e5d, 0x5341, 0x6708, 0x706b, 0x6c34, 0x6728,
+    0x91d1, 0x571f, 0x65e5, 0x682a, 0x6709, 0x793e,
+    0x540d, 0x7279, 0x8ca1, 0x795d, 0x52b4, 0x79d8,
+    0x7537, 0x5973, 0x9069, 0x512a, 0x5370, 0x6ce8,
+    0x9805, 0x4f11, 0x5199, 0x6b63, 0x4e0a, 0x4e2d,
+    0x4e0b, 0x5de6, 0x53f3, 0x533b, 0x5b97, 0x5b66,
+    0x76e3, 0x4f01, 0x8cc7, 0x5354, 0x591c, 0x33,
+    0x36, 0x33, 0x37, 0x33, 0x38, 0x33,
+    0x39, 0x34, 0x30, 0x34, 0x31, 0x34,
+    0x32, 0x34, 0x33, 0x34, 0x34, 0x34,
+    0x35, 0x34, 0x36, 0x34, 0x37, 0x34,
+    0x38, 0x34, 0x39, 0x35, 0x30, 0x31,
+    0x6708, 0x32, 0x6708, 0x33, 0x6708, 0x34,
+    0x6708, 0x35, 0x6708, 0x36, 0x6708, 0x37,
+    0x6708, 0x38, 0x6708, 0x39, 0x6708, 0x31,
+    0x30, 0x6708, 0x31, 0x31, 0x6708, 0x31,
+    0x32, 0x6708, 0x48, 0x67, 0x65, 0x72,
+    0x67, 0x65, 0x56, 0x4c, 0x54, 0x44,
+    0x30a2, 0x30a4, 0x30a6, 0x30a8, 0x30aa, 0x30ab,
+    0x30ad, 0x30af, 0x30b1, 0x30b3, 0x30b5, 0x30b7,
+    0x30b9, 0x30bb, 0x30bd, 0x30bf, 0x30c1, 0x30c4,
+    0x30c6, 0x30c8, 0x30ca, 0x30cb, 0x30cc, 0x30cd,
+    0x30ce, 0x30cf, 0x30d2, 0x30d5, 0x30d8, 0x30db,
+    0x30de, 0x30df, 0x30e0, 0x30e1, 0x30e2, 0x30e4,
+    0x30e6, 0x30e8, 0x30e9, 0x30ea, 0x30eb, 0x30ec,
+    0x30ed, 0x30ef, 0x30f0, 0x30f1, 0x30f2, 0x4ee4,
+    0x548c, 0x30a2, 0x30cf, 0x309a, 0x30fc, 0x30c8,
+    0x30a2, 0x30eb, 0x30d5, 0x30a1, 0x30a2, 0x30f3,
+    0x30d8, 0x309a, 0x30a2, 0x30a2, 0x30fc, 0x30eb,
+    0x30a4, 0x30cb, 0x30f3, 0x30af, 0x3099, 0x30a4,
+    0x30f3, 0x30c1, 0x30a6, 0x30a9, 0x30f3, 0x30a8,
+    0x30b9, 0x30af, 0x30fc, 0x30c8, 0x3099, 0x30a8,
+    0x30fc, 0x30ab, 0x30fc, 0x30aa, 0x30f3, 0x30b9,
+    0x30aa, 0x30fc, 0x30e0, 0x30ab, 0x30a4, 0x30ea,
+    0x30ab, 0x30e9, 0x30c3, 0x30c8, 0x30ab, 0x30ed,
+    0x30ea, 0x30fc, 0x30ab, 0x3099, 0x30ed, 0x30f3,
+    0x30ab, 0x3099, 0x30f3, 0x30de, 0x30ad, 0x3099,
+    0x30ab, 0x3099, 0x30ad, 0x3099, 0x30cb, 0x30fc,
+    0x30ad, 0x30e5, 0x30ea, 0x30fc, 0x30ad, 0x3099,
+    0x30eb, 0x30bf, 0x3099, 0x30fc, 0x30ad, 0x30ed,
+    0x30ad, 0x30ed, 0x30af, 0x3099, 0x30e9, 0x30e0,
+    0x30ad, 0x30ed, 0x30e1, 0x30fc, 0x30c8, 0x30eb,
+    0x30ad, 0x30ed, 0x30ef, 0x30c3, 0x30c8, 0x30af,
+    0x3099, 0x30e9, 0x30e0, 0x30af, 0x3099, 0x30e9,
+    0x30e0, 0x30c8, 0x30f3, 0x30af, 0x30eb, 0x30bb,
+    0x3099, 0x30a4, 0x30ed, 0x30af, 0x30ed, 0x30fc,
+    0x30cd, 0x30b1, 0x30fc, 0x30b9, 0x30b3, 0x30eb,
+    0x30ca, 0x30b3, 0x30fc, 0x30db, 0x309a, 0x30b5,
+    0x30a4, 0x30af, 0x30eb, 0x30b5, 0x30f3, 0x30c1,
+    0x30fc, 0x30e0, 0x30b7, 0x30ea, 0x30f3, 0x30af,
+    0x3099, 0x30bb, 0x30f3, 0x30c1, 0x30bb, 0x30f3,
+    0x30c8, 0x30bf, 0x3099, 0x30fc, 0x30b9, 0x30c6,
+    0x3099, 0x30b7, 0x30c8, 0x3099, 0x30eb, 0x30c8,
+    0x30f3, 0x30ca, 0x30ce, 0x30ce, 0x30c3, 0x30c8,
+    0x30cf, 0x30a4, 0x30c4, 0x30cf, 0x309a, 0x30fc,
+    0x30bb, 0x30f3, 0x30c8, 0x30cf, 0x309a, 0x30fc,
+    0x30c4, 0x30cf, 0x3099, 0x30fc, 0x30ec, 0x30eb,
+    0x30d2, 0x309a, 0x30a2, 0x30b9, 0x30c8, 0x30eb,
+    0x30d2, 0x309a, 0x30af, 0x30eb, 0x30d2, 0x309a,
+    0x30b3, 0x30d2, 0x3099, 0x30eb, 0x30d5, 0x30a1,
+    0x30e9, 0x30c3, 0x30c8, 0x3099, 0x30d5, 0x30a3,
+    0x30fc, 0x30c8, 0x30d5, 0x3099, 0x30c3, 0x30b7,
+    0x30a7, 0x30eb, 0x30d5, 0x30e9, 0x30f3, 0x30d8,
+    0x30af, 0x30bf, 0x30fc, 0x30eb, 0x30d8, 0x309a,
+    0x30bd, 0x30d8, 0x309a, 0x30cb, 0x30d2, 0x30d8,
+    0x30eb, 0x30c4, 0x30d8, 0x309a, 0x30f3, 0x30b9,
+    0x30d8, 0x309a, 0x30fc, 0x30b7, 0x3099, 0x30d8,
+    0x3099, 0x30fc, 0x30bf, 0x30db, 0x309a, 0x30a4,
+    0x30f3, 0x30c8, 0x30db, 0x3099, 0x30eb, 0x30c8,
+    0x30db, 0x30f3, 0x30db, 0x309a, 0x30f3, 0x30c8,
+    0x3099, 0x30db, 0x30fc, 0x30eb, 0x30db, 0x30fc,
+    0x30f3, 0x30de, 0x30a4, 0x30af, 0x30ed, 0x30de,
+    0x30a4, 0x30eb, 0x30de, 0x30c3, 0x30cf, 0x30de,
+    0x30eb, 0x30af, 0x30de, 0x30f3, 0x30b7, 0x30e7,
+    0x30f3, 0x30df, 0x30af, 0x30ed, 0x30f3, 0x30df,
+    0x30ea, 0x30df, 0x30ea, 0x30cf, 0x3099, 0x30fc,
+    0x30eb, 0x30e1, 0x30ab, 0x3099, 0x30e1, 0x30ab,
+    0x3099, 0x30c8, 0x30f3, 0x30e1, 0x30fc, 0x30c8,
+    0x30eb, 0x30e4, 0x30fc, 0x30c8, 0x3099, 0x30e4,
+    0x30fc, 0x30eb, 0x30e6, 0x30a2, 0x30f3, 0x30ea,
+    0x30c3, 0x30c8, 0x30eb, 0x30ea, 0x30e9, 0x30eb,
+    0x30d2, 0x309a, 0x30fc, 0x30eb, 0x30fc, 0x30d5,
+    0x3099, 0x30eb, 0x30ec, 0x30e0, 0x30ec, 0x30f3,
+    0x30c8, 0x30b1, 0x3099, 0x30f3, 0x30ef, 0x30c3,
+    0x30c8, 0x30, 0x70b9, 0x31, 0x70b9, 0x32,
+    0x70b9, 0x33, 0x70b9, 0x34, 0x70b9, 0x35,
+    0x70b9, 0x36, 0x70b9, 0x37, 0x70b9, 0x38,
+    0x70b9, 0x39, 0x70b9, 0x31, 0x30, 0x70b9,
+    0x31, 0x31, 0x70b9, 0x31, 0x32, 0x70b9,
+    0x31, 0x33, 0x70b9, 0x31, 0x34, 0x70b9,
+    0x31, 0x35, 0x70b9, 0x31, 0x36, 0x70b9,
+    0x31, 0x37, 0x70b9, 0x31, 0x38, 0x70b9,
+    0x31, 0x39, 0x70b9, 0x32, 0x30, 0x70b9,
+    0x32, 0x31, 0x70b9, 0x32, 0x32, 0x70b9,
+    0x32, 0x33, 0x70b9, 0x32, 0x34, 0x70b9,
+    0x68, 0x50, 0x61, 0x64, 0x61, 0x41,
+    0x55, 0x62, 0x61, 0x72, 0x6f, 0x56,
+    0x70, 0x63, 0x64, 0x6d, 0x64, 0x6d,
+    0x32, 0x64, 0x6d, 0x33, 0x49, 0x55,
+    0x5e73, 0x6210, 0x662d, 0x548c, 0x5927, 0x6b63,
+    0x660e, 0x6cbb, 0x682a, 0x5f0f, 0x4f1a, 0x793e,
+    0x70, 0x41, 0x6e, 0x41, 0x3bc, 0x41,
+    0x6d, 0x41, 0x6b, 0x41, 0x4b, 0x42,
+    0x4d, 0x42, 0x47, 0x42, 0x63, 0x61,
+    0x6c, 0x6b, 0x63, 0x61, 0x6c, 0x70,
+    0x46, 0x6e, 0x46, 0x3bc, 0x46, 0x3bc,
+    0x67, 0x6d, 0x67, 0x6b, 0x67, 0x48,
+    0x7a, 0x6b, 0x48, 0x7a, 0x4d, 0x48,
+    0x7a, 0x47, 0x48, 0x7a, 0x54, 0x48,
+    0x7a, 0x3bc, 0x6c, 0x6d, 0x6c, 0x64,
+    0x6c, 0x6b, 0x6c, 0x66, 0x6d, 0x6e,
+    0x6d, 0x3bc, 0x6d, 0x6d, 0x6d, 0x63,
+    0x6d, 0x6b, 0x6d, 0x6d, 0x6d, 0x32,
+    0x63, 0x6d, 0x32, 0x6d, 0x32, 0x6b,
+    0x6d, 0x32, 0x6d, 0x6d, 0x33, 0x63,
+    0x6d, 0x33, 0x6d, 0x33, 0x6b, 0x6d,
+    0x33, 0x6d, 0x2215, 0x73, 0x6d, 0x2215,
+    0x73, 0x32, 0x50, 0x61, 0x6b, 0x50,
+    0x61, 0x4d, 0x50, 0x61, 0x47, 0x50,
+    0x61, 0x72, 0x61, 0x64, 0x72, 0x61,
+    0x64, 0x2215, 0x73, 0x72, 0x61, 0x64,
+    0x2215, 0x73, 0x32, 0x70, 0x73, 0x6e,
+    0x73, 0x3bc, 0x73, 0x6d, 0x73, 0x70,
+    0x56, 0x6e, 0x56, 0x3bc, 0x56, 0x6d,
+    0x56, 0x6b, 0x56, 0x4d, 0x56, 0x70,
+    0x57, 0x6e, 0x57, 0x3bc, 0x57, 0x6d,
+    0x57, 0x6b, 0x57, 0x4d, 0x57, 0x6b,
+    0x3a9, 0x4d, 0x3a9, 0x61, 0x2e, 0x6d,
+    0x2e, 0x42, 0x71, 0x63, 0x63, 0x63,
+    0x64, 0x43, 0x2215, 0x6b, 0x67, 0x43,
+    0x6f, 0x2e, 0x64, 0x42, 0x47, 0x79,
+    0x68, 0x61, 0x48, 0x50, 0x69, 0x6e,
+    0x4b, 0x4b, 0x4b, 0x4d, 0x6b, 0x74,
+    0x6c, 0x6d, 0x6c, 0x6e, 0x6c, 0x6f,
+    0x67, 0x6c, 0x78, 0x6d, 0x62, 0x6d,
+    0x69, 0x6c, 0x6d, 0x6f, 0x6c, 0x50,
+    0x48, 0x70, 0x2e, 0x6d, 0x2e, 0x50,
+    0x50, 0x4d, 0x50, 0x52, 0x73, 0x72,
+    0x53, 0x76, 0x57, 0x62, 0x56, 0x2215,
+    0x6d, 0x41, 0x2215, 0x6d, 0x31, 0x65e5,
+    0x32, 0x65e5, 0x33, 0x65e5, 0x34, 0x65e5,
+    0x35, 0x65e5, 0x36, 0x65e5, 0x37, 0x65e5,
+    0x38, 0x65e5, 0x39, 0x65e5, 0x31, 0x30,
+    0x65e5, 0x31, 0x31, 0x65e5, 0x31, 0x32,
+    0x65e5, 0x31, 0x33, 0x65e5, 0x31, 0x34,
+    0x65e5, 0x31, 0x35, 0x65e5, 0x31, 0x36,
+    0x65e5, 0x31, 0x37, 0x65e5, 0x31, 0x38,
+    0x65e5, 0x31, 0x39, 0x65e5, 0x32, 0x30,
+    0x65e5, 0x32, 0x31, 0x65e5, 0x32, 0x32,
+    0x65e5, 0x32, 0x33, 0x65e5, 0x32, 0x34,
+    0x65e5, 0x32, 0x35, 0x65e5, 0x32, 0x36,
+    0x65e5, 0x32, 0x37, 0x65e5, 0x32, 0x38,
+    0x65e5, 0x32, 0x39, 0x65e5, 0x33, 0x30,
+    0x65e5, 0x33, 0x31, 0x65e5, 0x67, 0x61,
+    0x6c, 0x44a, 0x44c, 0xa76f, 0x43, 0x46,
+    0x51, 0x126, 0x153, 0xa727, 0xab37, 0x26b,
+    0xab52, 0x28d, 0x8c48, 0x66f4, 0x8eca, 0x8cc8,
+    0x6ed1, 0x4e32, 0x53e5, 0x9f9c, 0x9f9c, 0x5951,
+    0x91d1, 0x5587, 0x5948, 0x61f6, 0x7669, 0x7f85,
+    0x863f, 0x87ba, 0x88f8, 0x908f, 0x6a02, 0x6d1b,
+    0x70d9, 0x73de, 0x843d, 0x916a, 0x99f1, 0x4e82,
+    0x5375, 0x6b04, 0x721b, 0x862d, 0x9e1e, 0x5d50,
+    0x6feb, 0x85cd, 0x8964, 0x62c9, 0x81d8, 0x881f,
+    0x5eca, 0x6717, 0x6d6a, 0x72fc, 0x90ce, 0x4f86,
+    0x51b7, 0x52de, 0x64c4, 0x6ad3, 0x7210, 0x76e7,
+    0x8001, 0x8606, 0x865c, 0x8def, 0x9732, 0x9b6f,
+    0x9dfa, 0x788c, 0x797f, 0x7da0, 0x83c9, 0x9304,
+    0x9e7f, 0x8ad6, 0x58df, 0x5f04, 0x7c60, 0x807e,
+    0x7262, 0x78ca, 0x8cc2, 0x96f7, 0x58d8, 0x5c62,
+    0x6a13, 0x6dda, 0x6f0f, 0x7d2f, 0x7e37, 0x964b,
+    0x52d2, 0x808b, 0x51dc, 0x51cc, 0x7a1c, 0x7dbe,
+    0x83f1, 0x9675, 0x8b80, 0x62cf, 0x6a02, 0x8afe,
+    0x4e39, 0x5be7, 0x6012, 0x7387, 0x7570, 0x5317,
+    0x78fb, 0x4fbf, 0x5fa9, 0x4e0d, 0x6ccc, 0x6578,
+    0x7d22, 0x53c3, 0x585e, 0x7701, 0x8449, 0x8aaa,
+    0x6bba, 0x8fb0, 0x6c88, 0x62fe, 0x82e5, 0x63a0,
+    0x7565, 0x4eae, 0x5169, 0x51c9, 0x6881, 0x7ce7,
+    0x826f, 0x8ad2, 0x91cf, 0x52f5, 0x5442, 0x5973,
+    0x5eec, 0x65c5, 0x6ffe, 0x792a, 0x95ad, 0x9a6a,
+    0x9e97, 0x9ece, 0x529b, 0x66c6, 0x6b77, 0x8f62,
+    0x5e74, 0x6190, 0x6200, 0x649a, 0x6f23, 0x7149,
+    0x7489, 0x79ca, 0x7df4, 0x806f, 0x8f26, 0x84ee,
+    0x9023, 0x934a, 0x5217, 0x52a3, 0x54bd, 0x70c8,
+    0x88c2, 0x8aaa, 0x5ec9, 0x5ff5, 0x637b, 0x6bae,
+    0x7c3e, 0x7375, 0x4ee4, 0x56f9, 0x5be7, 0x5dba,
+    0x601c, 0x73b2, 0x7469, 0x7f9a, 0x8046, 0x9234,
+    0x96f6, 0x9748, 0x9818, 0x4f8b, 0x79ae, 0x91b4,
+    0x96b8, 0x60e1, 0x4e86, 0x50da, 0x5bee, 0x5c3f,
+    0x6599, 0x6a02, 0x71ce, 0x7642, 0x84fc, 0x907c,
+    0x9f8d, 0x6688, 0x962e, 0x5289, 0x677b, 0x67f3,
+    0x6d41, 0x6e9c, 0x7409, 0x7559, 0x786b, 0x7d10,
+    0x985e, 0x516d, 0x622e, 0x9678, 0x502b, 0x5d19,
+    0x6dea, 0x8f2a, 0x5f8b, 0x6144, 0x6817, 0x7387,
+    0x9686, 0x5229, 0x540f, 0x5c65, 0x6613, 0x674e,
+    0x68a8, 0x6ce5, 0x7406, 0x75e2, 0x7f79, 0x88cf,
+    0x88e1, 0x91cc, 0x96e2, 0x533f, 0x6eba, 0x541d,
+    0x71d0, 0x7498, 0x85fa, 0x96a3, 0x9c57, 0x9e9f,
+    0x6797, 0x6dcb, 0x81e8, 0x7acb, 0x7b20, 0x7c92,
+    0x72c0, 0x7099, 0x8b58, 0x4ec0, 0x8336, 0x523a,
+    0x5207, 0x5ea6, 0x62d3, 0x7cd6, 0x5b85, 0x6d1e,
+    0x66b4, 0x8f3b, 0x884c, 0x964d, 0x898b, 0x5ed3,
+    0x5140, 0x55c0, 0x585a, 0x6674, 0x51de, 0x732a,
+    0x76ca, 0x793c, 0x795e, 0x7965, 0x798f, 0x9756,
+    0x7cbe, 0x7fbd, 0x8612, 0x8af8, 0x9038, 0x90fd,
+    0x98ef, 0x98fc, 0x9928, 0x9db4, 0x90de, 0x96b7,
+    0x4fae, 0x50e7, 0x514d, 0x52c9, 0x52e4, 0x5351,
+    0x559d, 0x5606, 0x5668, 0x5840, 0x58a8, 0x5c64,
+    0x5c6e, 0x6094, 0x6168, 0x618e, 0x61f2, 0x654f,
+    0x65e2, 0x6691, 0x6885, 0x6d77, 0x6e1a, 0x6f22,
+    0x716e, 0x722b, 0x7422, 0x7891, 0x793e, 0x7949,
+    0x7948, 0x7950, 0x7956, 0x795d, 0x798d, 0x798e,
+    0x7a40, 0x7a81, 0x7bc0, 0x7df4, 0x7e09, 0x7e41,
+    0x7f72, 0x8005, 0x81ed, 0x8279, 0x8279, 0x8457,
+    0x8910, 0x8996, 0x8b01, 0x8b39, 0x8cd3, 0x8d08,
+    0x8fb6, 0x9038, 0x96e3, 0x97ff, 0x983b, 0x6075,
+    0x242ee, 0x8218, 0x4e26, 0x51b5, 0x5168, 0x4f80,
+    0x5145, 0x5180, 0x52c7, 0x52fa, 0x559d, 0x5555,
+    0x5599, 0x55e2, 0x585a, 0x58b3, 0x5944, 0x5954,
+    0x5a62, 0x5b28, 0x5ed2, 0x5ed9, 0x5f69, 0x5fad,
+    0x60d8, 0x614e, 0x6108, 0x618e, 0x6160, 0x61f2,
+    0x6234, 0x63c4, 0x641c, 0x6452, 0x6556, 0x6674,
+    0x6717, 0x671b, 0x6756, 0x6b79, 0x6bba, 0x6d41,
+    0x6edb, 0x6ecb, 0x6f22, 0x701e, 0x716e, 0x77a7,
+    0x7235, 0x72af, 0x732a, 0x7471, 0x7506, 0x753b,
+    0x761d, 0x761f, 0x76ca, 0x76db, 0x76f4, 0x774a,
+    0x7740, 0x78cc, 0x7ab1, 0x7bc0, 0x7c7b, 0x7d5b,
+    0x7df4, 0x7f3e, 0x8005, 0x8352, 0x83ef, 0x8779,
+    0x8941, 0x8986, 0x8996, 0x8abf, 0x8af8, 0x8acb,
+    0x8b01, 0x8afe, 0x8aed, 0x8b39, 0x8b8a, 0x8d08,
+    0x8f38, 0x9072, 0x9199, 0x9276, 0x967c, 0x96e3,
+    0x9756, 0x97db, 0x97ff, 0x980b, 0x983b, 0x9b12,
+    0x9f9c, 0x2284a, 0x22844, 0x233d5, 0x3b9d, 0x4018,
+    0x4039, 0x25249, 0x25cd0, 0x27ed3, 0x9f43, 0x9f8e,
+    0x66, 0x66, 0x66, 0x69, 0x66, 0x6c,
+    0x66, 0x66, 0x69, 0x66, 0x66, 0x6c,
+    0x73, 0x74, 0x73, 0x74, 0x574, 0x576,
+    0x574, 0x565, 0x574, 0x56b, 0x57e, 0x576,
+    0x574, 0x56d, 0x5d9, 0x5b4, 0x5f2, 0x5b7,
+    0x5e2, 0x5d0, 0x5d3, 0x5d4, 0x5db, 0x5dc,
+    0x5dd, 0x5e8, 0x5ea, 0x2b, 0x5e9, 0x5c1,
+    0x5e9, 0x5c2, 0x5e9, 0x5bc, 0x5c1, 0x5e9,
+    0x5bc, 0x5c2, 0x5d0, 0x5b7, 0x5d0, 0x5b8,
+    0x5d0, 0x5bc, 0x5d1, 0x5bc, 0x5d2, 0x5bc,
+    0x5d3, 0x5bc, 0x5d4, 0x5bc, 0x5d5, 0x5bc,
+    0x5d6, 0x5bc, 0x5d8, 0x5bc, 0x5d9, 0x5bc,
+    0x5da, 0x5bc, 0x5db, 0x5bc, 0x5dc, 0x5bc,
+    0x5de, 0x5bc, 0x5e0, 0x5bc, 0x5e1, 0x5bc,
+    0x5e3, 0x5bc, 0x5e4, 0x5bc, 0x5e6, 0x5bc,
+    0x5e7, 0x5bc, 0x5e8, 0x5bc, 0x5e9, 0x5bc,
+    0x5ea, 0x5bc, 0x5d5, 0x5b9, 0x5d1, 0x5bf,
+    0x5db, 0x5bf, 0x5e4, 0x5bf, 0x5d0, 0x5dc,
+    0x671, 0x671, 0x67b, 0x67b, 0x67b, 0x67b,
+    0x67e, 0x67e, 0x67e, 0x67e, 0x680, 0x680,
+    0x680, 0x680, 0x67a, 0x67a, 0x67a, 0x67a,
+    0x67f, 0x67f, 0x67f, 0x67f, 0x679, 0x679,
+    0x679, 0x679, 0x6a4, 0x6a4, 0x6a4, 0x6a4,
+    0x6a6, 0x6a6, 0x6a6, 0x6a6, 0x684, 0x684,
+    0x684, 0x684, 0x683, 0x683, 0x683, 0x683,
+    0x686, 0x686, 0x686, 0x686, 0x687, 0x687,
+    0x687, 0x687, 0x68d, 0x68d, 0x68c, 0x68c,
+    0x68e, 0x68e, 0x688, 0x688, 0x698, 0x698,
+    0x691, 0x691, 0x6a9, 0x6a9, 0x6a9, 0x6a9,
+    0x6af, 0x6af, 0x6af, 0x6af, 0x6b3, 0x6b3,
+    0x6b3, 0x6b3, 0x6b1, 0x6b1, 0x6b1, 0x6b1,
+    0x6ba, 0x6ba, 0x6bb, 0x6bb, 0x6bb, 0x6bb,
+    0x6d5, 0x654, 0x6d5, 0x654, 0x6c1, 0x6c1,
+    0x6c1, 0x6c1, 0x6be, 0x6be, 0x6be, 0x6be,
+    0x6d2, 0x6d2, 0x6d2, 0x654, 0x6d2, 0x654,
+    0x6ad, 0x6ad, 0x6ad, 0x6ad, 0x6c7, 0x6c7,
+    0x6c6, 0x6c6, 0x6c8, 0x6c8, 0x6c7, 0x674,
+    0x6cb, 0x6cb, 0x6c5, 0x6c5, 0x6c9, 0x6c9,
+    0x6d0, 0x6d0, 0x6d0, 0x6d0, 0x649, 0x649,
+    0x64a, 0x654, 0x627, 0x64a, 0x654, 0x627,
+    0x64a, 0x654, 0x6d5, 0x64a, 0x654, 0x6d5,
+    0x64a, 0x654, 0x648, 0x64a, 0x654, 0x648,
+    0x64a, 0x654, 0x6c7, 0x64a, 0x654, 0x6c7,
+    0x64a, 0x654, 0x6c6, 0x64a, 0x654, 0x6c6,
+    0x64a, 0x654, 0x6c8, 0x64a, 0x654, 0x6c8,
+    0x64a, 0x654, 0x6d0, 0x64a, 0x654, 0x6d0,
+    0x64a, 0x654, 0x6d0, 0x64a, 0x654, 0x649,
+    0x64a, 0x654, 0x649, 0x64a, 0x654, 0x649,
+    0x6cc, 0x6cc, 0x6cc, 0x6cc, 0x64a, 0x654,
+    0x62c, 0x64a, 0x654, 0x62d, 0x64a, 0x654,
+    0x645, 0x64a, 0x654, 0x649, 0x64a, 0x654,
+    0x64a, 0x628, 0x62c, 0x628, 0x62d, 0x628,
+    0x62e, 0x628, 0x645, 0x628, 0x649, 0x628,
+    0x64a, 0x62a, 0x62c, 0x62a, 0x62d, 0x62a,
+    0x62e, 0x62a, 0x645, 0x62a, 0x649, 0x62a,
+    0x64a, 0x62b, 0x62c, 0x62b, 0x645, 0x62b,
+    0x649, 0x62b, 0x64a, 0x62c, 0x62d, 0x62c,
+    0x645, 0x62d, 0x62c, 0x62d, 0x645, 0x62e,
+    0x62c, 0x62e, 0x62d, 0x62e, 0x645, 0x633,
+    0x62c, 0x633, 0x62d, 0x633, 0x62e, 0x633,
+    0x645, 0x635, 0x62d, 0x635, 0x645, 0x636,
+    0x62c, 0x636, 0x62d, 0x636, 0x62e, 0x636,
+    0x645, 0x637, 0x62d, 0x637, 0x645, 0x638,
+    0x645, 0x639, 0x62c, 0x639, 0x645, 0x63a,
+    0x62c, 0x63a, 0x645, 0x641, 0x62c, 0x641,
+    0x62d, 0x641, 0x62e, 0x641, 0x645, 0x641,
+    0x649, 0x641, 0x64a, 0x642, 0x62d, 0x642,
+    0x645, 0x642, 0x649, 0x642, 0x64a, 0x643,
+    0x627, 0x643, 0x62c, 0x643, 0x62d, 0x643,
+    0x62e, 0x643, 0x644, 0x643, 0x645, 0x643,
+    0x649, 0x643, 0x64a, 0x644, 0x62c, 0x644,
+    0x62d, 0x644, 0x62e, 0x644, 0x645, 0x644,
+    0x649, 0x644, 0x64a, 0x645, 0x62c, 0x645,
+    0x62d, 0x645, 0x62e, 0x645, 0x645, 0x645,
+    0x649, 0x645, 0x64a, 0x646, 0x62c, 0x646,
+    0x62d, 0x646, 0x62e, 0x646, 0x645, 0x646,
+    0x649, 0x646, 0x64a, 0x647, 0x62c, 0x647,
+    0x645, 0x647, 0x649, 0x647, 0x64a, 0x64a,
+    0x62c, 0x64a, 0x62d, 0x64a, 0x62e, 0x64a,
+    0x645, 0x64a, 0x649, 0x64a, 0x64a, 0x630,
+    0x670, 0x631, 0x670, 0x649, 0x670, 0x20,
+    0x64c, 0x651, 0x20, 0x64d, 0x651, 0x20,
+    0x64e, 0x651, 0x20, 0x64f, 0x651, 0x20,
+    0x650, 0x651, 0x20, 0x651, 0x670, 0x64a,
+    0x654, 0x631, 0x64a, 0x654, 0x632, 0x64a,
+    0x654, 0x645, 0x64a, 0x654, 0x646, 0x64a,
+    0x654, 0x649, 0x64a, 0x654, 0x64a, 0x628,
+    0x631, 0x628, 0x632, 0x628, 0x645, 0x628,
+    0x646, 0x628, 0x649, 0x628, 0x64a, 0x62a,
+    0x631, 0x62a, 0x632, 0x62a, 0x645, 0x62a,
+    0x646, 0x62a, 0x649, 0x62a, 0x64a, 0x62b,
+    0x631, 0x62b, 0x632, 0x62b, 0x645, 0x62b,
+    0x646, 0x62b, 0x649, 0x62b, 0x64a, 0x641,
+    0x649, 0x641, 0x64a, 0x642, 0x649, 0x642,
+    0x64a, 0x643, 0x627, 0x643, 0x644, 0x643,
+    0x645, 0x643, 0x649, 0x643, 0x64a, 0x644,
+    0x645, 0x644, 0x649, 0x644, 0x64a, 0x645,
+    0x627, 0x645, 0x645, 0x646, 0x631, 0x646,
+    0x632, 0x646, 0x645, 0x646, 0x646, 0x646,
+    0x649, 0x646, 0x64a, 0x649, 0x670, 0x64a,
+    0x631, 0x64a, 0x632, 0x64a, 0x645, 0x64a,
+    0x646, 0x64a, 0x649, 0x64a, 0x64a, 0x64a,
+    0x654, 0x62c, 0x64a, 0x654, 0x62d, 0x64a,
+    0x654, 0x62e, 0x64a, 0x654, 0x645, 0x64a,
+    0x654, 0x647, 0x628, 0x62c, 0x628, 0x62d,
+    0x628, 0x62e, 0x628, 0x645, 0x628, 0x647,
+    0x62a, 0x62c, 0x62a, 0x62d, 0x62a, 0x62e,
+    0x62a, 0x645, 0x62a, 0x647, 0x62b, 0x645,
+    0x62c, 0x62d, 0x62c, 0x645, 0x62d, 0x62c,
+    0x62d, 0x645, 0x62e, 0x62c, 0x62e, 0x645,
+    0x633, 0x62c, 0x633, 0x62d, 0x633, 0x62e,
+    0x633, 0x645, 0x635, 0x62d, 0x635, 0x62e,
+    0x635, 0x645, 0x636, 0x62c, 0x636, 0x62d,
+    0x636, 0x62e, 0x636, 0x645, 0x637, 0x62d,
+    0x638, 0x645, 0x639, 0x62c, 0x639, 0x645,
+    0x63a, 0x62c, 0x63a, 0x645, 0x641, 0x62c,
+    0x641, 0x62d, 0x641, 0x62e, 0x641, 0x645,
+    0x642, 0x62d, 0x642, 0x645, 0x643, 0x62c,
+    0x643, 0x62d, 0x643, 0x62e, 0x643, 0x644,
+    0x643, 0x645, 0x644, 0x62c, 0x644, 0x62d,
+    0x644, 0x62e, 0x644, 0x645, 0x644, 0x647,
+    0x645, 0x62c, 0x645, 0x62d, 0x645, 0x62e,
+    0x645, 0x645, 0x646, 0x62c, 0x646, 0x62d,
+    0x646, 0x62e, 0x646, 0x645, 0x646, 0x647,
+    0x647, 0x62c, 0x647, 0x645, 0x647, 0x670,
+    0x64a, 0x62c, 0x64a, 0x62d, 0x64a, 0x62e,
+    0x64a, 0x645, 0x64a, 0x647, 0x64a, 0x654,
+    0x645, 0x64a, 0x654, 0x647, 0x628, 0x645,
+    0x628, 0x647, 0x62a, 0x645, 0x62a, 0x647,
+    0x62b, 0x645, 0x62b, 0x647, 0x633, 0x645,
+    0x633, 0x647, 0x634, 0x645, 0x634, 0x647,
+    0x643, 0x644, 0x643, 0x645, 0x644, 0x645,
+    0x646, 0x645, 0x646, 0x647, 0x64a, 0x645,
+    0x64a, 0x647, 0x640, 0x64e, 0x651, 0x640,
+    0x64f, 0x651, 0x640, 0x650, 0x651, 0x637,
+    0x649, 0x637, 0x64a, 0x639, 0x649, 0x639,
+    0x64a, 0x63a, 0x649, 0x63a, 0x64a, 0x633,
+    0x649, 0x633, 0x64a, 0x634, 0x649, 0x634,
+    0x64a, 0x62d, 0x649, 0x62d, 0x64a, 0x62c,
+    0x649, 0x62c, 0x64a, 0x62e, 0x649, 0x62e,
+    0x64a, 0x635, 0x649, 0x635, 0x64a, 0x636,
+    0x649, 0x636, 0x64a, 0x634, 0x62c, 0x634,
+    0x62d, 0x634, 0x62e, 0x634, 0x645, 0x634,
+    0x631, 0x633, 0x631, 0x635, 0x631, 0x636,
+    0x631, 0x637, 0x649, 0x637, 0x64a, 0x639,
+    0x649, 0x639, 0x64a, 0x63a, 0x649, 0x63a,
+    0x64a, 0x633, 0x649, 0x633, 0x64a, 0x634,
+    0x649, 0x634, 0x64a, 0x62d, 0x649, 0x62d,
+    0x64a, 0x62c, 0x649, 0x62c, 0x64a, 0x62e,
+    0x649, 0x62e, 0x64a, 0x635, 0x649, 0x635,
+    0x64a, 0x636, 0x649, 0x636, 0x64a, 0x634,
+    0x62c, 0x634, 0x62d, 0x634, 0x62e, 0x634,
+    0x645, 0x634, 0x631, 0x633, 0x631, 0x635,
+    0x631, 0x636, 0x631, 0x634, 0x62c, 0x634,
+    0x62d, 0x634, 0x62e, 0x634, 0x645, 0x633,
+    0x647, 0x634, 0x647, 0x637, 0x645, 0x633,
+    0x62c, 0x633, 0x62d, 0x633, 0x62e, 0x634,
+    0x62c, 0x634, 0x62d, 0x634, 0x62e, 0x637,
+    0x645, 0x638, 0x645, 0x627, 0x64b, 0x627,
+    0x64b, 0x62a, 0x62c, 0x645, 0x62a, 0x62d,
+    0x62c, 0x62a, 0x62d, 0x62c, 0x62a, 0x62d,
+    0x645, 0x62a, 0x62e, 0x645, 0x62a, 0x645,
+    0x62c, 0x62a, 0x645, 0x62d, 0x62a, 0x645,
+    0x62e, 0x62c, 0x645, 0x62d, 0x62c, 0x645,
+    0x62d, 0x62d, 0x645, 0x64a, 0x62d, 0x645,
+    0x649, 0x633, 0x62d, 0x62c, 0x633, 0x62c,
+    0x62d, 0x633, 0x62c, 0x649, 0x633, 0x645,
+    0x62d, 0x633, 0x645, 0x62d, 0x633, 0x645,
+    0x62c, 0x633, 0x645, 0x645, 0x633, 0x645,
+    0x645, 0x635, 0x62d, 0x62d, 0x635, 0x62d,
+    0x62d, 0x635, 0x645, 0x645, 0x634, 0x62d,
+    0x645, 0x634, 0x62d, 0x645, 0x634, 0x62c,
+    0x64a, 0x634, 0x645, 0x62e, 0x634, 0x645,
+    0x62e, 0x634, 0x645, 0x645, 0x634, 0x645,
+    0x645, 0x636, 0x62d, 0x649, 0x636, 0x62e,
+    0x645, 0x636, 0x62e, 0x645, 0x637, 0x645,
+    0x62d, 0x637, 0x645, 0x62d, 0x637, 0x645,
+    0x645, 0x637, 0x645, 0x64a, 0x639, 0x62c,
+    0x645, 0x639, 0x645, 0x645, 0x639, 0x645,
+    0x645, 0x639, 0x645, 0x649, 0x63a, 0x645,
+    0x645, 0x63a, 0x645, 0x64a, 0x63a, 0x645,
+    0x649, 0x641, 0x62e, 0x645, 0x641, 0x62e,
+    0x645, 0x642, 0x645, 0x62d, 0x642, 0x645,
+    0x645, 0x644, 0x62d, 0x645, 0x644, 0x62d,
+    0x64a, 0x644, 0x62d, 0x649, 0x644, 0x62c,
+    0x62c, 0x644, 0x62c, 0x62c, 0x644, 0x62e,
+    0x645, 0x644, 0x62e, 0x645, 0x644, 0x645,
+    0x62d, 0x644, 0x645, 0x62d, 0x645, 0x62d,
+    0x62c, 0x645, 0x62d, 0x645, 0x645, 0x62d,
+    0x64a, 0x645, 0x62c, 0x62d, 0x645, 0x62c,
+    0x645, 0x645, 0x62e, 0x62c, 0x645, 0x62e,
+    0x645, 0x645, 0x62c, 0x62e, 0x647, 0x645,
+    0x62c, 0x647, 0x645, 0x645, 0x646, 0x62d,
+    0x645, 0x646, 0x62d, 0x649, 0x646, 0x62c,
+    0x645, 0x646, 0x62c, 0x645, 0x646, 0x62c,
+    0x649, 0x646, 0x645, 0x64a, 0x646, 0x645,
+    0x649, 0x64a, 0x645, 0x645, 0x64a, 0x645,
+    0x645, 0x628, 0x62e, 0x64a, 0x62a, 0x62c,
+    0x64a, 0x62a, 0x62c, 0x649, 0x62a, 0x62e,
+    0x64a, 0x62a, 0x62e, 0x649, 0x62a, 0x645,
+    0x64a, 0x62a, 0x645, 0x649, 0x62c, 0x645,
+    0x64a, 0x62c, 0x62d, 0x649, 0x62c, 0x645,
+    0x649, 0x633, 0x62e, 0x649, 0x635, 0x62d,
+    0x64a, 0x634, 0x62d, 0x64a, 0x636, 0x62d,
+    0x64a, 0x644, 0x62c, 0x64a, 0x644, 0x645,
+    0x64a, 0x64a, 0x62d, 0x64a, 0x64a, 0x62c,
+    0x64a, 0x64a, 0x645, 0x64a, 0x645, 0x645,
+    0x64a, 0x642, 0x645, 0x64a, 0x646, 0x62d,
+    0x64a, 0x642, 0x645, 0x62d, 0x644, 0x62d,
+    0x645, 0x639, 0x645, 0x64a, 0x643, 0x645,
+    0x64a, 0x646, 0x62c, 0x62d, 0x645, 0x62e,
+    0x64a, 0x644, 0x62c, 0x645, 0x643, 0x645,
+    0x645, 0x644, 0x62c, 0x645, 0x646, 0x62c,
+    0x62d, 0x62c, 0x62d, 0x64a, 0x62d, 0x62c,
+    0x64a, 0x645, 0x62c, 0x64a, 0x641, 0x645,
+    0x64a, 0x628, 0x62d, 0x64a, 0x643, 0x645,
+    0x645, 0x639, 0x62c, 0x645, 0x635, 0x645,
+    0x645, 0x633, 0x62e, 0x64a, 0x646, 0x62c,
+    0x64a, 0x635, 0x644, 0x6d2, 0x642, 0x644,
+    0x6d2, 0x627, 0x644, 0x644, 0x647, 0x627,
+    0x643, 0x628, 0x631, 0x645, 0x62d, 0x645,
+    0x62f, 0x635, 0x644, 0x639, 0x645, 0x631,
+    0x633, 0x648, 0x644, 0x639, 0x644, 0x64a,
+    0x647, 0x648, 0x633, 0x644, 0x645, 0x635,
+    0x644, 0x649, 0x635, 0x644, 0x649, 0x20,
+    0x627, 0x644, 0x644, 0x647, 0x20, 0x639,
+    0x644, 0x64a, 0x647, 0x20, 0x648, 0x633,
+    0x644, 0x645, 0x62c, 0x644, 0x20, 0x62c,
+    0x644, 0x627, 0x644, 0x647, 0x631, 0x6cc,
+    0x627, 0x644, 0x2c, 0x3001, 0x3002, 0x3a,
+    0x3b, 0x21, 0x3f, 0x3016, 0x3017, 0x2e,
+    0x2e, 0x2e, 0x2e, 0x2e, 0x2014, 0x2013,
+    0x5f, 0x5f, 0x28, 0x29, 0x7b, 0x7d,
+    0x3014, 0x3015, 0x3010, 0x3011, 0x300a, 0x300b,
+    0x3008, 0x3009, 0x300c, 0x300d, 0x300e, 0x300f,
+    0x5b, 0x5d, 0x20, 0x305, 0x20, 0x305,
+    0x20, 0x305, 0x20, 0x305, 0x5f, 0x5f,
+    0x5f, 0x2c, 0x3001, 0x2e, 0x3b, 0x3a,
+    0x3f, 0x21, 0x2014, 0x28, 0x29, 0x7b,
+    0x7d, 0x3014, 0x3015, 0x23, 0x26, 0x2a,
+    0x2b, 0x2d, 0x3c, 0x3e, 0x3d, 0x5c,
+    0x24, 0x25, 0x40, 0x20, 0x64b, 0x640,
+    0x64b, 0x20, 0x64c, 0x20, 0x64d, 0x20,
+    0x64e, 0x640, 0x64e, 0x20, 0x64f, 0x640,
+    0x64f, 0x20, 0x650, 0x640, 0x650, 0x20,
+    0x651, 0x640, 0x651, 0x20, 0x652, 0x640,
+    0x652, 0x621, 0x627, 0x653, 0x627, 0x653,
+    0x627, 0x654, 0x627, 0x654, 0x648, 0x654,
+    0x648, 0x654, 0x627, 0x655, 0x627, 0x655,
+    0x64a, 0x654, 0x64a, 0x654, 0x64a, 0x654,
+    0x64a, 0x654, 0x627, 0x627, 0x628, 0x628,
+    0x628, 0x628, 0x629, 0x629, 0x62a, 0x62a,
+    0x62a, 0x62a, 0x62b, 0x62b, 0x62b, 0x62b,
+    0x62c, 0x62c, 0x62c, 0x62c, 0x62d, 0x62d,
+    0x62d, 0x62d, 0x62e, 0x62e, 0x62e, 0x62e,
+    0x62f, 0x62f, 0x630, 0x630, 0x631, 0x631,
+    0x632, 0x632, 0x633, 0x633, 0x633, 0x633,
+    0x634, 0x634, 0x634, 0x634, 0x635, 0x635,
+    0x635, 0x635, 0x636, 0x636, 0x636, 0x636,
+    0x637, 0x637, 0x637, 0x637, 0x638, 0x638,
+    0x638, 0x638, 0x639, 0x639, 0x639, 0x639,
+    0x63a, 0x63a, 0x63a, 0x63a, 0x641, 0x641,
+    0x641, 0x641, 0x642, 0x642, 0x642, 0x642,
+    0x643, 0x643, 0x643, 0x643, 0x644, 0x644,
+    0x644, 0x644, 0x645, 0x645, 0x645, 0x645,
+    0x646, 0x646, 0x646, 0x646, 0x647, 0x647,
+    0x647, 0x647, 0x648, 0x648, 0x649, 0x649,
+    0x64a, 0x64a, 0x64a, 0x64a, 0x644, 0x627,
+    0x653, 0x644, 0x627, 0x653, 0x644, 0x627,
+    0x654, 0x644, 0x627, 0x654, 0x644, 0x627,
+    0x655, 0x644, 0x627, 0x655, 0x644, 0x627,
+    0x644, 0x627, 0x21, 0x22, 0x23, 0x24,
+    0x25, 0x26, 0x27, 0x28, 0x29, 0x2a,
+    0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30,
+    0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+    0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c,
+    0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e,
+    0x4f, 0x50, 0x51, 0x52, 0x53, 0x54,
+    0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+    0x5b, 0x5c, 0x5d, 0x5e, 0x5f, 0x60,
+    0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
+    0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c,
+    0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e,
+    0x2985, 0x2986, 0x3002, 0x300c, 0x300d, 0x3001,
+    0x30fb, 0x30f2, 0x30a1, 0x30a3, 0x30a5, 0x30a7,
+    0x30a9, 0x30e3, 0x30e5, 0x30e7, 0x30c3, 0x30fc,
+    0x30a2, 0x30a4, 0x30a6, 0x30a8, 0x30aa, 0x30ab,
+    0x30ad, 0x30af, 0x30b1, 0x30b3, 0x30b5, 0x30b7,
+    0x30b9, 0x30bb, 0x30bd, 0x30bf, 0x30c1, 0x30c4,
+    0x30c6, 0x30c8, 0x30ca, 0x30cb, 0x30cc, 0x30cd,
+    0x30ce, 0x30cf, 0x30d2, 0x30d5, 0x30d8, 0x30db,
+    0x30de, 0x30df, 0x30e0, 0x30e1, 0x30e2, 0x30e4,
+    0x30e6, 0x30e8, 0x30e9, 0x30ea, 0x30eb, 0x30ec,
+    0x30ed, 0x30ef, 0x30f3, 0x3099, 0x309a, 0x1160,
+    0x1100, 0x1101, 0x11aa, 0x1102, 0x11ac, 0x11ad,
+    0x1103, 0x1104, 0x1105, 0x11b0, 0x11b1, 0x11b2,
+    0x11b3, 0x11b4, 0x11b5, 0x111a, 0x1106, 0x1107,
+    0x1108, 0x1121, 0x1109, 0x110a, 0x110b, 0x110c,
+    0x110d, 0x110e, 0x110f, 0x1110, 0x1111, 0x1112,
+    0x1161, 0x1162, 0x1163, 0x1164, 0x1165, 0x1166,
+    0x1167, 0x1168, 0x1169, 0x116a, 0x116b, 0x116c,
+    0x116d, 0x116e, 0x116f, 0x1170, 0x1171, 0x1172,
+    0x1173, 0x1174, 0x1175, 0xa2, 0xa3, 0xac,
+    0x20, 0x304, 0xa6, 0xa5, 0x20a9, 0x2502,
+    0x2190, 0x2191, 0x2192, 0x2193, 0x25a0, 0x25cb,
+    0x2d0, 0x2d1, 0xe6, 0x299, 0x253, 0x2a3,
+    0xab66, 0x2a5, 0x2a4, 0x256, 0x257, 0x1d91,
+    0x258, 0x25e, 0x2a9, 0x264, 0x262, 0x260,
+    0x29b, 0x127, 0x29c, 0x267, 0x284, 0x2aa,
+    0x2ab, 0x26c, 0x1df04, 0xa78e, 0x26e, 0x1df05,
+    0x28e, 0x1df06, 0xf8, 0x276, 0x277, 0x71,
+    0x27a, 0x1df08, 0x27d, 0x27e, 0x280, 0x2a8,
+    0x2a6, 0xab67, 0x2a7, 0x288, 0x2c71, 0x28f,
+    0x2a1, 0x2a2, 0x298, 0x1c0, 0x1c1, 0x1c2,
+    0x1df0a, 0x1df1e, 0x11099, 0x110ba, 0x1109b, 0x110ba,
+    0x110a5, 0x110ba, 0x11131, 0x11127, 0x11132, 0x11127,
+    0x11347, 0x1133e, 0x11347, 0x11357, 0x114b9, 0x114ba,
+    0x114b9, 0x114b0, 0x114b9, 0x114bd, 0x115b8, 0x115af,
+    0x115b9, 0x115af, 0x11935, 0x11930, 0x1d157, 0x1d165,
+    0x1d158, 0x1d165, 0x1d158, 0x1d165, 0x1d16e, 0x1d158,
+    0x1d165, 0x1d16f, 0x1d158, 0x1d165, 0x1d170, 0x1d158,
+    0x1d165, 0x1d171, 0x1d158, 0x1d165, 0x1d172, 0x1d1b9,
+    0x1d165, 0x1d1ba, 0x1d165, 0x1d1b9, 0x1d165, 0x1d16e,
+    0x1d1ba, 0x1d165, 0x1d16e, 0x1d1b9, 0x1d165, 0x1d16f,
+    0x1d1ba, 0x1d165, 0x1d16f, 0x41, 0x42, 0x43,
+    0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55,
+    0x56, 0x57, 0x58, 0x59, 0x5a, 0x61,
+    0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d,
+    0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+    0x7a, 0x41, 0x42, 0x43, 0x44, 0x45,
+    0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b,
+    0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51,
+    0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5a, 0x61, 0x62, 0x63,
+    0x64, 0x65, 0x66, 0x67, 0x69, 0x6a,
+    0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7a, 0x41, 0x42,
+    0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e,
+    0x4f, 0x50, 0x51, 0x52, 0x53, 0x54,
+    0x55, 0x56, 0x57, 0x58, 0x59, 0x5a,
+    0x61, 0x62, 0x63, 0x64, 0x65, 0x66,
+    0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c,
+    0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78,
+    0x79, 0x7a, 0x41, 0x43, 0x44, 0x47,
+    0x4a, 0x4b, 0x4e, 0x4f, 0x50, 0x51,
+    0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0x61, 0x62, 0x63, 0x64,
+    0x66, 0x68, 0x69, 0x6a, 0x6b, 0x6c,
+    0x6d, 0x6e, 0x70, 0x71, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+    0x7a, 0x41, 0x42, 0x43, 0x44, 0x45,
+    0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b,
+    0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51,
+    0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5a, 0x61, 0x62, 0x63,
+    0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7a, 0x41,
+    0x42, 0x44, 0x45, 0x46, 0x47, 0x4a,
+    0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x61, 0x62, 0x63, 0x64,
+    0x65, 0x66, 0x67, 0x68, 0x69, 0x6a,
+    0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70,
+    0x71, 0x72, 0x73, 0x74, 0x75, 0x76,
+    0x77, 0x78, 0x79, 0x7a, 0x41, 0x42,
+    0x44, 0x45, 0x46, 0x47, 0x49, 0x4a,
+    0x4b, 0x4c, 0x4d, 0x4f, 0x53, 0x54,
+    0x55, 0x56, 0x57, 0x58, 0x59, 0x61,
+    0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d,
+    0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+    0x7a, 0x41, 0x42, 0x43, 0x44, 0x45,
+    0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b,
+    0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51,
+    0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5a, 0x61, 0x62, 0x63,
+    0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7a, 0x41,
+    0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d,
+    0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53,
+    0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+    0x5a, 0x61, 0x62, 0x63, 0x64, 0x65,
+    0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b,
+    0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71,
+    0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7a, 0x41, 0x42, 0x43,
+    0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55,
+    0x56, 0x57, 0x58, 0x59, 0x5a, 0x61,
+    0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d,
+    0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+    0x7a, 0x41, 0x42, 0x43, 0x44, 0x45,
+    0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b,
+    0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51,
+    0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5a, 0x61, 0x62, 0x63,
+    0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+    0x70, 0x71, 0x72, 0x73, 0x74, 0x75,
+    0x76, 0x77, 0x78, 0x79, 0x7a, 0x41,
+    0x42, 0x43, 0x44, 0x45, 0x46, 0x47,
+    0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d,
+    0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53,
+    0x54, 0x55, 0x56, 0x57, 0x58, 0x59,
+    0x5a, 0x61, 0x62, 0x63, 0x64, 0x65,
+    0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b,
+    0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71,
+    0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7a, 0x41, 0x42, 0x43,
+    0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+    0x50, 0x51, 0x52, 0x53, 0x54, 0x55,
+    0x56, 0x57, 0x58, 0x59, 0x5a, 0x61,
+    0x62, 0x63, 0x64, 0x65, 0x66, 0x67,
+    0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d,
+    0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73,
+    0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
+    0x7a, 0x131, 0x237, 0x391, 0x392, 0x393,
+    0x394, 0x395, 0x396, 0x397, 0x398, 0x399,
+    0x39a, 0x39b, 0x39c, 0x39d, 0x39e, 0x39f,
+    0x3a0, 0x3a1, 0x398, 0x3a3, 0x3a4, 0x3a5,
+    0x3a6, 0x3a7, 0x3a8, 0x3a9, 0x2207, 0x3b1,
+    0x3b2, 0x3b3, 0x3b4, 0x3b5, 0x3b6, 0x3b7,
+    0x3b8, 0x3b9, 0x3ba, 0x3bb, 0x3bc, 0x3bd,
+    0x3be, 0x3bf, 0x3c0, 0x3c1, 0x3c2, 0x3c3,
+    0x3c4, 0x3c5, 0x3c6, 0x3c7, 0x3c8, 0x3c9,
+    0x2202, 0x3b5, 0x3b8, 0x3ba, 0x3c6, 0x3c1,
+    0x3c0, 0x391, 0x392, 0x393, 0x394, 0x395,
+    0x396, 0x397, 0x398, 0x399, 0x39a, 0x39b,
+    0x39c, 0x39d, 0x39e, 0x39f, 0x3a0, 0x3a1,
+    0x398, 0x3a3, 0x3a4, 0x3a5, 0x3a6, 0x3a7,
+    0x3a8, 0x3a9, 0x2207, 0x3b1, 0x3b2, 0x3b3,
+    0x3b4, 0x3b5, 0x3b6, 0x3b7, 0x3b8, 0x3b9,
+    0x3ba, 0x3bb, 0x3bc, 0x3bd, 0x3be, 0x3bf,
+    0x3c0, 0x3c1, 0x3c2, 0x3c3, 0x3c4, 0x3c5,
+    0x3c6, 0x3c7, 0x3c8, 0x3c9, 0x2202, 0x3b5,
+    0x3b8, 0x3ba, 0x3c6, 0x3c1, 0x3c0, 0x391,
+    0x392, 0x393, 0x394, 0x395, 0x396, 0x397,
+    0x398, 0x399, 0x39a, 0x39b, 0x39c, 0x39d,
+    0x39e, 0x39f, 0x3a0, 0x3a1, 0x398, 0x3a3,
+    0x3a4, 0x3a5, 0x3a6, 0x3a7, 0x3a8, 0x3a9,
+    0x2207, 0x3b1, 0x3b2, 0x3b3, 0x3b4, 0x3b5,
+    0x3b6, 0x3b7, 0x3b8, 0x3b9, 0x3ba, 0x3bb,
+    0x3bc, 0x3bd, 0x3be, 0x3bf, 0x3c0, 0x3c1,
+    0x3c2, 0x3c3, 0x3c4, 0x3c5, 0x3c6, 0x3c7,
+    0x3c8, 0x3c9, 0x2202, 0x3b5, 0x3b8, 0x3ba,
+    0x3c6, 0x3c1, 0x3c0, 0x391, 0x392, 0x393,
+    0x394, 0x395, 0x396, 0x397, 0x398, 0x399,
+    0x39a, 0x39b, 0x39c, 0x39d, 0x39e, 0x39f,
+    0x3a0, 0x3a1, 0x398, 0x3a3, 0x3a4, 0x3a5,
+    0x3a6, 0x3a7, 0x3a8, 0x3a9, 0x2207, 0x3b1,
+    0x3b2, 0x3b3, 0x3b4, 0x3b5, 0x3b6, 0x3b7,
+    0x3b8, 0x3b9, 0x3ba, 0x3bb, 0x3bc, 0x3bd,
+    0x3be, 0x3bf, 0x3c0, 0x3c1, 0x3c2, 0x3c3,
+    0x3c4, 0x3c5, 0x3c6, 0x3c7, 0x3c8, 0x3c9,
+    0x2202, 0x3b5, 0x3b8, 0x3ba, 0x3c6, 0x3c1,
+    0x3c0, 0x391, 0x392, 0x393, 0x394, 0x395,
+    0x396, 0x397, 0x398, 0x399, 0x39a, 0x39b,
+    0x39c, 0x39d, 0x39e, 0x39f, 0x3a0, 0x3a1,
+    0x398, 0x3a3, 0x3a4, 0x3a5, 0x3a6, 0x3a7,
+    0x3a8, 0x3a9, 0x2207, 0x3b1, 0x3b2, 0x3b3,
+    0x3b4, 0x3b5, 0x3b6, 0x3b7, 0x3b8, 0x3b9,
+    0x3ba, 0x3bb, 0x3bc, 0x3bd, 0x3be, 0x3bf,
+    0x3c0, 0x3c1, 0x3c2, 0x3c3, 0x3c4, 0x3c5,
+    0x3c6, 0x3c7, 0x3c8, 0x3c9, 0x2202, 0x3b5,
+    0x3b8, 0x3ba, 0x3c6, 0x3c1, 0x3c0, 0x3dc,
+    0x3dd, 0x30, 0x31, 0x32, 0x33, 0x34,
+    0x35, 0x36, 0x37, 0x38, 0x39, 0x30,
+    0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+    0x37, 0x38, 0x39, 0x30, 0x31, 0x32,
+    0x33, 0x34, 0x35, 0x36, 0x37, 0x38,
+    0x39, 0x30, 0x31, 0x32, 0x33, 0x34,
+    0x35, 0x36, 0x37, 0x38, 0x39, 0x30,
+    0x31, 0x32, 0x33, 0x34, 0x35, 0x36,
+    0x37, 0x38, 0x39, 0x627, 0x628, 0x62c,
+    0x62f, 0x648, 0x632, 0x62d, 0x637, 0x64a,
+    0x643, 0x644, 0x645, 0x646, 0x633, 0x639,
+    0x641, 0x635, 0x642, 0x631, 0x634, 0x62a,
+    0x62b, 0x62e, 0x630, 0x636, 0x638, 0x63a,
+    0x66e, 0x6ba, 0x6a1, 0x66f, 0x628, 0x62c,
+    0x647, 0x62d, 0x64a, 0x643, 0x644, 0x645,
+    0x646, 0x633, 0x639, 0x641, 0x635, 0x642,
+    0x634, 0x62a, 0x62b, 0x62e, 0x636, 0x63a,
+    0x62c, 0x62d, 0x64a, 0x644, 0x646, 0x633,
+    0x639, 0x635, 0x642, 0x634, 0x62e, 0x636,
+    0x63a, 0x6ba, 0x66f, 0x628, 0x62c, 0x647,
+    0x62d, 0x637, 0x64a, 0x643, 0x645, 0x646,
+    0x633, 0x639, 0x641, 0x635, 0x642, 0x634,
+    0x62a, 0x62b, 0x62e, 0x636, 0x638, 0x63a,
+    0x66e, 0x6a1, 0x627, 0x628, 0x62c, 0x62f,
+    0x647, 0x648, 0x632, 0x62d, 0x637, 0x64a,
+    0x644, 0x645, 0x646, 0x633, 0x639, 0x641,
+    0x635, 0x642, 0x631, 0x634, 0x62a, 0x62b,
+    0x62e, 0x630, 0x636, 0x638, 0x63a, 0x628,
+    0x62c, 0x62f, 0x648, 0x632, 0x62d, 0x637,
+    0x64a, 0x644, 0x645, 0x646, 0x633, 0x639,
+    0x641, 0x635, 0x642, 0x631, 0x634, 0x62a,
+    0x62b, 0x62e, 0x630, 0x636, 0x638, 0x63a,
+    0x30, 0x2e, 0x30, 0x2c, 0x31, 0x2c,
+    0x32, 0x2c, 0x33, 0x2c, 0x34, 0x2c,
+    0x35, 0x2c, 0x36, 0x2c, 0x37, 0x2c,
+    0x38, 0x2c, 0x39, 0x2c, 0x28, 0x41,
+    0x29, 0x28, 0x42, 0x29, 0x28, 0x43,
+    0x29, 0x28, 0x44, 0x29, 0x28, 0x45,
+    0x29, 0x28, 0x46, 0x29, 0x28, 0x47,
+    0x29, 0x28, 0x48, 0x29, 0x28, 0x49,
+    0x29, 0x28, 0x4a, 0x29, 0x28, 0x4b,
+    0x29, 0x28, 0x4c, 0x29, 0x28, 0x4d,
+    0x29, 0x28, 0x4e, 0x29, 0x28, 0x4f,
+    0x29, 0x28, 0x50, 0x29, 0x28, 0x51,
+    0x29, 0x28, 0x52, 0x29, 0x28, 0x53,
+    0x29, 0x28, 0x54, 0x29, 0x28, 0x55,
+    0x29, 0x28, 0x56, 0x29, 0x28, 0x57,
+    0x29, 0x28, 0x58, 0x29, 0x28, 0x59,
+    0x29, 0x28, 0x5a, 0x29, 0x3014, 0x53,
+    0x3015, 0x43, 0x52, 0x43, 0x44, 0x57,
+    0x5a, 0x41, 0x42, 0x43, 0x44, 0x45,
+    0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b,
+    0x4c, 0x4d, 0x4e, 0x4f, 0x50, 0x51,
+    0x52, 0x53, 0x54, 0x55, 0x56, 0x57,
+    0x58, 0x59, 0x5a, 0x48, 0x56, 0x4d,
+    0x56, 0x53, 0x44, 0x53, 0x53, 0x50,
+    0x50, 0x56, 0x57, 0x43, 0x4d, 0x43,
+    0x4d, 0x44, 0x4d, 0x52, 0x44, 0x4a,
+    0x307b, 0x304b, 0x30b3, 0x30b3, 0x30b5, 0x624b,
+    0x5b57, 0x53cc, 0x30c6, 0x3099, 0x4e8c, 0x591a,
+    0x89e3, 0x5929, 0x4ea4, 0x6620, 0x7121, 0x6599,
+    0x524d, 0x5f8c, 0x518d, 0x65b0, 0x521d, 0x7d42,
+    0x751f, 0x8ca9, 0x58f0, 0x5439, 0x6f14, 0x6295,
+    0x6355, 0x4e00, 0x4e09, 0x904a, 0x5de6, 0x4e2d,
+    0x53f3, 0x6307, 0x8d70, 0x6253, 0x7981, 0x7a7a,
+    0x5408, 0x6e80, 0x6709, 0x6708, 0x7533, 0x5272,
+    0x55b6, 0x914d, 0x3014, 0x672c, 0x3015, 0x3014,
+    0x4e09, 0x3015, 0x3014, 0x4e8c, 0x3015, 0x3014,
+    0x5b89, 0x3015, 0x3014, 0x70b9, 0x3015, 0x3014,
+    0x6253, 0x3015, 0x3014, 0x76d7, 0x3015, 0x3014,
+    0x52dd, 0x3015, 0x3014, 0x6557, 0x3015, 0x5f97,
+    0x53ef, 0x30, 0x31, 0x32, 0x33, 0x34,
+    0x35, 0x36, 0x37, 0x38, 0x39, 0x4e3d,
+    0x4e38, 0x4e41, 0x20122, 0x4f60, 0x4fae, 0x4fbb,
+    0x5002, 0x507a, 0x5099, 0x50e7, 0x50cf, 0x349e,
+    0x2063a, 0x514d, 0x5154, 0x5164, 0x5177, 0x2051c,
+    0x34b9, 0x5167, 0x518d, 0x2054b, 0x5197, 0x51a4,
+    0x4ecc, 0x51ac, 0x51b5, 0x291df, 0x51f5, 0x5203,
+    0x34df, 0x523b, 0x5246, 0x5272, 0x5277, 0x3515,
+    0x52c7, 0x52c9, 0x52e4, 0x52fa, 0x5305, 0x5306,
+    0x5317, 0x5349, 0x5351, 0x535a, 0x5373, 0x537d,
+    0x537f, 0x537f, 0x537f, 0x20a2c, 0x7070, 0x53ca,
+    0x53df, 0x20b63, 0x53eb, 0x53f1, 0x5406, 0x549e,
+    0x5438, 0x5448, 0x5468, 0x54a2, 0x54f6, 0x5510,
+    0x5553, 0x5563, 0x5584, 0x5584, 0x5599, 0x55ab,
+    0x55b3, 0x55c2, 0x5716, 0x5606, 0x5717, 0x5651,
+    0x5674, 0x5207, 0x58ee, 0x57ce, 0x57f4, 0x580d,
+    0x578b, 0x5832, 0x5831, 0x58ac, 0x214e4, 0x58f2,
+    0x58f7, 0x5906, 0x591a, 0x5922, 0x5962, 0x216a8,
+    0x216ea, 0x59ec, 0x5a1b, 0x5a27, 0x59d8, 0x5a66,
+    0x36ee, 0x36fc, 0x5b08, 0x5b3e, 0x5b3e, 0x219c8,
+    0x5bc3, 0x5bd8, 0x5be7, 0x5bf3, 0x21b18, 0x5bff,
+    0x5c06, 0x5f53, 0x5c22, 0x3781, 0x5c60, 0x5c6e,
+    0x5cc0, 0x5c8d, 0x21de4, 0x5d43, 0x21de6, 0x5d6e,
+    0x5d6b, 0x5d7c, 0x5de1, 0x5de2, 0x382f, 0x5dfd,
+    0x5e28, 0x5e3d, 0x5e69, 0x3862, 0x22183, 0x387c,
+    0x5eb0, 0x5eb3, 0x5eb6, 0x5eca, 0x2a392, 0x5efe,
+    0x22331, 0x22331, 0x8201, 0x5f22, 0x5f22, 0x38c7,
+    0x232b8, 0x261da, 0x5f62, 0x5f6b, 0x38e3, 0x5f9a,
+    0x5fcd, 0x5fd7, 0x5ff9, 0x6081, 0x393a, 0x391c,
+    0x6094, 0x226d4, 0x60c7, 0x6148, 0x614c, 0x614e,
+    0x614c, 0x617a, 0x618e, 0x61b2, 0x61a4, 0x61af,
+    0x61de, 0x61f2, 0x61f6, 0x6210, 0x621b, 0x625d,
+    0x62b1, 0x62d4, 0x6350, 0x22b0c, 0x633d, 0x62fc,
+    0x6368, 0x6383, 0x63e4, 0x22bf1, 0x6422, 0x63c5,
+    0x63a9, 0x3a2e, 0x6469, 0x647e, 0x649d, 0x6477,
+    0x3a6c, 0x654f, 0x656c, 0x2300a, 0x65e3, 0x66f8,
+    0x6649, 0x3b19, 0x6691, 0x3b08, 0x3ae4, 0x5192,
+    0x5195, 0x6700, 0x669c, 0x80ad, 0x43d9, 0x6717,
+    0x671b, 0x6721, 0x675e, 0x6753, 0x233c3, 0x3b49,
+    0x67fa, 0x6785, 0x6852, 0x6885, 0x2346d, 0x688e,
+    0x681f, 0x6914, 0x3b9d, 0x6942, 0x69a3, 0x69ea,
+    0x6aa8, 0x236a3, 0x6adb, 0x3c18, 0x6b21, 0x238a7,
+    0x6b54, 0x3c4e, 0x6b72, 0x6b9f, 0x6bba, 0x6bbb,
+    0x23a8d, 0x21d0b, 0x23afa, 0x6c4e, 0x23cbc, 0x6cbf,
+    0x6ccd, 0x6c67, 0x6d16, 0x6d3e, 0x6d77, 0x6d41,
+    0x6d69, 0x6d78, 0x6d85, 0x23d1e, 0x6d34, 0x6e2f,
+    0x6e6e, 0x3d33, 0x6ecb, 0x6ec7, 0x23ed1, 0x6df9,
+    0x6f6e, 0x23f5e, 0x23f8e, 0x6fc6, 0x7039, 0x701e,
+    0x701b, 0x3d96, 0x704a, 0x707d, 0x7077, 0x70ad,
+    0x20525, 0x7145, 0x24263, 0x719c, 0x243ab, 0x7228,
+    0x7235, 0x7250, 0x24608, 0x7280, 0x7295, 0x24735,
+    0x24814, 0x737a, 0x738b, 0x3eac, 0x73a5, 0x3eb8,
+    0x3eb8, 0x7447, 0x745c, 0x7471, 0x7485, 0x74ca,
+    0x3f1b, 0x7524, 0x24c36, 0x753e, 0x24c92, 0x7570,
+    0x2219f, 0x7610, 0x24fa1, 0x24fb8, 0x25044, 0x3ffc,
+    0x4008, 0x76f4, 0x250f3, 0x250f2, 0x25119, 0x25133,
+    0x771e, 0x771f, 0x771f, 0x774a, 0x4039, 0x778b,
+    0x4046, 0x4096, 0x2541d, 0x784e, 0x788c, 0x78cc,
+    0x40e3, 0x25626, 0x7956, 0x2569a, 0x256c5, 0x798f,
+    0x79eb, 0x412f, 0x7a40, 0x7a4a, 0x7a4f, 0x2597c,
+    0x25aa7, 0x25aa7, 0x7aee, 0x4202, 0x25bab, 0x7bc6,
+    0x7bc9, 0x4227, 0x25c80, 0x7cd2, 0x42a0, 0x7ce8,
+    0x7ce3, 0x7d00, 0x25f86, 0x7d63, 0x4301, 0x7dc7,
+    0x7e02, 0x7e45, 0x4334, 0x26228, 0x26247, 0x4359,
+    0x262d9, 0x7f7a, 0x2633e, 0x7f95, 0x7ffa, 0x8005,
+    0x264da, 0x26523, 0x8060, 0x265a8, 0x8070, 0x2335f,
+    0x43d5, 0x80b2, 0x8103, 0x440b, 0x813e, 0x5ab5,
+    0x267a7, 0x267b5, 0x23393, 0x2339c, 0x8201, 0x8204,
+    0x8f9e, 0x446b, 0x8291, 0x828b, 0x829d, 0x52b3,
+    0x82b1, 0x82b3, 0x82bd, 0x82e6, 0x26b3c, 0x82e5,
+    0x831d, 0x8363, 0x83ad, 0x8323, 0x83bd, 0x83e7,
+    0x8457, 0x8353, 0x83ca, 0x83cc, 0x83dc, 0x26c36,
+    0x26d6b, 0x26cd5, 0x452b, 0x84f1, 0x84f3, 0x8516,
+    0x273ca, 0x8564, 0x26f2c, 0x455d, 0x4561, 0x26fb1,
+    0x270d2, 0x456b, 0x8650, 0x865c, 0x8667, 0x8669,
+    0x86a9, 0x8688, 0x870e, 0x86e2, 0x8779, 0x8728,
+    0x876b, 0x8786, 0x45d7, 0x87e1, 0x8801, 0x45f9,
+    0x8860, 0x8863, 0x27667, 0x88d7, 0x88de, 0x4635,
+    0x88fa, 0x34bb, 0x278ae, 0x27966, 0x46be, 0x46c7,
+    0x8aa0, 0x8aed, 0x8b8a, 0x8c55, 0x27ca8, 0x8cab,
+    0x8cc1, 0x8d1b, 0x8d77, 0x27f2f, 0x20804, 0x8dcb,
+    0x8dbc, 0x8df0, 0x208de, 0x8ed4, 0x8f38, 0x285d2,
+    0x285ed, 0x9094, 0x90f1, 0x9111, 0x2872e, 0x911b,
+    0x9238, 0x92d7, 0x92d8, 0x927c, 0x93f9, 0x9415,
+    0x28bfa, 0x958b, 0x4995, 0x95b7, 0x28d77, 0x49e6,
+    0x96c3, 0x5db2, 0x9723, 0x29145, 0x2921a, 0x4a6e,
+    0x4a76, 0x97e0, 0x2940a, 0x4ab2, 0x29496, 0x980b,
+    0x980b, 0x9829, 0x295b6, 0x98e2, 0x4b33, 0x9929,
+    0x99a7, 0x99c2, 0x99fe, 0x4bce, 0x29b30, 0x9b12,
+    0x9c40, 0x9cfd, 0x4cce, 0x4ced, 0x9d67, 0x2a0ce,
+    0x4cf8, 0x2a105, 0x2a20e, 0x2a291, 0x9ebb, 0x4d56,
+    0x9ef9, 0x9efe, 0x9f05, 0x9f0f, 0x9f16, 0x9f3b,
+    0x2a600, 0x61, 0x62, 0x63, 0x64, 0x65,
+    0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b,
+    0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71,
+    0x72, 0x73, 0x74, 0x75, 0x76, 0x77,
+    0x78, 0x79, 0x7a, 0x3bc, 0xe0, 0xe1,
+    0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7,
+    0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed,
+    0xee, 0xef, 0xf0, 0xf1, 0xf2, 0xf3,
+    0xf4, 0xf5, 0xf6, 0xf8, 0xf9, 0xfa,
+    0xfb, 0xfc, 0xfd, 0xfe, 0x73, 0x73,
+    0x101, 0x103, 0x105, 0x107, 0x109, 0x10b,
+    0x10d, 0x10f, 0x111, 0x113, 0x115, 0x117,
+    0x119, 0x11b, 0x11d, 0x11f, 0x121, 0x123,
+    0x125, 0x127, 0x129, 0x12b, 0x12d, 0x12f,
+    0x69, 0x307, 0x133, 0x135, 0x137, 0x13a,
+    0x13c, 0x13e, 0x140, 0x142, 0x144, 0x146,
+    0x148, 0x2bc, 0x6e, 0x14b, 0x14d, 0x14f,
+    0x151, 0x153, 0x155, 0x157, 0x159, 0x15b,
+    0x15d, 0x15f, 0x161, 0x163, 0x165, 0x167,
+    0x169, 0x16b, 0x16d, 0x16f, 0x171, 0x173,
+    0x175, 0x177, 0xff, 0x17a, 0x17c, 0x17e,
+    0x73, 0x253, 0x183, 0x185, 0x254, 0x188,
+    0x256, 0x257, 0x18c, 0x1dd, 0x259, 0x25b,
+    0x192, 0x260, 0x263, 0x269, 0x268, 0x199,
+    0x26f, 0x272, 0x275, 0x1a1, 0x1a3, 0x1a5,
+    0x280, 0x1a8, 0x283, 0x1ad, 0x288, 0x1b0,
+    0x28a, 0x28b, 0x1b4, 0x1b6, 0x292, 0x1b9,
+    0x1bd, 0x1c6, 0x1c6, 0x1c9, 0x1c9, 0x1cc,
+    0x1cc, 0x1ce, 0x1d0, 0x1d2, 0x1d4, 0x1d6,
+    0x1d8, 0x1da, 0x1dc, 0x1df, 0x1e1, 0x1e3,
+    0x1e5, 0x1e7, 0x1e9, 0x1eb, 0x1ed, 0x1ef,
+    0x6a, 0x30c, 0x1f3, 0x1f3, 0x1f5, 0x195,
+    0x1bf, 0x1f9, 0x1fb, 0x1fd, 0x1ff, 0x201,
+    0x203, 0x205, 0x207, 0x209, 0x20b, 0x20d,
+    0x20f, 0x211, 0x213, 0x215, 0x217, 0x219,
+    0x21b, 0x21d, 0x21f, 0x19e, 0x223, 0x225,
+    0x227, 0x229, 0x22b, 0x22d, 0x22f, 0x231,
+    0x233, 0x2c65, 0x23c, 0x19a, 0x2c66, 0x242,
+    0x180, 0x289, 0x28c, 0x247, 0x249, 0x24b,
+    0x24d, 0x24f, 0x3b9, 0x371, 0x373, 0x377,
+    0x3f3, 0x3ac, 0x3ad, 0x3ae, 0x3af, 0x3cc,
+    0x3cd, 0x3ce, 0x3b9, 0x308, 0x301, 0x3b1,
+    0x3b2, 0x3b3, 0x3b4, 0x3b5, 0x3b6, 0x3b7,
+    0x3b8, 0x3b9, 0x3ba, 0x3bb, 0x3bc, 0x3bd,
+    0x3be, 0x3bf, 0x3c0, 0x3c1, 0x3c3, 0x3c4,
+    0x3c5, 0x3c6, 0x3c7, 0x3c8, 0x3c9, 0x3ca,
+    0x3cb, 0x3c5, 0x308, 0x301, 0x3c3, 0x3d7,
+    0x3b2, 0x3b8, 0x3c6, 0x3c0, 0x3d9, 0x3db,
+    0x3dd, 0x3df, 0x3e1, 0x3e3, 0x3e5, 0x3e7,
+    0x3e9, 0x3eb, 0x3ed, 0x3ef, 0x3ba, 0x3c1,
+    0x3b8, 0x3b5, 0x3f8, 0x3f2, 0x3fb, 0x37b,
+    0x37c, 0x37d, 0x450, 0x451, 0x452, 0x453,
+    0x454, 0x455, 0x456, 0x457, 0x458, 0x459,
+    0x45a, 0x45b, 0x45c, 0x45d, 0x45e, 0x45f,
+    0x430, 0x431, 0x432, 0x433, 0x434, 0x435,
+    0x436, 0x437, 0x438, 0x439, 0x43a, 0x43b,
+    0x43c, 0x43d, 0x43e, 0x43f, 0x440, 0x441,
+    0x442, 0x443, 0x444, 0x445, 0x446, 0x447,
+    0x448, 0x449, 0x44a, 0x44b, 0x44c, 0x44d,
+    0x44e, 0x44f, 0x461, 0x463, 0x465, 0x467,
+    0x469, 0x46b, 0x46d, 0x46f, 0x471, 0x473,
+    0x475, 0x477, 0x479, 0x47b, 0x47d, 0x47f,
+    0x481, 0x48b, 0x48d, 0x48f, 0x491, 0x493,
+    0x495, 0x497, 0x499, 0x49b, 0x49d, 0x49f,
+    0x4a1, 0x4a3, 0x4a5, 0x4a7, 0x4a9, 0x4ab,
+    0x4ad, 0x4af, 0x4b1, 0x4b3, 0x4b5, 0x4b7,
+    0x4b9, 0x4bb, 0x4bd, 0x4bf, 0x4cf, 0x4c2,
+    0x4c4, 0x4c6, 0x4c8, 0x4ca, 0x4cc, 0x4ce,
+    0x4d1, 0x4d3, 0x4d5, 0x4d7, 0x4d9, 0x4db,
+    0x4dd, 0x4df, 0x4e1, 0x4e3, 0x4e5, 0x4e7,
+    0x4e9, 0x4eb, 0x4ed, 0x4ef, 0x4f1, 0x4f3,
+    0x4f5, 0x4f7, 0x4f9, 0x4fb, 0x4fd, 0x4ff,
+    0x501, 0x503, 0x505, 0x507, 0x509, 0x50b,
+    0x50d, 0x50f, 0x511, 0x513, 0x515, 0x517,
+    0x519, 0x51b, 0x51d, 0x51f, 0x521, 0x523,
+    0x525, 0x527, 0x529, 0x52b, 0x52d, 0x52f,
+    0x561, 0x562, 0x563, 0x564, 0x565, 0x566,
+    0x567, 0x568, 0x569, 0x56a, 0x56b, 0x56c,
+    0x56d, 0x56e, 0x56f, 0x570, 0x571, 0x572,
+    0x573, 0x574, 0x575, 0x576, 0x577, 0x578,
+    0x579, 0x57a, 0x57b, 0x57c, 0x57d, 0x57e,
+    0x57f, 0x580, 0x581, 0x582, 0x583, 0x584,
+    0x585, 0x586, 0x565, 0x582, 0x2d00, 0x2d01,
+    0x2d02, 0x2d03, 0x2d04, 0x2d05, 0x2d06, 0x2d07,
+    0x2d08, 0x2d09, 0x2d0a, 0x2d0b, 0x2d0c, 0x2d0d,
+    0x2d0e, 0x2d0f, 0x2d10, 0x2d11, 0x2d12, 0x2d13,
+    0x2d14, 0x2d15, 0x2d16, 0x2d17, 0x2d18, 0x2d19,
+    0x2d1a, 0x2d1b, 0x2d1c, 0x2d1d, 0x2d1e, 0x2d1f,
+    0x2d20, 0x2d21, 0x2d22, 0x2d23, 0x2d24, 0x2d25,
+    0x2d27, 0x2d2d, 0x13f0, 0x13f1, 0x13f2, 0x13f3,
+    0x13f4, 0x13f5, 0x432, 0x434, 0x43e, 0x441,
+    0x442, 0x442, 0x44a, 0x463, 0xa64b, 0x10d0,
+    0x10d1, 0x10d2, 0x10d3, 0x10d4, 0x10d5, 0x10d6,
+    0x10d7, 0x10d8, 0x10d9, 0x10da, 0x10db, 0x10dc,
+    0x10dd, 0x10de, 0x10df, 0x10e0, 0x10e1, 0x10e2,
+    0x10e3, 0x10e4, 0x10e5, 0x10e6, 0x10e7, 0x10e8,
+    0x10e9, 0x10ea, 0x10eb, 0x10ec, 0x10ed, 0x10ee,
+    0x10ef, 0x10f0, 0x10f1, 0x10f2, 0x10f3, 0x10f4,
+    0x10f5, 0x10f6, 0x10f7, 0x10f8, 0x10f9, 0x10fa,
+    0x10fd, 0x10fe, 0x10ff, 0x1e01, 0x1e03, 0x1e05,
+    0x1e07, 0x1e09, 0x1e0b, 0x1e0d, 0x1e0f, 0x1e11,
+    0x1e13, 0x1e15, 0x1e17, 0x1e19, 0x1e1b, 0x1e1d,
+    0x1e1f, 0x1e21, 0x1e23, 0x1e25, 0x1e27, 0x1e29,
+    0x1e2b, 0x1e2d, 0x1e2f, 0x1e31, 0x1e33, 0x1e35,
+    0x1e37, 0x1e39, 0x1e3b, 0x1e3d, 0x1e3f, 0x1e41,
+    0x1e43, 0x1e45, 0x1e47, 0x1e49, 0x1e4b, 0x1e4d,
+    0x1e4f, 0x1e51, 0x1e53, 0x1e55, 0x1e57, 0x1e59,
+    0x1e5b, 0x1e5d, 0x1e5f, 0x1e61, 0x1e63, 0x1e65,
+    0x1e67, 0x1e69, 0x1e6b, 0x1e6d, 0x1e6f, 0x1e71,
+    0x1e73, 0x1e75, 0x1e77, 0x1e79, 0x1e7b, 0x1e7d,
+    0x1e7f, 0x1e81, 0x1e83, 0x1e85, 0x1e87, 0x1e89,
+    0x1e8b, 0x1e8d, 0x1e8f, 0x1e91, 0x1e93, 0x1e95,
+    0x68, 0x331, 0x74, 0x308, 0x77, 0x30a,
+    0x79, 0x30a, 0x61, 0x2be, 0x1e61, 0x73,
+    0x73, 0x1ea1, 0x1ea3, 0x1ea5, 0x1ea7, 0x1ea9,
+    0x1eab, 0x1ead, 0x1eaf, 0x1eb1, 0x1eb3, 0x1eb5,
+    0x1eb7, 0x1eb9, 0x1ebb, 0x1ebd, 0x1ebf, 0x1ec1,
+    0x1ec3, 0x1ec5, 0x1ec7, 0x1ec9, 0x1ecb, 0x1ecd,
+    0x1ecf, 0x1ed1, 0x1ed3, 0x1ed5, 0x1ed7, 0x1ed9,
+    0x1edb, 0x1edd, 0x1edf, 0x1ee1, 0x1ee3, 0x1ee5,
+    0x1ee7, 0x1ee9, 0x1eeb, 0x1eed, 0x1eef, 0x1ef1,
+    0x1ef3, 0x1ef5, 0x1ef7, 0x1ef9, 0x1efb, 0x1efd,
+    0x1eff, 0x1f00, 0x1f01, 0x1f02, 0x1f03, 0x1f04,
+    0x1f05, 0x1f06, 0x1f07, 0x1f10, 0x1f11, 0x1f12,
+    0x1f13, 0x1f14, 0x1f15, 0x1f20, 0x1f21, 0x1f22,
+    0x1f23, 0x1f24, 0x1f25, 0x1f26, 0x1f27, 0x1f30,
+    0x1f31, 0x1f32, 0x1f33, 0x1f34, 0x1f35, 0x1f36,
+    0x1f37, 0x1f40, 0x1f41, 0x1f42, 0x1f43, 0x1f44,
+    0x1f45, 0x3c5, 0x313, 0x3c5, 0x313, 0x300,
+    0x3c5, 0x313, 0x301, 0x3c5, 0x313, 0x342,
+    0x1f51, 0x1f53, 0x1f55, 0x1f57, 0x1f60, 0x1f61,
+    0x1f62, 0x1f63, 0x1f64, 0x1f65, 0x1f66, 0x1f67,
+    0x1f00, 0x3b9, 0x1f01, 0x3b9, 0x1f02, 0x3b9,
+    0x1f03, 0x3b9, 0x1f04, 0x3b9, 0x1f05, 0x3b9,
+    0x1f06, 0x3b9, 0x1f07, 0x3b9, 0x1f00, 0x3b9,
+    0x1f01, 0x3b9, 0x1f02, 0x3b9, 0x1f03, 0x3b9,
+    0x1f04, 0x3b9, 0x1f05, 0x3b9, 0x1f06, 0x3b9,
+    0x1f07, 0x3b9, 0x1f20, 0x3b9, 0x1f21, 0x3b9,
+    0x1f22, 0x3b9, 0x1f23, 0x3b9, 0x1f24, 0x3b9,
+    0x1f25, 0x3b9, 0x1f26, 0x3b9, 0x1f27, 0x3b9,
+    0x1f20, 0x3b9, 0x1f21, 0x3b9, 0x1f22, 0x3b9,
+    0x1f23, 0x3b9, 0x1f24, 0x3b9, 0x1f25, 0x3b9,
+    0x1f26, 0x3b9, 0x1f27, 0x3b9, 0x1f60, 0x3b9,
+    0x1f61, 0x3b9, 0x1f62, 0x3b9, 0x1f63, 0x3b9,
+    0x1f64, 0x3b9, 0x1f65, 0x3b9, 0x1f66, 0x3b9,
+    0x1f67, 0x3b9, 0x1f60, 0x3b9, 0x1f61, 0x3b9,
+    0x1f62, 0x3b9, 0x1f63, 0x3b9, 0x1f64, 0x3b9,
+    0x1f65, 0x3b9, 0x1f66, 0x3b9, 0x1f67, 0x3b9,
+    0x1f70, 0x3b9, 0x3b1, 0x3b9, 0x3ac, 0x3b9,
+    0x3b1, 0x342, 0x3b1, 0x342, 0x3b9, 0x1fb0,
+    0x1fb1, 0x1f70, 0x1f71, 0x3b1, 0x3b9, 0x3b9,
+    0x1f74, 0x3b9, 0x3b7, 0x3b9, 0x3ae, 0x3b9,
+    0x3b7, 0x342, 0x3b7, 0x342, 0x3b9, 0x1f72,
+    0x1f73, 0x1f74, 0x1f75, 0x3b7, 0x3b9, 0x3b9,
+    0x308, 0x300, 0x3b9, 0x308, 0x301, 0x3b9,
+    0x342, 0x3b9, 0x308, 0x342, 0x1fd0, 0x1fd1,
+    0x1f76, 0x1f77, 0x3c5, 0x308, 0x300, 0x3c5,
+    0x308, 0x301, 0x3c1, 0x313, 0x3c5, 0x342,
+    0x3c5, 0x308, 0x342, 0x1fe0, 0x1fe1, 0x1f7a,
+    0x1f7b, 0x1fe5, 0x1f7c, 0x3b9, 0x3c9, 0x3b9,
+    0x3ce, 0x3b9, 0x3c9, 0x342, 0x3c9, 0x342,
+    0x3b9, 0x1f78, 0x1f79, 0x1f7c, 0x1f7d, 0x3c9,
+    0x3b9, 0x3c9, 0x6b, 0xe5, 0x214e, 0x2170,
+    0x2171, 0x2172, 0x2173, 0x2174, 0x2175, 0x2176,
+    0x2177, 0x2178, 0x2179, 0x217a, 0x217b, 0x217c,
+    0x217d, 0x217e, 0x217f, 0x2184, 0x24d0, 0x24d1,
+    0x24d2, 0x24d3, 0x24d4, 0x24d5, 0x24d6, 0x24d7,
+    0x24d8, 0x24d9, 0x24da, 0x24db, 0x24dc, 0x24dd,
+    0x24de, 0x24df, 0x24e0, 0x24e1, 0x24e2, 0x24e3,
+    0x24e4, 0x24e5, 0x24e6, 0x24e7, 0x24e8, 0x24e9,
+    0x2c30, 0x2c31, 0x2c32, 0x2c33, 0x2c34, 0x2c35,
+    0x2c36, 0x2c37, 0x2c38, 0x2c39, 0x2c3a, 0x2c3b,
+    0x2c3c, 0x2c3d, 0x2c3e, 0x2c3f, 0x2c40, 0x2c41,
+    0x2c42, 0x2c43, 0x2c44, 0x2c45, 0x2c46, 0x2c47,
+    0x2c48, 0x2c49, 0x2c4a, 0x2c4b, 0x2c4c, 0x2c4d,
+    0x2c4e, 0x2c4f, 0x2c50, 0x2c51, 0x2c52, 0x2c53,
+    0x2c54, 0x2c55, 0x2c56, 0x2c57, 0x2c58, 0x2c59,
+    0x2c5a, 0x2c5b, 0x2c5c, 0x2c5d, 0x2c5e, 0x2c5f,
+    0x2c61, 0x26b, 0x1d7d, 0x27d, 0x2c68, 0x2c6a,
+    0x2c6c, 0x251, 0x271, 0x250, 0x252, 0x2c73,
+    0x2c76, 0x23f, 0x240, 0x2c81, 0x2c83, 0x2c85,
+    0x2c87, 0x2c89, 0x2c8b, 0x2c8d, 0x2c8f, 0x2c91,
+    0x2c93, 0x2c95, 0x2c97, 0x2c99, 0x2c9b, 0x2c9d,
+    0x2c9f, 0x2ca1, 0x2ca3, 0x2ca5, 0x2ca7, 0x2ca9,
+    0x2cab, 0x2cad, 0x2caf, 0x2cb1, 0x2cb3, 0x2cb5,
+    0x2cb7, 0x2cb9, 0x2cbb, 0x2cbd, 0x2cbf, 0x2cc1,
+    0x2cc3, 0x2cc5, 0x2cc7, 0x2cc9, 0x2ccb, 0x2ccd,
+    0x2ccf, 0x2cd1, 0x2cd3, 0x2cd5, 0x2cd7, 0x2cd9,
+    0x2cdb, 0x2cdd, 0x2cdf, 0x2ce1, 0x2ce3, 0x2cec,
+    0x2cee, 0x2cf3, 0xa641, 0xa643, 0xa645, 0xa647,
+    0xa649, 0xa64b, 0xa64d, 0xa64f, 0xa651, 0xa653,
+    0xa655, 0xa657, 0xa659, 0xa65b, 0xa65d, 0xa65f,
+    0xa661, 0xa663, 0xa665, 0xa667, 0xa669, 0xa66b,
+    0xa66d, 0xa681, 0xa683, 0xa685, 0xa687, 0xa689,
+    0xa68b, 0xa68d, 0xa68f, 0xa691, 0xa693, 0xa695,
+    0xa697, 0xa699, 0xa69b, 0xa723, 0xa725, 0xa727,
+    0xa729, 0xa72b, 0xa72d, 0xa72f, 0xa733, 0xa735,
+    0xa737, 0xa739, 0xa73b, 0xa73d, 0xa73f, 0xa741,
+    0xa743, 0xa745, 0xa747, 0xa749, 0xa74b, 0xa74d,
+    0xa74f, 0xa751, 0xa753, 0xa755, 0xa757, 0xa759,
+    0xa75b, 0xa75d, 0xa75f, 0xa761, 0xa763, 0xa765,
+    0xa767, 0xa769, 0xa76b, 0xa76d, 0xa76f, 0xa77a,
+    0xa77c, 0x1d79, 0xa77f, 0xa781, 0xa783, 0xa785,
+    0xa787, 0xa78c, 0x265, 0xa791, 0xa793, 0xa797,
+    0xa799, 0xa79b, 0xa79d, 0xa79f, 0xa7a1, 0xa7a3,
+    0xa7a5, 0xa7a7, 0xa7a9, 0x266, 0x25c, 0x261,
+    0x26c, 0x26a, 0x29e, 0x287, 0x29d, 0xab53,
+    0xa7b5, 0xa7b7, 0xa7b9, 0xa7bb, 0xa7bd, 0xa7bf,
+    0xa7c1, 0xa7c3, 0xa794, 0x282, 0x1d8e, 0xa7c8,
+    0xa7ca, 0xa7d1, 0xa7d7, 0xa7d9, 0xa7f6, 0x13a0,
+    0x13a1, 0x13a2, 0x13a3, 0x13a4, 0x13a5, 0x13a6,
+    0x13a7, 0x13a8, 0x13a9, 0x13aa, 0x13ab, 0x13ac,
+    0x13ad, 0x13ae, 0x13af, 0x13b0, 0x13b1, 0x13b2,
+    0x13b3, 0x13b4, 0x13b5, 0x13b6, 0x13b7, 0x13b8,
+    0x13b9, 0x13ba, 0x13bb, 0x13bc, 0x13bd, 0x13be,
+    0x13bf, 0x13c0, 0x13c1, 0x13c2, 0x13c3, 0x13c4,
+    0x13c5, 0x13c6, 0x13c7, 0x13c8, 0x13c9, 0x13ca,
+    0x13cb, 0x13cc, 0x13cd, 0x13ce, 0x13cf, 0x13d0,
+    0x13d1, 0x13d2, 0x13d3, 0x13d4, 0x13d5, 0x13d6,
+    0x13d7, 0x13d8, 0x13d9, 0x13da, 0x13db, 0x13dc,
+    0x13dd, 0x13de, 0x13df, 0x13e0, 0x13e1, 0x13e2,
+    0x13e3, 0x13e4, 0x13e5, 0x13e6, 0x13e7, 0x13e8,
+    0x13e9, 0x13ea, 0x13eb, 0x13ec, 0x13ed, 0x13ee,
+    0x13ef, 0x66, 0x66, 0x66, 0x69, 0x66,
+    0x6c, 0x66, 0x66, 0x69, 0x66, 0x66,
+    0x6c, 0x73, 0x74, 0x73, 0x74, 0x574,
+    0x576, 0x574, 0x565, 0x574, 0x56b, 0x57e,
+    0x576, 0x574, 0x56d, 0xff41, 0xff42, 0xff43,
+    0xff44, 0xff45, 0xff46, 0xff47, 0xff48, 0xff49,
+    0xff4a, 0xff4b, 0xff4c, 0xff4d, 0xff4e, 0xff4f,
+    0xff50, 0xff51, 0xff52, 0xff53, 0xff54, 0xff55,
+    0xff56, 0xff57, 0xff58, 0xff59, 0xff5a, 0x10428,
+    0x10429, 0x1042a, 0x1042b, 0x1042c, 0x1042d, 0x1042e,
+    0x1042f, 0x10430, 0x10431, 0x10432, 0x10433, 0x10434,
+    0x10435, 0x10436, 0x10437, 0x10438, 0x10439, 0x1043a,
+    0x1043b, 0x1043c, 0x1043d, 0x1043e, 0x1043f, 0x10440,
+    0x10441, 0x10442, 0x10443, 0x10444, 0x10445, 0x10446,
+    0x10447, 0x10448, 0x10449, 0x1044a, 0x1044b, 0x1044c,
+    0x1044d, 0x1044e, 0x1044f, 0x104d8, 0x104d9, 0x104da,
+    0x104db, 0x104dc, 0x104dd, 0x104de, 0x104df, 0x104e0,
+    0x104e1, 0x104e2, 0x104e3, 0x104e4, 0x104e5, 0x104e6,
+    0x104e7, 0x104e8, 0x104e9, 0x104ea, 0x104eb, 0x104ec,
+    0x104ed, 0x104ee, 0x104ef, 0x104f0, 0x104f1, 0x104f2,
+    0x104f3, 0x104f4, 0x104f5, 0x104f6, 0x104f7, 0x104f8,
+    0x104f9, 0x104fa, 0x104fb, 0x10597, 0x10598, 0x10599,
+    0x1059a, 0x1059b, 0x1059c, 0x1059d, 0x1059e, 0x1059f,
+    0x105a0, 0x105a1, 0x105a3, 0x105a4, 0x105a5, 0x105a6,
+    0x105a7, 0x105a8, 0x105a9, 0x105aa, 0x105ab, 0x105ac,
+    0x105ad, 0x105ae, 0x105af, 0x105b0, 0x105b1, 0x105b3,
+    0x105b4, 0x105b5, 0x105b6, 0x105b7, 0x105b8, 0x105b9,
+    0x105bb, 0x105bc, 0x10cc0, 0x10cc1, 0x10cc2, 0x10cc3,
+    0x10cc4, 0x10cc5, 0x10cc6, 0x10cc7, 0x10cc8, 0x10cc9,
+    0x10cca, 0x10ccb, 0x10ccc, 0x10ccd, 0x10cce, 0x10ccf,
+    0x10cd0, 0x10cd1, 0x10cd2, 0x10cd3, 0x10cd4, 0x10cd5,
+    0x10cd6, 0x10cd7, 0x10cd8, 0x10cd9, 0x10cda, 0x10cdb,
+    0x10cdc, 0x10cdd, 0x10cde, 0x10cdf, 0x10ce0, 0x10ce1,
+    0x10ce2, 0x10ce3, 0x10ce4, 0x10ce5, 0x10ce6, 0x10ce7,
+    0x10ce8, 0x10ce9, 0x10cea, 0x10ceb, 0x10cec, 0x10ced,
+    0x10cee, 0x10cef, 0x10cf0, 0x10cf1, 0x10cf2, 0x118c0,
+    0x118c1, 0x118c2, 0x118c3, 0x118c4, 0x118c5, 0x118c6,
+    0x118c7, 0x118c8, 0x118c9, 0x118ca, 0x118cb, 0x118cc,
+    0x118cd, 0x118ce, 0x118cf, 0x118d0, 0x118d1, 0x118d2,
+    0x118d3, 0x118d4, 0x118d5, 0x118d6, 0x118d7, 0x118d8,
+    0x118d9, 0x118da, 0x118db, 0x118dc, 0x118dd, 0x118de,
+    0x118df, 0x16e60, 0x16e61, 0x16e62, 0x16e63, 0x16e64,
+    0x16e65, 0x16e66, 0x16e67, 0x16e68, 0x16e69, 0x16e6a,
+    0x16e6b, 0x16e6c, 0x16e6d, 0x16e6e, 0x16e6f, 0x16e70,
+    0x16e71, 0x16e72, 0x16e73, 0x16e74, 0x16e75, 0x16e76,
+    0x16e77, 0x16e78, 0x16e79, 0x16e7a, 0x16e7b, 0x16e7c,
+    0x16e7d, 0x16e7e, 0x16e7f, 0x1e922, 0x1e923, 0x1e924,
+    0x1e925, 0x1e926, 0x1e927, 0x1e928, 0x1e929, 0x1e92a,
+    0x1e92b, 0x1e92c, 0x1e92d, 0x1e92e, 0x1e92f, 0x1e930,
+    0x1e931, 0x1e932, 0x1e933, 0x1e934, 0x1e935, 0x1e936,
+    0x1e937, 0x1e938, 0x1e939, 0x1e93a, 0x1e93b, 0x1e93c,
+    0x1e93d, 0x1e93e, 0x1e93f, 0x1e940, 0x1e941, 0x1e942,
+    0x1e943
+};
+
+const uint32_t norm_cccs[ 912 ] = {
+    0x300e6, 0x301e6, 0x302e6, 0x303e6, 0x304e6, 0x305e6,
+    0x306e6, 0x307e6, 0x308e6, 0x309e6, 0x30ae6, 0x30be6,
+    0x30ce6, 0x30de6, 0x30ee6, 0x30fe6, 0x310e6, 0x311e6,
+    0x312e6, 0x313e6, 0x314e6, 0x315e8, 0x316dc, 0x317dc,
+    0x318dc, 0x319dc, 0x31ae8, 0x31bd8, 0x31cdc, 0x31ddc,
+    0x31edc, 0x31fdc, 0x320dc, 0x321ca, 0x322ca, 0x323dc,
+    0x324dc, 0x325dc, 0x326dc, 0x327ca, 0x328ca, 0x329dc,
+    0x32adc, 0x32bdc, 0x32cdc, 0x32ddc, 0x32edc, 0x32fdc,
+    0x330dc, 0x331dc, 0x332dc, 0x333dc, 0x33401, 0x33501,
+    0x33601, 0x33701, 0x33801, 0x339dc, 0x33adc, 0x33bdc,
+    0x33cdc, 0x33de6, 0x33ee6, 0x33fe6, 0x340e6, 0x341e6,
+    0x342e6, 0x343e6, 0x344e6, 0x345f0, 0x346e6, 0x347dc,
+    0x348dc, 0x349dc, 0x34ae6, 0x34be6, 0x34ce6, 0x34ddc,
+    0x34edc, 0x350e6, 0x351e6, 0x352e6, 0x353dc, 0x354dc,
+    0x355dc, 0x356dc, 0x357e6, 0x358e8, 0x359dc, 0x35adc,
+    0x35be6, 0x35ce9, 0x35dea, 0x35eea, 0x35fe9, 0x360ea,
+    0x361ea, 0x362e9, 0x363e6, 0x364e6, 0x365e6, 0x366e6,
+    0x367e6, 0x368e6, 0x369e6, 0x36ae6, 0x36be6, 0x36ce6,
+    0x36de6, 0x36ee6, 0x36fe6, 0x483e6, 0x484e6, 0x485e6,
+    0x486e6, 0x487e6, 0x591dc, 0x592e6, 0x593e6, 0x594e6,
+    0x595e6, 0x596dc, 0x597e6, 0x598e6, 0x599e6, 0x59ade,
+    0x59bdc, 0x59ce6, 0x59de6, 0x59ee6, 0x59fe6, 0x5a0e6,
+    0x5a1e6, 0x5a2dc, 0x5a3dc, 0x5a4dc, 0x5a5dc, 0x5a6dc,
+    0x5a7dc, 0x5a8e6, 0x5a9e6, 0x5aadc, 0x5abe6, 0x5ace6,
+    0x5adde, 0x5aee4, 0x5afe6, 0x5b00a, 0x5b10b, 0x5b20c,
+    0x5b30d, 0x5b40e, 0x5b50f, 0x5b610, 0x5b711, 0x5b812,
+    0x5b913, 0x5ba13, 0x5bb14, 0x5bc15, 0x5bd16, 0x5bf17,
+    0x5c118, 0x5c219, 0x5c4e6, 0x5c5dc, 0x5c712, 0x610e6,
+    0x611e6, 0x612e6, 0x613e6, 0x614e6, 0x615e6, 0x616e6,
+    0x617e6, 0x6181e, 0x6191f, 0x61a20, 0x64b1b, 0x64c1c,
+    0x64d1d, 0x64e1e, 0x64f1f, 0x65020, 0x65121, 0x65222,
+    0x653e6, 0x654e6, 0x655dc, 0x656dc, 0x657e6, 0x658e6,
+    0x659e6, 0x65ae6, 0x65be6, 0x65cdc, 0x65de6, 0x65ee6,
+    0x65fdc, 0x67023, 0x6d6e6, 0x6d7e6, 0x6d8e6, 0x6d9e6,
+    0x6dae6, 0x6dbe6, 0x6dce6, 0x6dfe6, 0x6e0e6, 0x6e1e6,
+    0x6e2e6, 0x6e3dc, 0x6e4e6, 0x6e7e6, 0x6e8e6, 0x6eadc,
+    0x6ebe6, 0x6ece6, 0x6eddc, 0x71124, 0x730e6, 0x731dc,
+    0x732e6, 0x733e6, 0x734dc, 0x735e6, 0x736e6, 0x737dc,
+    0x738dc, 0x739dc, 0x73ae6, 0x73bdc, 0x73cdc, 0x73de6,
+    0x73edc, 0x73fe6, 0x740e6, 0x741e6, 0x742dc, 0x743e6,
+    0x744dc, 0x745e6, 0x746dc, 0x747e6, 0x748dc, 0x749e6,
+    0x74ae6, 0x7ebe6, 0x7ece6, 0x7ede6, 0x7eee6, 0x7efe6,
+    0x7f0e6, 0x7f1e6, 0x7f2dc, 0x7f3e6, 0x7fddc, 0x816e6,
+    0x817e6, 0x818e6, 0x819e6, 0x81be6, 0x81ce6, 0x81de6,
+    0x81ee6, 0x81fe6, 0x820e6, 0x821e6, 0x822e6, 0x823e6,
+    0x825e6, 0x826e6, 0x827e6, 0x829e6, 0x82ae6, 0x82be6,
+    0x82ce6, 0x82de6, 0x859dc, 0x85adc, 0x85bdc, 0x898e6,
+    0x899dc, 0x89adc, 0x89bdc, 0x89ce6, 0x89de6, 0x89ee6,
+    0x89fe6, 0x8cae6, 0x8cbe6, 0x8cce6, 0x8cde6, 0x8cee6,
+    0x8cfdc, 0x8d0dc, 0x8d1dc, 0x8d2dc, 0x8d3dc, 0x8d4e6,
+    0x8d5e6, 0x8d6e6, 0x8d7e6, 0x8d8e6, 0x8d9e6, 0x8dae6,
+    0x8dbe6, 0x8dce6, 0x8dde6, 0x8dee6, 0x8dfe6, 0x8e0e6,
+    0x8e1e6, 0x8e3dc, 0x8e4e6, 0x8e5e6, 0x8e6dc, 0x8e7e6,
+    0x8e8e6, 0x8e9dc, 0x8eae6, 0x8ebe6, 0x8ece6, 0x8eddc,
+    0x8eedc, 0x8efdc, 0x8f01b, 0x8f11c, 0x8f21d, 0x8f3e6,
+    0x8f4e6, 0x8f5e6, 0x8f6dc, 0x8f7e6, 0x8f8e6, 0x8f9dc,
+    0x8fadc, 0x8fbe6, 0x8fce6, 0x8fde6, 0x8fee6, 0x8ffe6,
+    0x93c07, 0x94d09, 0x951e6, 0x952dc, 0x953e6, 0x954e6,
+    0x9bc07, 0x9cd09, 0x9fee6, 0xa3c07, 0xa4d09, 0xabc07,
+    0xacd09, 0xb3c07, 0xb4d09, 0xbcd09, 0xc3c07, 0xc4d09,
+    0xc5554, 0xc565b, 0xcbc07, 0xccd09, 0xd3b09, 0xd3c09,
+    0xd4d09, 0xdca09, 0xe3867, 0xe3967, 0xe3a09, 0xe486b,
+    0xe496b, 0xe4a6b, 0xe4b6b, 0xeb876, 0xeb976, 0xeba09,
+    0xec87a, 0xec97a, 0xeca7a, 0xecb7a, 0xf18dc, 0xf19dc,
+    0xf35dc, 0xf37dc, 0xf39d8, 0xf7181, 0xf7282, 0xf7484,
+    0xf7a82, 0xf7b82, 0xf7c82, 0xf7d82, 0xf8082, 0xf82e6,
+    0xf83e6, 0xf8409, 0xf86e6, 0xf87e6, 0xfc6dc, 0x103707,
+    0x103909, 0x103a09, 0x108ddc, 0x135de6, 0x135ee6, 0x135fe6,
+    0x171409, 0x171509, 0x173409, 0x17d209, 0x17dde6, 0x18a9e4,
+    0x1939de, 0x193ae6, 0x193bdc, 0x1a17e6, 0x1a18dc, 0x1a6009,
+    0x1a75e6, 0x1a76e6, 0x1a77e6, 0x1a78e6, 0x1a79e6, 0x1a7ae6,
+    0x1a7be6, 0x1a7ce6, 0x1a7fdc, 0x1ab0e6, 0x1ab1e6, 0x1ab2e6,
+    0x1ab3e6, 0x1ab4e6, 0x1ab5dc, 0x1ab6dc, 0x1ab7dc, 0x1ab8dc,
+    0x1ab9dc, 0x1abadc, 0x1abbe6, 0x1abce6, 0x1abddc, 0x1abfdc,
+    0x1ac0dc, 0x1ac1e6, 0x1ac2e6, 0x1ac3dc, 0x1ac4dc, 0x1ac5e6,
+    0x1ac6e6, 0x1ac7e6, 0x1ac8e6, 0x1ac9e6, 0x1acadc, 0x1acbe6,
+    0x1acce6, 0x1acde6, 0x1acee6, 0x1b3407, 0x1b4409, 0x1b6be6,
+    0x1b6cdc, 0x1b6de6, 0x1b6ee6, 0x1b6fe6, 0x1b70e6, 0x1b71e6,
+    0x1b72e6, 0x1b73e6, 0x1baa09, 0x1bab09, 0x1be607, 0x1bf209,
+    0x1bf309, 0x1c3707, 0x1cd0e6, 0x1cd1e6, 0x1cd2e6, 0x1cd401,
+    0x1cd5dc, 0x1cd6dc, 0x1cd7dc, 0x1cd8dc, 0x1cd9dc, 0x1cdae6,
+    0x1cdbe6, 0x1cdcdc, 0x1cdddc, 0x1cdedc, 0x1cdfdc, 0x1ce0e6,
+    0x1ce201, 0x1ce301, 0x1ce401, 0x1ce501, 0x1ce601, 0x1ce701,
+    0x1ce801, 0x1ceddc, 0x1cf4e6, 0x1cf8e6, 0x1cf9e6, 0x1dc0e6,
+    0x1dc1e6, 0x1dc2dc, 0x1dc3e6, 0x1dc4e6, 0x1dc5e6, 0x1dc6e6,
+    0x1dc7e6, 0x1dc8e6, 0x1dc9e6, 0x1dcadc, 0x1dcbe6, 0x1dcce6,
+    0x1dcdea, 0x1dced6, 0x1dcfdc, 0x1dd0ca, 0x1dd1e6, 0x1dd2e6,
+    0x1dd3e6, 0x1dd4e6, 0x1dd5e6, 0x1dd6e6, 0x1dd7e6, 0x1dd8e6,
+    0x1dd9e6, 0x1ddae6, 0x1ddbe6, 0x1ddce6, 0x1ddde6, 0x1ddee6,
+    0x1ddfe6, 0x1de0e6, 0x1de1e6, 0x1de2e6, 0x1de3e6, 0x1de4e6,
+    0x1de5e6, 0x1de6e6, 0x1de7e6, 0x1de8e6, 0x1de9e6, 0x1deae6,
+    0x1debe6, 0x1dece6, 0x1dede6, 0x1deee6, 0x1defe6, 0x1df0e6,
+    0x1df1e6, 0x1df2e6, 0x1df3e6, 0x1df4e6, 0x1df5e6, 0x1df6e8,
+    0x1df7e4, 0x1df8e4, 0x1df9dc, 0x1dfada, 0x1dfbe6, 0x1dfce9,
+    0x1dfddc, 0x1dfee6, 0x1dffdc, 0x20d0e6, 0x20d1e6, 0x20d201,
+    0x20d301, 0x20d4e6, 0x20d5e6, 0x20d6e6, 0x20d7e6, 0x20d801,
+    0x20d901, 0x20da01, 0x20dbe6, 0x20dce6, 0x20e1e6, 0x20e501,
+    0x20e601, 0x20e7e6, 0x20e8dc, 0x20e9e6, 0x20ea01, 0x20eb01,
+    0x20ecdc, 0x20eddc, 0x20eedc, 0x20efdc, 0x20f0e6, 0x2cefe6,
+    0x2cf0e6, 0x2cf1e6, 0x2d7f09, 0x2de0e6, 0x2de1e6, 0x2de2e6,
+    0x2de3e6, 0x2de4e6, 0x2de5e6, 0x2de6e6, 0x2de7e6, 0x2de8e6,
+    0x2de9e6, 0x2deae6, 0x2debe6, 0x2dece6, 0x2dede6, 0x2deee6,
+    0x2defe6, 0x2df0e6, 0x2df1e6, 0x2df2e6, 0x2df3e6, 0x2df4e6,
+    0x2df5e6, 0x2df6e6, 0x2df7e6, 0x2df8e6, 0x2df9e6, 0x2dfae6,
+    0x2dfbe6, 0x2dfce6, 0x2dfde6, 0x2dfee6, 0x2dffe6, 0x302ada,
+    0x302be4, 0x302ce8, 0x302dde, 0x302ee0, 0x302fe0, 0x309908,
+    0x309a08, 0xa66fe6, 0xa674e6, 0xa675e6, 0xa676e6, 0xa677e6,
+    0xa678e6, 0xa679e6, 0xa67ae6, 0xa67be6, 0xa67ce6, 0xa67de6,
+    0xa69ee6, 0xa69fe6, 0xa6f0e6, 0xa6f1e6, 0xa80609, 0xa82c09,
+    0xa8c409, 0xa8e0e6, 0xa8e1e6, 0xa8e2e6, 0xa8e3e6, 0xa8e4e6,
+    0xa8e5e6, 0xa8e6e6, 0xa8e7e6, 0xa8e8e6, 0xa8e9e6, 0xa8eae6,
+    0xa8ebe6, 0xa8ece6, 0xa8ede6, 0xa8eee6, 0xa8efe6, 0xa8f0e6,
+    0xa8f1e6, 0xa92bdc, 0xa92cdc, 0xa92ddc, 0xa95309, 0xa9b307,
+    0xa9c009, 0xaab0e6, 0xaab2e6, 0xaab3e6, 0xaab4dc, 0xaab7e6,
+    0xaab8e6, 0xaabee6, 0xaabfe6, 0xaac1e6, 0xaaf609, 0xabed09,
+    0xfb1e1a, 0xfe20e6, 0xfe21e6, 0xfe22e6, 0xfe23e6, 0xfe24e6,
+    0xfe25e6, 0xfe26e6, 0xfe27dc, 0xfe28dc, 0xfe29dc, 0xfe2adc,
+    0xfe2bdc, 0xfe2cdc, 0xfe2ddc, 0xfe2ee6, 0xfe2fe6, 0x101fddc,
+    0x102e0dc, 0x10376e6, 0x10377e6, 0x10378e6, 0x10379e6, 0x1037ae6,
+    0x10a0ddc, 0x10a0fe6, 0x10a38e6, 0x10a3901, 0x10a3adc, 0x10a3f09,
+    0x10ae5e6, 0x10ae6dc, 0x10d24e6, 0x10d25e6, 0x10d26e6, 0x10d27e6,
+    0x10eabe6, 0x10eace6, 0x10f46dc, 0x10f47dc, 0x10f48e6, 0x10f49e6,
+    0x10f4ae6, 0x10f4bdc, 0x10f4ce6, 0x10f4ddc, 0x10f4edc, 0x10f4fdc,
+    0x10f50dc, 0x10f82e6, 0x10f83dc, 0x10f84e6, 0x10f85dc, 0x1104609,
+    0x1107009, 0x1107f09, 0x110b909, 0x110ba07, 0x11100e6, 0x11101e6,
+    0x11102e6, 0x1113309, 0x1113409, 0x1117307, 0x111c009, 0x111ca07,
+    0x1123509, 0x1123607, 0x112e907, 0x112ea09, 0x1133b07, 0x1133c07,
+    0x1134d09, 0x11366e6, 0x11367e6, 0x11368e6, 0x11369e6, 0x1136ae6,
+    0x1136be6, 0x1136ce6, 0x11370e6, 0x11371e6, 0x11372e6, 0x11373e6,
+    0x11374e6, 0x1144209, 0x1144607, 0x1145ee6, 0x114c209, 0x114c307,
+    0x115bf09, 0x115c007, 0x1163f09, 0x116b609, 0x116b707, 0x1172b09,
+    0x1183909, 0x1183a07, 0x1193d09, 0x1193e09, 0x1194307, 0x119e009,
+    0x11a3409, 0x11a4709, 0x11a9909, 0x11c3f09, 0x11d4207, 0x11d4409,
+    0x11d4509, 0x11d9709, 0x16af001, 0x16af101, 0x16af201, 0x16af301,
+    0x16af401, 0x16b30e6, 0x16b31e6, 0x16b32e6, 0x16b33e6, 0x16b34e6,
+    0x16b35e6, 0x16b36e6, 0x16ff006, 0x16ff106, 0x1bc9e01, 0x1d165d8,
+    0x1d166d8, 0x1d16701, 0x1d16801, 0x1d16901, 0x1d16de2, 0x1d16ed8,
+    0x1d16fd8, 0x1d170d8, 0x1d171d8, 0x1d172d8, 0x1d17bdc, 0x1d17cdc,
+    0x1d17ddc, 0x1d17edc, 0x1d17fdc, 0x1d180dc, 0x1d181dc, 0x1d182dc,
+    0x1d185e6, 0x1d186e6, 0x1d187e6, 0x1d188e6, 0x1d189e6, 0x1d18adc,
+    0x1d18bdc, 0x1d1aae6, 0x1d1abe6, 0x1d1ace6, 0x1d1ade6, 0x1d242e6,
+    0x1d243e6, 0x1d244e6, 0x1e000e6, 0x1e001e6, 0x1e002e6, 0x1e003e6,
+    0x1e004e6, 0x1e005e6, 0x1e006e6, 0x1e008e6, 0x1e009e6, 0x1e00ae6,
+    0x1e00be6, 0x1e00ce6, 0x1e00de6, 0x1e00ee6, 0x1e00fe6, 0x1e010e6,
+    0x1e011e6, 0x1e012e6, 0x1e013e6, 0x1e014e6, 0x1e015e6, 0x1e016e6,
+    0x1e017e6, 0x1e018e6, 0x1e01be6, 0x1e01ce6, 0x1e01de6, 0x1e01ee6,
+    0x1e01fe6, 0x1e020e6, 0x1e021e6, 0x1e023e6, 0x1e024e6, 0x1e026e6,
+    0x1e027e6, 0x1e028e6, 0x1e029e6, 0x1e02ae6, 0x1e130e6, 0x1e131e6,
+    0x1e132e6, 0x1e133e6, 0x1e134e6, 0x1e135e6, 0x1e136e6, 0x1e2aee6,
+    0x1e2ece6, 0x1e2ede6, 0x1e2eee6, 0x1e2efe6, 0x1e8d0dc, 0x1e8d1dc,
+    0x1e8d2dc, 0x1e8d3dc, 0x1e8d4dc, 0x1e8d5dc, 0x1e8d6dc, 0x1e944e6,
+    0x1e945e6, 0x1e946e6, 0x1e947e6, 0x1e948e6, 0x1e949e6, 0x1e94a07
+};
+
+const uint32_t norm_decomp_cps[ 5795 ] = {
+    0xa0, 0xa8, 0xaa, 0xaf, 0xb2, 0xb3,
+    0xb4, 0xb5, 0xb8, 0xb9, 0xba, 0xbc,
+    0xbd, 0xbe, 0xc0, 0xc1, 0xc2, 0xc3,
+    0xc4, 0xc5, 0xc7, 0xc8, 0xc9, 0xca,
+    0xcb, 0xcc, 0xcd, 0xce, 0xcf, 0xd1,
+    0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd9,
+    0xda, 0xdb, 0xdc, 0xdd, 0xe0, 0xe1,
+    0xe2, 0xe3, 0xe4, 0xe5, 0xe7, 0xe8,
+    0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee,
+    0xef, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5,
+    0xf6, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd,
+    0xff, 0x100, 0x101, 0x102, 0x103, 0x104,
+    0x105, 0x106, 0x107, 0x108, 0x109, 0x10a,
+    0x10b, 0x10c, 0x10d, 0x10e, 0x10f, 0x112,
+    0x113, 0x114, 0x115, 0x116, 0x117, 0x118,
+    0x119, 0x11a, 0x11b, 0x11c, 0x11d, 0x11e,
+    0x11f, 0x120, 0x121, 0x122, 0x123, 0x124,
+    0x125, 0x128, 0x129, 0x12a, 0x12b, 0x12c,
+    0x12d, 0x12e, 0x12f, 0x130, 0x132, 0x133,
+    0x134, 0x135, 0x136, 0x137, 0x139, 0x13a,
+    0x13b, 0x13c, 0x13d, 0x13e, 0x13f, 0x140,
+    0x143, 0x144, 0x145, 0x146, 0x147, 0x148,
+    0x149, 0x14c, 0x14d, 0x14e, 0x14f, 0x150,
+    0x151, 0x154, 0x155, 0x156, 0x157, 0x158,
+    0x159, 0x15a, 0x15b, 0x15c, 0x15d, 0x15e,
+    0x15f, 0x160, 0x161, 0x162, 0x163, 0x164,
+    0x165, 0x168, 0x169, 0x16a, 0x16b, 0x16c,
+    0x16d, 0x16e, 0x16f, 0x170, 0x171, 0x172,
+    0x173, 0x174, 0x175, 0x176, 0x177, 0x178,
+    0x179, 0x17a, 0x17b, 0x17c, 0x17d, 0x17e,
+    0x17f, 0x1a0, 0x1a1, 0x1af, 0x1b0, 0x1c4,
+    0x1c5, 0x1c6, 0x1c7, 0x1c8, 0x1c9, 0x1ca,
+    0x1cb, 0x1cc, 0x1cd, 0x1ce, 0x1cf, 0x1d0,
+    0x1d1, 0x1d2, 0x1d3, 0x1d4, 0x1d5, 0x1d6,
+    0x1d7, 0x1d8, 0x1d9, 0x1da, 0x1db, 0x1dc,
+    0x1de, 0x1df, 0x1e0, 0x1e1, 0x1e2, 0x1e3,
+    0x1e6, 0x1e7, 0x1e8, 0x1e9, 0x1ea, 0x1eb,
+    0x1ec, 0x1ed, 0x1ee, 0x1ef, 0x1f0, 0x1f1,
+    0x1f2, 0x1f3, 0x1f4, 0x1f5, 0x1f8, 0x1f9,
+    0x1fa, 0x1fb, 0x1fc, 0x1fd, 0x1fe, 0x1ff,
+    0x200, 0x201, 0x202, 0x203, 0x204, 0x205,
+    0x206, 0x207, 0x208, 0x209, 0x20a, 0x20b,
+    0x20c, 0x20d, 0x20e, 0x20f, 0x210, 0x211,
+    0x212, 0x213, 0x214, 0x215, 0x216, 0x217,
+    0x218, 0x219, 0x21a, 0x21b, 0x21e, 0x21f,
+    0x226, 0x227, 0x228, 0x229, 0x22a, 0x22b,
+    0x22c, 0x22d, 0x22e, 0x22f, 0x230, 0x231,
+    0x232, 0x233, 0x2b0, 0x2b1, 0x2b2, 0x2b3,
+    0x2b4, 0x2b5, 0x2b6, 0x2b7, 0x2b8, 0x2d8,
+    0x2d9, 0x2da, 0x2db, 0x2dc, 0x2dd, 0x2e0,
+    0x2e1, 0x2e2, 0x2e3, 0x2e4, 0x340, 0x341,
+    0x343, 0x344, 0x374, 0x37a, 0x37e, 0x384,
+    0x385, 0x386, 0x387, 0x388, 0x389, 0x38a,
+    0x38c, 0x38e, 0x38f, 0x390, 0x3aa, 0x3ab,
+    0x3ac, 0x3ad, 0x3ae, 0x3af, 0x3b0, 0x3ca,
+    0x3cb, 0x3cc, 0x3cd, 0x3ce, 0x3d0, 0x3d1,
+    0x3d2, 0x3d3, 0x3d4, 0x3d5, 0x3d6, 0x3f0,
+    0x3f1, 0x3f2, 0x3f4, 0x3f5, 0x3f9, 0x400,
+    0x401, 0x403, 0x407, 0x40c, 0x40d, 0x40e,
+    0x419, 0x439, 0x450, 0x451, 0x453, 0x457,
+    0x45c, 0x45d, 0x45e, 0x476, 0x477, 0x4c1,
+    0x4c2, 0x4d0, 0x4d1, 0x4d2, 0x4d3, 0x4d6,
+    0x4d7, 0x4da, 0x4db, 0x4dc, 0x4dd, 0x4de,
+    0x4df, 0x4e2, 0x4e3, 0x4e4, 0x4e5, 0x4e6,
+    0x4e7, 0x4ea, 0x4eb, 0x4ec, 0x4ed, 0x4ee,
+    0x4ef, 0x4f0, 0x4f1, 0x4f2, 0x4f3, 0x4f4,
+    0x4f5, 0x4f8, 0x4f9, 0x587, 0x622, 0x623,
+    0x624, 0x625, 0x626, 0x675, 0x676, 0x677,
+    0x678, 0x6c0, 0x6c2, 0x6d3, 0x929, 0x931,
+    0x934, 0x958, 0x959, 0x95a, 0x95b, 0x95c,
+    0x95d, 0x95e, 0x95f, 0x9cb, 0x9cc, 0x9dc,
+    0x9dd, 0x9df, 0xa33, 0xa36, 0xa59, 0xa5a,
+    0xa5b, 0xa5e, 0xb48, 0xb4b, 0xb4c, 0xb5c,
+    0xb5d, 0xb94, 0xbca, 0xbcb, 0xbcc, 0xc48,
+    0xcc0, 0xcc7, 0xcc8, 0xcca, 0xccb, 0xd4a,
+    0xd4b, 0xd4c, 0xdda, 0xddc, 0xddd, 0xdde,
+    0xe33, 0xeb3, 0xedc, 0xedd, 0xf0c, 0xf43,
+    0xf4d, 0xf52, 0xf57, 0xf5c, 0xf69, 0xf73,
+    0xf75, 0xf76, 0xf77, 0xf78, 0xf79, 0xf81,
+    0xf93, 0xf9d, 0xfa2, 0xfa7, 0xfac, 0xfb9,
+    0x1026, 0x10fc, 0x1b06, 0x1b08, 0x1b0a, 0x1b0c,
+    0x1b0e, 0x1b12, 0x1b3b, 0x1b3d, 0x1b40, 0x1b41,
+    0x1b43, 0x1d2c, 0x1d2d, 0x1d2e, 0x1d30, 0x1d31,
+    0x1d32, 0x1d33, 0x1d34, 0x1d35, 0x1d36, 0x1d37,
+    0x1d38, 0x1d39, 0x1d3a, 0x1d3c, 0x1d3d, 0x1d3e,
+    0x1d3f, 0x1d40, 0x1d41, 0x1d42, 0x1d43, 0x1d44,
+    0x1d45, 0x1d46, 0x1d47, 0x1d48, 0x1d49, 0x1d4a,
+    0x1d4b, 0x1d4c, 0x1d4d, 0x1d4f, 0x1d50, 0x1d51,
+    0x1d52, 0x1d53, 0x1d54, 0x1d55, 0x1d56, 0x1d57,
+    0x1d58, 0x1d59, 0x1d5a, 0x1d5b, 0x1d5c, 0x1d5d,
+    0x1d5e, 0x1d5f, 0x1d60, 0x1d61, 0x1d62, 0x1d63,
+    0x1d64, 0x1d65, 0x1d66, 0x1d67, 0x1d68, 0x1d69,
+    0x1d6a, 0x1d78, 0x1d9b, 0x1d9c, 0x1d9d, 0x1d9e,
+    0x1d9f, 0x1da0, 0x1da1, 0x1da2, 0x1da3, 0x1da4,
+    0x1da5, 0x1da6, 0x1da7, 0x1da8, 0x1da9, 0x1daa,
+    0x1dab, 0x1dac, 0x1dad, 0x1dae, 0x1daf, 0x1db0,
+    0x1db1, 0x1db2, 0x1db3, 0x1db4, 0x1db5, 0x1db6,
+    0x1db7, 0x1db8, 0x1db9, 0x1dba, 0x1dbb, 0x1dbc,
+    0x1dbd, 0x1dbe, 0x1dbf, 0x1e00, 0x1e01, 0x1e02,
+    0x1e03, 0x1e04, 0x1e05, 0x1e06, 0x1e07, 0x1e08,
+    0x1e09, 0x1e0a, 0x1e0b, 0x1e0c, 0x1e0d, 0x1e0e,
+    0x1e0f, 0x1e10, 0x1e11, 0x1e12, 0x1e13, 0x1e14,
+    0x1e15, 0x1e16, 0x1e17, 0x1e18, 0x1e19, 0x1e1a,
+    0x1e1b, 0x1e1c, 0x1e1d, 0x1e1e, 0x1e1f, 0x1e20,
+    0x1e21, 0x1e22, 0x1e23, 0x1e24, 0x1e25, 0x1e26,
+    0x1e27, 0x1e28, 0x1e29, 0x1e2a, 0x1e2b, 0x1e2c,
+    0x1e2d, 0x1e2e, 0x1e2f, 0x1e30, 0x1e31, 0x1e32,
+    0x1e33, 0x1e34, 0x1e35, 0x1e36, 0x1e37, 0x1e38,
+    0x1e39, 0x1e3a, 0x1e3b, 0x1e3c, 0x1e3d, 0x1e3e,
+    0x1e3f, 0x1e40, 0x1e41, 0x1e42, 0x1e43, 0x1e44,
+    0x1e45, 0x1e46, 0x1e47, 0x1e48, 0x1e49, 0x1e4a,
+    0x1e4b, 0x1e4c, 0x1e4d, 0x1e4e, 0x1e4f, 0x1e50,
+    0x1e51, 0x1e52, 0x1e53, 0x1e54, 0x1e55, 0x1e56,
+    0x1e57, 0x1e58, 0x1e59, 0x1e5a, 0x1e5b, 0x1e5c,
+    0x1e5d, 0x1e5e, 0x1e5f, 0x1e60, 0x1e61, 0x1e62,
+    0x1e63, 0x1e64, 0x1e65, 0x1e66, 0x1e67, 0x1e68,
+    0x1e69, 0x1e6a, 0x1e6b, 0x1e6c, 0x1e6d, 0x1e6e,
+    0x1e6f, 0x1e70, 0x1e71, 0x1e72, 0x1e73, 0x1e74,
+    0x1e75, 0x1e76, 0x1e77, 0x1e78, 0x1e79, 0x1e7a,
+    0x1e7b, 0x1e7c, 0x1e7d, 0x1e7e, 0x1e7f, 0x1e80,
+    0x1e81, 0x1e82, 0x1e83, 0x1e84, 0x1e85, 0x1e86,
+    0x1e87, 0x1e88, 0x1e89, 0x1e8a, 0x1e8b, 0x1e8c,
+    0x1e8d, 0x1e8e, 0x1e8f, 0x1e90, 0x1e91, 0x1e92,
+    0x1e93, 0x1e94, 0x1e95, 0x1e96, 0x1e97, 0x1e98,
+    0x1e99, 0x1e9a, 0x1e9b, 0x1ea0, 0x1ea1, 0x1ea2,
+    0x1ea3, 0x1ea4, 0x1ea5, 0x1ea6, 0x1ea7, 0x1ea8,
+    0x1ea9, 0x1eaa, 0x1eab, 0x1eac, 0x1ead, 0x1eae,
+    0x1eaf, 0x1eb0, 0x1eb1, 0x1eb2, 0x1eb3, 0x1eb4,
+    0x1eb5, 0x1eb6, 0x1eb7, 0x1eb8, 0x1eb9, 0x1eba,
+    0x1ebb, 0x1ebc, 0x1ebd, 0x1ebe, 0x1ebf, 0x1ec0,
+    0x1ec1, 0x1ec2, 0x1ec3, 0x1ec4, 0x1ec5, 0x1ec6,
+    0x1ec7, 0x1ec8, 0x1ec9, 0x1eca, 0x1ecb, 0x1ecc,
+    0x1ecd, 0x1ece, 0x1ecf, 0x1ed0, 0x1ed1, 0x1ed2,
+    0x1ed3, 0x1ed4, 0x1ed5, 0x1ed6, 0x1ed7, 0x1ed8,
+    0x1ed9, 0x1eda, 0x1edb, 0x1edc, 0x1edd, 0x1ede,
+    0x1edf, 0x1ee0, 0x1ee1, 0x1ee2, 0x1ee3, 0x1ee4,
+    0x1ee5, 0x1ee6, 0x1ee7, 0x1ee8, 0x1ee9, 0x1eea,
+    0x1eeb, 0x1eec, 0x1eed, 0x1eee, 0x1eef, 0x1ef0,
+    0x1ef1, 0x1ef2, 0x1ef3, 0x1ef4, 0x1ef5, 0x1ef6,
+    0x1ef7, 0x1ef8, 0x1ef9, 0x1f00, 0x1f01, 0x1f02,
+    0x1f03, 0x1f04, 0x1f05, 0x1f06, 0x1f07, 0x1f08,
+    0x1f09, 0x1f0a, 0x1f0b, 0x1f0c, 0x1f0d, 0x1f0e,
+    0x1f0f, 0x1f10, 0x1f11, 0x1f12, 0x1f13, 0x1f14,
+    0x1f15, 0x1f18, 0x1f19, 0x1f1a, 0x1f1b, 0x1f1c,
+    0x1f1d, 0x1f20, 0x1f21, 0x1f22, 0x1f23, 0x1f24,
+    0x1f25, 0x1f26, 0x1f27, 0x1f28, 0x1f29, 0x1f2a,
+    0x1f2b, 0x1f2c, 0x1f2d, 0x1f2e, 0x1f2f, 0x1f30,
+    0x1f31, 0x1f32, 0x1f33, 0x1f34, 0x1f35, 0x1f36,
+    0x1f37, 0x1f38, 0x1f39, 0x1f3a, 0x1f3b, 0x1f3c,
+    0x1f3d, 0x1f3e, 0x1f3f, 0x1f40, 0x1f41, 0x1f42,
+    0x1f43, 0x1f44, 0x1f45, 0x1f48, 0x1f49, 0x1f4a,
+    0x1f4b, 0x1f4c, 0x1f4d, 0x1f50, 0x1f51, 0x1f52,
+    0x1f53, 0x1f54, 0x1f55, 0x1f56, 0x1f57, 0x1f59,
+    0x1f5b, 0x1f5d, 0x1f5f, 0x1f60, 0x1f61, 0x1f62,
+    0x1f63, 0x1f64, 0x1f65, 0x1f66, 0x1f67, 0x1f68,
+    0x1f69, 0x1f6a, 0x1f6b, 0x1f6c, 0x1f6d, 0x1f6e,
+    0x1f6f, 0x1f70, 0x1f71, 0x1f72, 0x1f73, 0x1f74,
+    0x1f75, 0x1f76, 0x1f77, 0x1f78, 0x1f79, 0x1f7a,
+    0x1f7b, 0x1f7c, 0x1f7d, 0x1f80, 0x1f81, 0x1f82,
+    0x1f83, 0x1f84, 0x1f85, 0x1f86, 0x1f87, 0x1f88,
+    0x1f89, 0x1f8a, 0x1f8b, 0x1f8c, 0x1f8d, 0x1f8e,
+    0x1f8f, 0x1f90, 0x1f91, 0x1f92, 0x1f93, 0x1f94,
+    0x1f95, 0x1f96, 0x1f97, 0x1f98, 0x1f99, 0x1f9a,
+    0x1f9b, 0x1f9c, 0x1f9d, 0x1f9e, 0x1f9f, 0x1fa0,
+    0x1fa1, 0x1fa2, 0x1fa3, 0x1fa4, 0x1fa5, 0x1fa6,
+    0x1fa7, 0x1fa8, 0x1fa9, 0x1faa, 0x1fab, 0x1fac,
+    0x1fad, 0x1fae, 0x1faf, 0x1fb0, 0x1fb1, 0x1fb2,
+    0x1fb3, 0x1fb4, 0x1fb6, 0x1fb7, 0x1fb8, 0x1fb9,
+    0x1fba, 0x1fbb, 0x1fbc, 0x1fbd, 0x1fbe, 0x1fbf,
+    0x1fc0, 0x1fc1, 0x1fc2, 0x1fc3, 0x1fc4, 0x1fc6,
+    0x1fc7, 0x1fc8, 0x1fc9, 0x1fca, 0x1fcb, 0x1fcc,
+    0x1fcd, 0x1fce, 0x1fcf, 0x1fd0, 0x1fd1, 0x1fd2,
+    0x1fd3, 0x1fd6, 0x1fd7, 0x1fd8, 0x1fd9, 0x1fda,
+    0x1fdb, 0x1fdd, 0x1fde, 0x1fdf, 0x1fe0, 0x1fe1,
+    0x1fe2, 0x1fe3, 0x1fe4, 0x1fe5, 0x1fe6, 0x1fe7,
+    0x1fe8, 0x1fe9, 0x1fea, 0x1feb, 0x1fec, 0x1fed,
+    0x1fee, 0x1fef, 0x1ff2, 0x1ff3, 0x1ff4, 0x1ff6,
+    0x1ff7, 0x1ff8, 0x1ff9, 0x1ffa, 0x1ffb, 0x1ffc,
+    0x1ffd, 0x1ffe, 0x2000, 0x2001, 0x2002, 0x2003,
+    0x2004, 0x2005, 0x2006, 0x2007, 0x2008, 0x2009,
+    0x200a, 0x2011, 0x2017, 0x2024, 0x2025, 0x2026,
+    0x202f, 0x2033, 0x2034, 0x2036, 0x2037, 0x203c,
+    0x203e, 0x2047, 0x2048, 0x2049, 0x2057, 0x205f,
+    0x2070, 0x2071, 0x2074, 0x2075, 0x2076, 0x2077,
+    0x2078, 0x2079, 0x207a, 0x207b, 0x207c, 0x207d,
+    0x207e, 0x207f, 0x2080, 0x2081, 0x2082, 0x2083,
+    0x2084, 0x2085, 0x2086, 0x2087, 0x2088, 0x2089,
+    0x208a, 0x208b, 0x208c, 0x208d, 0x208e, 0x2090,
+    0x2091, 0x2092, 0x2093, 0x2094, 0x2095, 0x2096,
+    0x2097, 0x2098, 0x2099, 0x209a, 0x209b, 0x209c,
+    0x20a8, 0x2100, 0x2101, 0x2102, 0x2103, 0x2105,
+    0x2106, 0x2107, 0x2109, 0x210a, 0x210b, 0x210c,
+    0x210d, 0x210e, 0x210f, 0x2110, 0x2111, 0x2112,
+    0x2113, 0x2115, 0x2116, 0x2119, 0x211a, 0x211b,
+    0x211c, 0x211d, 0x2120, 0x2121, 0x2122, 0x2124,
+    0x2126, 0x2128, 0x212a, 0x212b, 0x212c, 0x212d,
+    0x212f, 0x2130, 0x2131, 0x2133, 0x2134, 0x2135,
+    0x2136, 0x2137, 0x2138, 0x2139, 0x213b, 0x213c,
+    0x213d, 0x213e, 0x213f, 0x2140, 0x2145, 0x2146,
+    0x2147, 0x2148, 0x2149, 0x2150, 0x2151, 0x2152,
+    0x2153, 0x2154, 0x2155, 0x2156, 0x2157, 0x2158,
+    0x2159, 0x215a, 0x215b, 0x215c, 0x215d, 0x215e,
+    0x215f, 0x2160, 0x2161, 0x2162, 0x2163, 0x2164,
+    0x2165, 0x2166, 0x2167, 0x2168, 0x2169, 0x216a,
+    0x216b, 0x216c, 0x216d, 0x216e, 0x216f, 0x2170,
+    0x2171, 0x2172, 0x2173, 0x2174, 0x2175, 0x2176,
+    0x2177, 0x2178, 0x2179, 0x217a, 0x217b, 0x217c,
+    0x217d, 0x217e, 0x217f, 0x2189, 0x219a, 0x219b,
+    0x21ae, 0x21cd, 0x21ce, 0x21cf, 0x2204, 0x2209,
+    0x220c, 0x2224, 0x2226, 0x222c, 0x222d, 0x222f,
+    0x2230, 0x2241, 0x2244, 0x2247, 0x2249, 0x2260,
+    0x2262, 0x226d, 0x226e, 0x226f, 0x2270, 0x2271,
+    0x2274, 0x2275, 0x2278, 0x2279, 0x2280, 0x2281,
+    0x2284, 0x2285, 0x2288, 0x2289, 0x22ac, 0x22ad,
+    0x22ae, 0x22af, 0x22e0, 0x22e1, 0x22e2, 0x22e3,
+    0x22ea, 0x22eb, 0x22ec, 0x22ed, 0x2329, 0x232a,
+    0x2460, 0x2461, 0x2462, 0x2463, 0x2464, 0x2465,
+    0x2466, 0x2467, 0x2468, 0x2469, 0x246a, 0x246b,
+    0x246c, 0x246d, 0x246e, 0x246f, 0x2470, 0x2471,
+    0x2472, 0x2473, 0x2474, 0x2475, 0x2476, 0x2477,
+    0x2478, 0x2479, 0x247a, 0x247b, 0x247c, 0x247d,
+    0x247e, 0x247f, 0x2480, 0x2481, 0x2482, 0x2483,
+    0x2484, 0x2485, 0x2486, 0x2487, 0x2488, 0x2489,
+    0x248a, 0x248b, 0x248c, 0x248d, 0x248e, 0x248f,
+    0x2490, 0x2491, 0x2492, 0x2493, 0x2494, 0x2495,
+    0x2496, 0x2497, 0x2498, 0x2499, 0x249a, 0x249b,
+    0x249c, 0x249d, 0x249e, 0x249f, 0x24a0, 0x24a1,
+    0x24a2, 0x24a3, 0x24a4, 0x24a5, 0x24a6, 0x24a7,
+    0x24a8, 0x24a9, 0x24aa, 0x24ab, 0x24ac, 0x24ad,
+    0x24ae, 0x24af, 0x24b0, 0x24b1, 0x24b2, 0x24b3,
+    0x24b4, 0x24b5, 0x24b6, 0x24b7, 0x24b8, 0x24b9,
+    0x24ba, 0x24bb, 0x24bc, 0x24bd, 0x24be, 0x24bf,
+    0x24c0, 0x24c1, 0x24c2, 0x24c3, 0x24c4, 0x24c5,
+    0x24c6, 0x24c7, 0x24c8, 0x24c9, 0x24ca, 0x24cb,
+    0x24cc, 0x24cd, 0x24ce, 0x24cf, 0x24d0, 0x24d1,
+    0x24d2, 0x24d3, 0x24d4, 0x24d5, 0x24d6, 0x24d7,
+    0x24d8, 0x24d9, 0x24da, 0x24db, 0x24dc, 0x24dd,
+    0x24de, 0x24df, 0x24e0, 0x24e1, 0x24e2, 0x24e3,
+    0x24e4, 0x24e5, 0x24e6, 0x24e7, 0x24e8, 0x24e9,
+    0x24ea, 0x2a0c, 0x2a74, 0x2a75, 0x2a76, 0x2adc,
+    0x2c7c, 0x2c7d, 0x2d6f, 0x2e9f, 0x2ef3, 0x2f00,
+    0x2f01, 0x2f02, 0x2f03, 0x2f04, 0x2f05, 0x2f06,
+    0x2f07, 0x2f08, 0x2f09, 0x2f0a, 0x2f0b, 0x2f0c,
+    0x2f0d, 0x2f0e, 0x2f0f, 0x2f10, 0x2f11, 0x2f12,
+    0x2f13, 0x2f14, 0x2f15, 0x2f16, 0x2f17, 0x2f18,
+    0x2f19, 0x2f1a, 0x2f1b, 0x2f1c, 0x2f1d, 0x2f1e,
+    0x2f1f, 0x2f20, 0x2f21, 0x2f22, 0x2f23, 0x2f24,
+    0x2f25, 0x2f26, 0x2f27, 0x2f28, 0x2f29, 0x2f2a,
+    0x2f2b, 0x2f2c, 0x2f2d, 0x2f2e, 0x2f2f, 0x2f30,
+    0x2f31, 0x2f32, 0x2f33, 0x2f34, 0x2f35, 0x2f36,
+    0x2f37, 0x2f38, 0x2f39, 0x2f3a, 0x2f3b, 0x2f3c,
+    0x2f3d, 0x2f3e, 0x2f3f, 0x2f40, 0x2f41, 0x2f42,
+    0x2f43, 0x2f44, 0x2f45, 0x2f46, 0x2f47, 0x2f48,
+    0x2f49, 0x2f4a, 0x2f4b, 0x2f4c, 0x2f4d, 0x2f4e,
+    0x2f4f, 0x2f50, 0x2f51, 0x2f52, 0x2f53, 0x2f54,
+    0x2f55, 0x2f56, 0x2f57, 0x2f58, 0x2f59, 0x2f5a,
+    0x2f5b, 0x2f5c, 0x2f5d, 0x2f5e, 0x2f5f, 0x2f60,
+    0x2f61, 0x2f62, 0x2f63, 0x2f64, 0x2f65, 0x2f66,
+    0x2f67, 0x2f68, 0x2f69, 0x2f6a, 0x2f6b, 0x2f6c,
+    0x2f6d, 0x2f6e, 0x2f6f, 0x2f70, 0x2f71, 0x2f72,
+    0x2f73, 0x2f74, 0x2f75, 0x2f76, 0x2f77, 0x2f78,
+    0x2f79, 0x2f7a, 0x2f7b, 0x2f7c, 0x2f7d, 0x2f7e,
+    0x2f7f, 0x2f80, 0x2f81, 0x2f82, 0x2f83, 0x2f84,
+    0x2f85, 0x2f86, 0x2f87, 0x2f88, 0x2f89, 0x2f8a,
+    0x2f8b, 0x2f8c, 0x2f8d, 0x2f8e, 0x2f8f, 0x2f90,
+    0x2f91, 0x2f92, 0x2f93, 0x2f94, 0x2f95, 0x2f96,
+    0x2f97, 0x2f98, 0x2f99, 0x2f9a, 0x2f9b, 0x2f9c,
+    0x2f9d, 0x2f9e, 0x2f9f, 0x2fa0, 0x2fa1, 0x2fa2,
+    0x2fa3, 0x2fa4, 0x2fa5, 0x2fa6, 0x2fa7, 0x2fa8,
+    0x2fa9, 0x2faa, 0x2fab, 0x2fac, 0x2fad, 0x2fae,
+    0x2faf, 0x2fb0, 0x2fb1, 0x2fb2, 0x2fb3, 0x2fb4,
+    0x2fb5, 0x2fb6, 0x2fb7, 0x2fb8, 0x2fb9, 0x2fba,
+    0x2fbb, 0x2fbc, 0x2fbd, 0x2fbe, 0x2fbf, 0x2fc0,
+    0x2fc1, 0x2fc2, 0x2fc3, 0x2fc4, 0x2fc5, 0x2fc6,
+    0x2fc7, 0x2fc8, 0x2fc9, 0x2fca, 0x2fcb, 0x2fcc,
+    0x2fcd, 0x2fce, 0x2fcf, 0x2fd0, 0x2fd1, 0x2fd2,
+    0x2fd3, 0x2fd4, 0x2fd5, 0x3000, 0x3036, 0x3038,
+    0x3039, 0x303a, 0x304c, 0x304e, 0x3050, 0x3052,
+    0x3054, 0x3056, 0x3058, 0x305a, 0x305c, 0x305e,
+    0x3060, 0x3062, 0x3065, 0x3067, 0x3069, 0x3070,
+    0x3071, 0x3073, 0x3074, 0x3076, 0x3077, 0x3079,
+    0x307a, 0x307c, 0x307d, 0x3094, 0x309b, 0x309c,
+    0x309e, 0x309f, 0x30ac, 0x30ae, 0x30b0, 0x30b2,
+    0x30b4, 0x30b6, 0x30b8, 0x30ba, 0x30bc, 0x30be,
+    0x30c0, 0x30c2, 0x30c5, 0x30c7, 0x30c9, 0x30d0,
+    0x30d1, 0x30d3, 0x30d4, 0x30d6, 0x30d7, 0x30d9,
+    0x30da, 0x30dc, 0x30dd, 0x30f4, 0x30f7, 0x30f8,
+    0x30f9, 0x30fa, 0x30fe, 0x30ff, 0x3131, 0x3132,
+    0x3133, 0x3134, 0x3135, 0x3136, 0x3137, 0x3138,
+    0x3139, 0x313a, 0x313b, 0x313c, 0x313d, 0x313e,
+    0x313f, 0x3140, 0x3141, 0x3142, 0x3143, 0x3144,
+    0x3145, 0x3146, 0x3147, 0x3148, 0x3149, 0x314a,
+    0x314b, 0x314c, 0x314d, 0x314e, 0x314f, 0x3150,
+    0x3151, 0x3152, 0x3153, 0x3154, 0x3155, 0x3156,
+    0x3157, 0x3158, 0x3159, 0x315a, 0x315b, 0x315c,
+    0x315d, 0x315e, 0x315f, 0x3160, 0x3161, 0x3162,
+    0x3163, 0x3164, 0x3165, 0x3166, 0x3167, 0x3168,
+    0x3169, 0x316a, 0x316b, 0x316c, 0x316d, 0x316e,
+    0x316f, 0x3170, 0x3171, 0x3172, 0x3173, 0x3174,
+    0x3175, 0x3176, 0x3177, 0x3178, 0x3179, 0x317a,
+    0x317b, 0x317c, 0x317d, 0x317e, 0x317f, 0x3180,
+    0x3181, 0x3182, 0x3183, 0x3184, 0x3185, 0x3186,
+    0x3187, 0x3188, 0x3189, 0x318a, 0x318b, 0x318c,
+    0x318d, 0x318e, 0x3192, 0x3193, 0x3194, 0x3195,
+    0x3196, 0x3197, 0x3198, 0x3199, 0x319a, 0x319b,
+    0x319c, 0x319d, 0x319e, 0x319f, 0x3200, 0x3201,
+    0x3202, 0x3203, 0x3204, 0x3205, 0x3206, 0x3207,
+    0x3208, 0x3209, 0x320a, 0x320b, 0x320c, 0x320d,
+    0x320e, 0x320f, 0x3210, 0x3211, 0x3212, 0x3213,
+    0x3214, 0x3215, 0x3216, 0x3217, 0x3218, 0x3219,
+    0x321a, 0x321b, 0x321c, 0x321d, 0x321e, 0x3220,
+    0x3221, 0x3222, 0x3223, 0x3224, 0x3225, 0x3226,
+    0x3227, 0x3228, 0x3229, 0x322a, 0x322b, 0x322c,
+    0x322d, 0x322e, 0x322f, 0x3230, 0x3231, 0x3232,
+    0x3233, 0x3234, 0x3235, 0x3236, 0x3237, 0x3238,
+    0x3239, 0x323a, 0x323b, 0x323c, 0x323d, 0x323e,
+    0x323f, 0x3240, 0x3241, 0x3242, 0x3243, 0x3244,
+    0x3245, 0x3246, 0x3247, 0x3250, 0x3251, 0x3252,
+    0x3253, 0x3254, 0x3255, 0x3256, 0x3257, 0x3258,
+    0x3259, 0x325a, 0x325b, 0x325c, 0x325d, 0x325e,
+    0x325f, 0x3260, 0x3261, 0x3262, 0x3263, 0x3264,
+    0x3265, 0x3266, 0x3267, 0x3268, 0x3269, 0x326a,
+    0x326b, 0x326c, 0x326d, 0x326e, 0x326f, 0x3270,
+    0x3271, 0x3272, 0x3273, 0x3274, 0x3275, 0x3276,
+    0x3277, 0x3278, 0x3279, 0x327a, 0x327b, 0x327c,
+    0x327d, 0x327e, 0x3280, 0x3281, 0x3282, 0x3283,
+    0x3284, 0x3285, 0x3286, 0x3287, 0x3288, 0x3289,
+    0x328a, 0x328b, 0x328c, 0x328d, 0x328e, 0x328f,
+    0x3290, 0x3291, 0x3292, 0x3293, 0x3294, 0x3295,
+    0x3296, 0x3297, 0x3298, 0x3299, 0x329a, 0x329b,
+    0x329c, 0x329d, 0x329e, 0x329f, 0x32a0, 0x32a1,
+    0x32a2, 0x32a3, 0x32a4, 0x32a5, 0x32a6, 0x32a7,
+    0x32a8, 0x32a9, 0x32aa, 0x32ab, 0x32ac, 0x32ad,
+    0x32ae, 0x32af, 0x32b0, 0x32b1, 0x32b2, 0x32b3,
+    0x32b4, 0x32b5, 0x32b6, 0x32b7, 0x32b8, 0x32b9,
+    0x32ba, 0x32bb, 0x32bc, 0x32bd, 0x32be, 0x32bf,
+    0x32c0, 0x32c1, 0x32c2, 0x32c3, 0x32c4, 0x32c5,
+    0x32c6, 0x32c7, 0x32c8, 0x32c9, 0x32ca, 0x32cb,
+    0x32cc, 0x32cd, 0x32ce, 0x32cf, 0x32d0, 0x32d1,
+    0x32d2, 0x32d3, 0x32d4, 0x32d5, 0x32d6, 0x32d7,
+    0x32d8, 0x32d9, 0x32da, 0x32db, 0x32dc, 0x32dd,
+    0x32de, 0x32df, 0x32e0, 0x32e1, 0x32e2, 0x32e3,
+    0x32e4, 0x32e5, 0x32e6, 0x32e7, 0x32e8, 0x32e9,
+    0x32ea, 0x32eb, 0x32ec, 0x32ed, 0x32ee, 0x32ef,
+    0x32f0, 0x32f1, 0x32f2, 0x32f3, 0x32f4, 0x32f5,
+    0x32f6, 0x32f7, 0x32f8, 0x32f9, 0x32fa, 0x32fb,
+    0x32fc, 0x32fd, 0x32fe, 0x32ff, 0x3300, 0x3301,
+    0x3302, 0x3303, 0x3304, 0x3305, 0x3306, 0x3307,
+    0x3308, 0x3309, 0x330a, 0x330b, 0x330c, 0x330d,
+    0x330e, 0x330f, 0x3310, 0x3311, 0x3312, 0x3313,
+    0x3314, 0x3315, 0x3316, 0x3317, 0x3318, 0x3319,
+    0x331a, 0x331b, 0x331c, 0x331d, 0x331e, 0x331f,
+    0x3320, 0x3321, 0x3322, 0x3323, 0x3324, 0x3325,
+    0x3326, 0x3327, 0x3328, 0x3329, 0x332a, 0x332b,
+    0x332c, 0x332d, 0x332e, 0x332f, 0x3330, 0x3331,
+    0x3332, 0x3333, 0x3334, 0x3335, 0x3336, 0x3337,
+    0x3338, 0x3339, 0x333a, 0x333b, 0x333c, 0x333d,
+    0x333e, 0x333f, 0x3340, 0x3341, 0x3342, 0x3343,
+    0x3344, 0x3345, 0x3346, 0x3347, 0x3348, 0x3349,
+    0x334a, 0x334b, 0x334c, 0x334d, 0x334e, 0x334f,
+    0x3350, 0x3351, 0x3352, 0x3353, 0x3354, 0x3355,
+    0x3356, 0x3357, 0x3358, 0x3359, 0x335a, 0x335b,
+    0x335c, 0x335d, 0x335e, 0x335f, 0x3360, 0x3361,
+    0x3362, 0x3363, 0x3364, 0x3365, 0x3366, 0x3367,
+    0x3368, 0x3369, 0x336a, 0x336b, 0x336c, 0x336d,
+    0x336e, 0x336f, 0x3370, 0x3371, 0x3372, 0x3373,
+    0x3374, 0x3375, 0x3376, 0x3377, 0x3378, 0x3379,
+    0x337a, 0x337b, 0x337c, 0x337d, 0x337e, 0x337f,
+    0x3380, 0x3381, 0x3382, 0x3383, 0x3384, 0x3385,
+    0x3386, 0x3387, 0x3388, 0x3389, 0x338a, 0x338b,
+    0x338c, 0x338d, 0x338e, 0x338f, 0x3390, 0x3391,
+    0x3392, 0x3393, 0x3394, 0x3395, 0x3396, 0x3397,
+    0x3398, 0x3399, 0x339a, 0x339b, 0x339c, 0x339d,
+    0x339e, 0x339f, 0x33a0, 0x33a1, 0x33a2, 0x33a3,
+    0x33a4, 0x33a5, 0x33a6, 0x33a7, 0x33a8, 0x33a9,
+    0x33aa, 0x33ab, 0x33ac, 0x33ad, 0x33ae, 0x33af,
+    0x33b0, 0x33b1, 0x33b2, 0x33b3, 0x33b4, 0x33b5,
+    0x33b6, 0x33b7, 0x33b8, 0x33b9, 0x33ba, 0x33bb,
+    0x33bc, 0x33bd, 0x33be, 0x33bf, 0x33c0, 0x33c1,
+    0x33c2, 0x33c3, 0x33c4, 0x33c5, 0x33c6, 0x33c7,
+    0x33c8, 0x33c9, 0x33ca, 0x33cb, 0x33cc, 0x33cd,
+    0x33ce, 0x33cf, 0x33d0, 0x33d1, 0x33d2, 0x33d3,
+    0x33d4, 0x33d5, 0x33d6, 0x33d7, 0x33d8, 0x33d9,
+    0x33da, 0x33db, 0x33dc, 0x33dd, 0x33de, 0x33df,
+    0x33e0, 0x33e1, 0x33e2, 0x33e3, 0x33e4, 0x33e5,
+    0x33e6, 0x33e7, 0x33e8, 0x33e9, 0x33ea, 0x33eb,
+    0x33ec, 0x33ed, 0x33ee, 0x33ef, 0x33f0, 0x33f1,
+    0x33f2, 0x33f3, 0x33f4, 0x33f5, 0x33f6, 0x33f7,
+    0x33f8, 0x33f9, 0x33fa, 0x33fb, 0x33fc, 0x33fd,
+    0x33fe, 0x33ff, 0xa69c, 0xa69d, 0xa770, 0xa7f2,
+    0xa7f3, 0xa7f4, 0xa7f8, 0xa7f9, 0xab5c, 0xab5d,
+    0xab5e, 0xab5f, 0xab69, 0xf900, 0xf901, 0xf902,
+    0xf903, 0xf904, 0xf905, 0xf906, 0xf907, 0xf908,
+    0xf909, 0xf90a, 0xf90b, 0xf90c, 0xf90d, 0xf90e,
+    0xf90f, 0xf910, 0xf911, 0xf912, 0xf913, 0xf914,
+    0xf915, 0xf916, 0xf917, 0xf918, 0xf919, 0xf91a,
+    0xf91b, 0xf91c, 0xf91d, 0xf91e, 0xf91f, 0xf920,
+    0xf921, 0xf922, 0xf923, 0xf924, 0xf925, 0xf926,
+    0xf927, 0xf928, 0xf929, 0xf92a, 0xf92b, 0xf92c,
+    0xf92d, 0xf92e, 0xf92f, 0xf930, 0xf931, 0xf932,
+    0xf933, 0xf934, 0xf935, 0xf936, 0xf937, 0xf938,
+    0xf939, 0xf93a, 0xf93b, 0xf93c, 0xf93d, 0xf93e,
+    0xf93f, 0xf940, 0xf941, 0xf942, 0xf943, 0xf944,
+    0xf945, 0xf946, 0xf947, 0xf948, 0xf949, 0xf94a,
+    0xf94b, 0xf94c, 0xf94d, 0xf94e, 0xf94f, 0xf950,
+    0xf951, 0xf952, 0xf953, 0xf954, 0xf955, 0xf956,
+    0xf957, 0xf958, 0xf959, 0xf95a, 0xf95b, 0xf95c,
+    0xf95d, 0xf95e, 0xf95f, 0xf960, 0xf961, 0xf962,
+    0xf963, 0xf964, 0xf965, 0xf966, 0xf967, 0xf968,
+    0xf969, 0xf96a, 0xf96b, 0xf96c, 0xf96d, 0xf96e,
+    0xf96f, 0xf970, 0xf971, 0xf972, 0xf973, 0xf974,
+    0xf975, 0xf976, 0xf977, 0xf978, 0xf979, 0xf97a,
+    0xf97b, 0xf97c, 0xf97d, 0xf97e, 0xf97f, 0xf980,
+    0xf981, 0xf982, 0xf983, 0xf984, 0xf985, 0xf986,
+    0xf987, 0xf988, 0xf989, 0xf98a, 0xf98b, 0xf98c,
+    0xf98d, 0xf98e, 0xf98f, 0xf990, 0xf991, 0xf992,
+    0xf993, 0xf994, 0xf995, 0xf996, 0xf997, 0xf998,
+    0xf999, 0xf99a, 0xf99b, 0xf99c, 0xf99d, 0xf99e,
+    0xf99f, 0xf9a0, 0xf9a1, 0xf9a2, 0xf9a3, 0xf9a4,
+    0xf9a5, 0xf9a6, 0xf9a7, 0xf9a8, 0xf9a9, 0xf9aa,
+    0xf9ab, 0xf9ac, 0xf9ad, 0xf9ae, 0xf9af, 0xf9b0,
+    0xf9b1, 0xf9b2, 0xf9b3, 0xf9b4, 0xf9b5, 0xf9b6,
+    0xf9b7, 0xf9b8, 0xf9b9, 0xf9ba, 0xf9bb, 0xf9bc,
+    0xf9bd, 0xf9be, 0xf9bf, 0xf9c0, 0xf9c1, 0xf9c2,
+    0xf9c3, 0xf9c4, 0xf9c5, 0xf9c6, 0xf9c7, 0xf9c8,
+    0xf9c9, 0xf9ca, 0xf9cb, 0xf9cc, 0xf9cd, 0xf9ce,
+    0xf9cf, 0xf9d0, 0xf9d1, 0xf9d2, 0xf9d3, 0xf9d4,
+    0xf9d5, 0xf9d6, 0xf9d7, 0xf9d8, 0xf9d9, 0xf9da,
+    0xf9db, 0xf9dc, 0xf9dd, 0xf9de, 0xf9df, 0xf9e0,
+    0xf9e1, 0xf9e2, 0xf9e3, 0xf9e4, 0xf9e5, 0xf9e6,
+    0xf9e7, 0xf9e8, 0xf9e9, 0xf9ea, 0xf9eb, 0xf9ec,
+    0xf9ed, 0xf9ee, 0xf9ef, 0xf9f0, 0xf9f1, 0xf9f2,
+    0xf9f3, 0xf9f4, 0xf9f5, 0xf9f6, 0xf9f7, 0xf9f8,
+    0xf9f9, 0xf9fa, 0xf9fb, 0xf9fc, 0xf9fd, 0xf9fe,
+    0xf9ff, 0xfa00, 0xfa01, 0xfa02, 0xfa03, 0xfa04,
+    0xfa05, 0xfa06, 0xfa07, 0xfa08, 0xfa09, 0xfa0a,
+    0xfa0b, 0xfa0c, 0xfa0d, 0xfa10, 0xfa12, 0xfa15,
+    0xfa16, 0xfa17, 0xfa18, 0xfa19, 0xfa1a, 0xfa1b,
+    0xfa1c, 0xfa1d, 0xfa1e, 0xfa20, 0xfa22, 0xfa25,
+    0xfa26, 0xfa2a, 0xfa2b, 0xfa2c, 0xfa2d, 0xfa2e,
+    0xfa2f, 0xfa30, 0xfa31, 0xfa32, 0xfa33, 0xfa34,
+    0xfa35, 0xfa36, 0xfa37, 0xfa38, 0xfa39, 0xfa3a,
+    0xfa3b, 0xfa3c, 0xfa3d, 0xfa3e, 0xfa3f, 0xfa40,
+    0xfa41, 0xfa42, 0xfa43, 0xfa44, 0xfa45, 0xfa46,
+    0xfa47, 0xfa48, 0xfa49, 0xfa4a, 0xfa4b, 0xfa4c,
+    0xfa4d, 0xfa4e, 0xfa4f, 0xfa50, 0xfa51, 0xfa52,
+    0xfa53, 0xfa54, 0xfa55, 0xfa56, 0xfa57, 0xfa58,
+    0xfa59, 0xfa5a, 0xfa5b, 0xfa5c, 0xfa5d, 0xfa5e,
+    0xfa5f, 0xfa60, 0xfa61, 0xfa62, 0xfa63, 0xfa64,
+    0xfa65, 0xfa66, 0xfa67, 0xfa68, 0xfa69, 0xfa6a,
+    0xfa6b, 0xfa6c, 0xfa6d, 0xfa70, 0xfa71, 0xfa72,
+    0xfa73, 0xfa74, 0xfa75, 0xfa76, 0xfa77, 0xfa78,
+    0xfa79, 0xfa7a, 0xfa7b, 0xfa7c, 0xfa7d, 0xfa7e,
+    0xfa7f, 0xfa80, 0xfa81, 0xfa82, 0xfa83, 0xfa84,
+    0xfa85, 0xfa86, 0xfa87, 0xfa88, 0xfa89, 0xfa8a,
+    0xfa8b, 0xfa8c, 0xfa8d, 0xfa8e, 0xfa8f, 0xfa90,
+    0xfa91, 0xfa92, 0xfa93, 0xfa94, 0xfa95, 0xfa96,
+    0xfa97, 0xfa98, 0xfa99, 0xfa9a, 0xfa9b, 0xfa9c,
+    0xfa9d, 0xfa9e, 0xfa9f, 0xfaa0, 0xfaa1, 0xfaa2,
+    0xfaa3, 0xfaa4, 0xfaa5, 0xfaa6, 0xfaa7, 0xfaa8,
+    0xfaa9, 0xfaaa, 0xfaab, 0xfaac, 0xfaad, 0xfaae,
+    0xfaaf, 0xfab0, 0xfab1, 0xfab2, 0xfab3, 0xfab4,
+    0xfab5, 0xfab6, 0xfab7, 0xfab8, 0xfab9, 0xfaba,
+    0xfabb, 0xfabc, 0xfabd, 0xfabe, 0xfabf, 0xfac0,
+    0xfac1, 0xfac2, 0xfac3, 0xfac4, 0xfac5, 0xfac6,
+    0xfac7, 0xfac8, 0xfac9, 0xfaca, 0xfacb, 0xfacc,
+    0xfacd, 0xface, 0xfacf, 0xfad0, 0xfad1, 0xfad2,
+    0xfad3, 0xfad4, 0xfad5, 0xfad6, 0xfad7, 0xfad8,
+    0xfad9, 0xfb00, 0xfb01, 0xfb02, 0xfb03, 0xfb04,
+    0xfb05, 0xfb06, 0xfb13, 0xfb14, 0xfb15, 0xfb16,
+    0xfb17, 0xfb1d, 0xfb1f, 0xfb20, 0xfb21, 0xfb22,
+    0xfb23, 0xfb24, 0xfb25, 0xfb26, 0xfb27, 0xfb28,
+    0xfb29, 0xfb2a, 0xfb2b, 0xfb2c, 0xfb2d, 0xfb2e,
+    0xfb2f, 0xfb30, 0xfb31, 0xfb32, 0xfb33, 0xfb34,
+    0xfb35, 0xfb36, 0xfb38, 0xfb39, 0xfb3a, 0xfb3b,
+    0xfb3c, 0xfb3e, 0xfb40, 0xfb41, 0xfb43, 0xfb44,
+    0xfb46, 0xfb47, 0xfb48, 0xfb49, 0xfb4a, 0xfb4b,
+    0xfb4c, 0xfb4d, 0xfb4e, 0xfb4f, 0xfb50, 0xfb51,
+    0xfb52, 0xfb53, 0xfb54, 0xfb55, 0xfb56, 0xfb57,
+    0xfb58, 0xfb59, 0xfb5a, 0xfb5b, 0xfb5c, 0xfb5d,
+    0xfb5e, 0xfb5f, 0xfb60, 0xfb61, 0xfb62, 0xfb63,
+    0xfb64, 0xfb65, 0xfb66, 0xfb67, 0xfb68, 0xfb69,
+    0xfb6a, 0xfb6b, 0xfb6c, 0xfb6d, 0xfb6e, 0xfb6f,
+    0xfb70, 0xfb71, 0xfb72, 0xfb73, 0xfb74, 0xfb75,
+    0xfb76, 0xfb77, 0xfb78, 0xfb79, 0xfb7a, 0xfb7b,
+    0xfb7c, 0xfb7d, 0xfb7e, 0xfb7f, 0xfb80, 0xfb81,
+    0xfb82, 0xfb83, 0xfb84, 0xfb85, 0xfb86, 0xfb87,
+    0xfb88, 0xfb89, 0xfb8a, 0xfb8b, 0xfb8c, 0xfb8d,
+    0xfb8e, 0xfb8f, 0xfb90, 0xfb91, 0xfb92, 0xfb93,
+    0xfb94, 0xfb95, 0xfb96, 0xfb97, 0xfb98, 0xfb99,
+    0xfb9a, 0xfb9b, 0xfb9c, 0xfb9d, 0xfb9e, 0xfb9f,
+    0xfba0, 0xfba1, 0xfba2, 0xfba3, 0xfba4, 0xfba5,
+    0xfba6, 0xfba7, 0xfba8, 0xfba9, 0xfbaa, 0xfbab,
+    0xfbac, 0xfbad, 0xfbae, 0xfbaf, 0xfbb0, 0xfbb1,
+    0xfbd3, 0xfbd4, 0xfbd5, 0xfbd6, 0xfbd7, 0xfbd8,
+    0xfbd9, 0xfbda, 0xfbdb, 0xfbdc, 0xfbdd, 0xfbde,
+    0xfbdf, 0xfbe0, 0xfbe1, 0xfbe2, 0xfbe3, 0xfbe4,
+    0xfbe5, 0xfbe6, 0xfbe7, 0xfbe8, 0xfbe9, 0xfbea,
+    0xfbeb, 0xfbec, 0xfbed, 0xfbee, 0xfbef, 0xfbf0,
+    0xfbf1, 0xfbf2, 0xfbf3, 0xfbf4, 0xfbf5, 0xfbf6,
+    0xfbf7, 0xfbf8, 0xfbf9, 0xfbfa, 0xfbfb, 0xfbfc,
+    0xfbfd, 0xfbfe, 0xfbff, 0xfc00, 0xfc01, 0xfc02,
+    0xfc03, 0xfc04, 0xfc05, 0xfc06, 0xfc07, 0xfc08,
+    0xfc09, 0xfc0a, 0xfc0b, 0xfc0c, 0xfc0d, 0xfc0e,
+    0xfc0f, 0xfc10, 0xfc11, 0xfc12, 0xfc13, 0xfc14,
+    0xfc15, 0xfc16, 0xfc17, 0xfc18, 0xfc19, 0xfc1a,
+    0xfc1b, 0xfc1c, 0xfc1d, 0xfc1e, 0xfc1f, 0xfc20,
+    0xfc21, 0xfc22, 0xfc23, 0xfc24, 0xfc25, 0xfc26,
+    0xfc27, 0xfc28, 0xfc29, 0xfc2a, 0xfc2b, 0xfc2c,
+    0xfc2d, 0xfc2e, 0xfc2f, 0xfc30, 0xfc31, 0xfc32,
+    0xfc33, 0xfc34, 0xfc35, 0xfc36, 0xfc37, 0xfc38,
+    0xfc39, 0xfc3a, 0xfc3b, 0xfc3c, 0xfc3d, 0xfc3e,
+    0xfc3f, 0xfc40, 0xfc41, 0xfc42, 0xfc43, 0xfc44,
+    0xfc45, 0xfc46, 0xfc47, 0xfc48, 0xfc49, 0xfc4a,
+    0xfc4b, 0xfc4c, 0xfc4d, 0xfc4e, 0xfc4f, 0xfc50,
+    0xfc51, 0xfc52, 0xfc53, 0xfc54, 0xfc55, 0xfc56,
+    0xfc57, 0xfc58, 0xfc59, 0xfc5a, 0xfc5b, 0xfc5c,
+    0xfc5d, 0xfc5e, 0xfc5f, 0xfc60, 0xfc61, 0xfc62,
+    0xfc63, 0xfc64, 0xfc65, 0xfc66, 0xfc67, 0xfc68,
+    0xfc69, 0xfc6a, 0xfc6b, 0xfc6c, 0xfc6d, 0xfc6e,
+    0xfc6f, 0xfc70, 0xfc71, 0xfc72, 0xfc73, 0xfc74,
+    0xfc75, 0xfc76, 0xfc77, 0xfc78, 0xfc79, 0xfc7a,
+    0xfc7b, 0xfc7c, 0xfc7d, 0xfc7e, 0xfc7f, 0xfc80,
+    0xfc81, 0xfc82, 0xfc83, 0xfc84, 0xfc85, 0xfc86,
+    0xfc87, 0xfc88, 0xfc89, 0xfc8a, 0xfc8b, 0xfc8c,
+    0xfc8d, 0xfc8e, 0xfc8f, 0xfc90, 0xfc91, 0xfc92,
+    0xfc93, 0xfc94, 0xfc95, 0xfc96, 0xfc97, 0xfc98,
+    0xfc99, 0xfc9a, 0xfc9b, 0xfc9c, 0xfc9d, 0xfc9e,
+    0xfc9f, 0xfca0, 0xfca1, 0xfca2, 0xfca3, 0xfca4,
+    0xfca5, 0xfca6, 0xfca7, 0xfca8, 0xfca9, 0xfcaa,
+    0xfcab, 0xfcac, 0xfcad, 0xfcae, 0xfcaf, 0xfcb0,
+    0xfcb1, 0xfcb2, 0xfcb3, 0xfcb4, 0xfcb5, 0xfcb6,
+    0xfcb7, 0xfcb8, 0xfcb9, 0xfcba, 0xfcbb, 0xfcbc,
+    0xfcbd, 0xfcbe, 0xfcbf, 0xfcc0, 0xfcc1, 0xfcc2,
+    0xfcc3, 0xfcc4, 0xfcc5, 0xfcc6, 0xfcc7, 0xfcc8,
+    0xfcc9, 0xfcca, 0xfccb, 0xfccc, 0xfccd, 0xfcce,
+    0xfccf, 0xfcd0, 0xfcd1, 0xfcd2, 0xfcd3, 0xfcd4,
+    0xfcd5, 0xfcd6, 0xfcd7, 0xfcd8, 0xfcd9, 0xfcda,
+    0xfcdb, 0xfcdc, 0xfcdd, 0xfcde, 0xfcdf, 0xfce0,
+    0xfce1, 0xfce2, 0xfce3, 0xfce4, 0xfce5, 0xfce6,
+    0xfce7, 0xfce8, 0xfce9, 0xfcea, 0xfceb, 0xfcec,
+    0xfced, 0xfcee, 0xfcef, 0xfcf0, 0xfcf1, 0xfcf2,
+    0xfcf3, 0xfcf4, 0xfcf5, 0xfcf6, 0xfcf7, 0xfcf8,
+    0xfcf9, 0xfcfa, 0xfcfb, 0xfcfc, 0xfcfd, 0xfcfe,
+    0xfcff, 0xfd00, 0xfd01, 0xfd02, 0xfd03, 0xfd04,
+    0xfd05, 0xfd06, 0xfd07, 0xfd08, 0xfd09, 0xfd0a,
+    0xfd0b, 0xfd0c, 0xfd0d, 0xfd0e, 0xfd0f, 0xfd10,
+    0xfd11, 0xfd12, 0xfd13, 0xfd14, 0xfd15, 0xfd16,
+    0xfd17, 0xfd18, 0xfd19, 0xfd1a, 0xfd1b, 0xfd1c,
+    0xfd1d, 0xfd1e, 0xfd1f, 0xfd20, 0xfd21, 0xfd22,
+    0xfd23, 0xfd24, 0xfd25, 0xfd26, 0xfd27, 0xfd28,
+    0xfd29, 0xfd2a, 0xfd2b, 0xfd2c, 0xfd2d, 0xfd2e,
+    0xfd2f, 0xfd30, 0xfd31, 0xfd32, 0xfd33, 0xfd34,
+    0xfd35, 0xfd36, 0xfd37, 0xfd38, 0xfd39, 0xfd3a,
+    0xfd3b, 0xfd3c, 0xfd3d, 0xfd50, 0xfd51, 0xfd52,
+    0xfd53, 0xfd54, 0xfd55, 0xfd56, 0xfd57, 0xfd58,
+    0xfd59, 0xfd5a, 0xfd5b, 0xfd5c, 0xfd5d, 0xfd5e,
+    0xfd5f, 0xfd60, 0xfd61, 0xfd62, 0xfd63, 0xfd64,
+    0xfd65, 0xfd66, 0xfd67, 0xfd68, 0xfd69, 0xfd6a,
+    0xfd6b, 0xfd6c, 0xfd6d, 0xfd6e, 0xfd6f, 0xfd70,
+    0xfd71, 0xfd72, 0xfd73, 0xfd74, 0xfd75, 0xfd76,
+    0xfd77, 0xfd78, 0xfd79, 0xfd7a, 0xfd7b, 0xfd7c,
+    0xfd7d, 0xfd7e, 0xfd7f, 0xfd80, 0xfd81, 0xfd82,
+    0xfd83, 0xfd84, 0xfd85, 0xfd86, 0xfd87, 0xfd88,
+    0xfd89, 0xfd8a, 0xfd8b, 0xfd8c, 0xfd8d, 0xfd8e,
+    0xfd8f, 0xfd92, 0xfd93, 0xfd94, 0xfd95, 0xfd96,
+    0xfd97, 0xfd98, 0xfd99, 0xfd9a, 0xfd9b, 0xfd9c,
+    0xfd9d, 0xfd9e, 0xfd9f, 0xfda0, 0xfda1, 0xfda2,
+    0xfda3, 0xfda4, 0xfda5, 0xfda6, 0xfda7, 0xfda8,
+    0xfda9, 0xfdaa, 0xfdab, 0xfdac, 0xfdad, 0xfdae,
+    0xfdaf, 0xfdb0, 0xfdb1, 0xfdb2, 0xfdb3, 0xfdb4,
+    0xfdb5, 0xfdb6, 0xfdb7, 0xfdb8, 0xfdb9, 0xfdba,
+    0xfdbb, 0xfdbc, 0xfdbd, 0xfdbe, 0xfdbf, 0xfdc0,
+    0xfdc1, 0xfdc2, 0xfdc3, 0xfdc4, 0xfdc5, 0xfdc6,
+    0xfdc7, 0xfdf0, 0xfdf1, 0xfdf2, 0xfdf3, 0xfdf4,
+    0xfdf5, 0xfdf6, 0xfdf7, 0xfdf8, 0xfdf9, 0xfdfa,
+    0xfdfb, 0xfdfc, 0xfe10, 0xfe11, 0xfe12, 0xfe13,
+    0xfe14, 0xfe15, 0xfe16, 0xfe17, 0xfe18, 0xfe19,
+    0xfe30, 0xfe31, 0xfe32, 0xfe33, 0xfe34, 0xfe35,
+    0xfe36, 0xfe37, 0xfe38, 0xfe39, 0xfe3a, 0xfe3b,
+    0xfe3c, 0xfe3d, 0xfe3e, 0xfe3f, 0xfe40, 0xfe41,
+    0xfe42, 0xfe43, 0xfe44, 0xfe47, 0xfe48, 0xfe49,
+    0xfe4a, 0xfe4b, 0xfe4c, 0xfe4d, 0xfe4e, 0xfe4f,
+    0xfe50, 0xfe51, 0xfe52, 0xfe54, 0xfe55, 0xfe56,
+    0xfe57, 0xfe58, 0xfe59, 0xfe5a, 0xfe5b, 0xfe5c,
+    0xfe5d, 0xfe5e, 0xfe5f, 0xfe60, 0xfe61, 0xfe62,
+    0xfe63, 0xfe64, 0xfe65, 0xfe66, 0xfe68, 0xfe69,
+    0xfe6a, 0xfe6b, 0xfe70, 0xfe71, 0xfe72, 0xfe74,
+    0xfe76, 0xfe77, 0xfe78, 0xfe79, 0xfe7a, 0xfe7b,
+    0xfe7c, 0xfe7d, 0xfe7e, 0xfe7f, 0xfe80, 0xfe81,
+    0xfe82, 0xfe83, 0xfe84, 0xfe85, 0xfe86, 0xfe87,
+    0xfe88, 0xfe89, 0xfe8a, 0xfe8b, 0xfe8c, 0xfe8d,
+    0xfe8e, 0xfe8f, 0xfe90, 0xfe91, 0xfe92, 0xfe93,
+    0xfe94, 0xfe95, 0xfe96, 0xfe97, 0xfe98, 0xfe99,
+    0xfe9a, 0xfe9b, 0xfe9c, 0xfe9d, 0xfe9e, 0xfe9f,
+    0xfea0, 0xfea1, 0xfea2, 0xfea3, 0xfea4, 0xfea5,
+    0xfea6, 0xfea7, 0xfea8, 0xfea9, 0xfeaa, 0xfeab,
+    0xfeac, 0xfead, 0xfeae, 0xfeaf, 0xfeb0, 0xfeb1,
+    0xfeb2, 0xfeb3, 0xfeb4, 0xfeb5, 0xfeb6, 0xfeb7,
+    0xfeb8, 0xfeb9, 0xfeba, 0xfebb, 0xfebc, 0xfebd,
+    0xfebe, 0xfebf, 0xfec0, 0xfec1, 0xfec2, 0xfec3,
+    0xfec4, 0xfec5, 0xfec6, 0xfec7, 0xfec8, 0xfec9,
+    0xfeca, 0xfecb, 0xfecc, 0xfecd, 0xfece, 0xfecf,
+    0xfed0, 0xfed1, 0xfed2, 0xfed3, 0xfed4, 0xfed5,
+    0xfed6, 0xfed7, 0xfed8, 0xfed9, 0xfeda, 0xfedb,
+    0xfedc, 0xfedd, 0xfede, 0xfedf, 0xfee0, 0xfee1,
+    0xfee2, 0xfee3, 0xfee4, 0xfee5, 0xfee6, 0xfee7,
+    0xfee8, 0xfee9, 0xfeea, 0xfeeb, 0xfeec, 0xfeed,
+    0xfeee, 0xfeef, 0xfef0, 0xfef1, 0xfef2, 0xfef3,
+    0xfef4, 0xfef5, 0xfef6, 0xfef7, 0xfef8, 0xfef9,
+    0xfefa, 0xfefb, 0xfefc, 0xff01, 0xff02, 0xff03,
+    0xff04, 0xff05, 0xff06, 0xff07, 0xff08, 0xff09,
+    0xff0a, 0xff0b, 0xff0c, 0xff0d, 0xff0e, 0xff0f,
+    0xff10, 0xff11, 0xff12, 0xff13, 0xff14, 0xff15,
+    0xff16, 0xff17, 0xff18, 0xff19, 0xff1a, 0xff1b,
+    0xff1c, 0xff1d, 0xff1e, 0xff1f, 0xff20, 0xff21,
+    0xff22, 0xff23, 0xff24, 0xff25, 0xff26, 0xff27,
+    0xff28, 0xff29, 0xff2a, 0xff2b, 0xff2c, 0xff2d,
+    0xff2e, 0xff2f, 0xff30, 0xff31, 0xff32, 0xff33,
+    0xff34, 0xff35, 0xff36, 0xff37, 0xff38, 0xff39,
+    0xff3a, 0xff3b, 0xff3c, 0xff3d, 0xff3e, 0xff3f,
+    0xff40, 0xff41, 0xff42, 0xff43, 0xff44, 0xff45,
+    0xff46, 0xff47, 0xff48, 0xff49, 0xff4a, 0xff4b,
+    0xff4c, 0xff4d, 0xff4e, 0xff4f, 0xff50, 0xff51,
+    0xff52, 0xff53, 0xff54, 0xff55, 0xff56, 0xff57,
+    0xff58, 0xff59, 0xff5a, 0xff5b, 0xff5c, 0xff5d,
+    0xff5e, 0xff5f, 0xff60, 0xff61, 0xff62, 0xff63,
+    0xff64, 0xff65, 0xff66, 0xff67, 0xff68, 0xff69,
+    0xff6a, 0xff6b, 0xff6c, 0xff6d, 0xff6e, 0xff6f,
+    0xff70, 0xff71, 0xff72, 0xff73, 0xff74, 0xff75,
+    0xff76, 0xff77, 0xff78, 0xff79, 0xff7a, 0xff7b,
+    0xff7c, 0xff7d, 0xff7e, 0xff7f, 0xff80, 0xff81,
+    0xff82, 0xff83, 0xff84, 0xff85, 0xff86, 0xff87,
+    0xff88, 0xff89, 0xff8a, 0xff8b, 0xff8c, 0xff8d,
+    0xff8e, 0xff8f, 0xff90, 0xff91, 0xff92, 0xff93,
+    0xff94, 0xff95, 0xff96, 0xff97, 0xff98, 0xff99,
+    0xff9a, 0xff9b, 0xff9c, 0xff9d, 0xff9e, 0xff9f,
+    0xffa0, 0xffa1, 0xffa2, 0xffa3, 0xffa4, 0xffa5,
+    0xffa6, 0xffa7, 0xffa8, 0xffa9, 0xffaa, 0xffab,
+    0xffac, 0xffad, 0xffae, 0xffaf, 0xffb0, 0xffb1,
+    0xffb2, 0xffb3, 0xffb4, 0xffb5, 0xffb6, 0xffb7,
+    0xffb8, 0xffb9, 0xffba, 0xffbb, 0xffbc, 0xffbd,
+    0xffbe, 0xffc2, 0xffc3, 0xffc4, 0xffc5, 0xffc6,
+    0xffc7, 0xffca, 0xffcb, 0xffcc, 0xffcd, 0xffce,
+    0xffcf, 0xffd2, 0xffd3, 0xffd4, 0xffd5, 0xffd6,
+    0xffd7, 0xffda, 0xffdb, 0xffdc, 0xffe0, 0xffe1,
+    0xffe2, 0xffe3, 0xffe4, 0xffe5, 0xffe6, 0xffe8,
+    0xffe9, 0xffea, 0xffeb, 0xffec, 0xffed, 0xffee,
+    0x10781, 0x10782, 0x10783, 0x10784, 0x10785, 0x10787,
+    0x10788, 0x10789, 0x1078a, 0x1078b, 0x1078c, 0x1078d,
+    0x1078e, 0x1078f, 0x10790, 0x10791, 0x10792, 0x10793,
+    0x10794, 0x10795, 0x10796, 0x10797, 0x10798, 0x10799,
+    0x1079a, 0x1079b, 0x1079c, 0x1079d, 0x1079e, 0x1079f,
+    0x107a0, 0x107a1, 0x107a2, 0x107a3, 0x107a4, 0x107a5,
+    0x107a6, 0x107a7, 0x107a8, 0x107a9, 0x107aa, 0x107ab,
+    0x107ac, 0x107ad, 0x107ae, 0x107af, 0x107b0, 0x107b2,
+    0x107b3, 0x107b4, 0x107b5, 0x107b6, 0x107b7, 0x107b8,
+    0x107b9, 0x107ba, 0x1109a, 0x1109c, 0x110ab, 0x1112e,
+    0x1112f, 0x1134b, 0x1134c, 0x114bb, 0x114bc, 0x114be,
+    0x115ba, 0x115bb, 0x11938, 0x1d15e, 0x1d15f, 0x1d160,
+    0x1d161, 0x1d162, 0x1d163, 0x1d164, 0x1d1bb, 0x1d1bc,
+    0x1d1bd, 0x1d1be, 0x1d1bf, 0x1d1c0, 0x1d400, 0x1d401,
+    0x1d402, 0x1d403, 0x1d404, 0x1d405, 0x1d406, 0x1d407,
+    0x1d408, 0x1d409, 0x1d40a, 0x1d40b, 0x1d40c, 0x1d40d,
+    0x1d40e, 0x1d40f, 0x1d410, 0x1d411, 0x1d412, 0x1d413,
+    0x1d414, 0x1d415, 0x1d416, 0x1d417, 0x1d418, 0x1d419,
+    0x1d41a, 0x1d41b, 0x1d41c, 0x1d41d, 0x1d41e, 0x1d41f,
+    0x1d420, 0x1d421, 0x1d422, 0x1d423, 0x1d424, 0x1d425,
+    0x1d426, 0x1d427, 0x1d428, 0x1d429, 0x1d42a, 0x1d42b,
+    0x1d42c, 0x1d42d, 0x1d42e, 0x1d42f, 0x1d430, 0x1d431,
+    0x1d432, 0x1d433, 0x1d434, 0x1d435, 0x1d436, 0x1d437,
+    0x1d438, 0x1d439, 0x1d43a, 0x1d43b, 0x1d43c, 0x1d43d,
+    0x1d43e, 0x1d43f, 0x1d440, 0x1d441, 0x1d442, 0x1d443,
+    0x1d444, 0x1d445, 0x1d446, 0x1d447, 0x1d448, 0x1d449,
+    0x1d44a, 0x1d44b, 0x1d44c, 0x1d44d, 0x1d44e, 0x1d44f,
+    0x1d450, 0x1d451, 0x1d452, 0x1d453, 0x1d454, 0x1d456,
+    0x1d457, 0x1d458, 0x1d459, 0x1d45a, 0x1d45b, 0x1d45c,
+    0x1d45d, 0x1d45e, 0x1d45f, 0x1d460, 0x1d461, 0x1d462,
+    0x1d463, 0x1d464, 0x1d465, 0x1d466, 0x1d467, 0x1d468,
+    0x1d469, 0x1d46a, 0x1d46b, 0x1d46c, 0x1d46d, 0x1d46e,
+    0x1d46f, 0x1d470, 0x1d471, 0x1d472, 0x1d473, 0x1d474,
+    0x1d475, 0x1d476, 0x1d477, 0x1d478, 0x1d479, 0x1d47a,
+    0x1d47b, 0x1d47c, 0x1d47d, 0x1d47e, 0x1d47f, 0x1d480,
+    0x1d481, 0x1d482, 0x1d483, 0x1d484, 0x1d485, 0x1d486,
+    0x1d487, 0x1d488, 0x1d489, 0x1d48a, 0x1d48b, 0x1d48c,
+    0x1d48d, 0x1d48e, 0x1d48f, 0x1d490, 0x1d491, 0x1d492,
+    0x1d493, 0x1d494, 0x1d495, 0x1d496, 0x1d497, 0x1d498,
+    0x1d499, 0x1d49a, 0x1d49b, 0x1d49c, 0x1d49e, 0x1d49f,
+    0x1d4a2, 0x1d4a5, 0x1d4a6, 0x1d4a9, 0x1d4aa, 0x1d4ab,
+    0x1d4ac, 0x1d4ae, 0x1d4af, 0x1d4b0, 0x1d4b1, 0x1d4b2,
+    0x1d4b3, 0x1d4b4, 0x1d4b5, 0x1d4b6, 0x1d4b7, 0x1d4b8,
+    0x1d4b9, 0x1d4bb, 0x1d4bd, 0x1d4be, 0x1d4bf, 0x1d4c0,
+    0x1d4c1, 0x1d4c2, 0x1d4c3, 0x1d4c5, 0x1d4c6, 0x1d4c7,
+    0x1d4c8, 0x1d4c9, 0x1d4ca, 0x1d4cb, 0x1d4cc, 0x1d4cd,
+    0x1d4ce, 0x1d4cf, 0x1d4d0, 0x1d4d1, 0x1d4d2, 0x1d4d3,
+    0x1d4d4, 0x1d4d5, 0x1d4d6, 0x1d4d7, 0x1d4d8, 0x1d4d9,
+    0x1d4da, 0x1d4db, 0x1d4dc, 0x1d4dd, 0x1d4de, 0x1d4df,
+    0x1d4e0, 0x1d4e1, 0x1d4e2, 0x1d4e3, 0x1d4e4, 0x1d4e5,
+    0x1d4e6, 0x1d4e7, 0x1d4e8, 0x1d4e9, 0x1d4ea, 0x1d4eb,
+    0x1d4ec, 0x1d4ed, 0x1d4ee, 0x1d4ef, 0x1d4f0, 0x1d4f1,
+    0x1d4f2, 0x1d4f3, 0x1d4f4, 0x1d4f5, 0x1d4f6, 0x1d4f7,
+    0x1d4f8, 0x1d4f9, 0x1d4fa, 0x1d4fb, 0x1d4fc, 0x1d4fd,
+    0x1d4fe, 0x1d4ff, 0x1d500, 0x1d501, 0x1d502, 0x1d503,
+    0x1d504, 0x1d505, 0x1d507, 0x1d508, 0x1d509, 0x1d50a,
+    0x1d50d, 0x1d50e, 0x1d50f, 0x1d510, 0x1d511, 0x1d512,
+    0x1d513, 0x1d514, 0x1d516, 0x1d517, 0x1d518, 0x1d519,
+    0x1d51a, 0x1d51b, 0x1d51c, 0x1d51e, 0x1d51f, 0x1d520,
+    0x1d521, 0x1d522, 0x1d523, 0x1d524, 0x1d525, 0x1d526,
+    0x1d527, 0x1d528, 0x1d529, 0x1d52a, 0x1d52b, 0x1d52c,
+    0x1d52d, 0x1d52e, 0x1d52f, 0x1d530, 0x1d531, 0x1d532,
+    0x1d533, 0x1d534, 0x1d535, 0x1d536, 0x1d537, 0x1d538,
+    0x1d539, 0x1d53b, 0x1d53c, 0x1d53d, 0x1d53e, 0x1d540,
+    0x1d541, 0x1d542, 0x1d543, 0x1d544, 0x1d546, 0x1d54a,
+    0x1d54b, 0x1d54c, 0x1d54d, 0x1d54e, 0x1d54f, 0x1d550,
+    0x1d552, 0x1d553, 0x1d554, 0x1d555, 0x1d556, 0x1d557,
+    0x1d558, 0x1d559, 0x1d55a, 0x1d55b, 0x1d55c, 0x1d55d,
+    0x1d55e, 0x1d55f, 0x1d560, 0x1d561, 0x1d562, 0x1d563,
+    0x1d564, 0x1d565, 0x1d566, 0x1d567, 0x1d568, 0x1d569,
+    0x1d56a, 0x1d56b, 0x1d56c, 0x1d56d, 0x1d56e, 0x1d56f,
+    0x1d570, 0x1d571, 0x1d572, 0x1d573, 0x1d574, 0x1d575,
+    0x1d576, 0x1d577, 0x1d578, 0x1d579, 0x1d57a, 0x1d57b,
+    0x1d57c, 0x1d57d, 0x1d57e, 0x1d57f, 0x1d580, 0x1d581,
+    0x1d582, 0x1d583, 0x1d584, 0x1d585, 0x1d586, 0x1d587,
+    0x1d588, 0x1d589, 0x1d58a, 0x1d58b, 0x1d58c, 0x1d58d,
+    0x1d58e, 0x1d58f, 0x1d590, 0x1d591, 0x1d592, 0x1d593,
+    0x1d594, 0x1d595, 0x1d596, 0x1d597, 0x1d598, 0x1d599,
+    0x1d59a, 0x1d59b, 0x1d59c, 0x1d59d, 0x1d59e, 0x1d59f,
+    0x1d5a0, 0x1d5a1, 0x1d5a2, 0x1d5a3, 0x1d5a4, 0x1d5a5,
+    0x1d5a6, 0x1d5a7, 0x1d5a8, 0x1d5a9, 0x1d5aa, 0x1d5ab,
+    0x1d5ac, 0x1d5ad, 0x1d5ae, 0x1d5af, 0x1d5b0, 0x1d5b1,
+    0x1d5b2, 0x1d5b3, 0x1d5b4, 0x1d5b5, 0x1d5b6, 0x1d5b7,
+    0x1d5b8, 0x1d5b9, 0x1d5ba, 0x1d5bb, 0x1d5bc, 0x1d5bd,
+    0x1d5be, 0x1d5bf, 0x1d5c0, 0x1d5c1, 0x1d5c2, 0x1d5c3,
+    0x1d5c4, 0x1d5c5, 0x1d5c6, 0x1d5c7, 0x1d5c8, 0x1d5c9,
+    0x1d5ca, 0x1d5cb, 0x1d5cc, 0x1d5cd, 0x1d5ce, 0x1d5cf,
+    0x1d5d0, 0x1d5d1, 0x1d5d2, 0x1d5d3, 0x1d5d4, 0x1d5d5,
+    0x1d5d6, 0x1d5d7, 0x1d5d8, 0x1d5d9, 0x1d5da, 0x1d5db,
+    0x1d5dc, 0x1d5dd, 0x1d5de, 0x1d5df, 0x1d5e0, 0x1d5e1,
+    0x1d5e2, 0x1d5e3, 0x1d5e4, 0x1d5e5, 0x1d5e6, 0x1d5e7,
+    0x1d5e8, 0x1d5e9, 0x1d5ea, 0x1d5eb, 0x1d5ec, 0x1d5ed,
+    0x1d5ee, 0x1d5ef, 0x1d5f0, 0x1d5f1, 0x1d5f2, 0x1d5f3,
+    0x1d5f4, 0x1d5f5, 0x1d5f6, 0x1d5f7, 0x1d5f8, 0x1d5f9,
+    0x1d5fa, 0x1d5fb, 0x1d5fc, 0x1d5fd, 0x1d5fe, 0x1d5ff,
+    0x1d600, 0x1d601, 0x1d602, 0x1d603, 0x1d604, 0x1d605,
+    0x1d606, 0x1d607, 0x1d608, 0x1d609, 0x1d60a, 0x1d60b,
+    0x1d60c, 0x1d60d, 0x1d60e, 0x1d60f, 0x1d610, 0x1d611,
+    0x1d612, 0x1d613, 0x1d614, 0x1d615, 0x1d616, 0x1d617,
+    0x1d618, 0x1d619, 0x1d61a, 0x1d61b, 0x1d61c, 0x1d61d,
+    0x1d61e, 0x1d61f, 0x1d620, 0x1d621, 0x1d622, 0x1d623,
+    0x1d624, 0x1d625, 0x1d626, 0x1d627, 0x1d628, 0x1d629,
+    0x1d62a, 0x1d62b, 0x1d62c, 0x1d62d, 0x1d62e, 0x1d62f,
+    0x1d630, 0x1d631, 0x1d632, 0x1d633, 0x1d634, 0x1d635,
+    0x1d636, 0x1d637, 0x1d638, 0x1d639, 0x1d63a, 0x1d63b,
+    0x1d63c, 0x1d63d, 0x1d63e, 0x1d63f, 0x1d640, 0x1d641,
+    0x1d642, 0x1d643, 0x1d644, 0x1d645, 0x1d646, 0x1d647,
+    0x1d648, 0x1d649, 0x1d64a, 0x1d64b, 0x1d64c, 0x1d64d,
+    0x1d64e, 0x1d64f, 0x1d650, 0x1d651, 0x1d652, 0x1d653,
+    0x1d654, 0x1d655, 0x1d656, 0x1d657, 0x1d658, 0x1d659,
+    0x1d65a, 0x1d65b, 0x1d65c, 0x1d65d, 0x1d65e, 0x1d65f,
+    0x1d660, 0x1d661, 0x1d662, 0x1d663, 0x1d664, 0x1d665,
+    0x1d666, 0x1d667, 0x1d668, 0x1d669, 0x1d66a, 0x1d66b,
+    0x1d66c, 0x1d66d, 0x1d66e, 0x1d66f, 0x1d670, 0x1d671,
+    0x1d672, 0x1d673, 0x1d674, 0x1d675, 0x1d676, 0x1d677,
+    0x1d678, 0x1d679, 0x1d67a, 0x1d67b, 0x1d67c, 0x1d67d,
+    0x1d67e, 0x1d67f, 0x1d680, 0x1d681, 0x1d682, 0x1d683,
+    0x1d684, 0x1d685, 0x1d686, 0x1d687, 0x1d688, 0x1d689,
+    0x1d68a, 0x1d68b, 0x1d68c, 0x1d68d, 0x1d68e, 0x1d68f,
+    0x1d690, 0x1d691, 0x1d692, 0x1d693, 0x1d694, 0x1d695,
+    0x1d696, 0x1d697, 0x1d698, 0x1d699, 0x1d69a, 0x1d69b,
+    0x1d69c, 0x1d69d, 0x1d69e, 0x1d69f, 0x1d6a0, 0x1d6a1,
+    0x1d6a2, 0x1d6a3, 0x1d6a4, 0x1d6a5, 0x1d6a8, 0x1d6a9,
+    0x1d6aa, 0x1d6ab, 0x1d6ac, 0x1d6ad, 0x1d6ae, 0x1d6af,
+    0x1d6b0, 0x1d6b1, 0x1d6b2, 0x1d6b3, 0x1d6b4, 0x1d6b5,
+    0x1d6b6, 0x1d6b7, 0x1d6b8, 0x1d6b9, 0x1d6ba, 0x1d6bb,
+    0x1d6bc, 0x1d6bd, 0x1d6be, 0x1d6bf, 0x1d6c0, 0x1d6c1,
+    0x1d6c2, 0x1d6c3, 0x1d6c4, 0x1d6c5, 0x1d6c6, 0x1d6c7,
+    0x1d6c8, 0x1d6c9, 0x1d6ca, 0x1d6cb, 0x1d6cc, 0x1d6cd,
+    0x1d6ce, 0x1d6cf, 0x1d6d0, 0x1d6d1, 0x1d6d2, 0x1d6d3,
+    0x1d6d4, 0x1d6d5, 0x1d6d6, 0x1d6d7, 0x1d6d8, 0x1d6d9,
+    0x1d6da, 0x1d6db, 0x1d6dc, 0x1d6dd, 0x1d6de, 0x1d6df,
+    0x1d6e0, 0x1d6e1, 0x1d6e2, 0x1d6e3, 0x1d6e4, 0x1d6e5,
+    0x1d6e6, 0x1d6e7, 0x1d6e8, 0x1d6e9, 0x1d6ea, 0x1d6eb,
+    0x1d6ec, 0x1d6ed, 0x1d6ee, 0x1d6ef, 0x1d6f0, 0x1d6f1,
+    0x1d6f2, 0x1d6f3, 0x1d6f4, 0x1d6f5, 0x1d6f6, 0x1d6f7,
+    0x1d6f8, 0x1d6f9, 0x1d6fa, 0x1d6fb, 0x1d6fc, 0x1d6fd,
+    0x1d6fe, 0x1d6ff, 0x1d700, 0x1d701, 0x1d702, 0x1d703,
+    0x1d704, 0x1d705, 0x1d706, 0x1d707, 0x1d708, 0x1d709,
+    0x1d70a, 0x1d70b, 0x1d70c, 0x1d70d, 0x1d70e, 0x1d70f,
+    0x1d710, 0x1d711, 0x1d712, 0x1d713, 0x1d714, 0x1d715,
+    0x1d716, 0x1d717, 0x1d718, 0x1d719, 0x1d71a, 0x1d71b,
+    0x1d71c, 0x1d71d, 0x1d71e, 0x1d71f, 0x1d720, 0x1d721,
+    0x1d722, 0x1d723, 0x1d724, 0x1d725, 0x1d726, 0x1d727,
+    0x1d728, 0x1d729, 0x1d72a, 0x1d72b, 0x1d72c, 0x1d72d,
+    0x1d72e, 0x1d72f, 0x1d730, 0x1d731, 0x1d732, 0x1d733,
+    0x1d734, 0x1d735, 0x1d736, 0x1d737, 0x1d738, 0x1d739,
+    0x1d73a, 0x1d73b, 0x1d73c, 0x1d73d, 0x1d73e, 0x1d73f,
+    0x1d740, 0x1d741, 0x1d742, 0x1d743, 0x1d744, 0x1d745,
+    0x1d746, 0x1d747, 0x1d748, 0x1d749, 0x1d74a, 0x1d74b,
+    0x1d74c, 0x1d74d, 0x1d74e, 0x1d74f, 0x1d750, 0x1d751,
+    0x1d752, 0x1d753, 0x1d754, 0x1d755, 0x1d756, 0x1d757,
+    0x1d758, 0x1d759, 0x1d75a, 0x1d75b, 0x1d75c, 0x1d75d,
+    0x1d75e, 0x1d75f, 0x1d760, 0x1d761, 0x1d762, 0x1d763,
+    0x1d764, 0x1d765, 0x1d766, 0x1d767, 0x1d768, 0x1d769,
+    0x1d76a, 0x1d76b, 0x1d76c, 0x1d76d, 0x1d76e, 0x1d76f,
+    0x1d770, 0x1d771, 0x1d772, 0x1d773, 0x1d774, 0x1d775,
+    0x1d776, 0x1d777, 0x1d778, 0x1d779, 0x1d77a, 0x1d77b,
+    0x1d77c, 0x1d77d, 0x1d77e, 0x1d77f, 0x1d780, 0x1d781,
+    0x1d782, 0x1d783, 0x1d784, 0x1d785, 0x1d786, 0x1d787,
+    0x1d788, 0x1d789, 0x1d78a, 0x1d78b, 0x1d78c, 0x1d78d,
+    0x1d78e, 0x1d78f, 0x1d790, 0x1d791, 0x1d792, 0x1d793,
+    0x1d794, 0x1d795, 0x1d796, 0x1d797, 0x1d798, 0x1d799,
+    0x1d79a, 0x1d79b, 0x1d79c, 0x1d79d, 0x1d79e, 0x1d79f,
+    0x1d7a0, 0x1d7a1, 0x1d7a2, 0x1d7a3, 0x1d7a4, 0x1d7a5,
+    0x1d7a6, 0x1d7a7, 0x1d7a8, 0x1d7a9, 0x1d7aa, 0x1d7ab,
+    0x1d7ac, 0x1d7ad, 0x1d7ae, 0x1d7af, 0x1d7b0, 0x1d7b1,
+    0x1d7b2, 0x1d7b3, 0x1d7b4, 0x1d7b5, 0x1d7b6, 0x1d7b7,
+    0x1d7b8, 0x1d7b9, 0x1d7ba, 0x1d7bb, 0x1d7bc, 0x1d7bd,
+    0x1d7be, 0x1d7bf, 0x1d7c0, 0x1d7c1, 0x1d7c2, 0x1d7c3,
+    0x1d7c4, 0x1d7c5, 0x1d7c6, 0x1d7c7, 0x1d7c8, 0x1d7c9,
+    0x1d7ca, 0x1d7cb, 0x1d7ce, 0x1d7cf, 0x1d7d0, 0x1d7d1,
+    0x1d7d2, 0x1d7d3, 0x1d7d4, 0x1d7d5, 0x1d7d6, 0x1d7d7,
+    0x1d7d8, 0x1d7d9, 0x1d7da, 0x1d7db, 0x1d7dc, 0x1d7dd,
+    0x1d7de, 0x1d7df, 0x1d7e0, 0x1d7e1, 0x1d7e2, 0x1d7e3,
+    0x1d7e4, 0x1d7e5, 0x1d7e6, 0x1d7e7, 0x1d7e8, 0x1d7e9,
+    0x1d7ea, 0x1d7eb, 0x1d7ec, 0x1d7ed, 0x1d7ee, 0x1d7ef,
+    0x1d7f0, 0x1d7f1, 0x1d7f2, 0x1d7f3, 0x1d7f4, 0x1d7f5,
+    0x1d7f6, 0x1d7f7, 0x1d7f8, 0x1d7f9, 0x1d7fa, 0x1d7fb,
+    0x1d7fc, 0x1d7fd, 0x1d7fe, 0x1d7ff, 0x1ee00, 0x1ee01,
+    0x1ee02, 0x1ee03, 0x1ee05, 0x1ee06, 0x1ee07, 0x1ee08,
+    0x1ee09, 0x1ee0a, 0x1ee0b, 0x1ee0c, 0x1ee0d, 0x1ee0e,
+    0x1ee0f, 0x1ee10, 0x1ee11, 0x1ee12, 0x1ee13, 0x1ee14,
+    0x1ee15, 0x1ee16, 0x1ee17, 0x1ee18, 0x1ee19, 0x1ee1a,
+    0x1ee1b, 0x1ee1c, 0x1ee1d, 0x1ee1e, 0x1ee1f, 0x1ee21,
+    0x1ee22, 0x1ee24, 0x1ee27, 0x1ee29, 0x1ee2a, 0x1ee2b,
+    0x1ee2c, 0x1ee2d, 0x1ee2e, 0x1ee2f, 0x1ee30, 0x1ee31,
+    0x1ee32, 0x1ee34, 0x1ee35, 0x1ee36, 0x1ee37, 0x1ee39,
+    0x1ee3b, 0x1ee42, 0x1ee47, 0x1ee49, 0x1ee4b, 0x1ee4d,
+    0x1ee4e, 0x1ee4f, 0x1ee51, 0x1ee52, 0x1ee54, 0x1ee57,
+    0x1ee59, 0x1ee5b, 0x1ee5d, 0x1ee5f, 0x1ee61, 0x1ee62,
+    0x1ee64, 0x1ee67, 0x1ee68, 0x1ee69, 0x1ee6a, 0x1ee6c,
+    0x1ee6d, 0x1ee6e, 0x1ee6f, 0x1ee70, 0x1ee71, 0x1ee72,
+    0x1ee74, 0x1ee75, 0x1ee76, 0x1ee77, 0x1ee79, 0x1ee7a,
+    0x1ee7b, 0x1ee7c, 0x1ee7e, 0x1ee80, 0x1ee81, 0x1ee82,
+    0x1ee83, 0x1ee84, 0x1ee85, 0x1ee86, 0x1ee87, 0x1ee88,
+    0x1ee89, 0x1ee8b, 0x1ee8c, 0x1ee8d, 0x1ee8e, 0x1ee8f,
+    0x1ee90, 0x1ee91, 0x1ee92, 0x1ee93, 0x1ee94, 0x1ee95,
+    0x1ee96, 0x1ee97, 0x1ee98, 0x1ee99, 0x1ee9a, 0x1ee9b,
+    0x1eea1, 0x1eea2, 0x1eea3, 0x1eea5, 0x1eea6, 0x1eea7,
+    0x1eea8, 0x1eea9, 0x1eeab, 0x1eeac, 0x1eead, 0x1eeae,
+    0x1eeaf, 0x1eeb0, 0x1eeb1, 0x1eeb2, 0x1eeb3, 0x1eeb4,
+    0x1eeb5, 0x1eeb6, 0x1eeb7, 0x1eeb8, 0x1eeb9, 0x1eeba,
+    0x1eebb, 0x1f100, 0x1f101, 0x1f102, 0x1f103, 0x1f104,
+    0x1f105, 0x1f106, 0x1f107, 0x1f108, 0x1f109, 0x1f10a,
+    0x1f110, 0x1f111, 0x1f112, 0x1f113, 0x1f114, 0x1f115,
+    0x1f116, 0x1f117, 0x1f118, 0x1f119, 0x1f11a, 0x1f11b,
+    0x1f11c, 0x1f11d, 0x1f11e, 0x1f11f, 0x1f120, 0x1f121,
+    0x1f122, 0x1f123, 0x1f124, 0x1f125, 0x1f126, 0x1f127,
+    0x1f128, 0x1f129, 0x1f12a, 0x1f12b, 0x1f12c, 0x1f12d,
+    0x1f12e, 0x1f130, 0x1f131, 0x1f132, 0x1f133, 0x1f134,
+    0x1f135, 0x1f136, 0x1f137, 0x1f138, 0x1f139, 0x1f13a,
+    0x1f13b, 0x1f13c, 0x1f13d, 0x1f13e, 0x1f13f, 0x1f140,
+    0x1f141, 0x1f142, 0x1f143, 0x1f144, 0x1f145, 0x1f146,
+    0x1f147, 0x1f148, 0x1f149, 0x1f14a, 0x1f14b, 0x1f14c,
+    0x1f14d, 0x1f14e, 0x1f14f, 0x1f16a, 0x1f16b, 0x1f16c,
+    0x1f190, 0x1f200, 0x1f201, 0x1f202, 0x1f210, 0x1f211,
+    0x1f212, 0x1f213, 0x1f214, 0x1f215, 0x1f216, 0x1f217,
+    0x1f218, 0x1f219, 0x1f21a, 0x1f21b, 0x1f21c, 0x1f21d,
+    0x1f21e, 0x1f21f, 0x1f220, 0x1f221, 0x1f222, 0x1f223,
+    0x1f224, 0x1f225, 0x1f226, 0x1f227, 0x1f228, 0x1f229,
+    0x1f22a, 0x1f22b, 0x1f22c, 0x1f22d, 0x1f22e, 0x1f22f,
+    0x1f230, 0x1f231, 0x1f232, 0x1f233, 0x1f234, 0x1f235,
+    0x1f236, 0x1f237, 0x1f238, 0x1f239, 0x1f23a, 0x1f23b,
+    0x1f240, 0x1f241, 0x1f242, 0x1f243, 0x1f244, 0x1f245,
+    0x1f246, 0x1f247, 0x1f248, 0x1f250, 0x1f251, 0x1fbf0,
+    0x1fbf1, 0x1fbf2, 0x1fbf3, 0x1fbf4, 0x1fbf5, 0x1fbf6,
+    0x1fbf7, 0x1fbf8, 0x1fbf9, 0x2f800, 0x2f801, 0x2f802,
+    0x2f803, 0x2f804, 0x2f805, 0x2f806, 0x2f807, 0x2f808,
+    0x2f809, 0x2f80a, 0x2f80b, 0x2f80c, 0x2f80d, 0x2f80e,
+    0x2f80f, 0x2f810, 0x2f811, 0x2f812, 0x2f813, 0x2f814,
+    0x2f815, 0x2f816, 0x2f817, 0x2f818, 0x2f819, 0x2f81a,
+    0x2f81b, 0x2f81c, 0x2f81d, 0x2f81e, 0x2f81f, 0x2f820,
+    0x2f821, 0x2f822, 0x2f823, 0x2f824, 0x2f825, 0x2f826,
+    0x2f827, 0x2f828, 0x2f829, 0x2f82a, 0x2f82b, 0x2f82c,
+    0x2f82d, 0x2f82e, 0x2f82f, 0x2f830, 0x2f831, 0x2f832,
+    0x2f833, 0x2f834, 0x2f835, 0x2f836, 0x2f837, 0x2f838,
+    0x2f839, 0x2f83a, 0x2f83b, 0x2f83c, 0x2f83d, 0x2f83e,
+    0x2f83f, 0x2f840, 0x2f841, 0x2f842, 0x2f843, 0x2f844,
+    0x2f845, 0x2f846, 0x2f847, 0x2f848, 0x2f849, 0x2f84a,
+    0x2f84b, 0x2f84c, 0x2f84d, 0x2f84e, 0x2f84f, 0x2f850,
+    0x2f851, 0x2f852, 0x2f853, 0x2f854, 0x2f855, 0x2f856,
+    0x2f857, 0x2f858, 0x2f859, 0x2f85a, 0x2f85b, 0x2f85c,
+    0x2f85d, 0x2f85e, 0x2f85f, 0x2f860, 0x2f861, 0x2f862,
+    0x2f863, 0x2f864, 0x2f865, 0x2f866, 0x2f867, 0x2f868,
+    0x2f869, 0x2f86a, 0x2f86b, 0x2f86c, 0x2f86d, 0x2f86e,
+    0x2f86f, 0x2f870, 0x2f871, 0x2f872, 0x2f873, 0x2f874,
+    0x2f875, 0x2f876, 0x2f877, 0x2f878, 0x2f879, 0x2f87a,
+    0x2f87b, 0x2f87c, 0x2f87d, 0x2f87e, 0x2f87f, 0x2f880,
+    0x2f881, 0x2f882, 0x2f883, 0x2f884, 0x2f885, 0x2f886,
+    0x2f887, 0x2f888, 0x2f889, 0x2f88a, 0x2f88b, 0x2f88c,
+    0x2f88d, 0x2f88e, 0x2f88f, 0x2f890, 0x2f891, 0x2f892,
+    0x2f893, 0x2f894, 0x2f895, 0x2f896, 0x2f897, 0x2f898,
+    0x2f899, 0x2f89a, 0x2f89b, 0x2f89c, 0x2f89d, 0x2f89e,
+    0x2f89f, 0x2f8a0, 0x2f8a1, 0x2f8a2, 0x2f8a3, 0x2f8a4,
+    0x2f8a5, 0x2f8a6, 0x2f8a7, 0x2f8a8, 0x2f8a9, 0x2f8aa,
+    0x2f8ab, 0x2f8ac, 0x2f8ad, 0x2f8ae, 0x2f8af, 0x2f8b0,
+    0x2f8b1, 0x2f8b2, 0x2f8b3, 0x2f8b4, 0x2f8b5, 0x2f8b6,
+    0x2f8b7, 0x2f8b8, 0x2f8b9, 0x2f8ba, 0x2f8bb, 0x2f8bc,
+    0x2f8bd, 0x2f8be, 0x2f8bf, 0x2f8c0, 0x2f8c1, 0x2f8c2,
+    0x2f8c3, 0x2f8c4, 0x2f8c5, 0x2f8c6, 0x2f8c7, 0x2f8c8,
+    0x2f8c9, 0x2f8ca, 0x2f8cb, 0x2f8cc, 0x2f8cd, 0x2f8ce,
+    0x2f8cf, 0x2f8d0, 0x2f8d1, 0x2f8d2, 0x2f8d3, 0x2f8d4,
+    0x2f8d5, 0x2f8d6, 0x2f8d7, 0x2f8d8, 0x2f8d9, 0x2f8da,
+    0x2f8db, 0x2f8dc, 0x2f8dd, 0x2f8de, 0x2f8df, 0x2f8e0,
+    0x2f8e1, 0x2f8e2, 0x2f8e3, 0x2f8e4, 0x2f8e5, 0x2f8e6,
+    0x2f8e7, 0x2f8e8, 0x2f8e9, 0x2f8ea, 0x2f8eb, 0x2f8ec,
+    0x2f8ed, 0x2f8ee, 0x2f8ef, 0x2f8f0, 0x2f8f1, 0x2f8f2,
+    0x2f8f3, 0x2f8f4, 0x2f8f5, 0x2f8f6, 0x2f8f7, 0x2f8f8,
+    0x2f8f9, 0x2f8fa, 0x2f8fb, 0x2f8fc, 0x2f8fd, 0x2f8fe,
+    0x2f8ff, 0x2f900, 0x2f901, 0x2f902, 0x2f903, 0x2f904,
+    0x2f905, 0x2f906, 0x2f907, 0x2f908, 0x2f909, 0x2f90a,
+    0x2f90b, 0x2f90c, 0x2f90d, 0x2f90e, 0x2f90f, 0x2f910,
+    0x2f911, 0x2f912, 0x2f913, 0x2f914, 0x2f915, 0x2f916,
+    0x2f917, 0x2f918, 0x2f919, 0x2f91a, 0x2f91b, 0x2f91c,
+    0x2f91d, 0x2f91e, 0x2f91f, 0x2f920, 0x2f921, 0x2f922,
+    0x2f923, 0x2f924, 0x2f925, 0x2f926, 0x2f927, 0x2f928,
+    0x2f929, 0x2f92a, 0x2f92b, 0x2f92c, 0x2f92d, 0x2f92e,
+    0x2f92f, 0x2f930, 0x2f931, 0x2f932, 0x2f933, 0x2f934,
+    0x2f935, 0x2f936, 0x2f937, 0x2f938, 0x2f939, 0x2f93a,
+    0x2f93b, 0x2f93c, 0x2f93d, 0x2f93e, 0x2f93f, 0x2f940,
+    0x2f941, 0x2f942, 0x2f943, 0x2f944, 0x2f945, 0x2f946,
+    0x2f947, 0x2f948, 0x2f949, 0x2f94a, 0x2f94b, 0x2f94c,
+    0x2f94d, 0x2f94e, 0x2f94f, 0x2f950, 0x2f951, 0x2f952,
+    0x2f953, 0x2f954, 0x2f955, 0x2f956, 0x2f957, 0x2f958,
+    0x2f959, 0x2f95a, 0x2f95b, 0x2f95c, 0x2f95d, 0x2f95e,
+    0x2f95f, 0x2f960, 0x2f961, 0x2f962, 0x2f963, 0x2f964,
+    0x2f965, 0x2f966, 0x2f967, 0x2f968, 0x2f969, 0x2f96a,
+    0x2f96b, 0x2f96c, 0x2f96d, 0x2f96e, 0x2f96f, 0x2f970,
+    0x2f971, 0x2f972, 0x2f973, 0x2f974, 0x2f975, 0x2f976,
+    0x2f977, 0x2f978, 0x2f979, 0x2f97a, 0x2f97b, 0x2f97c,
+    0x2f97d, 0x2f97e, 0x2f97f, 0x2f980, 0x2f981, 0x2f982,
+    0x2f983, 0x2f984, 0x2f985, 0x2f986, 0x2f987, 0x2f988,
+    0x2f989, 0x2f98a, 0x2f98b, 0x2f98c, 0x2f98d, 0x2f98e,
+    0x2f98f, 0x2f990, 0x2f991, 0x2f992, 0x2f993, 0x2f994,
+    0x2f995, 0x2f996, 0x2f997, 0x2f998, 0x2f999, 0x2f99a,
+    0x2f99b, 0x2f99c, 0x2f99d, 0x2f99e, 0x2f99f, 0x2f9a0,
+    0x2f9a1, 0x2f9a2, 0x2f9a3, 0x2f9a4, 0x2f9a5, 0x2f9a6,
+    0x2f9a7, 0x2f9a8, 0x2f9a9, 0x2f9aa, 0x2f9ab, 0x2f9ac,
+    0x2f9ad, 0x2f9ae, 0x2f9af, 0x2f9b0, 0x2f9b1, 0x2f9b2,
+    0x2f9b3, 0x2f9b4, 0x2f9b5, 0x2f9b6, 0x2f9b7, 0x2f9b8,
+    0x2f9b9, 0x2f9ba, 0x2f9bb, 0x2f9bc, 0x2f9bd, 0x2f9be,
+    0x2f9bf, 0x2f9c0, 0x2f9c1, 0x2f9c2, 0x2f9c3, 0x2f9c4,
+    0x2f9c5, 0x2f9c6, 0x2f9c7, 0x2f9c8, 0x2f9c9, 0x2f9ca,
+    0x2f9cb, 0x2f9cc, 0x2f9cd, 0x2f9ce, 0x2f9cf, 0x2f9d0,
+    0x2f9d1, 0x2f9d2, 0x2f9d3, 0x2f9d4, 0x2f9d5, 0x2f9d6,
+    0x2f9d7, 0x2f9d8, 0x2f9d9, 0x2f9da, 0x2f9db, 0x2f9dc,
+    0x2f9dd, 0x2f9de, 0x2f9df, 0x2f9e0, 0x2f9e1, 0x2f9e2,
+    0x2f9e3, 0x2f9e4, 0x2f9e5, 0x2f9e6, 0x2f9e7, 0x2f9e8,
+    0x2f9e9, 0x2f9ea, 0x2f9eb, 0x2f9ec, 0x2f9ed, 0x2f9ee,
+    0x2f9ef, 0x2f9f0, 0x2f9f1, 0x2f9f2, 0x2f9f3, 0x2f9f4,
+    0x2f9f5, 0x2f9f6, 0x2f9f7, 0x2f9f8, 0x2f9f9, 0x2f9fa,
+    0x2f9fb, 0x2f9fc, 0x2f9fd, 0x2f9fe, 0x2f9ff, 0x2fa00,
+    0x2fa01, 0x2fa02, 0x2fa03, 0x2fa04, 0x2fa05, 0x2fa06,
+    0x2fa07, 0x2fa08, 0x2fa09, 0x2fa0a, 0x2fa0b, 0x2fa0c,
+    0x2fa0d, 0x2fa0e, 0x2fa0f, 0x2fa10, 0x2fa11, 0x2fa12,
+    0x2fa13, 0x2fa14, 0x2fa15, 0x2fa16, 0x2fa17, 0x2fa18,
+    0x2fa19, 0x2fa1a, 0x2fa1b, 0x2fa1c, 0x2fa1d
+};
+
+const uint32_t norm_canon_refs[ 5795 ] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x302, 0x342, 0x382, 0x3c2,
+    0x402, 0x442, 0x482, 0x4c2, 0x502, 0x542,
+    0x582, 0x5c2, 0x602, 0x642, 0x682, 0x6c2,
+    0x702, 0x742, 0x782, 0x7c2, 0x802, 0x842,
+    0x882, 0x8c2, 0x902, 0x942, 0x982, 0x9c2,
+    0xa02, 0xa42, 0xa82, 0xac2, 0xb02, 0xb42,
+    0xb82, 0xbc2, 0xc02, 0xc42, 0xc82, 0xcc2,
+    0xd02, 0xd42, 0xd82, 0xdc2, 0xe02, 0xe42,
+    0xe82, 0xec2, 0xf02, 0xf42, 0xf82, 0xfc2,
+    0x1002, 0x1042, 0x1082, 0x10c2, 0x1102, 0x1142,
+    0x1182, 0x11c2, 0x1202, 0x1242, 0x1282, 0x12c2,
+    0x1302, 0x1342, 0x1382, 0x13c2, 0x1402, 0x1442,
+    0x1482, 0x14c2, 0x1502, 0x1542, 0x1582, 0x15c2,
+    0x1602, 0x1642, 0x1682, 0x16c2, 0x1702, 0x1742,
+    0x1782, 0x17c2, 0x1802, 0x1842, 0x1882, 0x18c2,
+    0x1902, 0x1942, 0x1982, 0x19c2, 0x1a02, 0x1a42,
+    0x1a82, 0x1ac2, 0x1b02, 0x1b42, 0x0, 0x0,
+    0x1c02, 0x1c42, 0x1c82, 0x1cc2, 0x1d02, 0x1d42,
+    0x1d82, 0x1dc2, 0x1e02, 0x1e42, 0x0, 0x0,
+    0x1f02, 0x1f42, 0x1f82, 0x1fc2, 0x2002, 0x2042,
+    0x0, 0x20c2, 0x2102, 0x2142, 0x2182, 0x21c2,
+    0x2202, 0x2242, 0x2282, 0x22c2, 0x2302, 0x2342,
+    0x2382, 0x23c2, 0x2402, 0x2442, 0x2482, 0x24c2,
+    0x2502, 0x2542, 0x2582, 0x25c2, 0x2602, 0x2642,
+    0x2682, 0x26c2, 0x2702, 0x2742, 0x2782, 0x27c2,
+    0x2802, 0x2842, 0x2882, 0x28c2, 0x2902, 0x2942,
+    0x2982, 0x29c2, 0x2a02, 0x2a42, 0x2a82, 0x2ac2,
+    0x2b02, 0x2b42, 0x2b82, 0x2bc2, 0x2c02, 0x2c42,
+    0x0, 0x2ca2, 0x2ce2, 0x2d22, 0x2d62, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x3042, 0x3082, 0x30c2, 0x3102,
+    0x3142, 0x3182, 0x31c2, 0x3202, 0x3243, 0x32a3,
+    0x3303, 0x3363, 0x33c3, 0x3423, 0x3483, 0x34e3,
+    0x3543, 0x35a3, 0x3603, 0x3663, 0x36c2, 0x3702,
+    0x3742, 0x3782, 0x37c2, 0x3802, 0x3842, 0x3882,
+    0x38c3, 0x3923, 0x3982, 0x39c2, 0x3a02, 0x0,
+    0x0, 0x0, 0x3b02, 0x3b42, 0x3b82, 0x3bc2,
+    0x3c03, 0x3c63, 0x3cc2, 0x3d02, 0x3d42, 0x3d82,
+    0x3dc2, 0x3e02, 0x3e42, 0x3e82, 0x3ec2, 0x3f02,
+    0x3f42, 0x3f82, 0x3fc2, 0x4002, 0x4042, 0x4082,
+    0x40c2, 0x4102, 0x4142, 0x4182, 0x41c2, 0x4202,
+    0x4242, 0x4282, 0x42c2, 0x4302, 0x4342, 0x4382,
+    0x43c2, 0x4402, 0x4442, 0x4482, 0x44c2, 0x4502,
+    0x4542, 0x4582, 0x45c2, 0x4602, 0x4643, 0x46a3,
+    0x4703, 0x4763, 0x47c2, 0x4802, 0x4843, 0x48a3,
+    0x4902, 0x4942, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x4cc1, 0x4ce1,
+    0x4d01, 0x4d22, 0x4d61, 0x0, 0x4dc1, 0x0,
+    0x4e22, 0x4ec2, 0x4f01, 0x4f22, 0x4f62, 0x4fa2,
+    0x4fe2, 0x5022, 0x5062, 0x50a3, 0x5102, 0x5142,
+    0x5182, 0x51c2, 0x5202, 0x5242, 0x5283, 0x52e2,
+    0x5322, 0x5362, 0x53a2, 0x53e2, 0x0, 0x0,
+    0x0, 0x5482, 0x5502, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x5682,
+    0x56c2, 0x5702, 0x5742, 0x5782, 0x57c2, 0x5802,
+    0x5842, 0x5882, 0x58c2, 0x5902, 0x5942, 0x5982,
+    0x59c2, 0x5a02, 0x5a42, 0x5a82, 0x5ac2, 0x5b02,
+    0x5b42, 0x5b82, 0x5bc2, 0x5c02, 0x5c42, 0x5c82,
+    0x5cc2, 0x5d02, 0x5d42, 0x5d82, 0x5dc2, 0x5e02,
+    0x5e42, 0x5e82, 0x5ec2, 0x5f02, 0x5f42, 0x5f82,
+    0x5fc2, 0x6002, 0x6042, 0x6082, 0x60c2, 0x6102,
+    0x6142, 0x6182, 0x61c2, 0x6202, 0x6242, 0x6282,
+    0x62c2, 0x6302, 0x6342, 0x0, 0x63c2, 0x6402,
+    0x6442, 0x6482, 0x64c2, 0x0, 0x0, 0x0,
+    0x0, 0x6602, 0x6642, 0x6682, 0x66c2, 0x6702,
+    0x6742, 0x6782, 0x67c2, 0x6802, 0x6842, 0x6882,
+    0x68c2, 0x6902, 0x6942, 0x6982, 0x69c2, 0x6a02,
+    0x6a42, 0x6a82, 0x6ac2, 0x6b02, 0x6b42, 0x6b82,
+    0x6bc2, 0x6c02, 0x6c42, 0x6c82, 0x6cc2, 0x6d02,
+    0x6d42, 0x6d82, 0x6dc2, 0x6e02, 0x6e42, 0x6e82,
+    0x6ec2, 0x6f02, 0x6f42, 0x6f82, 0x6fc3, 0x7022,
+    0x7062, 0x70a2, 0x70e2, 0x7122, 0x7163, 0x71c2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x7322,
+    0x7362, 0x73a2, 0x73e2, 0x7422, 0x7462, 0x74a2,
+    0x74e2, 0x7522, 0x0, 0x75c2, 0x0, 0x7662,
+    0x76a2, 0x76e2, 0x7722, 0x7762, 0x77a2, 0x77e2,
+    0x7822, 0x0, 0x7882, 0x78c2, 0x7902, 0x7942,
+    0x7982, 0x79c2, 0x7a02, 0x7a42, 0x7a82, 0x7ac2,
+    0x7b02, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x8782, 0x87c2, 0x8802,
+    0x8842, 0x8882, 0x88c2, 0x8902, 0x8942, 0x8983,
+    0x89e3, 0x8a42, 0x8a82, 0x8ac2, 0x8b02, 0x8b42,
+    0x8b82, 0x8bc2, 0x8c02, 0x8c42, 0x8c82, 0x8cc3,
+    0x8d23, 0x8d83, 0x8de3, 0x8e42, 0x8e82, 0x8ec2,
+    0x8f02, 0x8f43, 0x8fa3, 0x9002, 0x9042, 0x9082,
+    0x90c2, 0x9102, 0x9142, 0x9182, 0x91c2, 0x9202,
+    0x9242, 0x9282, 0x92c2, 0x9302, 0x9342, 0x9382,
+    0x93c2, 0x9403, 0x9463, 0x94c2, 0x9502, 0x9542,
+    0x9582, 0x95c2, 0x9602, 0x9642, 0x9682, 0x96c3,
+    0x9723, 0x9782, 0x97c2, 0x9802, 0x9842, 0x9882,
+    0x98c2, 0x9902, 0x9942, 0x9982, 0x99c2, 0x9a02,
+    0x9a42, 0x9a82, 0x9ac2, 0x9b02, 0x9b42, 0x9b82,
+    0x9bc2, 0x9c03, 0x9c63, 0x9cc3, 0x9d23, 0x9d83,
+    0x9de3, 0x9e43, 0x9ea3, 0x9f02, 0x9f42, 0x9f82,
+    0x9fc2, 0xa002, 0xa042, 0xa082, 0xa0c2, 0xa103,
+    0xa163, 0xa1c2, 0xa202, 0xa242, 0xa282, 0xa2c2,
+    0xa302, 0xa343, 0xa3a3, 0xa403, 0xa463, 0xa4c3,
+    0xa523, 0xa582, 0xa5c2, 0xa602, 0xa642, 0xa682,
+    0xa6c2, 0xa702, 0xa742, 0xa782, 0xa7c2, 0xa802,
+    0xa842, 0xa882, 0xa8c2, 0xa903, 0xa963, 0xa9c3,
+    0xaa23, 0xaa82, 0xaac2, 0xab02, 0xab42, 0xab82,
+    0xabc2, 0xac02, 0xac42, 0xac82, 0xacc2, 0xad02,
+    0xad42, 0xad82, 0xadc2, 0xae02, 0xae42, 0xae82,
+    0xaec2, 0xaf02, 0xaf42, 0xaf82, 0xafc2, 0xb002,
+    0xb042, 0xb082, 0xb0c2, 0xb102, 0xb142, 0xb182,
+    0xb1c2, 0x0, 0xb242, 0xb2c2, 0xb302, 0xb342,
+    0xb382, 0xb3c3, 0xb423, 0xb483, 0xb4e3, 0xb543,
+    0xb5a3, 0xb603, 0xb663, 0xb6c3, 0xb723, 0xb783,
+    0xb7e3, 0xb843, 0xb8a3, 0xb903, 0xb963, 0xb9c3,
+    0xba23, 0xba83, 0xbae3, 0xbb42, 0xbb82, 0xbbc2,
+    0xbc02, 0xbc42, 0xbc82, 0xbcc3, 0xbd23, 0xbd83,
+    0xbde3, 0xbe43, 0xbea3, 0xbf03, 0xbf63, 0xbfc3,
+    0xc023, 0xc082, 0xc0c2, 0xc102, 0xc142, 0xc182,
+    0xc1c2, 0xc202, 0xc242, 0xc283, 0xc2e3, 0xc343,
+    0xc3a3, 0xc403, 0xc463, 0xc4c3, 0xc523, 0xc583,
+    0xc5e3, 0xc643, 0xc6a3, 0xc703, 0xc763, 0xc7c3,
+    0xc823, 0xc883, 0xc8e3, 0xc943, 0xc9a3, 0xca02,
+    0xca42, 0xca82, 0xcac2, 0xcb03, 0xcb63, 0xcbc3,
+    0xcc23, 0xcc83, 0xcce3, 0xcd43, 0xcda3, 0xce03,
+    0xce63, 0xcec2, 0xcf02, 0xcf42, 0xcf82, 0xcfc2,
+    0xd002, 0xd042, 0xd082, 0xd0c2, 0xd102, 0xd143,
+    0xd1a3, 0xd203, 0xd263, 0xd2c3, 0xd323, 0xd382,
+    0xd3c2, 0xd403, 0xd463, 0xd4c3, 0xd523, 0xd583,
+    0xd5e3, 0xd642, 0xd682, 0xd6c3, 0xd723, 0xd783,
+    0xd7e3, 0xd842, 0xd882, 0xd8c3, 0xd923, 0xd983,
+    0xd9e3, 0xda42, 0xda82, 0xdac3, 0xdb23, 0xdb83,
+    0xdbe3, 0xdc43, 0xdca3, 0xdd02, 0xdd42, 0xdd83,
+    0xdde3, 0xde43, 0xdea3, 0xdf03, 0xdf63, 0xdfc2,
+    0xe002, 0xe043, 0xe0a3, 0xe103, 0xe163, 0xe1c3,
+    0xe223, 0xe282, 0xe2c2, 0xe303, 0xe363, 0xe3c3,
+    0xe423, 0xe483, 0xe4e3, 0xe542, 0xe582, 0xe5c3,
+    0xe623, 0xe683, 0xe6e3, 0xe742, 0xe782, 0xe7c3,
+    0xe823, 0xe883, 0xe8e3, 0xe942, 0xe982, 0xe9c3,
+    0xea23, 0xea83, 0xeae3, 0xeb43, 0xeba3, 0xec02,
+    0xec43, 0xeca3, 0xed03, 0xed62, 0xeda2, 0xede3,
+    0xee43, 0xeea3, 0xef03, 0xef63, 0xefc3, 0xf022,
+    0xf062, 0xf0a3, 0xf103, 0xf163, 0xf1c3, 0xf223,
+    0xf283, 0xf2e2, 0xf322, 0xf362, 0xf3a2, 0xf3e2,
+    0xf422, 0xf462, 0xf4a2, 0xf4e2, 0xf522, 0xf562,
+    0xf5a2, 0xf5e2, 0xf622, 0xf663, 0xf6c3, 0xf724,
+    0xf7a4, 0xf824, 0xf8a4, 0xf924, 0xf9a4, 0xfa23,
+    0xfa83, 0xfae4, 0xfb64, 0xfbe4, 0xfc64, 0xfce4,
+    0xfd64, 0xfde3, 0xfe43, 0xfea4, 0xff24, 0xffa4,
+    0x10024, 0x100a4, 0x10124, 0x101a3, 0x10203, 0x10264,
+    0x102e4, 0x10364, 0x103e4, 0x10464, 0x104e4, 0x10563,
+    0x105c3, 0x10624, 0x106a4, 0x10724, 0x107a4, 0x10824,
+    0x108a4, 0x10923, 0x10983, 0x109e4, 0x10a64, 0x10ae4,
+    0x10b64, 0x10be4, 0x10c64, 0x10ce2, 0x10d22, 0x10d63,
+    0x10dc2, 0x10e03, 0x10e62, 0x10ea3, 0x10f02, 0x10f42,
+    0x10f82, 0x10fc2, 0x11002, 0x0, 0x11081, 0x0,
+    0x0, 0x11122, 0x111c3, 0x11222, 0x11263, 0x112c2,
+    0x11303, 0x11362, 0x113a2, 0x113e2, 0x11422, 0x11462,
+    0x114a2, 0x11542, 0x115e2, 0x11682, 0x116c2, 0x11703,
+    0x11763, 0x117c2, 0x11803, 0x11862, 0x118a2, 0x118e2,
+    0x11922, 0x11962, 0x11a02, 0x11aa2, 0x11b42, 0x11b82,
+    0x11bc3, 0x11c23, 0x11c82, 0x11cc2, 0x11d02, 0x11d43,
+    0x11da2, 0x11de2, 0x11e22, 0x11e62, 0x11ea2, 0x11ee2,
+    0x11f82, 0x12021, 0x12043, 0x120a2, 0x120e3, 0x12142,
+    0x12183, 0x121e2, 0x12222, 0x12262, 0x122a2, 0x122e2,
+    0x12321, 0x0, 0x123c1, 0x12401, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x134c1, 0x0, 0x13501, 0x13522, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x14662, 0x146a2,
+    0x146e2, 0x14722, 0x14762, 0x147a2, 0x147e2, 0x14822,
+    0x14862, 0x148a2, 0x148e2, 0x0, 0x0, 0x0,
+    0x0, 0x14a62, 0x14aa2, 0x14ae2, 0x14b22, 0x14b62,
+    0x14ba2, 0x14be2, 0x14c22, 0x14c62, 0x14ca2, 0x14ce2,
+    0x14d22, 0x14d62, 0x14da2, 0x14de2, 0x14e22, 0x14e62,
+    0x14ea2, 0x14ee2, 0x14f22, 0x14f62, 0x14fa2, 0x14fe2,
+    0x15022, 0x15062, 0x150a2, 0x150e2, 0x15122, 0x15162,
+    0x151a2, 0x151e2, 0x15222, 0x15262, 0x152a1, 0x152c1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x177e2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x19422, 0x19462, 0x194a2, 0x194e2,
+    0x19522, 0x19562, 0x195a2, 0x195e2, 0x19622, 0x19662,
+    0x196a2, 0x196e2, 0x19722, 0x19762, 0x197a2, 0x197e2,
+    0x19822, 0x19862, 0x198a2, 0x198e2, 0x19922, 0x19962,
+    0x199a2, 0x199e2, 0x19a22, 0x19a62, 0x0, 0x0,
+    0x19b22, 0x0, 0x19ba2, 0x19be2, 0x19c22, 0x19c62,
+    0x19ca2, 0x19ce2, 0x19d22, 0x19d62, 0x19da2, 0x19de2,
+    0x19e22, 0x19e62, 0x19ea2, 0x19ee2, 0x19f22, 0x19f62,
+    0x19fa2, 0x19fe2, 0x1a022, 0x1a062, 0x1a0a2, 0x1a0e2,
+    0x1a122, 0x1a162, 0x1a1a2, 0x1a1e2, 0x1a222, 0x1a262,
+    0x1a2a2, 0x1a2e2, 0x1a322, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x24e81, 0x24ea1, 0x24ec1,
+    0x24ee1, 0x24f01, 0x24f21, 0x24f41, 0x24f61, 0x24f81,
+    0x24fa1, 0x24fc1, 0x24fe1, 0x25001, 0x25021, 0x25041,
+    0x25061, 0x25081, 0x250a1, 0x250c1, 0x250e1, 0x25101,
+    0x25121, 0x25141, 0x25161, 0x25181, 0x251a1, 0x251c1,
+    0x251e1, 0x25201, 0x25221, 0x25241, 0x25261, 0x25281,
+    0x252a1, 0x252c1, 0x252e1, 0x25301, 0x25321, 0x25341,
+    0x25361, 0x25381, 0x253a1, 0x253c1, 0x253e1, 0x25401,
+    0x25421, 0x25441, 0x25461, 0x25481, 0x254a1, 0x254c1,
+    0x254e1, 0x25501, 0x25521, 0x25541, 0x25561, 0x25581,
+    0x255a1, 0x255c1, 0x255e1, 0x25601, 0x25621, 0x25641,
+    0x25661, 0x25681, 0x256a1, 0x256c1, 0x256e1, 0x25701,
+    0x25721, 0x25741, 0x25761, 0x25781, 0x257a1, 0x257c1,
+    0x257e1, 0x25801, 0x25821, 0x25841, 0x25861, 0x25881,
+    0x258a1, 0x258c1, 0x258e1, 0x25901, 0x25921, 0x25941,
+    0x25961, 0x25981, 0x259a1, 0x259c1, 0x259e1, 0x25a01,
+    0x25a21, 0x25a41, 0x25a61, 0x25a81, 0x25aa1, 0x25ac1,
+    0x25ae1, 0x25b01, 0x25b21, 0x25b41, 0x25b61, 0x25b81,
+    0x25ba1, 0x25bc1, 0x25be1, 0x25c01, 0x25c21, 0x25c41,
+    0x25c61, 0x25c81, 0x25ca1, 0x25cc1, 0x25ce1, 0x25d01,
+    0x25d21, 0x25d41, 0x25d61, 0x25d81, 0x25da1, 0x25dc1,
+    0x25de1, 0x25e01, 0x25e21, 0x25e41, 0x25e61, 0x25e81,
+    0x25ea1, 0x25ec1, 0x25ee1, 0x25f01, 0x25f21, 0x25f41,
+    0x25f61, 0x25f81, 0x25fa1, 0x25fc1, 0x25fe1, 0x26001,
+    0x26021, 0x26041, 0x26061, 0x26081, 0x260a1, 0x260c1,
+    0x260e1, 0x26101, 0x26121, 0x26141, 0x26161, 0x26181,
+    0x261a1, 0x261c1, 0x261e1, 0x26201, 0x26221, 0x26241,
+    0x26261, 0x26281, 0x262a1, 0x262c1, 0x262e1, 0x26301,
+    0x26321, 0x26341, 0x26361, 0x26381, 0x263a1, 0x263c1,
+    0x263e1, 0x26401, 0x26421, 0x26441, 0x26461, 0x26481,
+    0x264a1, 0x264c1, 0x264e1, 0x26501, 0x26521, 0x26541,
+    0x26561, 0x26581, 0x265a1, 0x265c1, 0x265e1, 0x26601,
+    0x26621, 0x26641, 0x26661, 0x26681, 0x266a1, 0x266c1,
+    0x266e1, 0x26701, 0x26721, 0x26741, 0x26761, 0x26781,
+    0x267a1, 0x267c1, 0x267e1, 0x26801, 0x26821, 0x26841,
+    0x26861, 0x26881, 0x268a1, 0x268c1, 0x268e1, 0x26901,
+    0x26921, 0x26941, 0x26961, 0x26981, 0x269a1, 0x269c1,
+    0x269e1, 0x26a01, 0x26a21, 0x26a41, 0x26a61, 0x26a81,
+    0x26aa1, 0x26ac1, 0x26ae1, 0x26b01, 0x26b21, 0x26b41,
+    0x26b61, 0x26b81, 0x26ba1, 0x26bc1, 0x26be1, 0x26c01,
+    0x26c21, 0x26c41, 0x26c61, 0x26c81, 0x26ca1, 0x26cc1,
+    0x26ce1, 0x26d01, 0x26d21, 0x26d41, 0x26d61, 0x26d81,
+    0x26da1, 0x26dc1, 0x26de1, 0x26e01, 0x26e21, 0x26e41,
+    0x26e61, 0x26e81, 0x26ea1, 0x26ec1, 0x26ee1, 0x26f01,
+    0x26f21, 0x26f41, 0x26f61, 0x26f81, 0x26fa1, 0x26fc1,
+    0x26fe1, 0x27001, 0x27021, 0x27041, 0x27061, 0x27081,
+    0x270a1, 0x270c1, 0x270e1, 0x27101, 0x27121, 0x27141,
+    0x27161, 0x27181, 0x271a1, 0x271c1, 0x271e1, 0x27201,
+    0x27221, 0x27241, 0x27261, 0x27281, 0x272a1, 0x272c1,
+    0x272e1, 0x27301, 0x27321, 0x27341, 0x27361, 0x27381,
+    0x273a1, 0x273c1, 0x273e1, 0x27401, 0x27421, 0x27441,
+    0x27461, 0x27481, 0x274a1, 0x274c1, 0x274e1, 0x27501,
+    0x27521, 0x27541, 0x27561, 0x27581, 0x275a1, 0x275c1,
+    0x275e1, 0x27601, 0x27621, 0x27641, 0x27661, 0x27681,
+    0x276a1, 0x276c1, 0x276e1, 0x27701, 0x27721, 0x27741,
+    0x27761, 0x27781, 0x277a1, 0x277c1, 0x277e1, 0x27801,
+    0x27821, 0x27841, 0x27861, 0x27881, 0x278a1, 0x278c1,
+    0x278e1, 0x27901, 0x27921, 0x27941, 0x27961, 0x27981,
+    0x279a1, 0x279c1, 0x279e1, 0x27a01, 0x27a21, 0x27a41,
+    0x27a61, 0x27a81, 0x27aa1, 0x27ac1, 0x27ae1, 0x27b01,
+    0x27b21, 0x27b41, 0x27b61, 0x27b81, 0x27ba1, 0x27bc1,
+    0x27be1, 0x27c01, 0x27c21, 0x27c41, 0x27c61, 0x27c81,
+    0x27ca1, 0x27cc1, 0x27ce1, 0x27d01, 0x27d21, 0x27d41,
+    0x27d61, 0x27d81, 0x27da1, 0x27dc1, 0x27de1, 0x27e01,
+    0x27e21, 0x27e41, 0x27e61, 0x27e81, 0x27ea1, 0x27ec1,
+    0x27ee1, 0x27f01, 0x27f21, 0x27f41, 0x27f61, 0x27f81,
+    0x27fa1, 0x27fc1, 0x27fe1, 0x28001, 0x28021, 0x28041,
+    0x28061, 0x28081, 0x280a1, 0x280c1, 0x280e1, 0x28101,
+    0x28121, 0x28141, 0x28161, 0x28181, 0x281a1, 0x281c1,
+    0x281e1, 0x28201, 0x28221, 0x28241, 0x28261, 0x28281,
+    0x282a1, 0x282c1, 0x282e1, 0x28301, 0x28321, 0x28341,
+    0x28361, 0x28381, 0x283a1, 0x283c1, 0x283e1, 0x28401,
+    0x28421, 0x28441, 0x28461, 0x28481, 0x284a1, 0x284c1,
+    0x284e1, 0x28501, 0x28521, 0x28541, 0x28561, 0x28581,
+    0x285a1, 0x285c1, 0x285e1, 0x28601, 0x28621, 0x28641,
+    0x28661, 0x28681, 0x286a1, 0x286c1, 0x286e1, 0x28701,
+    0x28721, 0x28741, 0x28761, 0x28781, 0x287a1, 0x287c1,
+    0x287e1, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x28b42, 0x28b82, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x28d02, 0x28d42, 0x28d83, 0x28de3, 0x28e42,
+    0x28e82, 0x28ec2, 0x28f02, 0x28f42, 0x28f82, 0x28fc2,
+    0x29002, 0x29042, 0x29082, 0x290c2, 0x29102, 0x29142,
+    0x29182, 0x291c2, 0x29202, 0x29242, 0x29282, 0x292c2,
+    0x29302, 0x29342, 0x29382, 0x293c2, 0x29402, 0x29442,
+    0x29482, 0x294c2, 0x29502, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x376c2, 0x37702, 0x37742, 0x37782,
+    0x377c2, 0x37802, 0x37842, 0x37882, 0x378c2, 0x37902,
+    0x37942, 0x37982, 0x379c2, 0x37a02, 0x37a42, 0x37a83,
+    0x37ae3, 0x37b43, 0x37ba3, 0x37c03, 0x37c62, 0x37ca2,
+    0x37ce3, 0x37d43, 0x37da3, 0x37e03, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x42b21, 0x42b41, 0x42b61,
+    0x42b81, 0x42ba1, 0x42bc1, 0x42be1, 0x42c01, 0x42c21,
+    0x42c41, 0x42c61, 0x42c81, 0x42ca1, 0x42cc1, 0x42ce1,
+    0x42d01, 0x42d21, 0x42d41, 0x42d61, 0x42d81, 0x42da1,
+    0x42dc1, 0x42de1, 0x42e01, 0x42e21, 0x42e41, 0x42e61,
+    0x42e81, 0x42ea1, 0x42ec1, 0x42ee1, 0x42f01, 0x42f21,
+    0x42f41, 0x42f61, 0x42f81, 0x42fa1, 0x42fc1, 0x42fe1,
+    0x43001, 0x43021, 0x43041, 0x43061, 0x43081, 0x430a1,
+    0x430c1, 0x430e1, 0x43101, 0x43121, 0x43141, 0x43161,
+    0x43181, 0x431a1, 0x431c1, 0x431e1, 0x43201, 0x43221,
+    0x43241, 0x43261, 0x43281, 0x432a1, 0x432c1, 0x432e1,
+    0x43301, 0x43321, 0x43341, 0x43361, 0x43381, 0x433a1,
+    0x433c1, 0x433e1, 0x43401, 0x43421, 0x43441, 0x43461,
+    0x43481, 0x434a1, 0x434c1, 0x434e1, 0x43501, 0x43521,
+    0x43541, 0x43561, 0x43581, 0x435a1, 0x435c1, 0x435e1,
+    0x43601, 0x43621, 0x43641, 0x43661, 0x43681, 0x436a1,
+    0x436c1, 0x436e1, 0x43701, 0x43721, 0x43741, 0x43761,
+    0x43781, 0x437a1, 0x437c1, 0x437e1, 0x43801, 0x43821,
+    0x43841, 0x43861, 0x43881, 0x438a1, 0x438c1, 0x438e1,
+    0x43901, 0x43921, 0x43941, 0x43961, 0x43981, 0x439a1,
+    0x439c1, 0x439e1, 0x43a01, 0x43a21, 0x43a41, 0x43a61,
+    0x43a81, 0x43aa1, 0x43ac1, 0x43ae1, 0x43b01, 0x43b21,
+    0x43b41, 0x43b61, 0x43b81, 0x43ba1, 0x43bc1, 0x43be1,
+    0x43c01, 0x43c21, 0x43c41, 0x43c61, 0x43c81, 0x43ca1,
+    0x43cc1, 0x43ce1, 0x43d01, 0x43d21, 0x43d41, 0x43d61,
+    0x43d81, 0x43da1, 0x43dc1, 0x43de1, 0x43e01, 0x43e21,
+    0x43e41, 0x43e61, 0x43e81, 0x43ea1, 0x43ec1, 0x43ee1,
+    0x43f01, 0x43f21, 0x43f41, 0x43f61, 0x43f81, 0x43fa1,
+    0x43fc1, 0x43fe1, 0x44001, 0x44021, 0x44041, 0x44061,
+    0x44081, 0x440a1, 0x440c1, 0x440e1, 0x44101, 0x44121,
+    0x44141, 0x44161, 0x44181, 0x441a1, 0x441c1, 0x441e1,
+    0x44201, 0x44221, 0x44241, 0x44261, 0x44281, 0x442a1,
+    0x442c1, 0x442e1, 0x44301, 0x44321, 0x44341, 0x44361,
+    0x44381, 0x443a1, 0x443c1, 0x443e1, 0x44401, 0x44421,
+    0x44441, 0x44461, 0x44481, 0x444a1, 0x444c1, 0x444e1,
+    0x44501, 0x44521, 0x44541, 0x44561, 0x44581, 0x445a1,
+    0x445c1, 0x445e1, 0x44601, 0x44621, 0x44641, 0x44661,
+    0x44681, 0x446a1, 0x446c1, 0x446e1, 0x44701, 0x44721,
+    0x44741, 0x44761, 0x44781, 0x447a1, 0x447c1, 0x447e1,
+    0x44801, 0x44821, 0x44841, 0x44861, 0x44881, 0x448a1,
+    0x448c1, 0x448e1, 0x44901, 0x44921, 0x44941, 0x44961,
+    0x44981, 0x449a1, 0x449c1, 0x449e1, 0x44a01, 0x44a21,
+    0x44a41, 0x44a61, 0x44a81, 0x44aa1, 0x44ac1, 0x44ae1,
+    0x44b01, 0x44b21, 0x44b41, 0x44b61, 0x44b81, 0x44ba1,
+    0x44bc1, 0x44be1, 0x44c01, 0x44c21, 0x44c41, 0x44c61,
+    0x44c81, 0x44ca1, 0x44cc1, 0x44ce1, 0x44d01, 0x44d21,
+    0x44d41, 0x44d61, 0x44d81, 0x44da1, 0x44dc1, 0x44de1,
+    0x44e01, 0x44e21, 0x44e41, 0x44e61, 0x44e81, 0x44ea1,
+    0x44ec1, 0x44ee1, 0x44f01, 0x44f21, 0x44f41, 0x44f61,
+    0x44f81, 0x44fa1, 0x44fc1, 0x44fe1, 0x45001, 0x45021,
+    0x45041, 0x45061, 0x45081, 0x450a1, 0x450c1, 0x450e1,
+    0x45101, 0x45121, 0x45141, 0x45161, 0x45181, 0x451a1,
+    0x451c1, 0x451e1, 0x45201, 0x45221, 0x45241, 0x45261,
+    0x45281, 0x452a1, 0x452c1, 0x452e1, 0x45301, 0x45321,
+    0x45341, 0x45361, 0x45381, 0x453a1, 0x453c1, 0x453e1,
+    0x45401, 0x45421, 0x45441, 0x45461, 0x45481, 0x454a1,
+    0x454c1, 0x454e1, 0x45501, 0x45521, 0x45541, 0x45561,
+    0x45581, 0x455a1, 0x455c1, 0x455e1, 0x45601, 0x45621,
+    0x45641, 0x45661, 0x45681, 0x456a1, 0x456c1, 0x456e1,
+    0x45701, 0x45721, 0x45741, 0x45761, 0x45781, 0x457a1,
+    0x457c1, 0x457e1, 0x45801, 0x45821, 0x45841, 0x45861,
+    0x45881, 0x458a1, 0x458c1, 0x458e1, 0x45901, 0x45921,
+    0x45941, 0x45961, 0x45981, 0x459a1, 0x459c1, 0x459e1,
+    0x45a01, 0x45a21, 0x45a41, 0x45a61, 0x45a81, 0x45aa1,
+    0x45ac1, 0x45ae1, 0x45b01, 0x45b21, 0x45b41, 0x45b61,
+    0x45b81, 0x45ba1, 0x45bc1, 0x45be1, 0x45c01, 0x45c21,
+    0x45c41, 0x45c61, 0x45c81, 0x45ca1, 0x45cc1, 0x45ce1,
+    0x45d01, 0x45d21, 0x45d41, 0x45d61, 0x45d81, 0x45da1,
+    0x45dc1, 0x45de1, 0x45e01, 0x45e21, 0x45e41, 0x45e61,
+    0x45e81, 0x45ea1, 0x45ec1, 0x45ee1, 0x45f01, 0x45f21,
+    0x45f41, 0x45f61, 0x45f81, 0x45fa1, 0x45fc1, 0x45fe1,
+    0x46001, 0x46021, 0x46041, 0x46061, 0x46081, 0x460a1,
+    0x460c1, 0x460e1, 0x46101, 0x46121, 0x46141, 0x46161,
+    0x46181, 0x461a1, 0x461c1, 0x461e1, 0x46201, 0x46221,
+    0x46241, 0x46261, 0x46281, 0x462a1, 0x462c1, 0x462e1,
+    0x46301, 0x46321, 0x46341, 0x46361, 0x46381, 0x463a1,
+    0x463c1, 0x463e1, 0x46401, 0x46421, 0x46441, 0x46461,
+    0x46481, 0x464a1, 0x464c1, 0x464e1, 0x46501, 0x46521,
+    0x46541, 0x46561, 0x46581, 0x465a1, 0x465c1, 0x465e1,
+    0x46601, 0x46621, 0x46641, 0x46661, 0x46681, 0x466a1,
+    0x466c1, 0x466e1, 0x46701, 0x46721, 0x46741, 0x46761,
+    0x46781, 0x467a1, 0x467c1, 0x467e1, 0x46801, 0x46821,
+    0x46841, 0x46861, 0x46881, 0x468a1, 0x468c1, 0x468e1,
+    0x46901, 0x46921, 0x46941, 0x46961, 0x46981, 0x469a1,
+    0x469c1, 0x469e1, 0x46a01, 0x46a21, 0x46a41, 0x46a61,
+    0x46a81, 0x46aa1, 0x46ac1, 0x46ae1, 0x46b01, 0x46b21,
+    0x46b41, 0x46b61, 0x46b81, 0x46ba1, 0x46bc1, 0x46be1,
+    0x46c01, 0x46c21, 0x46c41, 0x46c61, 0x46c81, 0x46ca1,
+    0x46cc1, 0x46ce1, 0x46d01, 0x46d21, 0x46d41, 0x46d61,
+    0x46d81, 0x46da1, 0x46dc1, 0x46de1, 0x46e01, 0x46e21,
+    0x46e41, 0x46e61, 0x46e81, 0x46ea1, 0x46ec1
+};
+
+const uint32_t norm_compat_refs[ 5795 ] = {
+    0x1, 0x22, 0x61, 0x82, 0xc1, 0xe1,
+    0x102, 0x141, 0x162, 0x1a1, 0x1c1, 0x1e3,
+    0x243, 0x2a3, 0x302, 0x342, 0x382, 0x3c2,
+    0x402, 0x442, 0x482, 0x4c2, 0x502, 0x542,
+    0x582, 0x5c2, 0x602, 0x642, 0x682, 0x6c2,
+    0x702, 0x742, 0x782, 0x7c2, 0x802, 0x842,
+    0x882, 0x8c2, 0x902, 0x942, 0x982, 0x9c2,
+    0xa02, 0xa42, 0xa82, 0xac2, 0xb02, 0xb42,
+    0xb82, 0xbc2, 0xc02, 0xc42, 0xc82, 0xcc2,
+    0xd02, 0xd42, 0xd82, 0xdc2, 0xe02, 0xe42,
+    0xe82, 0xec2, 0xf02, 0xf42, 0xf82, 0xfc2,
+    0x1002, 0x1042, 0x1082, 0x10c2, 0x1102, 0x1142,
+    0x1182, 0x11c2, 0x1202, 0x1242, 0x1282, 0x12c2,
+    0x1302, 0x1342, 0x1382, 0x13c2, 0x1402, 0x1442,
+    0x1482, 0x14c2, 0x1502, 0x1542, 0x1582, 0x15c2,
+    0x1602, 0x1642, 0x1682, 0x16c2, 0x1702, 0x1742,
+    0x1782, 0x17c2, 0x1802, 0x1842, 0x1882, 0x18c2,
+    0x1902, 0x1942, 0x1982, 0x19c2, 0x1a02, 0x1a42,
+    0x1a82, 0x1ac2, 0x1b02, 0x1b42, 0x1b82, 0x1bc2,
+    0x1c02, 0x1c42, 0x1c82, 0x1cc2, 0x1d02, 0x1d42,
+    0x1d82, 0x1dc2, 0x1e02, 0x1e42, 0x1e82, 0x1ec2,
+    0x1f02, 0x1f42, 0x1f82, 0x1fc2, 0x2002, 0x2042,
+    0x2082, 0x20c2, 0x2102, 0x2142, 0x2182, 0x21c2,
+    0x2202, 0x2242, 0x2282, 0x22c2, 0x2302, 0x2342,
+    0x2382, 0x23c2, 0x2402, 0x2442, 0x2482, 0x24c2,
+    0x2502, 0x2542, 0x2582, 0x25c2, 0x2602, 0x2642,
+    0x2682, 0x26c2, 0x2702, 0x2742, 0x2782, 0x27c2,
+    0x2802, 0x2842, 0x2882, 0x28c2, 0x2902, 0x2942,
+    0x2982, 0x29c2, 0x2a02, 0x2a42, 0x2a82, 0x2ac2,
+    0x2b02, 0x2b42, 0x2b82, 0x2bc2, 0x2c02, 0x2c42,
+    0x2c81, 0x2ca2, 0x2ce2, 0x2d22, 0x2d62, 0x2da3,
+    0x2e03, 0x2e63, 0x2ec2, 0x2f02, 0x2f42, 0x2f82,
+    0x2fc2, 0x3002, 0x3042, 0x3082, 0x30c2, 0x3102,
+    0x3142, 0x3182, 0x31c2, 0x3202, 0x3243, 0x32a3,
+    0x3303, 0x3363, 0x33c3, 0x3423, 0x3483, 0x34e3,
+    0x3543, 0x35a3, 0x3603, 0x3663, 0x36c2, 0x3702,
+    0x3742, 0x3782, 0x37c2, 0x3802, 0x3842, 0x3882,
+    0x38c3, 0x3923, 0x3982, 0x39c2, 0x3a02, 0x3a42,
+    0x3a82, 0x3ac2, 0x3b02, 0x3b42, 0x3b82, 0x3bc2,
+    0x3c03, 0x3c63, 0x3cc2, 0x3d02, 0x3d42, 0x3d82,
+    0x3dc2, 0x3e02, 0x3e42, 0x3e82, 0x3ec2, 0x3f02,
+    0x3f42, 0x3f82, 0x3fc2, 0x4002, 0x4042, 0x4082,
+    0x40c2, 0x4102, 0x4142, 0x4182, 0x41c2, 0x4202,
+    0x4242, 0x4282, 0x42c2, 0x4302, 0x4342, 0x4382,
+    0x43c2, 0x4402, 0x4442, 0x4482, 0x44c2, 0x4502,
+    0x4542, 0x4582, 0x45c2, 0x4602, 0x4643, 0x46a3,
+    0x4703, 0x4763, 0x47c2, 0x4802, 0x4843, 0x48a3,
+    0x4902, 0x4942, 0x4981, 0x49a1, 0x49c1, 0x49e1,
+    0x4a01, 0x4a21, 0x4a41, 0x4a61, 0x4a81, 0x4aa2,
+    0x4ae2, 0x4b22, 0x4b62, 0x4ba2, 0x4be2, 0x4c21,
+    0x4c41, 0x4c61, 0x4c81, 0x4ca1, 0x4cc1, 0x4ce1,
+    0x4d01, 0x4d22, 0x4d61, 0x4d82, 0x4dc1, 0x4de2,
+    0x4e63, 0x4ec2, 0x4f01, 0x4f22, 0x4f62, 0x4fa2,
+    0x4fe2, 0x5022, 0x5062, 0x50a3, 0x5102, 0x5142,
+    0x5182, 0x51c2, 0x5202, 0x5242, 0x5283, 0x52e2,
+    0x5322, 0x5362, 0x53a2, 0x53e2, 0x5421, 0x5441,
+    0x5461, 0x54c2, 0x5542, 0x5581, 0x55a1, 0x55c1,
+    0x55e1, 0x5601, 0x5621, 0x5641, 0x5661, 0x5682,
+    0x56c2, 0x5702, 0x5742, 0x5782, 0x57c2, 0x5802,
+    0x5842, 0x5882, 0x58c2, 0x5902, 0x5942, 0x5982,
+    0x59c2, 0x5a02, 0x5a42, 0x5a82, 0x5ac2, 0x5b02,
+    0x5b42, 0x5b82, 0x5bc2, 0x5c02, 0x5c42, 0x5c82,
+    0x5cc2, 0x5d02, 0x5d42, 0x5d82, 0x5dc2, 0x5e02,
+    0x5e42, 0x5e82, 0x5ec2, 0x5f02, 0x5f42, 0x5f82,
+    0x5fc2, 0x6002, 0x6042, 0x6082, 0x60c2, 0x6102,
+    0x6142, 0x6182, 0x61c2, 0x6202, 0x6242, 0x6282,
+    0x62c2, 0x6302, 0x6342, 0x6382, 0x63c2, 0x6402,
+    0x6442, 0x6482, 0x64c2, 0x6502, 0x6542, 0x6582,
+    0x65c2, 0x6602, 0x6642, 0x6682, 0x66c2, 0x6702,
+    0x6742, 0x6782, 0x67c2, 0x6802, 0x6842, 0x6882,
+    0x68c2, 0x6902, 0x6942, 0x6982, 0x69c2, 0x6a02,
+    0x6a42, 0x6a82, 0x6ac2, 0x6b02, 0x6b42, 0x6b82,
+    0x6bc2, 0x6c02, 0x6c42, 0x6c82, 0x6cc2, 0x6d02,
+    0x6d42, 0x6d82, 0x6dc2, 0x6e02, 0x6e42, 0x6e82,
+    0x6ec2, 0x6f02, 0x6f42, 0x6f82, 0x6fc3, 0x7022,
+    0x7062, 0x70a2, 0x70e2, 0x7122, 0x7163, 0x71c2,
+    0x7202, 0x7242, 0x7282, 0x72c2, 0x7301, 0x7322,
+    0x7362, 0x73a2, 0x73e2, 0x7422, 0x7462, 0x74a2,
+    0x74e2, 0x7522, 0x7563, 0x75c2, 0x7603, 0x7662,
+    0x76a2, 0x76e2, 0x7722, 0x7762, 0x77a2, 0x77e2,
+    0x7822, 0x7861, 0x7882, 0x78c2, 0x7902, 0x7942,
+    0x7982, 0x79c2, 0x7a02, 0x7a42, 0x7a82, 0x7ac2,
+    0x7b02, 0x7b41, 0x7b61, 0x7b81, 0x7ba1, 0x7bc1,
+    0x7be1, 0x7c01, 0x7c21, 0x7c41, 0x7c61, 0x7c81,
+    0x7ca1, 0x7cc1, 0x7ce1, 0x7d01, 0x7d21, 0x7d41,
+    0x7d61, 0x7d81, 0x7da1, 0x7dc1, 0x7de1, 0x7e01,
+    0x7e21, 0x7e41, 0x7e61, 0x7e81, 0x7ea1, 0x7ec1,
+    0x7ee1, 0x7f01, 0x7f21, 0x7f41, 0x7f61, 0x7f81,
+    0x7fa1, 0x7fc1, 0x7fe1, 0x8001, 0x8021, 0x8041,
+    0x8061, 0x8081, 0x80a1, 0x80c1, 0x80e1, 0x8101,
+    0x8121, 0x8141, 0x8161, 0x8181, 0x81a1, 0x81c1,
+    0x81e1, 0x8201, 0x8221, 0x8241, 0x8261, 0x8281,
+    0x82a1, 0x82c1, 0x82e1, 0x8301, 0x8321, 0x8341,
+    0x8361, 0x8381, 0x83a1, 0x83c1, 0x83e1, 0x8401,
+    0x8421, 0x8441, 0x8461, 0x8481, 0x84a1, 0x84c1,
+    0x84e1, 0x8501, 0x8521, 0x8541, 0x8561, 0x8581,
+    0x85a1, 0x85c1, 0x85e1, 0x8601, 0x8621, 0x8641,
+    0x8661, 0x8681, 0x86a1, 0x86c1, 0x86e1, 0x8701,
+    0x8721, 0x8741, 0x8761, 0x8782, 0x87c2, 0x8802,
+    0x8842, 0x8882, 0x88c2, 0x8902, 0x8942, 0x8983,
+    0x89e3, 0x8a42, 0x8a82, 0x8ac2, 0x8b02, 0x8b42,
+    0x8b82, 0x8bc2, 0x8c02, 0x8c42, 0x8c82, 0x8cc3,
+    0x8d23, 0x8d83, 0x8de3, 0x8e42, 0x8e82, 0x8ec2,
+    0x8f02, 0x8f43, 0x8fa3, 0x9002, 0x9042, 0x9082,
+    0x90c2, 0x9102, 0x9142, 0x9182, 0x91c2, 0x9202,
+    0x9242, 0x9282, 0x92c2, 0x9302, 0x9342, 0x9382,
+    0x93c2, 0x9403, 0x9463, 0x94c2, 0x9502, 0x9542,
+    0x9582, 0x95c2, 0x9602, 0x9642, 0x9682, 0x96c3,
+    0x9723, 0x9782, 0x97c2, 0x9802, 0x9842, 0x9882,
+    0x98c2, 0x9902, 0x9942, 0x9982, 0x99c2, 0x9a02,
+    0x9a42, 0x9a82, 0x9ac2, 0x9b02, 0x9b42, 0x9b82,
+    0x9bc2, 0x9c03, 0x9c63, 0x9cc3, 0x9d23, 0x9d83,
+    0x9de3, 0x9e43, 0x9ea3, 0x9f02, 0x9f42, 0x9f82,
+    0x9fc2, 0xa002, 0xa042, 0xa082, 0xa0c2, 0xa103,
+    0xa163, 0xa1c2, 0xa202, 0xa242, 0xa282, 0xa2c2,
+    0xa302, 0xa343, 0xa3a3, 0xa403, 0xa463, 0xa4c3,
+    0xa523, 0xa582, 0xa5c2, 0xa602, 0xa642, 0xa682,
+    0xa6c2, 0xa702, 0xa742, 0xa782, 0xa7c2, 0xa802,
+    0xa842, 0xa882, 0xa8c2, 0xa903, 0xa963, 0xa9c3,
+    0xaa23, 0xaa82, 0xaac2, 0xab02, 0xab42, 0xab82,
+    0xabc2, 0xac02, 0xac42, 0xac82, 0xacc2, 0xad02,
+    0xad42, 0xad82, 0xadc2, 0xae02, 0xae42, 0xae82,
+    0xaec2, 0xaf02, 0xaf42, 0xaf82, 0xafc2, 0xb002,
+    0xb042, 0xb082, 0xb0c2, 0xb102, 0xb142, 0xb182,
+    0xb1c2, 0xb202, 0xb282, 0xb2c2, 0xb302, 0xb342,
+    0xb382, 0xb3c3, 0xb423, 0xb483, 0xb4e3, 0xb543,
+    0xb5a3, 0xb603, 0xb663, 0xb6c3, 0xb723, 0xb783,
+    0xb7e3, 0xb843, 0xb8a3, 0xb903, 0xb963, 0xb9c3,
+    0xba23, 0xba83, 0xbae3, 0xbb42, 0xbb82, 0xbbc2,
+    0xbc02, 0xbc42, 0xbc82, 0xbcc3, 0xbd23, 0xbd83,
+    0xbde3, 0xbe43, 0xbea3, 0xbf03, 0xbf63, 0xbfc3,
+    0xc023, 0xc082, 0xc0c2, 0xc102, 0xc142, 0xc182,
+    0xc1c2, 0xc202, 0xc242, 0xc283, 0xc2e3, 0xc343,
+    0xc3a3, 0xc403, 0xc463, 0xc4c3, 0xc523, 0xc583,
+    0xc5e3, 0xc643, 0xc6a3, 0xc703, 0xc763, 0xc7c3,
+    0xc823, 0xc883, 0xc8e3, 0xc943, 0xc9a3, 0xca02,
+    0xca42, 0xca82, 0xcac2, 0xcb03, 0xcb63, 0xcbc3,
+    0xcc23, 0xcc83, 0xcce3, 0xcd43, 0xcda3, 0xce03,
+    0xce63, 0xcec2, 0xcf02, 0xcf42, 0xcf82, 0xcfc2,
+    0xd002, 0xd042, 0xd082, 0xd0c2, 0xd102, 0xd143,
+    0xd1a3, 0xd203, 0xd263, 0xd2c3, 0xd323, 0xd382,
+    0xd3c2, 0xd403, 0xd463, 0xd4c3, 0xd523, 0xd583,
+    0xd5e3, 0xd642, 0xd682, 0xd6c3, 0xd723, 0xd783,
+    0xd7e3, 0xd842, 0xd882, 0xd8c3, 0xd923, 0xd983,
+    0xd9e3, 0xda42, 0xda82, 0xdac3, 0xdb23, 0xdb83,
+    0xdbe3, 0xdc43, 0xdca3, 0xdd02, 0xdd42, 0xdd83,
+    0xdde3, 0xde43, 0xdea3, 0xdf03, 0xdf63, 0xdfc2,
+    0xe002, 0xe043, 0xe0a3, 0xe103, 0xe163, 0xe1c3,
+    0xe223, 0xe282, 0xe2c2, 0xe303, 0xe363, 0xe3c3,
+    0xe423, 0xe483, 0xe4e3, 0xe542, 0xe582, 0xe5c3,
+    0xe623, 0xe683, 0xe6e3, 0xe742, 0xe782, 0xe7c3,
+    0xe823, 0xe883, 0xe8e3, 0xe942, 0xe982, 0xe9c3,
+    0xea23, 0xea83, 0xeae3, 0xeb43, 0xeba3, 0xec02,
+    0xec43, 0xeca3, 0xed03, 0xed62, 0xeda2, 0xede3,
+    0xee43, 0xeea3, 0xef03, 0xef63, 0xefc3, 0xf022,
+    0xf062, 0xf0a3, 0xf103, 0xf163, 0xf1c3, 0xf223,
+    0xf283, 0xf2e2, 0xf322, 0xf362, 0xf3a2, 0xf3e2,
+    0xf422, 0xf462, 0xf4a2, 0xf4e2, 0xf522, 0xf562,
+    0xf5a2, 0xf5e2, 0xf622, 0xf663, 0xf6c3, 0xf724,
+    0xf7a4, 0xf824, 0xf8a4, 0xf924, 0xf9a4, 0xfa23,
+    0xfa83, 0xfae4, 0xfb64, 0xfbe4, 0xfc64, 0xfce4,
+    0xfd64, 0xfde3, 0xfe43, 0xfea4, 0xff24, 0xffa4,
+    0x10024, 0x100a4, 0x10124, 0x101a3, 0x10203, 0x10264,
+    0x102e4, 0x10364, 0x103e4, 0x10464, 0x104e4, 0x10563,
+    0x105c3, 0x10624, 0x106a4, 0x10724, 0x107a4, 0x10824,
+    0x108a4, 0x10923, 0x10983, 0x109e4, 0x10a64, 0x10ae4,
+    0x10b64, 0x10be4, 0x10c64, 0x10ce2, 0x10d22, 0x10d63,
+    0x10dc2, 0x10e03, 0x10e62, 0x10ea3, 0x10f02, 0x10f42,
+    0x10f82, 0x10fc2, 0x11002, 0x11042, 0x11081, 0x110a2,
+    0x110e2, 0x11163, 0x111c3, 0x11222, 0x11263, 0x112c2,
+    0x11303, 0x11362, 0x113a2, 0x113e2, 0x11422, 0x11462,
+    0x114e3, 0x11583, 0x11623, 0x11682, 0x116c2, 0x11703,
+    0x11763, 0x117c2, 0x11803, 0x11862, 0x118a2, 0x118e2,
+    0x11922, 0x119a3, 0x11a43, 0x11ae3, 0x11b42, 0x11b82,
+    0x11bc3, 0x11c23, 0x11c82, 0x11cc2, 0x11d02, 0x11d43,
+    0x11da2, 0x11de2, 0x11e22, 0x11e62, 0x11ea2, 0x11f23,
+    0x11fc3, 0x12021, 0x12043, 0x120a2, 0x120e3, 0x12142,
+    0x12183, 0x121e2, 0x12222, 0x12262, 0x122a2, 0x122e2,
+    0x12342, 0x12382, 0x123e1, 0x12421, 0x12441, 0x12461,
+    0x12481, 0x124a1, 0x124c1, 0x124e1, 0x12501, 0x12521,
+    0x12541, 0x12561, 0x12582, 0x125c1, 0x125e2, 0x12623,
+    0x12681, 0x126a2, 0x126e3, 0x12742, 0x12783, 0x127e2,
+    0x12822, 0x12862, 0x128a2, 0x128e2, 0x12924, 0x129a1,
+    0x129c1, 0x129e1, 0x12a01, 0x12a21, 0x12a41, 0x12a61,
+    0x12a81, 0x12aa1, 0x12ac1, 0x12ae1, 0x12b01, 0x12b21,
+    0x12b41, 0x12b61, 0x12b81, 0x12ba1, 0x12bc1, 0x12be1,
+    0x12c01, 0x12c21, 0x12c41, 0x12c61, 0x12c81, 0x12ca1,
+    0x12cc1, 0x12ce1, 0x12d01, 0x12d21, 0x12d41, 0x12d61,
+    0x12d81, 0x12da1, 0x12dc1, 0x12de1, 0x12e01, 0x12e21,
+    0x12e41, 0x12e61, 0x12e81, 0x12ea1, 0x12ec1, 0x12ee1,
+    0x12f02, 0x12f43, 0x12fa3, 0x13001, 0x13022, 0x13063,
+    0x130c3, 0x13121, 0x13142, 0x13181, 0x131a1, 0x131c1,
+    0x131e1, 0x13201, 0x13221, 0x13241, 0x13261, 0x13281,
+    0x132a1, 0x132c1, 0x132e2, 0x13321, 0x13341, 0x13361,
+    0x13381, 0x133a1, 0x133c2, 0x13403, 0x13462, 0x134a1,
+    0x134c1, 0x134e1, 0x13501, 0x13522, 0x13561, 0x13581,
+    0x135a1, 0x135c1, 0x135e1, 0x13601, 0x13621, 0x13641,
+    0x13661, 0x13681, 0x136a1, 0x136c1, 0x136e3, 0x13741,
+    0x13761, 0x13781, 0x137a1, 0x137c1, 0x137e1, 0x13801,
+    0x13821, 0x13841, 0x13861, 0x13883, 0x138e3, 0x13944,
+    0x139c3, 0x13a23, 0x13a83, 0x13ae3, 0x13b43, 0x13ba3,
+    0x13c03, 0x13c63, 0x13cc3, 0x13d23, 0x13d83, 0x13de3,
+    0x13e42, 0x13e81, 0x13ea2, 0x13ee3, 0x13f42, 0x13f81,
+    0x13fa2, 0x13fe3, 0x14044, 0x140c2, 0x14101, 0x14122,
+    0x14163, 0x141c1, 0x141e1, 0x14201, 0x14221, 0x14241,
+    0x14262, 0x142a3, 0x14302, 0x14341, 0x14362, 0x143a3,
+    0x14404, 0x14482, 0x144c1, 0x144e2, 0x14523, 0x14581,
+    0x145a1, 0x145c1, 0x145e1, 0x14603, 0x14662, 0x146a2,
+    0x146e2, 0x14722, 0x14762, 0x147a2, 0x147e2, 0x14822,
+    0x14862, 0x148a2, 0x148e2, 0x14922, 0x14963, 0x149c2,
+    0x14a03, 0x14a62, 0x14aa2, 0x14ae2, 0x14b22, 0x14b62,
+    0x14ba2, 0x14be2, 0x14c22, 0x14c62, 0x14ca2, 0x14ce2,
+    0x14d22, 0x14d62, 0x14da2, 0x14de2, 0x14e22, 0x14e62,
+    0x14ea2, 0x14ee2, 0x14f22, 0x14f62, 0x14fa2, 0x14fe2,
+    0x15022, 0x15062, 0x150a2, 0x150e2, 0x15122, 0x15162,
+    0x151a2, 0x151e2, 0x15222, 0x15262, 0x152a1, 0x152c1,
+    0x152e1, 0x15301, 0x15321, 0x15341, 0x15361, 0x15381,
+    0x153a1, 0x153c1, 0x153e1, 0x15402, 0x15442, 0x15482,
+    0x154c2, 0x15502, 0x15542, 0x15582, 0x155c2, 0x15602,
+    0x15642, 0x15682, 0x156c3, 0x15723, 0x15783, 0x157e3,
+    0x15843, 0x158a3, 0x15903, 0x15963, 0x159c3, 0x15a24,
+    0x15aa4, 0x15b24, 0x15ba4, 0x15c24, 0x15ca4, 0x15d24,
+    0x15da4, 0x15e24, 0x15ea4, 0x15f24, 0x15fa2, 0x15fe2,
+    0x16022, 0x16062, 0x160a2, 0x160e2, 0x16122, 0x16162,
+    0x161a2, 0x161e3, 0x16243, 0x162a3, 0x16303, 0x16363,
+    0x163c3, 0x16423, 0x16483, 0x164e3, 0x16543, 0x165a3,
+    0x16603, 0x16663, 0x166c3, 0x16723, 0x16783, 0x167e3,
+    0x16843, 0x168a3, 0x16903, 0x16963, 0x169c3, 0x16a23,
+    0x16a83, 0x16ae3, 0x16b43, 0x16ba3, 0x16c03, 0x16c63,
+    0x16cc3, 0x16d23, 0x16d83, 0x16de3, 0x16e43, 0x16ea3,
+    0x16f03, 0x16f63, 0x16fc1, 0x16fe1, 0x17001, 0x17021,
+    0x17041, 0x17061, 0x17081, 0x170a1, 0x170c1, 0x170e1,
+    0x17101, 0x17121, 0x17141, 0x17161, 0x17181, 0x171a1,
+    0x171c1, 0x171e1, 0x17201, 0x17221, 0x17241, 0x17261,
+    0x17281, 0x172a1, 0x172c1, 0x172e1, 0x17301, 0x17321,
+    0x17341, 0x17361, 0x17381, 0x173a1, 0x173c1, 0x173e1,
+    0x17401, 0x17421, 0x17441, 0x17461, 0x17481, 0x174a1,
+    0x174c1, 0x174e1, 0x17501, 0x17521, 0x17541, 0x17561,
+    0x17581, 0x175a1, 0x175c1, 0x175e1, 0x17601, 0x17621,
+    0x17641, 0x17664, 0x176e3, 0x17742, 0x17783, 0x177e2,
+    0x17821, 0x17841, 0x17861, 0x17881, 0x178a1, 0x178c1,
+    0x178e1, 0x17901, 0x17921, 0x17941, 0x17961, 0x17981,
+    0x179a1, 0x179c1, 0x179e1, 0x17a01, 0x17a21, 0x17a41,
+    0x17a61, 0x17a81, 0x17aa1, 0x17ac1, 0x17ae1, 0x17b01,
+    0x17b21, 0x17b41, 0x17b61, 0x17b81, 0x17ba1, 0x17bc1,
+    0x17be1, 0x17c01, 0x17c21, 0x17c41, 0x17c61, 0x17c81,
+    0x17ca1, 0x17cc1, 0x17ce1, 0x17d01, 0x17d21, 0x17d41,
+    0x17d61, 0x17d81, 0x17da1, 0x17dc1, 0x17de1, 0x17e01,
+    0x17e21, 0x17e41, 0x17e61, 0x17e81, 0x17ea1, 0x17ec1,
+    0x17ee1, 0x17f01, 0x17f21, 0x17f41, 0x17f61, 0x17f81,
+    0x17fa1, 0x17fc1, 0x17fe1, 0x18001, 0x18021, 0x18041,
+    0x18061, 0x18081, 0x180a1, 0x180c1, 0x180e1, 0x18101,
+    0x18121, 0x18141, 0x18161, 0x18181, 0x181a1, 0x181c1,
+    0x181e1, 0x18201, 0x18221, 0x18241, 0x18261, 0x18281,
+    0x182a1, 0x182c1, 0x182e1, 0x18301, 0x18321, 0x18341,
+    0x18361, 0x18381, 0x183a1, 0x183c1, 0x183e1, 0x18401,
+    0x18421, 0x18441, 0x18461, 0x18481, 0x184a1, 0x184c1,
+    0x184e1, 0x18501, 0x18521, 0x18541, 0x18561, 0x18581,
+    0x185a1, 0x185c1, 0x185e1, 0x18601, 0x18621, 0x18641,
+    0x18661, 0x18681, 0x186a1, 0x186c1, 0x186e1, 0x18701,
+    0x18721, 0x18741, 0x18761, 0x18781, 0x187a1, 0x187c1,
+    0x187e1, 0x18801, 0x18821, 0x18841, 0x18861, 0x18881,
+    0x188a1, 0x188c1, 0x188e1, 0x18901, 0x18921, 0x18941,
+    0x18961, 0x18981, 0x189a1, 0x189c1, 0x189e1, 0x18a01,
+    0x18a21, 0x18a41, 0x18a61, 0x18a81, 0x18aa1, 0x18ac1,
+    0x18ae1, 0x18b01, 0x18b21, 0x18b41, 0x18b61, 0x18b81,
+    0x18ba1, 0x18bc1, 0x18be1, 0x18c01, 0x18c21, 0x18c41,
+    0x18c61, 0x18c81, 0x18ca1, 0x18cc1, 0x18ce1, 0x18d01,
+    0x18d21, 0x18d41, 0x18d61, 0x18d81, 0x18da1, 0x18dc1,
+    0x18de1, 0x18e01, 0x18e21, 0x18e41, 0x18e61, 0x18e81,
+    0x18ea1, 0x18ec1, 0x18ee1, 0x18f01, 0x18f21, 0x18f41,
+    0x18f61, 0x18f81, 0x18fa1, 0x18fc1, 0x18fe1, 0x19001,
+    0x19021, 0x19041, 0x19061, 0x19081, 0x190a1, 0x190c1,
+    0x190e1, 0x19101, 0x19121, 0x19141, 0x19161, 0x19181,
+    0x191a1, 0x191c1, 0x191e1, 0x19201, 0x19221, 0x19241,
+    0x19261, 0x19281, 0x192a1, 0x192c1, 0x192e1, 0x19301,
+    0x19321, 0x19341, 0x19361, 0x19381, 0x193a1, 0x193c1,
+    0x193e1, 0x19401, 0x19422, 0x19462, 0x194a2, 0x194e2,
+    0x19522, 0x19562, 0x195a2, 0x195e2, 0x19622, 0x19662,
+    0x196a2, 0x196e2, 0x19722, 0x19762, 0x197a2, 0x197e2,
+    0x19822, 0x19862, 0x198a2, 0x198e2, 0x19922, 0x19962,
+    0x199a2, 0x199e2, 0x19a22, 0x19a62, 0x19aa2, 0x19ae2,
+    0x19b22, 0x19b62, 0x19ba2, 0x19be2, 0x19c22, 0x19c62,
+    0x19ca2, 0x19ce2, 0x19d22, 0x19d62, 0x19da2, 0x19de2,
+    0x19e22, 0x19e62, 0x19ea2, 0x19ee2, 0x19f22, 0x19f62,
+    0x19fa2, 0x19fe2, 0x1a022, 0x1a062, 0x1a0a2, 0x1a0e2,
+    0x1a122, 0x1a162, 0x1a1a2, 0x1a1e2, 0x1a222, 0x1a262,
+    0x1a2a2, 0x1a2e2, 0x1a322, 0x1a362, 0x1a3a1, 0x1a3c1,
+    0x1a3e1, 0x1a401, 0x1a421, 0x1a441, 0x1a461, 0x1a481,
+    0x1a4a1, 0x1a4c1, 0x1a4e1, 0x1a501, 0x1a521, 0x1a541,
+    0x1a561, 0x1a581, 0x1a5a1, 0x1a5c1, 0x1a5e1, 0x1a601,
+    0x1a621, 0x1a641, 0x1a661, 0x1a681, 0x1a6a1, 0x1a6c1,
+    0x1a6e1, 0x1a701, 0x1a721, 0x1a741, 0x1a761, 0x1a781,
+    0x1a7a1, 0x1a7c1, 0x1a7e1, 0x1a801, 0x1a821, 0x1a841,
+    0x1a861, 0x1a881, 0x1a8a1, 0x1a8c1, 0x1a8e1, 0x1a901,
+    0x1a921, 0x1a941, 0x1a961, 0x1a981, 0x1a9a1, 0x1a9c1,
+    0x1a9e1, 0x1aa01, 0x1aa21, 0x1aa41, 0x1aa61, 0x1aa81,
+    0x1aaa1, 0x1aac1, 0x1aae1, 0x1ab01, 0x1ab21, 0x1ab41,
+    0x1ab61, 0x1ab81, 0x1aba1, 0x1abc1, 0x1abe1, 0x1ac01,
+    0x1ac21, 0x1ac41, 0x1ac61, 0x1ac81, 0x1aca1, 0x1acc1,
+    0x1ace1, 0x1ad01, 0x1ad21, 0x1ad41, 0x1ad61, 0x1ad81,
+    0x1ada1, 0x1adc1, 0x1ade1, 0x1ae01, 0x1ae21, 0x1ae41,
+    0x1ae61, 0x1ae81, 0x1aea1, 0x1aec1, 0x1aee1, 0x1af01,
+    0x1af21, 0x1af41, 0x1af61, 0x1af81, 0x1afa1, 0x1afc1,
+    0x1afe1, 0x1b001, 0x1b021, 0x1b041, 0x1b061, 0x1b081,
+    0x1b0a1, 0x1b0c1, 0x1b0e1, 0x1b101, 0x1b123, 0x1b183,
+    0x1b1e3, 0x1b243, 0x1b2a3, 0x1b303, 0x1b363, 0x1b3c3,
+    0x1b423, 0x1b483, 0x1b4e3, 0x1b543, 0x1b5a3, 0x1b603,
+    0x1b664, 0x1b6e4, 0x1b764, 0x1b7e4, 0x1b864, 0x1b8e4,
+    0x1b964, 0x1b9e4, 0x1ba64, 0x1bae4, 0x1bb64, 0x1bbe4,
+    0x1bc64, 0x1bce4, 0x1bd64, 0x1bde7, 0x1bec6, 0x1bf83,
+    0x1bfe3, 0x1c043, 0x1c0a3, 0x1c103, 0x1c163, 0x1c1c3,
+    0x1c223, 0x1c283, 0x1c2e3, 0x1c343, 0x1c3a3, 0x1c403,
+    0x1c463, 0x1c4c3, 0x1c523, 0x1c583, 0x1c5e3, 0x1c643,
+    0x1c6a3, 0x1c703, 0x1c763, 0x1c7c3, 0x1c823, 0x1c883,
+    0x1c8e3, 0x1c943, 0x1c9a3, 0x1ca03, 0x1ca63, 0x1cac3,
+    0x1cb23, 0x1cb83, 0x1cbe3, 0x1cc43, 0x1cca3, 0x1cd01,
+    0x1cd21, 0x1cd41, 0x1cd61, 0x1cd83, 0x1cde2, 0x1ce22,
+    0x1ce62, 0x1cea2, 0x1cee2, 0x1cf22, 0x1cf62, 0x1cfa2,
+    0x1cfe2, 0x1d022, 0x1d062, 0x1d0a2, 0x1d0e2, 0x1d122,
+    0x1d162, 0x1d1a1, 0x1d1c1, 0x1d1e1, 0x1d201, 0x1d221,
+    0x1d241, 0x1d261, 0x1d281, 0x1d2a1, 0x1d2c1, 0x1d2e1,
+    0x1d301, 0x1d321, 0x1d341, 0x1d362, 0x1d3a2, 0x1d3e2,
+    0x1d422, 0x1d462, 0x1d4a2, 0x1d4e2, 0x1d522, 0x1d562,
+    0x1d5a2, 0x1d5e2, 0x1d622, 0x1d662, 0x1d6a2, 0x1d6e5,
+    0x1d784, 0x1d802, 0x1d841, 0x1d861, 0x1d881, 0x1d8a1,
+    0x1d8c1, 0x1d8e1, 0x1d901, 0x1d921, 0x1d941, 0x1d961,
+    0x1d981, 0x1d9a1, 0x1d9c1, 0x1d9e1, 0x1da01, 0x1da21,
+    0x1da41, 0x1da61, 0x1da81, 0x1daa1, 0x1dac1, 0x1dae1,
+    0x1db01, 0x1db21, 0x1db41, 0x1db61, 0x1db81, 0x1dba1,
+    0x1dbc1, 0x1dbe1, 0x1dc01, 0x1dc21, 0x1dc41, 0x1dc61,
+    0x1dc81, 0x1dca1, 0x1dcc1, 0x1dce1, 0x1dd01, 0x1dd21,
+    0x1dd41, 0x1dd61, 0x1dd81, 0x1dda1, 0x1ddc1, 0x1dde1,
+    0x1de01, 0x1de21, 0x1de41, 0x1de62, 0x1dea2, 0x1dee2,
+    0x1df22, 0x1df62, 0x1dfa2, 0x1dfe2, 0x1e022, 0x1e062,
+    0x1e0a2, 0x1e0e2, 0x1e122, 0x1e162, 0x1e1a2, 0x1e1e2,
+    0x1e222, 0x1e262, 0x1e2a2, 0x1e2e2, 0x1e322, 0x1e362,
+    0x1e3a2, 0x1e3e2, 0x1e422, 0x1e463, 0x1e4c3, 0x1e523,
+    0x1e582, 0x1e5c3, 0x1e622, 0x1e663, 0x1e6c1, 0x1e6e1,
+    0x1e701, 0x1e721, 0x1e741, 0x1e761, 0x1e781, 0x1e7a1,
+    0x1e7c1, 0x1e7e1, 0x1e801, 0x1e821, 0x1e841, 0x1e861,
+    0x1e881, 0x1e8a1, 0x1e8c1, 0x1e8e1, 0x1e901, 0x1e921,
+    0x1e941, 0x1e961, 0x1e981, 0x1e9a1, 0x1e9c1, 0x1e9e1,
+    0x1ea01, 0x1ea21, 0x1ea41, 0x1ea61, 0x1ea81, 0x1eaa1,
+    0x1eac1, 0x1eae1, 0x1eb01, 0x1eb21, 0x1eb41, 0x1eb61,
+    0x1eb81, 0x1eba1, 0x1ebc1, 0x1ebe1, 0x1ec01, 0x1ec21,
+    0x1ec41, 0x1ec61, 0x1ec81, 0x1eca2, 0x1ece5, 0x1ed84,
+    0x1ee05, 0x1eea3, 0x1ef05, 0x1efa3, 0x1f003, 0x1f066,
+    0x1f124, 0x1f1a3, 0x1f203, 0x1f263, 0x1f2c4, 0x1f344,
+    0x1f3c4, 0x1f444, 0x1f4c4, 0x1f544, 0x1f5c4, 0x1f646,
+    0x1f702, 0x1f746, 0x1f806, 0x1f8c5, 0x1f964, 0x1f9e6,
+    0x1faa6, 0x1fb64, 0x1fbe3, 0x1fc43, 0x1fca4, 0x1fd24,
+    0x1fda5, 0x1fe45, 0x1fee3, 0x1ff43, 0x1ffa4, 0x20023,
+    0x20083, 0x200e2, 0x20122, 0x20163, 0x201c3, 0x20226,
+    0x202e4, 0x20365, 0x20406, 0x204c4, 0x20543, 0x205a3,
+    0x20606, 0x206c4, 0x20746, 0x20803, 0x20865, 0x20903,
+    0x20964, 0x209e3, 0x20a44, 0x20ac5, 0x20b64, 0x20be5,
+    0x20c84, 0x20d02, 0x20d45, 0x20de3, 0x20e43, 0x20ea4,
+    0x20f23, 0x20f83, 0x20fe3, 0x21045, 0x210e4, 0x21162,
+    0x211a6, 0x21263, 0x212c5, 0x21364, 0x213e4, 0x21463,
+    0x214c3, 0x21524, 0x215a2, 0x215e4, 0x21665, 0x21702,
+    0x21746, 0x21803, 0x21862, 0x218a2, 0x218e2, 0x21922,
+    0x21962, 0x219a2, 0x219e2, 0x21a22, 0x21a62, 0x21aa2,
+    0x21ae3, 0x21b43, 0x21ba3, 0x21c03, 0x21c63, 0x21cc3,
+    0x21d23, 0x21d83, 0x21de3, 0x21e43, 0x21ea3, 0x21f03,
+    0x21f63, 0x21fc3, 0x22023, 0x22083, 0x220e2, 0x22122,
+    0x22163, 0x221c2, 0x22202, 0x22242, 0x22283, 0x222e3,
+    0x22342, 0x22382, 0x223c2, 0x22402, 0x22442, 0x22484,
+    0x22502, 0x22542, 0x22582, 0x225c2, 0x22602, 0x22642,
+    0x22682, 0x226c2, 0x22703, 0x22764, 0x227e2, 0x22822,
+    0x22862, 0x228a2, 0x228e2, 0x22922, 0x22962, 0x229a3,
+    0x22a03, 0x22a63, 0x22ac3, 0x22b22, 0x22b62, 0x22ba2,
+    0x22be2, 0x22c22, 0x22c62, 0x22ca2, 0x22ce2, 0x22d22,
+    0x22d62, 0x22da3, 0x22e03, 0x22e62, 0x22ea3, 0x22f03,
+    0x22f63, 0x22fc2, 0x23003, 0x23063, 0x230c4, 0x23142,
+    0x23183, 0x231e3, 0x23243, 0x232a3, 0x23305, 0x233a6,
+    0x23462, 0x234a2, 0x234e2, 0x23522, 0x23562, 0x235a2,
+    0x235e2, 0x23622, 0x23662, 0x236a2, 0x236e2, 0x23722,
+    0x23762, 0x237a2, 0x237e2, 0x23822, 0x23862, 0x238a2,
+    0x238e4, 0x23962, 0x239a2, 0x239e2, 0x23a24, 0x23aa3,
+    0x23b02, 0x23b42, 0x23b82, 0x23bc2, 0x23c02, 0x23c42,
+    0x23c82, 0x23cc2, 0x23d02, 0x23d42, 0x23d83, 0x23de2,
+    0x23e22, 0x23e63, 0x23ec3, 0x23f22, 0x23f64, 0x23fe3,
+    0x24042, 0x24082, 0x240c2, 0x24102, 0x24143, 0x241a3,
+    0x24202, 0x24242, 0x24282, 0x242c2, 0x24302, 0x24342,
+    0x24382, 0x243c2, 0x24402, 0x24443, 0x244a3, 0x24503,
+    0x24563, 0x245c3, 0x24623, 0x24683, 0x246e3, 0x24743,
+    0x247a3, 0x24803, 0x24863, 0x248c3, 0x24923, 0x24983,
+    0x249e3, 0x24a43, 0x24aa3, 0x24b03, 0x24b63, 0x24bc3,
+    0x24c23, 0x24c83, 0x24ce1, 0x24d01, 0x24d21, 0x24d41,
+    0x24d61, 0x24d81, 0x24da1, 0x24dc1, 0x24de1, 0x24e01,
+    0x24e21, 0x24e41, 0x24e61, 0x24e81, 0x24ea1, 0x24ec1,
+    0x24ee1, 0x24f01, 0x24f21, 0x24f41, 0x24f61, 0x24f81,
+    0x24fa1, 0x24fc1, 0x24fe1, 0x25001, 0x25021, 0x25041,
+    0x25061, 0x25081, 0x250a1, 0x250c1, 0x250e1, 0x25101,
+    0x25121, 0x25141, 0x25161, 0x25181, 0x251a1, 0x251c1,
+    0x251e1, 0x25201, 0x25221, 0x25241, 0x25261, 0x25281,
+    0x252a1, 0x252c1, 0x252e1, 0x25301, 0x25321, 0x25341,
+    0x25361, 0x25381, 0x253a1, 0x253c1, 0x253e1, 0x25401,
+    0x25421, 0x25441, 0x25461, 0x25481, 0x254a1, 0x254c1,
+    0x254e1, 0x25501, 0x25521, 0x25541, 0x25561, 0x25581,
+    0x255a1, 0x255c1, 0x255e1, 0x25601, 0x25621, 0x25641,
+    0x25661, 0x25681, 0x256a1, 0x256c1, 0x256e1, 0x25701,
+    0x25721, 0x25741, 0x25761, 0x25781, 0x257a1, 0x257c1,
+    0x257e1, 0x25801, 0x25821, 0x25841, 0x25861, 0x25881,
+    0x258a1, 0x258c1, 0x258e1, 0x25901, 0x25921, 0x25941,
+    0x25961, 0x25981, 0x259a1, 0x259c1, 0x259e1, 0x25a01,
+    0x25a21, 0x25a41, 0x25a61, 0x25a81, 0x25aa1, 0x25ac1,
+    0x25ae1, 0x25b01, 0x25b21, 0x25b41, 0x25b61, 0x25b81,
+    0x25ba1, 0x25bc1, 0x25be1, 0x25c01, 0x25c21, 0x25c41,
+    0x25c61, 0x25c81, 0x25ca1, 0x25cc1, 0x25ce1, 0x25d01,
+    0x25d21, 0x25d41, 0x25d61, 0x25d81, 0x25da1, 0x25dc1,
+    0x25de1, 0x25e01, 0x25e21, 0x25e41, 0x25e61, 0x25e81,
+    0x25ea1, 0x25ec1, 0x25ee1, 0x25f01, 0x25f21, 0x25f41,
+    0x25f61, 0x25f81, 0x25fa1, 0x25fc1, 0x25fe1, 0x26001,
+    0x26021, 0x26041, 0x26061, 0x26081, 0x260a1, 0x260c1,
+    0x260e1, 0x26101, 0x26121, 0x26141, 0x26161, 0x26181,
+    0x261a1, 0x261c1, 0x261e1, 0x26201, 0x26221, 0x26241,
+    0x26261, 0x26281, 0x262a1, 0x262c1, 0x262e1, 0x26301,
+    0x26321, 0x26341, 0x26361, 0x26381, 0x263a1, 0x263c1,
+    0x263e1, 0x26401, 0x26421, 0x26441, 0x26461, 0x26481,
+    0x264a1, 0x264c1, 0x264e1, 0x26501, 0x26521, 0x26541,
+    0x26561, 0x26581, 0x265a1, 0x265c1, 0x265e1, 0x26601,
+    0x26621, 0x26641, 0x26661, 0x26681, 0x266a1, 0x266c1,
+    0x266e1, 0x26701, 0x26721, 0x26741, 0x26761, 0x26781,
+    0x267a1, 0x267c1, 0x267e1, 0x26801, 0x26821, 0x26841,
+    0x26861, 0x26881, 0x268a1, 0x268c1, 0x268e1, 0x26901,
+    0x26921, 0x26941, 0x26961, 0x26981, 0x269a1, 0x269c1,
+    0x269e1, 0x26a01, 0x26a21, 0x26a41, 0x26a61, 0x26a81,
+    0x26aa1, 0x26ac1, 0x26ae1, 0x26b01, 0x26b21, 0x26b41,
+    0x26b61, 0x26b81, 0x26ba1, 0x26bc1, 0x26be1, 0x26c01,
+    0x26c21, 0x26c41, 0x26c61, 0x26c81, 0x26ca1, 0x26cc1,
+    0x26ce1, 0x26d01, 0x26d21, 0x26d41, 0x26d61, 0x26d81,
+    0x26da1, 0x26dc1, 0x26de1, 0x26e01, 0x26e21, 0x26e41,
+    0x26e61, 0x26e81, 0x26ea1, 0x26ec1, 0x26ee1, 0x26f01,
+    0x26f21, 0x26f41, 0x26f61, 0x26f81, 0x26fa1, 0x26fc1,
+    0x26fe1, 0x27001, 0x27021, 0x27041, 0x27061, 0x27081,
+    0x270a1, 0x270c1, 0x270e1, 0x27101, 0x27121, 0x27141,
+    0x27161, 0x27181, 0x271a1, 0x271c1, 0x271e1, 0x27201,
+    0x27221, 0x27241, 0x27261, 0x27281, 0x272a1, 0x272c1,
+    0x272e1, 0x27301, 0x27321, 0x27341, 0x27361, 0x27381,
+    0x273a1, 0x273c1, 0x273e1, 0x27401, 0x27421, 0x27441,
+    0x27461, 0x27481, 0x274a1, 0x274c1, 0x274e1, 0x27501,
+    0x27521, 0x27541, 0x27561, 0x27581, 0x275a1, 0x275c1,
+    0x275e1, 0x27601, 0x27621, 0x27641, 0x27661, 0x27681,
+    0x276a1, 0x276c1, 0x276e1, 0x27701, 0x27721, 0x27741,
+    0x27761, 0x27781, 0x277a1, 0x277c1, 0x277e1, 0x27801,
+    0x27821, 0x27841, 0x27861, 0x27881, 0x278a1, 0x278c1,
+    0x278e1, 0x27901, 0x27921, 0x27941, 0x27961, 0x27981,
+    0x279a1, 0x279c1, 0x279e1, 0x27a01, 0x27a21, 0x27a41,
+    0x27a61, 0x27a81, 0x27aa1, 0x27ac1, 0x27ae1, 0x27b01,
+    0x27b21, 0x27b41, 0x27b61, 0x27b81, 0x27ba1, 0x27bc1,
+    0x27be1, 0x27c01, 0x27c21, 0x27c41, 0x27c61, 0x27c81,
+    0x27ca1, 0x27cc1, 0x27ce1, 0x27d01, 0x27d21, 0x27d41,
+    0x27d61, 0x27d81, 0x27da1, 0x27dc1, 0x27de1, 0x27e01,
+    0x27e21, 0x27e41, 0x27e61, 0x27e81, 0x27ea1, 0x27ec1,
+    0x27ee1, 0x27f01, 0x27f21, 0x27f41, 0x27f61, 0x27f81,
+    0x27fa1, 0x27fc1, 0x27fe1, 0x28001, 0x28021, 0x28041,
+    0x28061, 0x28081, 0x280a1, 0x280c1, 0x280e1, 0x28101,
+    0x28121, 0x28141, 0x28161, 0x28181, 0x281a1, 0x281c1,
+    0x281e1, 0x28201, 0x28221, 0x28241, 0x28261, 0x28281,
+    0x282a1, 0x282c1, 0x282e1, 0x28301, 0x28321, 0x28341,
+    0x28361, 0x28381, 0x283a1, 0x283c1, 0x283e1, 0x28401,
+    0x28421, 0x28441, 0x28461, 0x28481, 0x284a1, 0x284c1,
+    0x284e1, 0x28501, 0x28521, 0x28541, 0x28561, 0x28581,
+    0x285a1, 0x285c1, 0x285e1, 0x28601, 0x28621, 0x28641,
+    0x28661, 0x28681, 0x286a1, 0x286c1, 0x286e1, 0x28701,
+    0x28721, 0x28741, 0x28761, 0x28781, 0x287a1, 0x287c1,
+    0x287e1, 0x28802, 0x28842, 0x28882, 0x288c3, 0x28923,
+    0x28982, 0x289c2, 0x28a02, 0x28a42, 0x28a82, 0x28ac2,
+    0x28b02, 0x28b42, 0x28b82, 0x28bc1, 0x28be1, 0x28c01,
+    0x28c21, 0x28c41, 0x28c61, 0x28c81, 0x28ca1, 0x28cc1,
+    0x28ce1, 0x28d02, 0x28d42, 0x28d83, 0x28de3, 0x28e42,
+    0x28e82, 0x28ec2, 0x28f02, 0x28f42, 0x28f82, 0x28fc2,
+    0x29002, 0x29042, 0x29082, 0x290c2, 0x29102, 0x29142,
+    0x29182, 0x291c2, 0x29202, 0x29242, 0x29282, 0x292c2,
+    0x29302, 0x29342, 0x29382, 0x293c2, 0x29402, 0x29442,
+    0x29482, 0x294c2, 0x29502, 0x29542, 0x29581, 0x295a1,
+    0x295c1, 0x295e1, 0x29601, 0x29621, 0x29641, 0x29661,
+    0x29681, 0x296a1, 0x296c1, 0x296e1, 0x29701, 0x29721,
+    0x29741, 0x29761, 0x29781, 0x297a1, 0x297c1, 0x297e1,
+    0x29801, 0x29821, 0x29841, 0x29861, 0x29881, 0x298a1,
+    0x298c1, 0x298e1, 0x29901, 0x29921, 0x29941, 0x29961,
+    0x29981, 0x299a1, 0x299c1, 0x299e1, 0x29a01, 0x29a21,
+    0x29a41, 0x29a61, 0x29a81, 0x29aa1, 0x29ac1, 0x29ae1,
+    0x29b01, 0x29b21, 0x29b41, 0x29b61, 0x29b81, 0x29ba1,
+    0x29bc1, 0x29be1, 0x29c01, 0x29c21, 0x29c41, 0x29c61,
+    0x29c81, 0x29ca1, 0x29cc1, 0x29ce1, 0x29d01, 0x29d21,
+    0x29d41, 0x29d61, 0x29d81, 0x29da1, 0x29dc1, 0x29de1,
+    0x29e01, 0x29e21, 0x29e41, 0x29e61, 0x29e81, 0x29ea1,
+    0x29ec1, 0x29ee1, 0x29f01, 0x29f21, 0x29f41, 0x29f61,
+    0x29f81, 0x29fa1, 0x29fc1, 0x29fe1, 0x2a002, 0x2a042,
+    0x2a081, 0x2a0a1, 0x2a0c1, 0x2a0e1, 0x2a101, 0x2a121,
+    0x2a141, 0x2a161, 0x2a181, 0x2a1a1, 0x2a1c2, 0x2a202,
+    0x2a241, 0x2a261, 0x2a281, 0x2a2a1, 0x2a2c1, 0x2a2e1,
+    0x2a301, 0x2a321, 0x2a341, 0x2a361, 0x2a382, 0x2a3c1,
+    0x2a3e1, 0x2a401, 0x2a421, 0x2a441, 0x2a461, 0x2a481,
+    0x2a4a1, 0x2a4c1, 0x2a4e1, 0x2a501, 0x2a521, 0x2a543,
+    0x2a5a3, 0x2a603, 0x2a663, 0x2a6c3, 0x2a723, 0x2a783,
+    0x2a7e3, 0x2a843, 0x2a8a3, 0x2a903, 0x2a963, 0x2a9c3,
+    0x2aa23, 0x2aa83, 0x2aae3, 0x2ab43, 0x2aba3, 0x2ac01,
+    0x2ac21, 0x2ac41, 0x2ac61, 0x2ac83, 0x2ace3, 0x2ad43,
+    0x2ada3, 0x2ae03, 0x2ae62, 0x2aea2, 0x2aee2, 0x2af22,
+    0x2af62, 0x2afa2, 0x2afe2, 0x2b022, 0x2b062, 0x2b0a2,
+    0x2b0e2, 0x2b122, 0x2b162, 0x2b1a2, 0x2b1e2, 0x2b222,
+    0x2b262, 0x2b2a2, 0x2b2e2, 0x2b322, 0x2b362, 0x2b3a2,
+    0x2b3e2, 0x2b422, 0x2b462, 0x2b4a2, 0x2b4e2, 0x2b522,
+    0x2b562, 0x2b5a2, 0x2b5e2, 0x2b622, 0x2b662, 0x2b6a2,
+    0x2b6e2, 0x2b722, 0x2b762, 0x2b7a2, 0x2b7e2, 0x2b822,
+    0x2b862, 0x2b8a2, 0x2b8e2, 0x2b922, 0x2b962, 0x2b9a2,
+    0x2b9e2, 0x2ba22, 0x2ba62, 0x2baa2, 0x2bae2, 0x2bb22,
+    0x2bb62, 0x2bba2, 0x2bbe2, 0x2bc22, 0x2bc62, 0x2bca2,
+    0x2bce2, 0x2bd22, 0x2bd62, 0x2bda2, 0x2bde2, 0x2be22,
+    0x2be62, 0x2bea2, 0x2bee2, 0x2bf22, 0x2bf62, 0x2bfa2,
+    0x2bfe2, 0x2c022, 0x2c062, 0x2c0a2, 0x2c0e2, 0x2c122,
+    0x2c162, 0x2c1a2, 0x2c1e2, 0x2c222, 0x2c262, 0x2c2a2,
+    0x2c2e2, 0x2c322, 0x2c362, 0x2c3a2, 0x2c3e2, 0x2c422,
+    0x2c462, 0x2c4a3, 0x2c503, 0x2c563, 0x2c5c3, 0x2c623,
+    0x2c683, 0x2c6e3, 0x2c743, 0x2c7a3, 0x2c803, 0x2c863,
+    0x2c8c3, 0x2c922, 0x2c962, 0x2c9a2, 0x2c9e2, 0x2ca22,
+    0x2ca62, 0x2caa2, 0x2cae2, 0x2cb22, 0x2cb62, 0x2cba2,
+    0x2cbe2, 0x2cc22, 0x2cc62, 0x2cca2, 0x2cce2, 0x2cd22,
+    0x2cd62, 0x2cda2, 0x2cde2, 0x2ce22, 0x2ce62, 0x2cea2,
+    0x2cee2, 0x2cf22, 0x2cf62, 0x2cfa2, 0x2cfe2, 0x2d022,
+    0x2d062, 0x2d0a2, 0x2d0e2, 0x2d122, 0x2d162, 0x2d1a2,
+    0x2d1e2, 0x2d222, 0x2d262, 0x2d2a2, 0x2d2e2, 0x2d322,
+    0x2d362, 0x2d3a2, 0x2d3e2, 0x2d422, 0x2d463, 0x2d4c3,
+    0x2d523, 0x2d583, 0x2d5e3, 0x2d642, 0x2d682, 0x2d6c2,
+    0x2d702, 0x2d742, 0x2d782, 0x2d7c2, 0x2d802, 0x2d842,
+    0x2d882, 0x2d8c2, 0x2d902, 0x2d942, 0x2d982, 0x2d9c2,
+    0x2da02, 0x2da42, 0x2da82, 0x2dac2, 0x2db02, 0x2db42,
+    0x2db82, 0x2dbc2, 0x2dc02, 0x2dc42, 0x2dc82, 0x2dcc2,
+    0x2dd02, 0x2dd42, 0x2dd82, 0x2ddc2, 0x2de02, 0x2de42,
+    0x2de82, 0x2dec2, 0x2df02, 0x2df42, 0x2df82, 0x2dfc2,
+    0x2e002, 0x2e042, 0x2e082, 0x2e0c2, 0x2e102, 0x2e142,
+    0x2e182, 0x2e1c2, 0x2e202, 0x2e242, 0x2e282, 0x2e2c2,
+    0x2e302, 0x2e342, 0x2e382, 0x2e3c2, 0x2e402, 0x2e442,
+    0x2e482, 0x2e4c2, 0x2e502, 0x2e542, 0x2e582, 0x2e5c2,
+    0x2e602, 0x2e642, 0x2e682, 0x2e6c2, 0x2e703, 0x2e763,
+    0x2e7c2, 0x2e802, 0x2e842, 0x2e882, 0x2e8c2, 0x2e902,
+    0x2e942, 0x2e982, 0x2e9c2, 0x2ea02, 0x2ea42, 0x2ea82,
+    0x2eac2, 0x2eb02, 0x2eb42, 0x2eb82, 0x2ebc2, 0x2ec03,
+    0x2ec63, 0x2ecc3, 0x2ed22, 0x2ed62, 0x2eda2, 0x2ede2,
+    0x2ee22, 0x2ee62, 0x2eea2, 0x2eee2, 0x2ef22, 0x2ef62,
+    0x2efa2, 0x2efe2, 0x2f022, 0x2f062, 0x2f0a2, 0x2f0e2,
+    0x2f122, 0x2f162, 0x2f1a2, 0x2f1e2, 0x2f222, 0x2f262,
+    0x2f2a2, 0x2f2e2, 0x2f322, 0x2f362, 0x2f3a2, 0x2f3e2,
+    0x2f422, 0x2f462, 0x2f4a2, 0x2f4e2, 0x2f522, 0x2f562,
+    0x2f5a2, 0x2f5e2, 0x2f622, 0x2f662, 0x2f6a2, 0x2f6e2,
+    0x2f722, 0x2f762, 0x2f7a2, 0x2f7e2, 0x2f822, 0x2f862,
+    0x2f8a2, 0x2f8e2, 0x2f922, 0x2f962, 0x2f9a2, 0x2f9e2,
+    0x2fa22, 0x2fa62, 0x2faa2, 0x2fae2, 0x2fb22, 0x2fb62,
+    0x2fba2, 0x2fbe2, 0x2fc22, 0x2fc62, 0x2fca2, 0x2fce2,
+    0x2fd22, 0x2fd62, 0x2fda2, 0x2fde2, 0x2fe22, 0x2fe62,
+    0x2fea2, 0x2fee2, 0x2ff22, 0x2ff63, 0x2ffc3, 0x30023,
+    0x30083, 0x300e3, 0x30143, 0x301a3, 0x30203, 0x30263,
+    0x302c3, 0x30323, 0x30383, 0x303e3, 0x30443, 0x304a3,
+    0x30503, 0x30563, 0x305c3, 0x30623, 0x30683, 0x306e3,
+    0x30743, 0x307a3, 0x30803, 0x30863, 0x308c3, 0x30923,
+    0x30983, 0x309e3, 0x30a43, 0x30aa3, 0x30b03, 0x30b63,
+    0x30bc3, 0x30c23, 0x30c83, 0x30ce3, 0x30d43, 0x30da3,
+    0x30e03, 0x30e63, 0x30ec3, 0x30f23, 0x30f83, 0x30fe3,
+    0x31043, 0x310a3, 0x31103, 0x31163, 0x311c3, 0x31223,
+    0x31283, 0x312e3, 0x31343, 0x313a3, 0x31403, 0x31463,
+    0x314c3, 0x31523, 0x31583, 0x315e3, 0x31643, 0x316a3,
+    0x31703, 0x31763, 0x317c3, 0x31823, 0x31883, 0x318e3,
+    0x31943, 0x319a3, 0x31a03, 0x31a63, 0x31ac3, 0x31b23,
+    0x31b83, 0x31be3, 0x31c43, 0x31ca3, 0x31d03, 0x31d63,
+    0x31dc3, 0x31e23, 0x31e83, 0x31ee3, 0x31f43, 0x31fa3,
+    0x32003, 0x32063, 0x320c3, 0x32123, 0x32183, 0x321e3,
+    0x32243, 0x322a3, 0x32303, 0x32363, 0x323c3, 0x32423,
+    0x32483, 0x324e3, 0x32543, 0x325a3, 0x32603, 0x32663,
+    0x326c3, 0x32723, 0x32783, 0x327e3, 0x32843, 0x328a3,
+    0x32903, 0x32963, 0x329c3, 0x32a23, 0x32a83, 0x32ae3,
+    0x32b43, 0x32ba3, 0x32c03, 0x32c64, 0x32ce4, 0x32d64,
+    0x32de4, 0x32e64, 0x32ee4, 0x32f64, 0x32fe3, 0x33052,
+    0x33288, 0x33384, 0x33401, 0x33421, 0x33441, 0x33461,
+    0x33481, 0x334a1, 0x334c1, 0x334e1, 0x33501, 0x33523,
+    0x33582, 0x335c1, 0x335e1, 0x33601, 0x33621, 0x33641,
+    0x33661, 0x33681, 0x336a1, 0x336c1, 0x336e1, 0x33701,
+    0x33721, 0x33741, 0x33761, 0x33781, 0x337a1, 0x337c1,
+    0x337e1, 0x33801, 0x33821, 0x33841, 0x33861, 0x33882,
+    0x338c2, 0x33902, 0x33942, 0x33981, 0x339a1, 0x339c1,
+    0x339e1, 0x33a01, 0x33a21, 0x33a41, 0x33a61, 0x33a81,
+    0x33aa1, 0x33ac1, 0x33ae1, 0x33b01, 0x33b21, 0x33b41,
+    0x33b61, 0x33b81, 0x33ba1, 0x33bc1, 0x33be1, 0x33c01,
+    0x33c21, 0x33c41, 0x33c61, 0x33c81, 0x33ca1, 0x33cc1,
+    0x33ce1, 0x33d01, 0x33d22, 0x33d62, 0x33da2, 0x33de2,
+    0x33e22, 0x33e62, 0x33ea2, 0x33ee2, 0x33f22, 0x33f62,
+    0x33fa2, 0x33fe2, 0x34022, 0x34062, 0x340a1, 0x340c2,
+    0x34102, 0x34142, 0x34182, 0x341c2, 0x34202, 0x34242,
+    0x34282, 0x342c2, 0x34302, 0x34342, 0x34382, 0x343c1,
+    0x343e1, 0x34401, 0x34421, 0x34441, 0x34461, 0x34481,
+    0x344a1, 0x344c1, 0x344e1, 0x34501, 0x34521, 0x34541,
+    0x34561, 0x34581, 0x345a1, 0x345c1, 0x345e1, 0x34601,
+    0x34621, 0x34641, 0x34661, 0x34681, 0x346a1, 0x346c1,
+    0x346e1, 0x34701, 0x34721, 0x34741, 0x34761, 0x34781,
+    0x347a1, 0x347c1, 0x347e1, 0x34801, 0x34821, 0x34841,
+    0x34861, 0x34881, 0x348a1, 0x348c1, 0x348e1, 0x34901,
+    0x34921, 0x34941, 0x34961, 0x34981, 0x349a1, 0x349c1,
+    0x349e1, 0x34a01, 0x34a21, 0x34a41, 0x34a61, 0x34a81,
+    0x34aa1, 0x34ac1, 0x34ae1, 0x34b01, 0x34b21, 0x34b41,
+    0x34b61, 0x34b81, 0x34ba1, 0x34bc1, 0x34be1, 0x34c01,
+    0x34c21, 0x34c41, 0x34c61, 0x34c81, 0x34ca1, 0x34cc1,
+    0x34ce1, 0x34d01, 0x34d21, 0x34d41, 0x34d61, 0x34d81,
+    0x34da1, 0x34dc1, 0x34de1, 0x34e01, 0x34e21, 0x34e41,
+    0x34e61, 0x34e81, 0x34ea1, 0x34ec1, 0x34ee1, 0x34f01,
+    0x34f21, 0x34f41, 0x34f61, 0x34f81, 0x34fa1, 0x34fc1,
+    0x34fe1, 0x35001, 0x35021, 0x35041, 0x35061, 0x35081,
+    0x350a1, 0x350c3, 0x35123, 0x35183, 0x351e3, 0x35243,
+    0x352a3, 0x35302, 0x35342, 0x35381, 0x353a1, 0x353c1,
+    0x353e1, 0x35401, 0x35421, 0x35441, 0x35461, 0x35481,
+    0x354a1, 0x354c1, 0x354e1, 0x35501, 0x35521, 0x35541,
+    0x35561, 0x35581, 0x355a1, 0x355c1, 0x355e1, 0x35601,
+    0x35621, 0x35641, 0x35661, 0x35681, 0x356a1, 0x356c1,
+    0x356e1, 0x35701, 0x35721, 0x35741, 0x35761, 0x35781,
+    0x357a1, 0x357c1, 0x357e1, 0x35801, 0x35821, 0x35841,
+    0x35861, 0x35881, 0x358a1, 0x358c1, 0x358e1, 0x35901,
+    0x35921, 0x35941, 0x35961, 0x35981, 0x359a1, 0x359c1,
+    0x359e1, 0x35a01, 0x35a21, 0x35a41, 0x35a61, 0x35a81,
+    0x35aa1, 0x35ac1, 0x35ae1, 0x35b01, 0x35b21, 0x35b41,
+    0x35b61, 0x35b81, 0x35ba1, 0x35bc1, 0x35be1, 0x35c01,
+    0x35c21, 0x35c41, 0x35c61, 0x35c81, 0x35ca1, 0x35cc1,
+    0x35ce1, 0x35d01, 0x35d21, 0x35d41, 0x35d61, 0x35d81,
+    0x35da1, 0x35dc1, 0x35de1, 0x35e01, 0x35e21, 0x35e41,
+    0x35e61, 0x35e81, 0x35ea1, 0x35ec1, 0x35ee1, 0x35f01,
+    0x35f21, 0x35f41, 0x35f61, 0x35f81, 0x35fa1, 0x35fc1,
+    0x35fe1, 0x36001, 0x36021, 0x36041, 0x36061, 0x36081,
+    0x360a1, 0x360c1, 0x360e1, 0x36101, 0x36121, 0x36141,
+    0x36161, 0x36181, 0x361a1, 0x361c1, 0x361e1, 0x36201,
+    0x36221, 0x36241, 0x36261, 0x36281, 0x362a1, 0x362c1,
+    0x362e1, 0x36301, 0x36321, 0x36341, 0x36361, 0x36381,
+    0x363a1, 0x363c1, 0x363e1, 0x36401, 0x36421, 0x36441,
+    0x36461, 0x36481, 0x364a1, 0x364c1, 0x364e1, 0x36501,
+    0x36521, 0x36541, 0x36561, 0x36581, 0x365a1, 0x365c1,
+    0x365e1, 0x36601, 0x36621, 0x36641, 0x36661, 0x36681,
+    0x366a1, 0x366c1, 0x366e1, 0x36701, 0x36721, 0x36741,
+    0x36761, 0x36781, 0x367a1, 0x367c1, 0x367e1, 0x36801,
+    0x36821, 0x36841, 0x36861, 0x36881, 0x368a1, 0x368c1,
+    0x368e1, 0x36901, 0x36921, 0x36941, 0x36961, 0x36981,
+    0x369a1, 0x369c1, 0x369e1, 0x36a01, 0x36a21, 0x36a41,
+    0x36a61, 0x36a81, 0x36aa1, 0x36ac1, 0x36ae1, 0x36b01,
+    0x36b21, 0x36b41, 0x36b61, 0x36b81, 0x36ba1, 0x36bc1,
+    0x36be1, 0x36c01, 0x36c21, 0x36c41, 0x36c61, 0x36c81,
+    0x36ca1, 0x36cc1, 0x36ce1, 0x36d01, 0x36d21, 0x36d41,
+    0x36d61, 0x36d81, 0x36da1, 0x36dc1, 0x36de1, 0x36e01,
+    0x36e21, 0x36e42, 0x36e81, 0x36ea1, 0x36ec1, 0x36ee1,
+    0x36f01, 0x36f21, 0x36f41, 0x36f61, 0x36f81, 0x36fa1,
+    0x36fc1, 0x36fe1, 0x37001, 0x37021, 0x37041, 0x37061,
+    0x37081, 0x370a1, 0x370c1, 0x370e1, 0x37101, 0x37121,
+    0x37141, 0x37161, 0x37181, 0x371a1, 0x371c1, 0x371e1,
+    0x37201, 0x37221, 0x37241, 0x37261, 0x37281, 0x372a1,
+    0x372c1, 0x372e1, 0x37301, 0x37321, 0x37341, 0x37361,
+    0x37381, 0x373a1, 0x373c1, 0x373e1, 0x37401, 0x37421,
+    0x37441, 0x37461, 0x37481, 0x374a1, 0x374c1, 0x374e1,
+    0x37501, 0x37521, 0x37541, 0x37561, 0x37581, 0x375a1,
+    0x375c1, 0x375e1, 0x37601, 0x37621, 0x37641, 0x37661,
+    0x37681, 0x376a1, 0x376c2, 0x37702, 0x37742, 0x37782,
+    0x377c2, 0x37802, 0x37842, 0x37882, 0x378c2, 0x37902,
+    0x37942, 0x37982, 0x379c2, 0x37a02, 0x37a42, 0x37a83,
+    0x37ae3, 0x37b43, 0x37ba3, 0x37c03, 0x37c62, 0x37ca2,
+    0x37ce3, 0x37d43, 0x37da3, 0x37e03, 0x37e61, 0x37e81,
+    0x37ea1, 0x37ec1, 0x37ee1, 0x37f01, 0x37f21, 0x37f41,
+    0x37f61, 0x37f81, 0x37fa1, 0x37fc1, 0x37fe1, 0x38001,
+    0x38021, 0x38041, 0x38061, 0x38081, 0x380a1, 0x380c1,
+    0x380e1, 0x38101, 0x38121, 0x38141, 0x38161, 0x38181,
+    0x381a1, 0x381c1, 0x381e1, 0x38201, 0x38221, 0x38241,
+    0x38261, 0x38281, 0x382a1, 0x382c1, 0x382e1, 0x38301,
+    0x38321, 0x38341, 0x38361, 0x38381, 0x383a1, 0x383c1,
+    0x383e1, 0x38401, 0x38421, 0x38441, 0x38461, 0x38481,
+    0x384a1, 0x384c1, 0x384e1, 0x38501, 0x38521, 0x38541,
+    0x38561, 0x38581, 0x385a1, 0x385c1, 0x385e1, 0x38601,
+    0x38621, 0x38641, 0x38661, 0x38681, 0x386a1, 0x386c1,
+    0x386e1, 0x38701, 0x38721, 0x38741, 0x38761, 0x38781,
+    0x387a1, 0x387c1, 0x387e1, 0x38801, 0x38821, 0x38841,
+    0x38861, 0x38881, 0x388a1, 0x388c1, 0x388e1, 0x38901,
+    0x38921, 0x38941, 0x38961, 0x38981, 0x389a1, 0x389c1,
+    0x389e1, 0x38a01, 0x38a21, 0x38a41, 0x38a61, 0x38a81,
+    0x38aa1, 0x38ac1, 0x38ae1, 0x38b01, 0x38b21, 0x38b41,
+    0x38b61, 0x38b81, 0x38ba1, 0x38bc1, 0x38be1, 0x38c01,
+    0x38c21, 0x38c41, 0x38c61, 0x38c81, 0x38ca1, 0x38cc1,
+    0x38ce1, 0x38d01, 0x38d21, 0x38d41, 0x38d61, 0x38d81,
+    0x38da1, 0x38dc1, 0x38de1, 0x38e01, 0x38e21, 0x38e41,
+    0x38e61, 0x38e81, 0x38ea1, 0x38ec1, 0x38ee1, 0x38f01,
+    0x38f21, 0x38f41, 0x38f61, 0x38f81, 0x38fa1, 0x38fc1,
+    0x38fe1, 0x39001, 0x39021, 0x39041, 0x39061, 0x39081,
+    0x390a1, 0x390c1, 0x390e1, 0x39101, 0x39121, 0x39141,
+    0x39161, 0x39181, 0x391a1, 0x391c1, 0x391e1, 0x39201,
+    0x39221, 0x39241, 0x39261, 0x39281, 0x392a1, 0x392c1,
+    0x392e1, 0x39301, 0x39321, 0x39341, 0x39361, 0x39381,
+    0x393a1, 0x393c1, 0x393e1, 0x39401, 0x39421, 0x39441,
+    0x39461, 0x39481, 0x394a1, 0x394c1, 0x394e1, 0x39501,
+    0x39521, 0x39541, 0x39561, 0x39581, 0x395a1, 0x395c1,
+    0x395e1, 0x39601, 0x39621, 0x39641, 0x39661, 0x39681,
+    0x396a1, 0x396c1, 0x396e1, 0x39701, 0x39721, 0x39741,
+    0x39761, 0x39781, 0x397a1, 0x397c1, 0x397e1, 0x39801,
+    0x39821, 0x39841, 0x39861, 0x39881, 0x398a1, 0x398c1,
+    0x398e1, 0x39901, 0x39921, 0x39941, 0x39961, 0x39981,
+    0x399a1, 0x399c1, 0x399e1, 0x39a01, 0x39a21, 0x39a41,
+    0x39a61, 0x39a81, 0x39aa1, 0x39ac1, 0x39ae1, 0x39b01,
+    0x39b21, 0x39b41, 0x39b61, 0x39b81, 0x39ba1, 0x39bc1,
+    0x39be1, 0x39c01, 0x39c21, 0x39c41, 0x39c61, 0x39c81,
+    0x39ca1, 0x39cc1, 0x39ce1, 0x39d01, 0x39d21, 0x39d41,
+    0x39d61, 0x39d81, 0x39da1, 0x39dc1, 0x39de1, 0x39e01,
+    0x39e21, 0x39e41, 0x39e61, 0x39e81, 0x39ea1, 0x39ec1,
+    0x39ee1, 0x39f01, 0x39f21, 0x39f41, 0x39f61, 0x39f81,
+    0x39fa1, 0x39fc1, 0x39fe1, 0x3a001, 0x3a021, 0x3a041,
+    0x3a061, 0x3a081, 0x3a0a1, 0x3a0c1, 0x3a0e1, 0x3a101,
+    0x3a121, 0x3a141, 0x3a161, 0x3a181, 0x3a1a1, 0x3a1c1,
+    0x3a1e1, 0x3a201, 0x3a221, 0x3a241, 0x3a261, 0x3a281,
+    0x3a2a1, 0x3a2c1, 0x3a2e1, 0x3a301, 0x3a321, 0x3a341,
+    0x3a361, 0x3a381, 0x3a3a1, 0x3a3c1, 0x3a3e1, 0x3a401,
+    0x3a421, 0x3a441, 0x3a461, 0x3a481, 0x3a4a1, 0x3a4c1,
+    0x3a4e1, 0x3a501, 0x3a521, 0x3a541, 0x3a561, 0x3a581,
+    0x3a5a1, 0x3a5c1, 0x3a5e1, 0x3a601, 0x3a621, 0x3a641,
+    0x3a661, 0x3a681, 0x3a6a1, 0x3a6c1, 0x3a6e1, 0x3a701,
+    0x3a721, 0x3a741, 0x3a761, 0x3a781, 0x3a7a1, 0x3a7c1,
+    0x3a7e1, 0x3a801, 0x3a821, 0x3a841, 0x3a861, 0x3a881,
+    0x3a8a1, 0x3a8c1, 0x3a8e1, 0x3a901, 0x3a921, 0x3a941,
+    0x3a961, 0x3a981, 0x3a9a1, 0x3a9c1, 0x3a9e1, 0x3aa01,
+    0x3aa21, 0x3aa41, 0x3aa61, 0x3aa81, 0x3aaa1, 0x3aac1,
+    0x3aae1, 0x3ab01, 0x3ab21, 0x3ab41, 0x3ab61, 0x3ab81,
+    0x3aba1, 0x3abc1, 0x3abe1, 0x3ac01, 0x3ac21, 0x3ac41,
+    0x3ac61, 0x3ac81, 0x3aca1, 0x3acc1, 0x3ace1, 0x3ad01,
+    0x3ad21, 0x3ad41, 0x3ad61, 0x3ad81, 0x3ada1, 0x3adc1,
+    0x3ade1, 0x3ae01, 0x3ae21, 0x3ae41, 0x3ae61, 0x3ae81,
+    0x3aea1, 0x3aec1, 0x3aee1, 0x3af01, 0x3af21, 0x3af41,
+    0x3af61, 0x3af81, 0x3afa1, 0x3afc1, 0x3afe1, 0x3b001,
+    0x3b021, 0x3b041, 0x3b061, 0x3b081, 0x3b0a1, 0x3b0c1,
+    0x3b0e1, 0x3b101, 0x3b121, 0x3b141, 0x3b161, 0x3b181,
+    0x3b1a1, 0x3b1c1, 0x3b1e1, 0x3b201, 0x3b221, 0x3b241,
+    0x3b261, 0x3b281, 0x3b2a1, 0x3b2c1, 0x3b2e1, 0x3b301,
+    0x3b321, 0x3b341, 0x3b361, 0x3b381, 0x3b3a1, 0x3b3c1,
+    0x3b3e1, 0x3b401, 0x3b421, 0x3b441, 0x3b461, 0x3b481,
+    0x3b4a1, 0x3b4c1, 0x3b4e1, 0x3b501, 0x3b521, 0x3b541,
+    0x3b561, 0x3b581, 0x3b5a1, 0x3b5c1, 0x3b5e1, 0x3b601,
+    0x3b621, 0x3b641, 0x3b661, 0x3b681, 0x3b6a1, 0x3b6c1,
+    0x3b6e1, 0x3b701, 0x3b721, 0x3b741, 0x3b761, 0x3b781,
+    0x3b7a1, 0x3b7c1, 0x3b7e1, 0x3b801, 0x3b821, 0x3b841,
+    0x3b861, 0x3b881, 0x3b8a1, 0x3b8c1, 0x3b8e1, 0x3b901,
+    0x3b921, 0x3b941, 0x3b961, 0x3b981, 0x3b9a1, 0x3b9c1,
+    0x3b9e1, 0x3ba01, 0x3ba21, 0x3ba41, 0x3ba61, 0x3ba81,
+    0x3baa1, 0x3bac1, 0x3bae1, 0x3bb01, 0x3bb21, 0x3bb41,
+    0x3bb61, 0x3bb81, 0x3bba1, 0x3bbc1, 0x3bbe1, 0x3bc01,
+    0x3bc21, 0x3bc41, 0x3bc61, 0x3bc81, 0x3bca1, 0x3bcc1,
+    0x3bce1, 0x3bd01, 0x3bd21, 0x3bd41, 0x3bd61, 0x3bd81,
+    0x3bda1, 0x3bdc1, 0x3bde1, 0x3be01, 0x3be21, 0x3be41,
+    0x3be61, 0x3be81, 0x3bea1, 0x3bec1, 0x3bee1, 0x3bf01,
+    0x3bf21, 0x3bf41, 0x3bf61, 0x3bf81, 0x3bfa1, 0x3bfc1,
+    0x3bfe1, 0x3c001, 0x3c021, 0x3c041, 0x3c061, 0x3c081,
+    0x3c0a1, 0x3c0c1, 0x3c0e1, 0x3c101, 0x3c121, 0x3c141,
+    0x3c161, 0x3c181, 0x3c1a1, 0x3c1c1, 0x3c1e1, 0x3c201,
+    0x3c221, 0x3c241, 0x3c261, 0x3c281, 0x3c2a1, 0x3c2c1,
+    0x3c2e1, 0x3c301, 0x3c321, 0x3c341, 0x3c361, 0x3c381,
+    0x3c3a1, 0x3c3c1, 0x3c3e1, 0x3c401, 0x3c421, 0x3c441,
+    0x3c461, 0x3c481, 0x3c4a1, 0x3c4c1, 0x3c4e1, 0x3c501,
+    0x3c521, 0x3c541, 0x3c561, 0x3c581, 0x3c5a1, 0x3c5c1,
+    0x3c5e1, 0x3c601, 0x3c621, 0x3c641, 0x3c661, 0x3c681,
+    0x3c6a1, 0x3c6c1, 0x3c6e1, 0x3c701, 0x3c721, 0x3c741,
+    0x3c761, 0x3c781, 0x3c7a1, 0x3c7c1, 0x3c7e1, 0x3c801,
+    0x3c821, 0x3c841, 0x3c861, 0x3c881, 0x3c8a1, 0x3c8c1,
+    0x3c8e1, 0x3c901, 0x3c921, 0x3c941, 0x3c961, 0x3c981,
+    0x3c9a1, 0x3c9c1, 0x3c9e1, 0x3ca01, 0x3ca21, 0x3ca41,
+    0x3ca61, 0x3ca81, 0x3caa1, 0x3cac1, 0x3cae1, 0x3cb01,
+    0x3cb21, 0x3cb41, 0x3cb61, 0x3cb81, 0x3cba1, 0x3cbc1,
+    0x3cbe1, 0x3cc01, 0x3cc21, 0x3cc41, 0x3cc61, 0x3cc81,
+    0x3cca1, 0x3ccc1, 0x3cce1, 0x3cd01, 0x3cd21, 0x3cd41,
+    0x3cd61, 0x3cd81, 0x3cda1, 0x3cdc1, 0x3cde1, 0x3ce01,
+    0x3ce21, 0x3ce41, 0x3ce61, 0x3ce81, 0x3cea1, 0x3cec1,
+    0x3cee1, 0x3cf01, 0x3cf21, 0x3cf41, 0x3cf61, 0x3cf81,
+    0x3cfa1, 0x3cfc1, 0x3cfe1, 0x3d001, 0x3d021, 0x3d041,
+    0x3d061, 0x3d081, 0x3d0a1, 0x3d0c1, 0x3d0e1, 0x3d101,
+    0x3d121, 0x3d141, 0x3d161, 0x3d181, 0x3d1a1, 0x3d1c1,
+    0x3d1e1, 0x3d201, 0x3d221, 0x3d241, 0x3d261, 0x3d281,
+    0x3d2a1, 0x3d2c1, 0x3d2e1, 0x3d301, 0x3d321, 0x3d341,
+    0x3d361, 0x3d381, 0x3d3a1, 0x3d3c1, 0x3d3e1, 0x3d401,
+    0x3d421, 0x3d441, 0x3d461, 0x3d481, 0x3d4a1, 0x3d4c1,
+    0x3d4e1, 0x3d501, 0x3d521, 0x3d541, 0x3d561, 0x3d581,
+    0x3d5a1, 0x3d5c1, 0x3d5e1, 0x3d601, 0x3d621, 0x3d641,
+    0x3d661, 0x3d681, 0x3d6a1, 0x3d6c1, 0x3d6e1, 0x3d701,
+    0x3d721, 0x3d741, 0x3d761, 0x3d781, 0x3d7a1, 0x3d7c1,
+    0x3d7e1, 0x3d801, 0x3d821, 0x3d841, 0x3d861, 0x3d881,
+    0x3d8a1, 0x3d8c1, 0x3d8e1, 0x3d901, 0x3d921, 0x3d941,
+    0x3d961, 0x3d981, 0x3d9a1, 0x3d9c1, 0x3d9e1, 0x3da01,
+    0x3da21, 0x3da41, 0x3da61, 0x3da81, 0x3daa1, 0x3dac1,
+    0x3dae1, 0x3db01, 0x3db21, 0x3db41, 0x3db61, 0x3db81,
+    0x3dba1, 0x3dbc1, 0x3dbe1, 0x3dc01, 0x3dc21, 0x3dc41,
+    0x3dc61, 0x3dc81, 0x3dca1, 0x3dcc1, 0x3dce1, 0x3dd01,
+    0x3dd21, 0x3dd41, 0x3dd61, 0x3dd81, 0x3dda1, 0x3ddc1,
+    0x3dde1, 0x3de01, 0x3de21, 0x3de41, 0x3de61, 0x3de81,
+    0x3dea1, 0x3dec1, 0x3dee1, 0x3df01, 0x3df21, 0x3df41,
+    0x3df61, 0x3df81, 0x3dfa1, 0x3dfc1, 0x3dfe1, 0x3e001,
+    0x3e021, 0x3e041, 0x3e061, 0x3e081, 0x3e0a1, 0x3e0c1,
+    0x3e0e1, 0x3e101, 0x3e121, 0x3e141, 0x3e161, 0x3e181,
+    0x3e1a1, 0x3e1c1, 0x3e1e1, 0x3e201, 0x3e221, 0x3e241,
+    0x3e261, 0x3e281, 0x3e2a1, 0x3e2c1, 0x3e2e1, 0x3e301,
+    0x3e321, 0x3e341, 0x3e361, 0x3e381, 0x3e3a1, 0x3e3c1,
+    0x3e3e1, 0x3e401, 0x3e421, 0x3e441, 0x3e461, 0x3e481,
+    0x3e4a1, 0x3e4c1, 0x3e4e1, 0x3e501, 0x3e521, 0x3e541,
+    0x3e561, 0x3e581, 0x3e5a1, 0x3e5c1, 0x3e5e1, 0x3e601,
+    0x3e621, 0x3e641, 0x3e661, 0x3e681, 0x3e6a1, 0x3e6c1,
+    0x3e6e1, 0x3e701, 0x3e721, 0x3e741, 0x3e761, 0x3e781,
+    0x3e7a1, 0x3e7c1, 0x3e7e1, 0x3e801, 0x3e821, 0x3e841,
+    0x3e861, 0x3e881, 0x3e8a1, 0x3e8c1, 0x3e8e1, 0x3e901,
+    0x3e921, 0x3e941, 0x3e961, 0x3e981, 0x3e9a1, 0x3e9c1,
+    0x3e9e1, 0x3ea01, 0x3ea21, 0x3ea41, 0x3ea61, 0x3ea81,
+    0x3eaa1, 0x3eac1, 0x3eae1, 0x3eb01, 0x3eb21, 0x3eb41,
+    0x3eb61, 0x3eb81, 0x3eba1, 0x3ebc1, 0x3ebe1, 0x3ec01,
+    0x3ec21, 0x3ec41, 0x3ec61, 0x3ec81, 0x3eca1, 0x3ecc1,
+    0x3ece1, 0x3ed01, 0x3ed21, 0x3ed41, 0x3ed61, 0x3ed81,
+    0x3eda1, 0x3edc1, 0x3ede1, 0x3ee01, 0x3ee21, 0x3ee41,
+    0x3ee61, 0x3ee81, 0x3eea1, 0x3eec1, 0x3eee1, 0x3ef01,
+    0x3ef21, 0x3ef41, 0x3ef61, 0x3ef81, 0x3efa1, 0x3efc1,
+    0x3efe1, 0x3f001, 0x3f021, 0x3f041, 0x3f061, 0x3f081,
+    0x3f0a1, 0x3f0c1, 0x3f0e1, 0x3f101, 0x3f121, 0x3f141,
+    0x3f161, 0x3f181, 0x3f1a1, 0x3f1c1, 0x3f1e1, 0x3f201,
+    0x3f221, 0x3f241, 0x3f261, 0x3f281, 0x3f2a1, 0x3f2c1,
+    0x3f2e1, 0x3f301, 0x3f321, 0x3f341, 0x3f361, 0x3f381,
+    0x3f3a1, 0x3f3c1, 0x3f3e1, 0x3f401, 0x3f421, 0x3f441,
+    0x3f461, 0x3f481, 0x3f4a1, 0x3f4c1, 0x3f4e1, 0x3f501,
+    0x3f521, 0x3f541, 0x3f561, 0x3f581, 0x3f5a1, 0x3f5c1,
+    0x3f5e1, 0x3f601, 0x3f621, 0x3f641, 0x3f661, 0x3f681,
+    0x3f6a1, 0x3f6c1, 0x3f6e1, 0x3f701, 0x3f721, 0x3f741,
+    0x3f761, 0x3f781, 0x3f7a1, 0x3f7c1, 0x3f7e1, 0x3f801,
+    0x3f821, 0x3f841, 0x3f861, 0x3f881, 0x3f8a1, 0x3f8c1,
+    0x3f8e1, 0x3f901, 0x3f921, 0x3f941, 0x3f961, 0x3f981,
+    0x3f9a1, 0x3f9c1, 0x3f9e1, 0x3fa01, 0x3fa21, 0x3fa41,
+    0x3fa61, 0x3fa81, 0x3faa1, 0x3fac1, 0x3fae1, 0x3fb01,
+    0x3fb21, 0x3fb41, 0x3fb61, 0x3fb81, 0x3fba1, 0x3fbc1,
+    0x3fbe1, 0x3fc01, 0x3fc21, 0x3fc41, 0x3fc61, 0x3fc81,
+    0x3fca1, 0x3fcc1, 0x3fce1, 0x3fd01, 0x3fd21, 0x3fd41,
+    0x3fd61, 0x3fd81, 0x3fda1, 0x3fdc1, 0x3fde1, 0x3fe01,
+    0x3fe21, 0x3fe41, 0x3fe61, 0x3fe81, 0x3fea1, 0x3fec1,
+    0x3fee1, 0x3ff01, 0x3ff21, 0x3ff41, 0x3ff61, 0x3ff81,
+    0x3ffa1, 0x3ffc1, 0x3ffe1, 0x40001, 0x40021, 0x40041,
+    0x40061, 0x40081, 0x400a1, 0x400c1, 0x400e1, 0x40101,
+    0x40121, 0x40141, 0x40161, 0x40181, 0x401a1, 0x401c1,
+    0x401e1, 0x40201, 0x40221, 0x40241, 0x40261, 0x40281,
+    0x402a1, 0x402c1, 0x402e1, 0x40301, 0x40321, 0x40341,
+    0x40361, 0x40381, 0x403a1, 0x403c1, 0x403e1, 0x40401,
+    0x40421, 0x40441, 0x40461, 0x40481, 0x404a1, 0x404c1,
+    0x404e1, 0x40501, 0x40521, 0x40541, 0x40561, 0x40581,
+    0x405a1, 0x405c1, 0x405e1, 0x40601, 0x40621, 0x40641,
+    0x40661, 0x40681, 0x406a1, 0x406c1, 0x406e1, 0x40701,
+    0x40721, 0x40741, 0x40761, 0x40781, 0x407a1, 0x407c1,
+    0x407e1, 0x40801, 0x40821, 0x40841, 0x40861, 0x40881,
+    0x408a1, 0x408c1, 0x408e1, 0x40901, 0x40921, 0x40941,
+    0x40961, 0x40981, 0x409a1, 0x409c1, 0x409e1, 0x40a01,
+    0x40a21, 0x40a41, 0x40a61, 0x40a81, 0x40aa1, 0x40ac1,
+    0x40ae1, 0x40b01, 0x40b21, 0x40b41, 0x40b61, 0x40b81,
+    0x40ba1, 0x40bc1, 0x40be1, 0x40c01, 0x40c21, 0x40c41,
+    0x40c61, 0x40c82, 0x40cc2, 0x40d02, 0x40d42, 0x40d82,
+    0x40dc2, 0x40e02, 0x40e42, 0x40e82, 0x40ec2, 0x40f02,
+    0x40f43, 0x40fa3, 0x41003, 0x41063, 0x410c3, 0x41123,
+    0x41183, 0x411e3, 0x41243, 0x412a3, 0x41303, 0x41363,
+    0x413c3, 0x41423, 0x41483, 0x414e3, 0x41543, 0x415a3,
+    0x41603, 0x41663, 0x416c3, 0x41723, 0x41783, 0x417e3,
+    0x41843, 0x418a3, 0x41903, 0x41961, 0x41981, 0x419a2,
+    0x419e2, 0x41a21, 0x41a41, 0x41a61, 0x41a81, 0x41aa1,
+    0x41ac1, 0x41ae1, 0x41b01, 0x41b21, 0x41b41, 0x41b61,
+    0x41b81, 0x41ba1, 0x41bc1, 0x41be1, 0x41c01, 0x41c21,
+    0x41c41, 0x41c61, 0x41c81, 0x41ca1, 0x41cc1, 0x41ce1,
+    0x41d01, 0x41d21, 0x41d41, 0x41d62, 0x41da2, 0x41de2,
+    0x41e22, 0x41e63, 0x41ec2, 0x41f02, 0x41f42, 0x41f82,
+    0x41fc2, 0x42002, 0x42042, 0x42081, 0x420a1, 0x420c1,
+    0x420e1, 0x42102, 0x42141, 0x42161, 0x42181, 0x421a1,
+    0x421c1, 0x421e1, 0x42201, 0x42221, 0x42241, 0x42261,
+    0x42281, 0x422a1, 0x422c1, 0x422e1, 0x42301, 0x42321,
+    0x42341, 0x42361, 0x42381, 0x423a1, 0x423c1, 0x423e1,
+    0x42401, 0x42421, 0x42441, 0x42461, 0x42481, 0x424a1,
+    0x424c1, 0x424e1, 0x42501, 0x42521, 0x42541, 0x42561,
+    0x42581, 0x425a1, 0x425c1, 0x425e1, 0x42601, 0x42621,
+    0x42643, 0x426a3, 0x42703, 0x42763, 0x427c3, 0x42823,
+    0x42883, 0x428e3, 0x42943, 0x429a1, 0x429c1, 0x429e1,
+    0x42a01, 0x42a21, 0x42a41, 0x42a61, 0x42a81, 0x42aa1,
+    0x42ac1, 0x42ae1, 0x42b01, 0x42b21, 0x42b41, 0x42b61,
+    0x42b81, 0x42ba1, 0x42bc1, 0x42be1, 0x42c01, 0x42c21,
+    0x42c41, 0x42c61, 0x42c81, 0x42ca1, 0x42cc1, 0x42ce1,
+    0x42d01, 0x42d21, 0x42d41, 0x42d61, 0x42d81, 0x42da1,
+    0x42dc1, 0x42de1, 0x42e01, 0x42e21, 0x42e41, 0x42e61,
+    0x42e81, 0x42ea1, 0x42ec1, 0x42ee1, 0x42f01, 0x42f21,
+    0x42f41, 0x42f61, 0x42f81, 0x42fa1, 0x42fc1, 0x42fe1,
+    0x43001, 0x43021, 0x43041, 0x43061, 0x43081, 0x430a1,
+    0x430c1, 0x430e1, 0x43101, 0x43121, 0x43141, 0x43161,
+    0x43181, 0x431a1, 0x431c1, 0x431e1, 0x43201, 0x43221,
+    0x43241, 0x43261, 0x43281, 0x432a1, 0x432c1, 0x432e1,
+    0x43301, 0x43321, 0x43341, 0x43361, 0x43381, 0x433a1,
+    0x433c1, 0x433e1, 0x43401, 0x43421, 0x43441, 0x43461,
+    0x43481, 0x434a1, 0x434c1, 0x434e1, 0x43501, 0x43521,
+    0x43541, 0x43561, 0x43581, 0x435a1, 0x435c1, 0x435e1,
+    0x43601, 0x43621, 0x43641, 0x43661, 0x43681, 0x436a1,
+    0x436c1, 0x436e1, 0x43701, 0x43721, 0x43741, 0x43761,
+    0x43781, 0x437a1, 0x437c1, 0x437e1, 0x43801, 0x43821,
+    0x43841, 0x43861, 0x43881, 0x438a1, 0x438c1, 0x438e1,
+    0x43901, 0x43921, 0x43941, 0x43961, 0x43981, 0x439a1,
+    0x439c1, 0x439e1, 0x43a01, 0x43a21, 0x43a41, 0x43a61,
+    0x43a81, 0x43aa1, 0x43ac1, 0x43ae1, 0x43b01, 0x43b21,
+    0x43b41, 0x43b61, 0x43b81, 0x43ba1, 0x43bc1, 0x43be1,
+    0x43c01, 0x43c21, 0x43c41, 0x43c61, 0x43c81, 0x43ca1,
+    0x43cc1, 0x43ce1, 0x43d01, 0x43d21, 0x43d41, 0x43d61,
+    0x43d81, 0x43da1, 0x43dc1, 0x43de1, 0x43e01, 0x43e21,
+    0x43e41, 0x43e61, 0x43e81, 0x43ea1, 0x43ec1, 0x43ee1,
+    0x43f01, 0x43f21, 0x43f41, 0x43f61, 0x43f81, 0x43fa1,
+    0x43fc1, 0x43fe1, 0x44001, 0x44021, 0x44041, 0x44061,
+    0x44081, 0x440a1, 0x440c1, 0x440e1, 0x44101, 0x44121,
+    0x44141, 0x44161, 0x44181, 0x441a1, 0x441c1, 0x441e1,
+    0x44201, 0x44221, 0x44241, 0x44261, 0x44281, 0x442a1,
+    0x442c1, 0x442e1, 0x44301, 0x44321, 0x44341, 0x44361,
+    0x44381, 0x443a1, 0x443c1, 0x443e1, 0x44401, 0x44421,
+    0x44441, 0x44461, 0x44481, 0x444a1, 0x444c1, 0x444e1,
+    0x44501, 0x44521, 0x44541, 0x44561, 0x44581, 0x445a1,
+    0x445c1, 0x445e1, 0x44601, 0x44621, 0x44641, 0x44661,
+    0x44681, 0x446a1, 0x446c1, 0x446e1, 0x44701, 0x44721,
+    0x44741, 0x44761, 0x44781, 0x447a1, 0x447c1, 0x447e1,
+    0x44801, 0x44821, 0x44841, 0x44861, 0x44881, 0x448a1,
+    0x448c1, 0x448e1, 0x44901, 0x44921, 0x44941, 0x44961,
+    0x44981, 0x449a1, 0x449c1, 0x449e1, 0x44a01, 0x44a21,
+    0x44a41, 0x44a61, 0x44a81, 0x44aa1, 0x44ac1, 0x44ae1,
+    0x44b01, 0x44b21, 0x44b41, 0x44b61, 0x44b81, 0x44ba1,
+    0x44bc1, 0x44be1, 0x44c01, 0x44c21, 0x44c41, 0x44c61,
+    0x44c81, 0x44ca1, 0x44cc1, 0x44ce1, 0x44d01, 0x44d21,
+    0x44d41, 0x44d61, 0x44d81, 0x44da1, 0x44dc1, 0x44de1,
+    0x44e01, 0x44e21, 0x44e41, 0x44e61, 0x44e81, 0x44ea1,
+    0x44ec1, 0x44ee1, 0x44f01, 0x44f21, 0x44f41, 0x44f61,
+    0x44f81, 0x44fa1, 0x44fc1, 0x44fe1, 0x45001, 0x45021,
+    0x45041, 0x45061, 0x45081, 0x450a1, 0x450c1, 0x450e1,
+    0x45101, 0x45121, 0x45141, 0x45161, 0x45181, 0x451a1,
+    0x451c1, 0x451e1, 0x45201, 0x45221, 0x45241, 0x45261,
+    0x45281, 0x452a1, 0x452c1, 0x452e1, 0x45301, 0x45321,
+    0x45341, 0x45361, 0x45381, 0x453a1, 0x453c1, 0x453e1,
+    0x45401, 0x45421, 0x45441, 0x45461, 0x45481, 0x454a1,
+    0x454c1, 0x454e1, 0x45501, 0x45521, 0x45541, 0x45561,
+    0x45581, 0x455a1, 0x455c1, 0x455e1, 0x45601, 0x45621,
+    0x45641, 0x45661, 0x45681, 0x456a1, 0x456c1, 0x456e1,
+    0x45701, 0x45721, 0x45741, 0x45761, 0x45781, 0x457a1,
+    0x457c1, 0x457e1, 0x45801, 0x45821, 0x45841, 0x45861,
+    0x45881, 0x458a1, 0x458c1, 0x458e1, 0x45901, 0x45921,
+    0x45941, 0x45961, 0x45981, 0x459a1, 0x459c1, 0x459e1,
+    0x45a01, 0x45a21, 0x45a41, 0x45a61, 0x45a81, 0x45aa1,
+    0x45ac1, 0x45ae1, 0x45b01, 0x45b21, 0x45b41, 0x45b61,
+    0x45b81, 0x45ba1, 0x45bc1, 0x45be1, 0x45c01, 0x45c21,
+    0x45c41, 0x45c61, 0x45c81, 0x45ca1, 0x45cc1, 0x45ce1,
+    0x45d01, 0x45d21, 0x45d41, 0x45d61, 0x45d81, 0x45da1,
+    0x45dc1, 0x45de1, 0x45e01, 0x45e21, 0x45e41, 0x45e61,
+    0x45e81, 0x45ea1, 0x45ec1, 0x45ee1, 0x45f01, 0x45f21,
+    0x45f41, 0x45f61, 0x45f81, 0x45fa1, 0x45fc1, 0x45fe1,
+    0x46001, 0x46021, 0x46041, 0x46061, 0x46081, 0x460a1,
+    0x460c1, 0x460e1, 0x46101, 0x46121, 0x46141, 0x46161,
+    0x46181, 0x461a1, 0x461c1, 0x461e1, 0x46201, 0x46221,
+    0x46241, 0x46261, 0x46281, 0x462a1, 0x462c1, 0x462e1,
+    0x46301, 0x46321, 0x46341, 0x46361, 0x46381, 0x463a1,
+    0x463c1, 0x463e1, 0x46401, 0x46421, 0x46441, 0x46461,
+    0x46481, 0x464a1, 0x464c1, 0x464e1, 0x46501, 0x46521,
+    0x46541, 0x46561, 0x46581, 0x465a1, 0x465c1, 0x465e1,
+    0x46601, 0x46621, 0x46641, 0x46661, 0x46681, 0x466a1,
+    0x466c1, 0x466e1, 0x46701, 0x46721, 0x46741, 0x46761,
+    0x46781, 0x467a1, 0x467c1, 0x467e1, 0x46801, 0x46821,
+    0x46841, 0x46861, 0x46881, 0x468a1, 0x468c1, 0x468e1,
+    0x46901, 0x46921, 0x46941, 0x46961, 0x46981, 0x469a1,
+    0x469c1, 0x469e1, 0x46a01, 0x46a21, 0x46a41, 0x46a61,
+    0x46a81, 0x46aa1, 0x46ac1, 0x46ae1, 0x46b01, 0x46b21,
+    0x46b41, 0x46b61, 0x46b81, 0x46ba1, 0x46bc1, 0x46be1,
+    0x46c01, 0x46c21, 0x46c41, 0x46c61, 0x46c81, 0x46ca1,
+    0x46cc1, 0x46ce1, 0x46d01, 0x46d21, 0x46d41, 0x46d61,
+    0x46d81, 0x46da1, 0x46dc1, 0x46de1, 0x46e01, 0x46e21,
+    0x46e41, 0x46e61, 0x46e81, 0x46ea1, 0x46ec1
+};
+
+const uint32_t norm_comps[ 2823 ] = {
+    0x3c, 0x338, 0x226e, 0x3d, 0x338, 0x2260,
+    0x3e, 0x338, 0x226f, 0x41, 0x300, 0xc0,
+    0x41, 0x301, 0xc1, 0x41, 0x302, 0xc2,
+    0x41, 0x303, 0xc3, 0x41, 0x304, 0x100,
+    0x41, 0x306, 0x102, 0x41, 0x307, 0x226,
+    0x41, 0x308, 0xc4, 0x41, 0x309, 0x1ea2,
+    0x41, 0x30a, 0xc5, 0x41, 0x30c, 0x1cd,
+    0x41, 0x30f, 0x200, 0x41, 0x311, 0x202,
+    0x41, 0x323, 0x1ea0, 0x41, 0x325, 0x1e00,
+    0x41, 0x328, 0x104, 0x42, 0x307, 0x1e02,
+    0x42, 0x323, 0x1e04, 0x42, 0x331, 0x1e06,
+    0x43, 0x301, 0x106, 0x43, 0x302, 0x108,
+    0x43, 0x307, 0x10a, 0x43, 0x30c, 0x10c,
+    0x43, 0x327, 0xc7, 0x44, 0x307, 0x1e0a,
+    0x44, 0x30c, 0x10e, 0x44, 0x323, 0x1e0c,
+    0x44, 0x327, 0x1e10, 0x44, 0x32d, 0x1e12,
+    0x44, 0x331, 0x1e0e, 0x45, 0x300, 0xc8,
+    0x45, 0x301, 0xc9, 0x45, 0x302, 0xca,
+    0x45, 0x303, 0x1ebc, 0x45, 0x304, 0x112,
+    0x45, 0x306, 0x114, 0x45, 0x307, 0x116,
+    0x45, 0x308, 0xcb, 0x45, 0x309, 0x1eba,
+    0x45, 0x30c, 0x11a, 0x45, 0x30f, 0x204,
+    0x45, 0x311, 0x206, 0x45, 0x323, 0x1eb8,
+    0x45, 0x327, 0x228, 0x45, 0x328, 0x118,
+    0x45, 0x32d, 0x1e18, 0x45, 0x330, 0x1e1a,
+    0x46, 0x307, 0x1e1e, 0x47, 0x301, 0x1f4,
+    0x47, 0x302, 0x11c, 0x47, 0x304, 0x1e20,
+    0x47, 0x306, 0x11e, 0x47, 0x307, 0x120,
+    0x47, 0x30c, 0x1e6, 0x47, 0x327, 0x122,
+    0x48, 0x302, 0x124, 0x48, 0x307, 0x1e22,
+    0x48, 0x308, 0x1e26, 0x48, 0x30c, 0x21e,
+    0x48, 0x323, 0x1e24, 0x48, 0x327, 0x1e28,
+    0x48, 0x32e, 0x1e2a, 0x49, 0x300, 0xcc,
+    0x49, 0x301, 0xcd, 0x49, 0x302, 0xce,
+    0x49, 0x303, 0x128, 0x49, 0x304, 0x12a,
+    0x49, 0x306, 0x12c, 0x49, 0x307, 0x130,
+    0x49, 0x308, 0xcf, 0x49, 0x309, 0x1ec8,
+    0x49, 0x30c, 0x1cf, 0x49, 0x30f, 0x208,
+    0x49, 0x311, 0x20a, 0x49, 0x323, 0x1eca,
+    0x49, 0x328, 0x12e, 0x49, 0x330, 0x1e2c,
+    0x4a, 0x302, 0x134, 0x4b, 0x301, 0x1e30,
+    0x4b, 0x30c, 0x1e8, 0x4b, 0x323, 0x1e32,
+    0x4b, 0x327, 0x136, 0x4b, 0x331, 0x1e34,
+    0x4c, 0x301, 0x139, 0x4c, 0x30c, 0x13d,
+    0x4c, 0x323, 0x1e36, 0x4c, 0x327, 0x13b,
+    0x4c, 0x32d, 0x1e3c, 0x4c, 0x331, 0x1e3a,
+    0x4d, 0x301, 0x1e3e, 0x4d, 0x307, 0x1e40,
+    0x4d, 0x323, 0x1e42, 0x4e, 0x300, 0x1f8,
+    0x4e, 0x301, 0x143, 0x4e, 0x303, 0xd1,
+    0x4e, 0x307, 0x1e44, 0x4e, 0x30c, 0x147,
+    0x4e, 0x323, 0x1e46, 0x4e, 0x327, 0x145,
+    0x4e, 0x32d, 0x1e4a, 0x4e, 0x331, 0x1e48,
+    0x4f, 0x300, 0xd2, 0x4f, 0x301, 0xd3,
+    0x4f, 0x302, 0xd4, 0x4f, 0x303, 0xd5,
+    0x4f, 0x304, 0x14c, 0x4f, 0x306, 0x14e,
+    0x4f, 0x307, 0x22e, 0x4f, 0x308, 0xd6,
+    0x4f, 0x309, 0x1ece, 0x4f, 0x30b, 0x150,
+    0x4f, 0x30c, 0x1d1, 0x4f, 0x30f, 0x20c,
+    0x4f, 0x311, 0x20e, 0x4f, 0x31b, 0x1a0,
+    0x4f, 0x323, 0x1ecc, 0x4f, 0x328, 0x1ea,
+    0x50, 0x301, 0x1e54, 0x50, 0x307, 0x1e56,
+    0x52, 0x301, 0x154, 0x52, 0x307, 0x1e58,
+    0x52, 0x30c, 0x158, 0x52, 0x30f, 0x210,
+    0x52, 0x311, 0x212, 0x52, 0x323, 0x1e5a,
+    0x52, 0x327, 0x156, 0x52, 0x331, 0x1e5e,
+    0x53, 0x301, 0x15a, 0x53, 0x302, 0x15c,
+    0x53, 0x307, 0x1e60, 0x53, 0x30c, 0x160,
+    0x53, 0x323, 0x1e62, 0x53, 0x326, 0x218,
+    0x53, 0x327, 0x15e, 0x54, 0x307, 0x1e6a,
+    0x54, 0x30c, 0x164, 0x54, 0x323, 0x1e6c,
+    0x54, 0x326, 0x21a, 0x54, 0x327, 0x162,
+    0x54, 0x32d, 0x1e70, 0x54, 0x331, 0x1e6e,
+    0x55, 0x300, 0xd9, 0x55, 0x301, 0xda,
+    0x55, 0x302, 0xdb, 0x55, 0x303, 0x168,
+    0x55, 0x304, 0x16a, 0x55, 0x306, 0x16c,
+    0x55, 0x308, 0xdc, 0x55, 0x309, 0x1ee6,
+    0x55, 0x30a, 0x16e, 0x55, 0x30b, 0x170,
+    0x55, 0x30c, 0x1d3, 0x55, 0x30f, 0x214,
+    0x55, 0x311, 0x216, 0x55, 0x31b, 0x1af,
+    0x55, 0x323, 0x1ee4, 0x55, 0x324, 0x1e72,
+    0x55, 0x328, 0x172, 0x55, 0x32d, 0x1e76,
+    0x55, 0x330, 0x1e74, 0x56, 0x303, 0x1e7c,
+    0x56, 0x323, 0x1e7e, 0x57, 0x300, 0x1e80,
+    0x57, 0x301, 0x1e82, 0x57, 0x302, 0x174,
+    0x57, 0x307, 0x1e86, 0x57, 0x308, 0x1e84,
+    0x57, 0x323, 0x1e88, 0x58, 0x307, 0x1e8a,
+    0x58, 0x308, 0x1e8c, 0x59, 0x300, 0x1ef2,
+    0x59, 0x301, 0xdd, 0x59, 0x302, 0x176,
+    0x59, 0x303, 0x1ef8, 0x59, 0x304, 0x232,
+    0x59, 0x307, 0x1e8e, 0x59, 0x308, 0x178,
+    0x59, 0x309, 0x1ef6, 0x59, 0x323, 0x1ef4,
+    0x5a, 0x301, 0x179, 0x5a, 0x302, 0x1e90,
+    0x5a, 0x307, 0x17b, 0x5a, 0x30c, 0x17d,
+    0x5a, 0x323, 0x1e92, 0x5a, 0x331, 0x1e94,
+    0x61, 0x300, 0xe0, 0x61, 0x301, 0xe1,
+    0x61, 0x302, 0xe2, 0x61, 0x303, 0xe3,
+    0x61, 0x304, 0x101, 0x61, 0x306, 0x103,
+    0x61, 0x307, 0x227, 0x61, 0x308, 0xe4,
+    0x61, 0x309, 0x1ea3, 0x61, 0x30a, 0xe5,
+    0x61, 0x30c, 0x1ce, 0x61, 0x30f, 0x201,
+    0x61, 0x311, 0x203, 0x61, 0x323, 0x1ea1,
+    0x61, 0x325, 0x1e01, 0x61, 0x328, 0x105,
+    0x62, 0x307, 0x1e03, 0x62, 0x323, 0x1e05,
+    0x62, 0x331, 0x1e07, 0x63, 0x301, 0x107,
+    0x63, 0x302, 0x109, 0x63, 0x307, 0x10b,
+    0x63, 0x30c, 0x10d, 0x63, 0x327, 0xe7,
+    0x64, 0x307, 0x1e0b, 0x64, 0x30c, 0x10f,
+    0x64, 0x323, 0x1e0d, 0x64, 0x327, 0x1e11,
+    0x64, 0x32d, 0x1e13, 0x64, 0x331, 0x1e0f,
+    0x65, 0x300, 0xe8, 0x65, 0x301, 0xe9,
+    0x65, 0x302, 0xea, 0x65, 0x303, 0x1ebd,
+    0x65, 0x304, 0x113, 0x65, 0x306, 0x115,
+    0x65, 0x307, 0x117, 0x65, 0x308, 0xeb,
+    0x65, 0x309, 0x1ebb, 0x65, 0x30c, 0x11b,
+    0x65, 0x30f, 0x205, 0x65, 0x311, 0x207,
+    0x65, 0x323, 0x1eb9, 0x65, 0x327, 0x229,
+    0x65, 0x328, 0x119, 0x65, 0x32d, 0x1e19,
+    0x65, 0x330, 0x1e1b, 0x66, 0x307, 0x1e1f,
+    0x67, 0x301, 0x1f5, 0x67, 0x302, 0x11d,
+    0x67, 0x304, 0x1e21, 0x67, 0x306, 0x11f,
+    0x67, 0x307, 0x121, 0x67, 0x30c, 0x1e7,
+    0x67, 0x327, 0x123, 0x68, 0x302, 0x125,
+    0x68, 0x307, 0x1e23, 0x68, 0x308, 0x1e27,
+    0x68, 0x30c, 0x21f, 0x68, 0x323, 0x1e25,
+    0x68, 0x327, 0x1e29, 0x68, 0x32e, 0x1e2b,
+    0x68, 0x331, 0x1e96, 0x69, 0x300, 0xec,
+    0x69, 0x301, 0xed, 0x69, 0x302, 0xee,
+    0x69, 0x303, 0x129, 0x69, 0x304, 0x12b,
+    0x69, 0x306, 0x12d, 0x69, 0x308, 0xef,
+    0x69, 0x309, 0x1ec9, 0x69, 0x30c, 0x1d0,
+    0x69, 0x30f, 0x209, 0x69, 0x311, 0x20b,
+    0x69, 0x323, 0x1ecb, 0x69, 0x328, 0x12f,
+    0x69, 0x330, 0x1e2d, 0x6a, 0x302, 0x135,
+    0x6a, 0x30c, 0x1f0, 0x6b, 0x301, 0x1e31,
+    0x6b, 0x30c, 0x1e9, 0x6b, 0x323, 0x1e33,
+    0x6b, 0x327, 0x137, 0x6b, 0x331, 0x1e35,
+    0x6c, 0x301, 0x13a, 0x6c, 0x30c, 0x13e,
+    0x6c, 0x323, 0x1e37, 0x6c, 0x327, 0x13c,
+    0x6c, 0x32d, 0x1e3d, 0x6c, 0x331, 0x1e3b,
+    0x6d, 0x301, 0x1e3f, 0x6d, 0x307, 0x1e41,
+    0x6d, 0x323, 0x1e43, 0x6e, 0x300, 0x1f9,
+    0x6e, 0x301, 0x144, 0x6e, 0x303, 0xf1,
+    0x6e, 0x307, 0x1e45, 0x6e, 0x30c, 0x148,
+    0x6e, 0x323, 0x1e47, 0x6e, 0x327, 0x146,
+    0x6e, 0x32d, 0x1e4b, 0x6e, 0x331, 0x1e49,
+    0x6f, 0x300, 0xf2, 0x6f, 0x301, 0xf3,
+    0x6f, 0x302, 0xf4, 0x6f, 0x303, 0xf5,
+    0x6f, 0x304, 0x14d, 0x6f, 0x306, 0x14f,
+    0x6f, 0x307, 0x22f, 0x6f, 0x308, 0xf6,
+    0x6f, 0x309, 0x1ecf, 0x6f, 0x30b, 0x151,
+    0x6f, 0x30c, 0x1d2, 0x6f, 0x30f, 0x20d,
+    0x6f, 0x311, 0x20f, 0x6f, 0x31b, 0x1a1,
+    0x6f, 0x323, 0x1ecd, 0x6f, 0x328, 0x1eb,
+    0x70, 0x301, 0x1e55, 0x70, 0x307, 0x1e57,
+    0x72, 0x301, 0x155, 0x72, 0x307, 0x1e59,
+    0x72, 0x30c, 0x159, 0x72, 0x30f, 0x211,
+    0x72, 0x311, 0x213, 0x72, 0x323, 0x1e5b,
+    0x72, 0x327, 0x157, 0x72, 0x331, 0x1e5f,
+    0x73, 0x301, 0x15b, 0x73, 0x302, 0x15d,
+    0x73, 0x307, 0x1e61, 0x73, 0x30c, 0x161,
+    0x73, 0x323, 0x1e63, 0x73, 0x326, 0x219,
+    0x73, 0x327, 0x15f, 0x74, 0x307, 0x1e6b,
+    0x74, 0x308, 0x1e97, 0x74, 0x30c, 0x165,
+    0x74, 0x323, 0x1e6d, 0x74, 0x326, 0x21b,
+    0x74, 0x327, 0x163, 0x74, 0x32d, 0x1e71,
+    0x74, 0x331, 0x1e6f, 0x75, 0x300, 0xf9,
+    0x75, 0x301, 0xfa, 0x75, 0x302, 0xfb,
+    0x75, 0x303, 0x169, 0x75, 0x304, 0x16b,
+    0x75, 0x306, 0x16d, 0x75, 0x308, 0xfc,
+    0x75, 0x309, 0x1ee7, 0x75, 0x30a, 0x16f,
+    0x75, 0x30b, 0x171, 0x75, 0x30c, 0x1d4,
+    0x75, 0x30f, 0x215, 0x75, 0x311, 0x217,
+    0x75, 0x31b, 0x1b0, 0x75, 0x323, 0x1ee5,
+    0x75, 0x324, 0x1e73, 0x75, 0x328, 0x173,
+    0x75, 0x32d, 0x1e77, 0x75, 0x330, 0x1e75,
+    0x76, 0x303, 0x1e7d, 0x76, 0x323, 0x1e7f,
+    0x77, 0x300, 0x1e81, 0x77, 0x301, 0x1e83,
+    0x77, 0x302, 0x175, 0x77, 0x307, 0x1e87,
+    0x77, 0x308, 0x1e85, 0x77, 0x30a, 0x1e98,
+    0x77, 0x323, 0x1e89, 0x78, 0x307, 0x1e8b,
+    0x78, 0x308, 0x1e8d, 0x79, 0x300, 0x1ef3,
+    0x79, 0x301, 0xfd, 0x79, 0x302, 0x177,
+    0x79, 0x303, 0x1ef9, 0x79, 0x304, 0x233,
+    0x79, 0x307, 0x1e8f, 0x79, 0x308, 0xff,
+    0x79, 0x309, 0x1ef7, 0x79, 0x30a, 0x1e99,
+    0x79, 0x323, 0x1ef5, 0x7a, 0x301, 0x17a,
+    0x7a, 0x302, 0x1e91, 0x7a, 0x307, 0x17c,
+    0x7a, 0x30c, 0x17e, 0x7a, 0x323, 0x1e93,
+    0x7a, 0x331, 0x1e95, 0xa8, 0x300, 0x1fed,
+    0xa8, 0x301, 0x385, 0xa8, 0x342, 0x1fc1,
+    0xc2, 0x300, 0x1ea6, 0xc2, 0x301, 0x1ea4,
+    0xc2, 0x303, 0x1eaa, 0xc2, 0x309, 0x1ea8,
+    0xc4, 0x304, 0x1de, 0xc5, 0x301, 0x1fa,
+    0xc6, 0x301, 0x1fc, 0xc6, 0x304, 0x1e2,
+    0xc7, 0x301, 0x1e08, 0xca, 0x300, 0x1ec0,
+    0xca, 0x301, 0x1ebe, 0xca, 0x303, 0x1ec4,
+    0xca, 0x309, 0x1ec2, 0xcf, 0x301, 0x1e2e,
+    0xd4, 0x300, 0x1ed2, 0xd4, 0x301, 0x1ed0,
+    0xd4, 0x303, 0x1ed6, 0xd4, 0x309, 0x1ed4,
+    0xd5, 0x301, 0x1e4c, 0xd5, 0x304, 0x22c,
+    0xd5, 0x308, 0x1e4e, 0xd6, 0x304, 0x22a,
+    0xd8, 0x301, 0x1fe, 0xdc, 0x300, 0x1db,
+    0xdc, 0x301, 0x1d7, 0xdc, 0x304, 0x1d5,
+    0xdc, 0x30c, 0x1d9, 0xe2, 0x300, 0x1ea7,
+    0xe2, 0x301, 0x1ea5, 0xe2, 0x303, 0x1eab,
+    0xe2, 0x309, 0x1ea9, 0xe4, 0x304, 0x1df,
+    0xe5, 0x301, 0x1fb, 0xe6, 0x301, 0x1fd,
+    0xe6, 0x304, 0x1e3, 0xe7, 0x301, 0x1e09,
+    0xea, 0x300, 0x1ec1, 0xea, 0x301, 0x1ebf,
+    0xea, 0x303, 0x1ec5, 0xea, 0x309, 0x1ec3,
+    0xef, 0x301, 0x1e2f, 0xf4, 0x300, 0x1ed3,
+    0xf4, 0x301, 0x1ed1, 0xf4, 0x303, 0x1ed7,
+    0xf4, 0x309, 0x1ed5, 0xf5, 0x301, 0x1e4d,
+    0xf5, 0x304, 0x22d, 0xf5, 0x308, 0x1e4f,
+    0xf6, 0x304, 0x22b, 0xf8, 0x301, 0x1ff,
+    0xfc, 0x300, 0x1dc, 0xfc, 0x301, 0x1d8,
+    0xfc, 0x304, 0x1d6, 0xfc, 0x30c, 0x1da,
+    0x102, 0x300, 0x1eb0, 0x102, 0x301, 0x1eae,
+    0x102, 0x303, 0x1eb4, 0x102, 0x309, 0x1eb2,
+    0x103, 0x300, 0x1eb1, 0x103, 0x301, 0x1eaf,
+    0x103, 0x303, 0x1eb5, 0x103, 0x309, 0x1eb3,
+    0x112, 0x300, 0x1e14, 0x112, 0x301, 0x1e16,
+    0x113, 0x300, 0x1e15, 0x113, 0x301, 0x1e17,
+    0x14c, 0x300, 0x1e50, 0x14c, 0x301, 0x1e52,
+    0x14d, 0x300, 0x1e51, 0x14d, 0x301, 0x1e53,
+    0x15a, 0x307, 0x1e64, 0x15b, 0x307, 0x1e65,
+    0x160, 0x307, 0x1e66, 0x161, 0x307, 0x1e67,
+    0x168, 0x301, 0x1e78, 0x169, 0x301, 0x1e79,
+    0x16a, 0x308, 0x1e7a, 0x16b, 0x308, 0x1e7b,
+    0x17f, 0x307, 0x1e9b, 0x1a0, 0x300, 0x1edc,
+    0x1a0, 0x301, 0x1eda, 0x1a0, 0x303, 0x1ee0,
+    0x1a0, 0x309, 0x1ede, 0x1a0, 0x323, 0x1ee2,
+    0x1a1, 0x300, 0x1edd, 0x1a1, 0x301, 0x1edb,
+    0x1a1, 0x303, 0x1ee1, 0x1a1, 0x309, 0x1edf,
+    0x1a1, 0x323, 0x1ee3, 0x1af, 0x300, 0x1eea,
+    0x1af, 0x301, 0x1ee8, 0x1af, 0x303, 0x1eee,
+    0x1af, 0x309, 0x1eec, 0x1af, 0x323, 0x1ef0,
+    0x1b0, 0x300, 0x1eeb, 0x1b0, 0x301, 0x1ee9,
+    0x1b0, 0x303, 0x1eef, 0x1b0, 0x309, 0x1eed,
+    0x1b0, 0x323, 0x1ef1, 0x1b7, 0x30c, 0x1ee,
+    0x1ea, 0x304, 0x1ec, 0x1eb, 0x304, 0x1ed,
+    0x226, 0x304, 0x1e0, 0x227, 0x304, 0x1e1,
+    0x228, 0x306, 0x1e1c, 0x229, 0x306, 0x1e1d,
+    0x22e, 0x304, 0x230, 0x22f, 0x304, 0x231,
+    0x292, 0x30c, 0x1ef, 0x391, 0x300, 0x1fba,
+    0x391, 0x301, 0x386, 0x391, 0x304, 0x1fb9,
+    0x391, 0x306, 0x1fb8, 0x391, 0x313, 0x1f08,
+    0x391, 0x314, 0x1f09, 0x391, 0x345, 0x1fbc,
+    0x395, 0x300, 0x1fc8, 0x395, 0x301, 0x388,
+    0x395, 0x313, 0x1f18, 0x395, 0x314, 0x1f19,
+    0x397, 0x300, 0x1fca, 0x397, 0x301, 0x389,
+    0x397, 0x313, 0x1f28, 0x397, 0x314, 0x1f29,
+    0x397, 0x345, 0x1fcc, 0x399, 0x300, 0x1fda,
+    0x399, 0x301, 0x38a, 0x399, 0x304, 0x1fd9,
+    0x399, 0x306, 0x1fd8, 0x399, 0x308, 0x3aa,
+    0x399, 0x313, 0x1f38, 0x399, 0x314, 0x1f39,
+    0x39f, 0x300, 0x1ff8, 0x39f, 0x301, 0x38c,
+    0x39f, 0x313, 0x1f48, 0x39f, 0x314, 0x1f49,
+    0x3a1, 0x314, 0x1fec, 0x3a5, 0x300, 0x1fea,
+    0x3a5, 0x301, 0x38e, 0x3a5, 0x304, 0x1fe9,
+    0x3a5, 0x306, 0x1fe8, 0x3a5, 0x308, 0x3ab,
+    0x3a5, 0x314, 0x1f59, 0x3a9, 0x300, 0x1ffa,
+    0x3a9, 0x301, 0x38f, 0x3a9, 0x313, 0x1f68,
+    0x3a9, 0x314, 0x1f69, 0x3a9, 0x345, 0x1ffc,
+    0x3ac, 0x345, 0x1fb4, 0x3ae, 0x345, 0x1fc4,
+    0x3b1, 0x300, 0x1f70, 0x3b1, 0x301, 0x3ac,
+    0x3b1, 0x304, 0x1fb1, 0x3b1, 0x306, 0x1fb0,
+    0x3b1, 0x313, 0x1f00, 0x3b1, 0x314, 0x1f01,
+    0x3b1, 0x342, 0x1fb6, 0x3b1, 0x345, 0x1fb3,
+    0x3b5, 0x300, 0x1f72, 0x3b5, 0x301, 0x3ad,
+    0x3b5, 0x313, 0x1f10, 0x3b5, 0x314, 0x1f11,
+    0x3b7, 0x300, 0x1f74, 0x3b7, 0x301, 0x3ae,
+    0x3b7, 0x313, 0x1f20, 0x3b7, 0x314, 0x1f21,
+    0x3b7, 0x342, 0x1fc6, 0x3b7, 0x345, 0x1fc3,
+    0x3b9, 0x300, 0x1f76, 0x3b9, 0x301, 0x3af,
+    0x3b9, 0x304, 0x1fd1, 0x3b9, 0x306, 0x1fd0,
+    0x3b9, 0x308, 0x3ca, 0x3b9, 0x313, 0x1f30,
+    0x3b9, 0x314, 0x1f31, 0x3b9, 0x342, 0x1fd6,
+    0x3bf, 0x300, 0x1f78, 0x3bf, 0x301, 0x3cc,
+    0x3bf, 0x313, 0x1f40, 0x3bf, 0x314, 0x1f41,
+    0x3c1, 0x313, 0x1fe4, 0x3c1, 0x314, 0x1fe5,
+    0x3c5, 0x300, 0x1f7a, 0x3c5, 0x301, 0x3cd,
+    0x3c5, 0x304, 0x1fe1, 0x3c5, 0x306, 0x1fe0,
+    0x3c5, 0x308, 0x3cb, 0x3c5, 0x313, 0x1f50,
+    0x3c5, 0x314, 0x1f51, 0x3c5, 0x342, 0x1fe6,
+    0x3c9, 0x300, 0x1f7c, 0x3c9, 0x301, 0x3ce,
+    0x3c9, 0x313, 0x1f60, 0x3c9, 0x314, 0x1f61,
+    0x3c9, 0x342, 0x1ff6, 0x3c9, 0x345, 0x1ff3,
+    0x3ca, 0x300, 0x1fd2, 0x3ca, 0x301, 0x390,
+    0x3ca, 0x342, 0x1fd7, 0x3cb, 0x300, 0x1fe2,
+    0x3cb, 0x301, 0x3b0, 0x3cb, 0x342, 0x1fe7,
+    0x3ce, 0x345, 0x1ff4, 0x3d2, 0x301, 0x3d3,
+    0x3d2, 0x308, 0x3d4, 0x406, 0x308, 0x407,
+    0x410, 0x306, 0x4d0, 0x410, 0x308, 0x4d2,
+    0x413, 0x301, 0x403, 0x415, 0x300, 0x400,
+    0x415, 0x306, 0x4d6, 0x415, 0x308, 0x401,
+    0x416, 0x306, 0x4c1, 0x416, 0x308, 0x4dc,
+    0x417, 0x308, 0x4de, 0x418, 0x300, 0x40d,
+    0x418, 0x304, 0x4e2, 0x418, 0x306, 0x419,
+    0x418, 0x308, 0x4e4, 0x41a, 0x301, 0x40c,
+    0x41e, 0x308, 0x4e6, 0x423, 0x304, 0x4ee,
+    0x423, 0x306, 0x40e, 0x423, 0x308, 0x4f0,
+    0x423, 0x30b, 0x4f2, 0x427, 0x308, 0x4f4,
+    0x42b, 0x308, 0x4f8, 0x42d, 0x308, 0x4ec,
+    0x430, 0x306, 0x4d1, 0x430, 0x308, 0x4d3,
+    0x433, 0x301, 0x453, 0x435, 0x300, 0x450,
+    0x435, 0x306, 0x4d7, 0x435, 0x308, 0x451,
+    0x436, 0x306, 0x4c2, 0x436, 0x308, 0x4dd,
+    0x437, 0x308, 0x4df, 0x438, 0x300, 0x45d,
+    0x438, 0x304, 0x4e3, 0x438, 0x306, 0x439,
+    0x438, 0x308, 0x4e5, 0x43a, 0x301, 0x45c,
+    0x43e, 0x308, 0x4e7, 0x443, 0x304, 0x4ef,
+    0x443, 0x306, 0x45e, 0x443, 0x308, 0x4f1,
+    0x443, 0x30b, 0x4f3, 0x447, 0x308, 0x4f5,
+    0x44b, 0x308, 0x4f9, 0x44d, 0x308, 0x4ed,
+    0x456, 0x308, 0x457, 0x474, 0x30f, 0x476,
+    0x475, 0x30f, 0x477, 0x4d8, 0x308, 0x4da,
+    0x4d9, 0x308, 0x4db, 0x4e8, 0x308, 0x4ea,
+    0x4e9, 0x308, 0x4eb, 0x627, 0x653, 0x622,
+    0x627, 0x654, 0x623, 0x627, 0x655, 0x625,
+    0x648, 0x654, 0x624, 0x64a, 0x654, 0x626,
+    0x6c1, 0x654, 0x6c2, 0x6d2, 0x654, 0x6d3,
+    0x6d5, 0x654, 0x6c0, 0x928, 0x93c, 0x929,
+    0x930, 0x93c, 0x931, 0x933, 0x93c, 0x934,
+    0x9c7, 0x9be, 0x9cb, 0x9c7, 0x9d7, 0x9cc,
+    0xb47, 0xb3e, 0xb4b, 0xb47, 0xb56, 0xb48,
+    0xb47, 0xb57, 0xb4c, 0xb92, 0xbd7, 0xb94,
+    0xbc6, 0xbbe, 0xbca, 0xbc6, 0xbd7, 0xbcc,
+    0xbc7, 0xbbe, 0xbcb, 0xc46, 0xc56, 0xc48,
+    0xcbf, 0xcd5, 0xcc0, 0xcc6, 0xcc2, 0xcca,
+    0xcc6, 0xcd5, 0xcc7, 0xcc6, 0xcd6, 0xcc8,
+    0xcca, 0xcd5, 0xccb, 0xd46, 0xd3e, 0xd4a,
+    0xd46, 0xd57, 0xd4c, 0xd47, 0xd3e, 0xd4b,
+    0xdd9, 0xdca, 0xdda, 0xdd9, 0xdcf, 0xddc,
+    0xdd9, 0xddf, 0xdde, 0xddc, 0xdca, 0xddd,
+    0x1025, 0x102e, 0x1026, 0x1b05, 0x1b35, 0x1b06,
+    0x1b07, 0x1b35, 0x1b08, 0x1b09, 0x1b35, 0x1b0a,
+    0x1b0b, 0x1b35, 0x1b0c, 0x1b0d, 0x1b35, 0x1b0e,
+    0x1b11, 0x1b35, 0x1b12, 0x1b3a, 0x1b35, 0x1b3b,
+    0x1b3c, 0x1b35, 0x1b3d, 0x1b3e, 0x1b35, 0x1b40,
+    0x1b3f, 0x1b35, 0x1b41, 0x1b42, 0x1b35, 0x1b43,
+    0x1e36, 0x304, 0x1e38, 0x1e37, 0x304, 0x1e39,
+    0x1e5a, 0x304, 0x1e5c, 0x1e5b, 0x304, 0x1e5d,
+    0x1e62, 0x307, 0x1e68, 0x1e63, 0x307, 0x1e69,
+    0x1ea0, 0x302, 0x1eac, 0x1ea0, 0x306, 0x1eb6,
+    0x1ea1, 0x302, 0x1ead, 0x1ea1, 0x306, 0x1eb7,
+    0x1eb8, 0x302, 0x1ec6, 0x1eb9, 0x302, 0x1ec7,
+    0x1ecc, 0x302, 0x1ed8, 0x1ecd, 0x302, 0x1ed9,
+    0x1f00, 0x300, 0x1f02, 0x1f00, 0x301, 0x1f04,
+    0x1f00, 0x342, 0x1f06, 0x1f00, 0x345, 0x1f80,
+    0x1f01, 0x300, 0x1f03, 0x1f01, 0x301, 0x1f05,
+    0x1f01, 0x342, 0x1f07, 0x1f01, 0x345, 0x1f81,
+    0x1f02, 0x345, 0x1f82, 0x1f03, 0x345, 0x1f83,
+    0x1f04, 0x345, 0x1f84, 0x1f05, 0x345, 0x1f85,
+    0x1f06, 0x345, 0x1f86, 0x1f07, 0x345, 0x1f87,
+    0x1f08, 0x300, 0x1f0a, 0x1f08, 0x301, 0x1f0c,
+    0x1f08, 0x342, 0x1f0e, 0x1f08, 0x345, 0x1f88,
+    0x1f09, 0x300, 0x1f0b, 0x1f09, 0x301, 0x1f0d,
+    0x1f09, 0x342, 0x1f0f, 0x1f09, 0x345, 0x1f89,
+    0x1f0a, 0x345, 0x1f8a, 0x1f0b, 0x345, 0x1f8b,
+    0x1f0c, 0x345, 0x1f8c, 0x1f0d, 0x345, 0x1f8d,
+    0x1f0e, 0x345, 0x1f8e, 0x1f0f, 0x345, 0x1f8f,
+    0x1f10, 0x300, 0x1f12, 0x1f10, 0x301, 0x1f14,
+    0x1f11, 0x300, 0x1f13, 0x1f11, 0x301, 0x1f15,
+    0x1f18, 0x300, 0x1f1a, 0x1f18, 0x301, 0x1f1c,
+    0x1f19, 0x300, 0x1f1b, 0x1f19, 0x301, 0x1f1d,
+    0x1f20, 0x300, 0x1f22, 0x1f20, 0x301, 0x1f24,
+    0x1f20, 0x342, 0x1f26, 0x1f20, 0x345, 0x1f90,
+    0x1f21, 0x300, 0x1f23, 0x1f21, 0x301, 0x1f25,
+    0x1f21, 0x342, 0x1f27, 0x1f21, 0x345, 0x1f91,
+    0x1f22, 0x345, 0x1f92, 0x1f23, 0x345, 0x1f93,
+    0x1f24, 0x345, 0x1f94, 0x1f25, 0x345, 0x1f95,
+    0x1f26, 0x345, 0x1f96, 0x1f27, 0x345, 0x1f97,
+    0x1f28, 0x300, 0x1f2a, 0x1f28, 0x301, 0x1f2c,
+    0x1f28, 0x342, 0x1f2e, 0x1f28, 0x345, 0x1f98,
+    0x1f29, 0x300, 0x1f2b, 0x1f29, 0x301, 0x1f2d,
+    0x1f29, 0x342, 0x1f2f, 0x1f29, 0x345, 0x1f99,
+    0x1f2a, 0x345, 0x1f9a, 0x1f2b, 0x345, 0x1f9b,
+    0x1f2c, 0x345, 0x1f9c, 0x1f2d, 0x345, 0x1f9d,
+    0x1f2e, 0x345, 0x1f9e, 0x1f2f, 0x345, 0x1f9f,
+    0x1f30, 0x300, 0x1f32, 0x1f30, 0x301, 0x1f34,
+    0x1f30, 0x342, 0x1f36, 0x1f31, 0x300, 0x1f33,
+    0x1f31, 0x301, 0x1f35, 0x1f31, 0x342, 0x1f37,
+    0x1f38, 0x300, 0x1f3a, 0x1f38, 0x301, 0x1f3c,
+    0x1f38, 0x342, 0x1f3e, 0x1f39, 0x300, 0x1f3b,
+    0x1f39, 0x301, 0x1f3d, 0x1f39, 0x342, 0x1f3f,
+    0x1f40, 0x300, 0x1f42, 0x1f40, 0x301, 0x1f44,
+    0x1f41, 0x300, 0x1f43, 0x1f41, 0x301, 0x1f45,
+    0x1f48, 0x300, 0x1f4a, 0x1f48, 0x301, 0x1f4c,
+    0x1f49, 0x300, 0x1f4b, 0x1f49, 0x301, 0x1f4d,
+    0x1f50, 0x300, 0x1f52, 0x1f50, 0x301, 0x1f54,
+    0x1f50, 0x342, 0x1f56, 0x1f51, 0x300, 0x1f53,
+    0x1f51, 0x301, 0x1f55, 0x1f51, 0x342, 0x1f57,
+    0x1f59, 0x300, 0x1f5b, 0x1f59, 0x301, 0x1f5d,
+    0x1f59, 0x342, 0x1f5f, 0x1f60, 0x300, 0x1f62,
+    0x1f60, 0x301, 0x1f64, 0x1f60, 0x342, 0x1f66,
+    0x1f60, 0x345, 0x1fa0, 0x1f61, 0x300, 0x1f63,
+    0x1f61, 0x301, 0x1f65, 0x1f61, 0x342, 0x1f67,
+    0x1f61, 0x345, 0x1fa1, 0x1f62, 0x345, 0x1fa2,
+    0x1f63, 0x345, 0x1fa3, 0x1f64, 0x345, 0x1fa4,
+    0x1f65, 0x345, 0x1fa5, 0x1f66, 0x345, 0x1fa6,
+    0x1f67, 0x345, 0x1fa7, 0x1f68, 0x300, 0x1f6a,
+    0x1f68, 0x301, 0x1f6c, 0x1f68, 0x342, 0x1f6e,
+    0x1f68, 0x345, 0x1fa8, 0x1f69, 0x300, 0x1f6b,
+    0x1f69, 0x301, 0x1f6d, 0x1f69, 0x342, 0x1f6f,
+    0x1f69, 0x345, 0x1fa9, 0x1f6a, 0x345, 0x1faa,
+    0x1f6b, 0x345, 0x1fab, 0x1f6c, 0x345, 0x1fac,
+    0x1f6d, 0x345, 0x1fad, 0x1f6e, 0x345, 0x1fae,
+    0x1f6f, 0x345, 0x1faf, 0x1f70, 0x345, 0x1fb2,
+    0x1f74, 0x345, 0x1fc2, 0x1f7c, 0x345, 0x1ff2,
+    0x1fb6, 0x345, 0x1fb7, 0x1fbf, 0x300, 0x1fcd,
+    0x1fbf, 0x301, 0x1fce, 0x1fbf, 0x342, 0x1fcf,
+    0x1fc6, 0x345, 0x1fc7, 0x1ff6, 0x345, 0x1ff7,
+    0x1ffe, 0x300, 0x1fdd, 0x1ffe, 0x301, 0x1fde,
+    0x1ffe, 0x342, 0x1fdf, 0x2190, 0x338, 0x219a,
+    0x2192, 0x338, 0x219b, 0x2194, 0x338, 0x21ae,
+    0x21d0, 0x338, 0x21cd, 0x21d2, 0x338, 0x21cf,
+    0x21d4, 0x338, 0x21ce, 0x2203, 0x338, 0x2204,
+    0x2208, 0x338, 0x2209, 0x220b, 0x338, 0x220c,
+    0x2223, 0x338, 0x2224, 0x2225, 0x338, 0x2226,
+    0x223c, 0x338, 0x2241, 0x2243, 0x338, 0x2244,
+    0x2245, 0x338, 0x2247, 0x2248, 0x338, 0x2249,
+    0x224d, 0x338, 0x226d, 0x2261, 0x338, 0x2262,
+    0x2264, 0x338, 0x2270, 0x2265, 0x338, 0x2271,
+    0x2272, 0x338, 0x2274, 0x2273, 0x338, 0x2275,
+    0x2276, 0x338, 0x2278, 0x2277, 0x338, 0x2279,
+    0x227a, 0x338, 0x2280, 0x227b, 0x338, 0x2281,
+    0x227c, 0x338, 0x22e0, 0x227d, 0x338, 0x22e1,
+    0x2282, 0x338, 0x2284, 0x2283, 0x338, 0x2285,
+    0x2286, 0x338, 0x2288, 0x2287, 0x338, 0x2289,
+    0x2291, 0x338, 0x22e2, 0x2292, 0x338, 0x22e3,
+    0x22a2, 0x338, 0x22ac, 0x22a8, 0x338, 0x22ad,
+    0x22a9, 0x338, 0x22ae, 0x22ab, 0x338, 0x22af,
+    0x22b2, 0x338, 0x22ea, 0x22b3, 0x338, 0x22eb,
+    0x22b4, 0x338, 0x22ec, 0x22b5, 0x338, 0x22ed,
+    0x3046, 0x3099, 0x3094, 0x304b, 0x3099, 0x304c,
+    0x304d, 0x3099, 0x304e, 0x304f, 0x3099, 0x3050,
+    0x3051, 0x3099, 0x3052, 0x3053, 0x3099, 0x3054,
+    0x3055, 0x3099, 0x3056, 0x3057, 0x3099, 0x3058,
+    0x3059, 0x3099, 0x305a, 0x305b, 0x3099, 0x305c,
+    0x305d, 0x3099, 0x305e, 0x305f, 0x3099, 0x3060,
+    0x3061, 0x3099, 0x3062, 0x3064, 0x3099, 0x3065,
+    0x3066, 0x3099, 0x3067, 0x3068, 0x3099, 0x3069,
+    0x306f, 0x3099, 0x3070, 0x306f, 0x309a, 0x3071,
+    0x3072, 0x3099, 0x3073, 0x3072, 0x309a, 0x3074,
+    0x3075, 0x3099, 0x3076, 0x3075, 0x309a, 0x3077,
+    0x3078, 0x3099, 0x3079, 0x3078, 0x309a, 0x307a,
+    0x307b, 0x3099, 0x307c, 0x307b, 0x309a, 0x307d,
+    0x309d, 0x3099, 0x309e, 0x30a6, 0x3099, 0x30f4,
+    0x30ab, 0x3099, 0x30ac, 0x30ad, 0x3099, 0x30ae,
+    0x30af, 0x3099, 0x30b0, 0x30b1, 0x3099, 0x30b2,
+    0x30b3, 0x3099, 0x30b4, 0x30b5, 0x3099, 0x30b6,
+    0x30b7, 0x3099, 0x30b8, 0x30b9, 0x3099, 0x30ba,
+    0x30bb, 0x3099, 0x30bc, 0x30bd, 0x3099, 0x30be,
+    0x30bf, 0x3099, 0x30c0, 0x30c1, 0x3099, 0x30c2,
+    0x30c4, 0x3099, 0x30c5, 0x30c6, 0x3099, 0x30c7,
+    0x30c8, 0x3099, 0x30c9, 0x30cf, 0x3099, 0x30d0,
+    0x30cf, 0x309a, 0x30d1, 0x30d2, 0x3099, 0x30d3,
+    0x30d2, 0x309a, 0x30d4, 0x30d5, 0x3099, 0x30d6,
+    0x30d5, 0x309a, 0x30d7, 0x30d8, 0x3099, 0x30d9,
+    0x30d8, 0x309a, 0x30da, 0x30db, 0x3099, 0x30dc,
+    0x30db, 0x309a, 0x30dd, 0x30ef, 0x3099, 0x30f7,
+    0x30f0, 0x3099, 0x30f8, 0x30f1, 0x3099, 0x30f9,
+    0x30f2, 0x3099, 0x30fa, 0x30fd, 0x3099, 0x30fe,
+    0x11099, 0x110ba, 0x1109a, 0x1109b, 0x110ba, 0x1109c,
+    0x110a5, 0x110ba, 0x110ab, 0x11131, 0x11127, 0x1112e,
+    0x11132, 0x11127, 0x1112f, 0x11347, 0x1133e, 0x1134b,
+    0x11347, 0x11357, 0x1134c, 0x114b9, 0x114b0, 0x114bc,
+    0x114b9, 0x114ba, 0x114bb, 0x114b9, 0x114bd, 0x114be,
+    0x115b8, 0x115af, 0x115ba, 0x115b9, 0x115af, 0x115bb,
+    0x11935, 0x11930, 0x11938
+};
+
+const uint32_t norm_fold_cps[ 1530 ] = {
+    0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+    0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c,
+    0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52,
+    0x53, 0x54, 0x55, 0x56, 0x57, 0x58,
+    0x59, 0x5a, 0xb5, 0xc0, 0xc1, 0xc2,
+    0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8,
+    0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce,
+    0xcf, 0xd0, 0xd1, 0xd2, 0xd3, 0xd4,
+    0xd5, 0xd6, 0xd8, 0xd9, 0xda, 0xdb,
+    0xdc, 0xdd, 0xde, 0xdf, 0x100, 0x102,
+    0x104, 0x106, 0x108, 0x10a, 0x10c, 0x10e,
+    0x110, 0x112, 0x114, 0x116, 0x118, 0x11a,
+    0x11c, 0x11e, 0x120, 0x122, 0x124, 0x126,
+    0x128, 0x12a, 0x12c, 0x12e, 0x130, 0x132,
+    0x134, 0x136, 0x139, 0x13b, 0x13d, 0x13f,
+    0x141, 0x143, 0x145, 0x147, 0x149, 0x14a,
+    0x14c, 0x14e, 0x150, 0x152, 0x154, 0x156,
+    0x158, 0x15a, 0x15c, 0x15e, 0x160, 0x162,
+    0x164, 0x166, 0x168, 0x16a, 0x16c, 0x16e,
+    0x170, 0x172, 0x174, 0x176, 0x178, 0x179,
+    0x17b, 0x17d, 0x17f, 0x181, 0x182, 0x184,
+    0x186, 0x187, 0x189, 0x18a, 0x18b, 0x18e,
+    0x18f, 0x190, 0x191, 0x193, 0x194, 0x196,
+    0x197, 0x198, 0x19c, 0x19d, 0x19f, 0x1a0,
+    0x1a2, 0x1a4, 0x1a6, 0x1a7, 0x1a9, 0x1ac,
+    0x1ae, 0x1af, 0x1b1, 0x1b2, 0x1b3, 0x1b5,
+    0x1b7, 0x1b8, 0x1bc, 0x1c4, 0x1c5, 0x1c7,
+    0x1c8, 0x1ca, 0x1cb, 0x1cd, 0x1cf, 0x1d1,
+    0x1d3, 0x1d5, 0x1d7, 0x1d9, 0x1db, 0x1de,
+    0x1e0, 0x1e2, 0x1e4, 0x1e6, 0x1e8, 0x1ea,
+    0x1ec, 0x1ee, 0x1f0, 0x1f1, 0x1f2, 0x1f4,
+    0x1f6, 0x1f7, 0x1f8, 0x1fa, 0x1fc, 0x1fe,
+    0x200, 0x202, 0x204, 0x206, 0x208, 0x20a,
+    0x20c, 0x20e, 0x210, 0x212, 0x214, 0x216,
+    0x218, 0x21a, 0x21c, 0x21e, 0x220, 0x222,
+    0x224, 0x226, 0x228, 0x22a, 0x22c, 0x22e,
+    0x230, 0x232, 0x23a, 0x23b, 0x23d, 0x23e,
+    0x241, 0x243, 0x244, 0x245, 0x246, 0x248,
+    0x24a, 0x24c, 0x24e, 0x345, 0x370, 0x372,
+    0x376, 0x37f, 0x386, 0x388, 0x389, 0x38a,
+    0x38c, 0x38e, 0x38f, 0x390, 0x391, 0x392,
+    0x393, 0x394, 0x395, 0x396, 0x397, 0x398,
+    0x399, 0x39a, 0x39b, 0x39c, 0x39d, 0x39e,
+    0x39f, 0x3a0, 0x3a1, 0x3a3, 0x3a4, 0x3a5,
+    0x3a6, 0x3a7, 0x3a8, 0x3a9, 0x3aa, 0x3ab,
+    0x3b0, 0x3c2, 0x3cf, 0x3d0, 0x3d1, 0x3d5,
+    0x3d6, 0x3d8, 0x3da, 0x3dc, 0x3de, 0x3e0,
+    0x3e2, 0x3e4, 0x3e6, 0x3e8, 0x3ea, 0x3ec,
+    0x3ee, 0x3f0, 0x3f1, 0x3f4, 0x3f5, 0x3f7,
+    0x3f9, 0x3fa, 0x3fd, 0x3fe, 0x3ff, 0x400,
+    0x401, 0x402, 0x403, 0x404, 0x405, 0x406,
+    0x407, 0x408, 0x409, 0x40a, 0x40b, 0x40c,
+    0x40d, 0x40e, 0x40f, 0x410, 0x411, 0x412,
+    0x413, 0x414, 0x415, 0x416, 0x417, 0x418,
+    0x419, 0x41a, 0x41b, 0x41c, 0x41d, 0x41e,
+    0x41f, 0x420, 0x421, 0x422, 0x423, 0x424,
+    0x425, 0x426, 0x427, 0x428, 0x429, 0x42a,
+    0x42b, 0x42c, 0x42d, 0x42e, 0x42f, 0x460,
+    0x462, 0x464, 0x466, 0x468, 0x46a, 0x46c,
+    0x46e, 0x470, 0x472, 0x474, 0x476, 0x478,
+    0x47a, 0x47c, 0x47e, 0x480, 0x48a, 0x48c,
+    0x48e, 0x490, 0x492, 0x494, 0x496, 0x498,
+    0x49a, 0x49c, 0x49e, 0x4a0, 0x4a2, 0x4a4,
+    0x4a6, 0x4a8, 0x4aa, 0x4ac, 0x4ae, 0x4b0,
+    0x4b2, 0x4b4, 0x4b6, 0x4b8, 0x4ba, 0x4bc,
+    0x4be, 0x4c0, 0x4c1, 0x4c3, 0x4c5, 0x4c7,
+    0x4c9, 0x4cb, 0x4cd, 0x4d0, 0x4d2, 0x4d4,
+    0x4d6, 0x4d8, 0x4da, 0x4dc, 0x4de, 0x4e0,
+    0x4e2, 0x4e4, 0x4e6, 0x4e8, 0x4ea, 0x4ec,
+    0x4ee, 0x4f0, 0x4f2, 0x4f4, 0x4f6, 0x4f8,
+    0x4fa, 0x4fc, 0x4fe, 0x500, 0x502, 0x504,
+    0x506, 0x508, 0x50a, 0x50c, 0x50e, 0x510,
+    0x512, 0x514, 0x516, 0x518, 0x51a, 0x51c,
+    0x51e, 0x520, 0x522, 0x524, 0x526, 0x528,
+    0x52a, 0x52c, 0x52e, 0x531, 0x532, 0x533,
+    0x534, 0x535, 0x536, 0x537, 0x538, 0x539,
+    0x53a, 0x53b, 0x53c, 0x53d, 0x53e, 0x53f,
+    0x540, 0x541, 0x542, 0x543, 0x544, 0x545,
+    0x546, 0x547, 0x548, 0x549, 0x54a, 0x54b,
+    0x54c, 0x54d, 0x54e, 0x54f, 0x550, 0x551,
+    0x552, 0x553, 0x554, 0x555, 0x556, 0x587,
+    0x10a0, 0x10a1, 0x10a2, 0x10a3, 0x10a4, 0x10a5,
+    0x10a6, 0x10a7, 0x10a8, 0x10a9, 0x10aa, 0x10ab,
+    0x10ac, 0x10ad, 0x10ae, 0x10af, 0x10b0, 0x10b1,
+    0x10b2, 0x10b3, 0x10b4, 0x10b5, 0x10b6, 0x10b7,
+    0x10b8, 0x10b9, 0x10ba, 0x10bb, 0x10bc, 0x10bd,
+    0x10be, 0x10bf, 0x10c0, 0x10c1, 0x10c2, 0x10c3,
+    0x10c4, 0x10c5, 0x10c7, 0x10cd, 0x13f8, 0x13f9,
+    0x13fa, 0x13fb, 0x13fc, 0x13fd, 0x1c80, 0x1c81,
+    0x1c82, 0x1c83, 0x1c84, 0x1c85, 0x1c86, 0x1c87,
+    0x1c88, 0x1c90, 0x1c91, 0x1c92, 0x1c93, 0x1c94,
+    0x1c95, 0x1c96, 0x1c97, 0x1c98, 0x1c99, 0x1c9a,
+    0x1c9b, 0x1c9c, 0x1c9d, 0x1c9e, 0x1c9f, 0x1ca0,
+    0x1ca1, 0x1ca2, 0x1ca3, 0x1ca4, 0x1ca5, 0x1ca6,
+    0x1ca7, 0x1ca8, 0x1ca9, 0x1caa, 0x1cab, 0x1cac,
+    0x1cad, 0x1cae, 0x1caf, 0x1cb0, 0x1cb1, 0x1cb2,
+    0x1cb3, 0x1cb4, 0x1cb5, 0x1cb6, 0x1cb7, 0x1cb8,
+    0x1cb9, 0x1cba, 0x1cbd, 0x1cbe, 0x1cbf, 0x1e00,
+    0x1e02, 0x1e04, 0x1e06, 0x1e08, 0x1e0a, 0x1e0c,
+    0x1e0e, 0x1e10, 0x1e12, 0x1e14, 0x1e16, 0x1e18,
+    0x1e1a, 0x1e1c, 0x1e1e, 0x1e20, 0x1e22, 0x1e24,
+    0x1e26, 0x1e28, 0x1e2a, 0x1e2c, 0x1e2e, 0x1e30,
+    0x1e32, 0x1e34, 0x1e36, 0x1e38, 0x1e3a, 0x1e3c,
+    0x1e3e, 0x1e40, 0x1e42, 0x1e44, 0x1e46, 0x1e48,
+    0x1e4a, 0x1e4c, 0x1e4e, 0x1e50, 0x1e52, 0x1e54,
+    0x1e56, 0x1e58, 0x1e5a, 0x1e5c, 0x1e5e, 0x1e60,
+    0x1e62, 0x1e64, 0x1e66, 0x1e68, 0x1e6a, 0x1e6c,
+    0x1e6e, 0x1e70, 0x1e72, 0x1e74, 0x1e76, 0x1e78,
+    0x1e7a, 0x1e7c, 0x1e7e, 0x1e80, 0x1e82, 0x1e84,
+    0x1e86, 0x1e88, 0x1e8a, 0x1e8c, 0x1e8e, 0x1e90,
+    0x1e92, 0x1e94, 0x1e96, 0x1e97, 0x1e98, 0x1e99,
+    0x1e9a, 0x1e9b, 0x1e9e, 0x1ea0, 0x1ea2, 0x1ea4,
+    0x1ea6, 0x1ea8, 0x1eaa, 0x1eac, 0x1eae, 0x1eb0,
+    0x1eb2, 0x1eb4, 0x1eb6, 0x1eb8, 0x1eba, 0x1ebc,
+    0x1ebe, 0x1ec0, 0x1ec2, 0x1ec4, 0x1ec6, 0x1ec8,
+    0x1eca, 0x1ecc, 0x1ece, 0x1ed0, 0x1ed2, 0x1ed4,
+    0x1ed6, 0x1ed8, 0x1eda, 0x1edc, 0x1ede, 0x1ee0,
+    0x1ee2, 0x1ee4, 0x1ee6, 0x1ee8, 0x1eea, 0x1eec,
+    0x1eee, 0x1ef0, 0x1ef2, 0x1ef4, 0x1ef6, 0x1ef8,
+    0x1efa, 0x1efc, 0x1efe, 0x1f08, 0x1f09, 0x1f0a,
+    0x1f0b, 0x1f0c, 0x1f0d, 0x1f0e, 0x1f0f, 0x1f18,
+    0x1f19, 0x1f1a, 0x1f1b, 0x1f1c, 0x1f1d, 0x1f28,
+    0x1f29, 0x1f2a, 0x1f2b, 0x1f2c, 0x1f2d, 0x1f2e,
+    0x1f2f, 0x1f38, 0x1f39, 0x1f3a, 0x1f3b, 0x1f3c,
+    0x1f3d, 0x1f3e, 0x1f3f, 0x1f48, 0x1f49, 0x1f4a,
+    0x1f4b, 0x1f4c, 0x1f4d, 0x1f50, 0x1f52, 0x1f54,
+    0x1f56, 0x1f59, 0x1f5b, 0x1f5d, 0x1f5f, 0x1f68,
+    0x1f69, 0x1f6a, 0x1f6b, 0x1f6c, 0x1f6d, 0x1f6e,
+    0x1f6f, 0x1f80, 0x1f81, 0x1f82, 0x1f83, 0x1f84,
+    0x1f85, 0x1f86, 0x1f87, 0x1f88, 0x1f89, 0x1f8a,
+    0x1f8b, 0x1f8c, 0x1f8d, 0x1f8e, 0x1f8f, 0x1f90,
+    0x1f91, 0x1f92, 0x1f93, 0x1f94, 0x1f95, 0x1f96,
+    0x1f97, 0x1f98, 0x1f99, 0x1f9a, 0x1f9b, 0x1f9c,
+    0x1f9d, 0x1f9e, 0x1f9f, 0x1fa0, 0x1fa1, 0x1fa2,
+    0x1fa3, 0x1fa4, 0x1fa5, 0x1fa6, 0x1fa7, 0x1fa8,
+    0x1fa9, 0x1faa, 0x1fab, 0x1fac, 0x1fad, 0x1fae,
+    0x1faf, 0x1fb2, 0x1fb3, 0x1fb4, 0x1fb6, 0x1fb7,
+    0x1fb8, 0x1fb9, 0x1fba, 0x1fbb, 0x1fbc, 0x1fbe,
+    0x1fc2, 0x1fc3, 0x1fc4, 0x1fc6, 0x1fc7, 0x1fc8,
+    0x1fc9, 0x1fca, 0x1fcb, 0x1fcc, 0x1fd2, 0x1fd3,
+    0x1fd6, 0x1fd7, 0x1fd8, 0x1fd9, 0x1fda, 0x1fdb,
+    0x1fe2, 0x1fe3, 0x1fe4, 0x1fe6, 0x1fe7, 0x1fe8,
+    0x1fe9, 0x1fea, 0x1feb, 0x1fec, 0x1ff2, 0x1ff3,
+    0x1ff4, 0x1ff6, 0x1ff7, 0x1ff8, 0x1ff9, 0x1ffa,
+    0x1ffb, 0x1ffc, 0x2126, 0x212a, 0x212b, 0x2132,
+    0x2160, 0x2161, 0x2162, 0x2163, 0x2164, 0x2165,
+    0x2166, 0x2167, 0x2168, 0x2169, 0x216a, 0x216b,
+    0x216c, 0x216d, 0x216e, 0x216f, 0x2183, 0x24b6,
+    0x24b7, 0x24b8, 0x24b9, 0x24ba, 0x24bb, 0x24bc,
+    0x24bd, 0x24be, 0x24bf, 0x24c0, 0x24c1, 0x24c2,
+    0x24c3, 0x24c4, 0x24c5, 0x24c6, 0x24c7, 0x24c8,
+    0x24c9, 0x24ca, 0x24cb, 0x24cc, 0x24cd, 0x24ce,
+    0x24cf, 0x2c00, 0x2c01, 0x2c02, 0x2c03, 0x2c04,
+    0x2c05, 0x2c06, 0x2c07, 0x2c08, 0x2c09, 0x2c0a,
+    0x2c0b, 0x2c0c, 0x2c0d, 0x2c0e, 0x2c0f, 0x2c10,
+    0x2c11, 0x2c12, 0x2c13, 0x2c14, 0x2c15, 0x2c16,
+    0x2c17, 0x2c18, 0x2c19, 0x2c1a, 0x2c1b, 0x2c1c,
+    0x2c1d, 0x2c1e, 0x2c1f, 0x2c20, 0x2c21, 0x2c22,
+    0x2c23, 0x2c24, 0x2c25, 0x2c26, 0x2c27, 0x2c28,
+    0x2c29, 0x2c2a, 0x2c2b, 0x2c2c, 0x2c2d, 0x2c2e,
+    0x2c2f, 0x2c60, 0x2c62, 0x2c63, 0x2c64, 0x2c67,
+    0x2c69, 0x2c6b, 0x2c6d, 0x2c6e, 0x2c6f, 0x2c70,
+    0x2c72, 0x2c75, 0x2c7e, 0x2c7f, 0x2c80, 0x2c82,
+    0x2c84, 0x2c86, 0x2c88, 0x2c8a, 0x2c8c, 0x2c8e,
+    0x2c90, 0x2c92, 0x2c94, 0x2c96, 0x2c98, 0x2c9a,
+    0x2c9c, 0x2c9e, 0x2ca0, 0x2ca2, 0x2ca4, 0x2ca6,
+    0x2ca8, 0x2caa, 0x2cac, 0x2cae, 0x2cb0, 0x2cb2,
+    0x2cb4, 0x2cb6, 0x2cb8, 0x2cba, 0x2cbc, 0x2cbe,
+    0x2cc0, 0x2cc2, 0x2cc4, 0x2cc6, 0x2cc8, 0x2cca,
+    0x2ccc, 0x2cce, 0x2cd0, 0x2cd2, 0x2cd4, 0x2cd6,
+    0x2cd8, 0x2cda, 0x2cdc, 0x2cde, 0x2ce0, 0x2ce2,
+    0x2ceb, 0x2ced, 0x2cf2, 0xa640, 0xa642, 0xa644,
+    0xa646, 0xa648, 0xa64a, 0xa64c, 0xa64e, 0xa650,
+    0xa652, 0xa654, 0xa656, 0xa658, 0xa65a, 0xa65c,
+    0xa65e, 0xa660, 0xa662, 0xa664, 0xa666, 0xa668,
+    0xa66a, 0xa66c, 0xa680, 0xa682, 0xa684, 0xa686,
+    0xa688, 0xa68a, 0xa68c, 0xa68e, 0xa690, 0xa692,
+    0xa694, 0xa696, 0xa698, 0xa69a, 0xa722, 0xa724,
+    0xa726, 0xa728, 0xa72a, 0xa72c, 0xa72e, 0xa732,
+    0xa734, 0xa736, 0xa738, 0xa73a, 0xa73c, 0xa73e,
+    0xa740, 0xa742, 0xa744, 0xa746, 0xa748, 0xa74a,
+    0xa74c, 0xa74e, 0xa750, 0xa752, 0xa754, 0xa756,
+    0xa758, 0xa75a, 0xa75c, 0xa75e, 0xa760, 0xa762,
+    0xa764, 0xa766, 0xa768, 0xa76a, 0xa76c, 0xa76e,
+    0xa779, 0xa77b, 0xa77d, 0xa77e, 0xa780, 0xa782,
+    0xa784, 0xa786, 0xa78b, 0xa78d, 0xa790, 0xa792,
+    0xa796, 0xa798, 0xa79a, 0xa79c, 0xa79e, 0xa7a0,
+    0xa7a2, 0xa7a4, 0xa7a6, 0xa7a8, 0xa7aa, 0xa7ab,
+    0xa7ac, 0xa7ad, 0xa7ae, 0xa7b0, 0xa7b1, 0xa7b2,
+    0xa7b3, 0xa7b4, 0xa7b6, 0xa7b8, 0xa7ba, 0xa7bc,
+    0xa7be, 0xa7c0, 0xa7c2, 0xa7c4, 0xa7c5, 0xa7c6,
+    0xa7c7, 0xa7c9, 0xa7d0, 0xa7d6, 0xa7d8, 0xa7f5,
+    0xab70, 0xab71, 0xab72, 0xab73, 0xab74, 0xab75,
+    0xab76, 0xab77, 0xab78, 0xab79, 0xab7a, 0xab7b,
+    0xab7c, 0xab7d, 0xab7e, 0xab7f, 0xab80, 0xab81,
+    0xab82, 0xab83, 0xab84, 0xab85, 0xab86, 0xab87,
+    0xab88, 0xab89, 0xab8a, 0xab8b, 0xab8c, 0xab8d,
+    0xab8e, 0xab8f, 0xab90, 0xab91, 0xab92, 0xab93,
+    0xab94, 0xab95, 0xab96, 0xab97, 0xab98, 0xab99,
+    0xab9a, 0xab9b, 0xab9c, 0xab9d, 0xab9e, 0xab9f,
+    0xaba0, 0xaba1, 0xaba2, 0xaba3, 0xaba4, 0xaba5,
+    0xaba6, 0xaba7, 0xaba8, 0xaba9, 0xabaa, 0xabab,
+    0xabac, 0xabad, 0xabae, 0xabaf, 0xabb0, 0xabb1,
+    0xabb2, 0xabb3, 0xabb4, 0xabb5, 0xabb6, 0xabb7,
+    0xabb8, 0xabb9, 0xabba, 0xabbb, 0xabbc, 0xabbd,
+    0xabbe, 0xabbf, 0xfb00, 0xfb01, 0xfb02, 0xfb03,
+    0xfb04, 0xfb05, 0xfb06, 0xfb13, 0xfb14, 0xfb15,
+    0xfb16, 0xfb17, 0xff21, 0xff22, 0xff23, 0xff24,
+    0xff25, 0xff26, 0xff27, 0xff28, 0xff29, 0xff2a,
+    0xff2b, 0xff2c, 0xff2d, 0xff2e, 0xff2f, 0xff30,
+    0xff31, 0xff32, 0xff33, 0xff34, 0xff35, 0xff36,
+    0xff37, 0xff38, 0xff39, 0xff3a, 0x10400, 0x10401,
+    0x10402, 0x10403, 0x10404, 0x10405, 0x10406, 0x10407,
+    0x10408, 0x10409, 0x1040a, 0x1040b, 0x1040c, 0x1040d,
+    0x1040e, 0x1040f, 0x10410, 0x10411, 0x10412, 0x10413,
+    0x10414, 0x10415, 0x10416, 0x10417, 0x10418, 0x10419,
+    0x1041a, 0x1041b, 0x1041c, 0x1041d, 0x1041e, 0x1041f,
+    0x10420, 0x10421, 0x10422, 0x10423, 0x10424, 0x10425,
+    0x10426, 0x10427, 0x104b0, 0x104b1, 0x104b2, 0x104b3,
+    0x104b4, 0x104b5, 0x104b6, 0x104b7, 0x104b8, 0x104b9,
+    0x104ba, 0x104bb, 0x104bc, 0x104bd, 0x104be, 0x104bf,
+    0x104c0, 0x104c1, 0x104c2, 0x104c3, 0x104c4, 0x104c5,
+    0x104c6, 0x104c7, 0x104c8, 0x104c9, 0x104ca, 0x104cb,
+    0x104cc, 0x104cd, 0x104ce, 0x104cf, 0x104d0, 0x104d1,
+    0x104d2, 0x104d3, 0x10570, 0x10571, 0x10572, 0x10573,
+    0x10574, 0x10575, 0x10576, 0x10577, 0x10578, 0x10579,
+    0x1057a, 0x1057c, 0x1057d, 0x1057e, 0x1057f, 0x10580,
+    0x10581, 0x10582, 0x10583, 0x10584, 0x10585, 0x10586,
+    0x10587, 0x10588, 0x10589, 0x1058a, 0x1058c, 0x1058d,
+    0x1058e, 0x1058f, 0x10590, 0x10591, 0x10592, 0x10594,
+    0x10595, 0x10c80, 0x10c81, 0x10c82, 0x10c83, 0x10c84,
+    0x10c85, 0x10c86, 0x10c87, 0x10c88, 0x10c89, 0x10c8a,
+    0x10c8b, 0x10c8c, 0x10c8d, 0x10c8e, 0x10c8f, 0x10c90,
+    0x10c91, 0x10c92, 0x10c93, 0x10c94, 0x10c95, 0x10c96,
+    0x10c97, 0x10c98, 0x10c99, 0x10c9a, 0x10c9b, 0x10c9c,
+    0x10c9d, 0x10c9e, 0x10c9f, 0x10ca0, 0x10ca1, 0x10ca2,
+    0x10ca3, 0x10ca4, 0x10ca5, 0x10ca6, 0x10ca7, 0x10ca8,
+    0x10ca9, 0x10caa, 0x10cab, 0x10cac, 0x10cad, 0x10cae,
+    0x10caf, 0x10cb0, 0x10cb1, 0x10cb2, 0x118a0, 0x118a1,
+    0x118a2, 0x118a3, 0x118a4, 0x118a5, 0x118a6, 0x118a7,
+    0x118a8, 0x118a9, 0x118aa, 0x118ab, 0x118ac, 0x118ad,
+    0x118ae, 0x118af, 0x118b0, 0x118b1, 0x118b2, 0x118b3,
+    0x118b4, 0x118b5, 0x118b6, 0x118b7, 0x118b8, 0x118b9,
+    0x118ba, 0x118bb, 0x118bc, 0x118bd, 0x118be, 0x118bf,
+    0x16e40, 0x16e41, 0x16e42, 0x16e43, 0x16e44, 0x16e45,
+    0x16e46, 0x16e47, 0x16e48, 0x16e49, 0x16e4a, 0x16e4b,
+    0x16e4c, 0x16e4d, 0x16e4e, 0x16e4f, 0x16e50, 0x16e51,
+    0x16e52, 0x16e53, 0x16e54, 0x16e55, 0x16e56, 0x16e57,
+    0x16e58, 0x16e59, 0x16e5a, 0x16e5b, 0x16e5c, 0x16e5d,
+    0x16e5e, 0x16e5f, 0x1e900, 0x1e901, 0x1e902, 0x1e903,
+    0x1e904, 0x1e905, 0x1e906, 0x1e907, 0x1e908, 0x1e909,
+    0x1e90a, 0x1e90b, 0x1e90c, 0x1e90d, 0x1e90e, 0x1e90f,
+    0x1e910, 0x1e911, 0x1e912, 0x1e913, 0x1e914, 0x1e915,
+    0x1e916, 0x1e917, 0x1e918, 0x1e919, 0x1e91a, 0x1e91b,
+    0x1e91c, 0x1e91d, 0x1e91e, 0x1e91f, 0x1e920, 0x1e921
+};
+
+const uint32_t norm_fold_refs[ 1530 ] = {
+    0x46ee1, 0x46f01, 0x46f21, 0x46f41, 0x46f61, 0x46f81,
+    0x46fa1, 0x46fc1, 0x46fe1, 0x47001, 0x47021, 0x47041,
+    0x47061, 0x47081, 0x470a1, 0x470c1, 0x470e1, 0x47101,
+    0x47121, 0x47141, 0x47161, 0x47181, 0x471a1, 0x471c1,
+    0x471e1, 0x47201, 0x47221, 0x47241, 0x47261, 0x47281,
+    0x472a1, 0x472c1, 0x472e1, 0x47301, 0x47321, 0x47341,
+    0x47361, 0x47381, 0x473a1, 0x473c1, 0x473e1, 0x47401,
+    0x47421, 0x47441, 0x47461, 0x47481, 0x474a1, 0x474c1,
+    0x474e1, 0x47501, 0x47521, 0x47541, 0x47561, 0x47581,
+    0x475a1, 0x475c1, 0x475e1, 0x47602, 0x47641, 0x47661,
+    0x47681, 0x476a1, 0x476c1, 0x476e1, 0x47701, 0x47721,
+    0x47741, 0x47761, 0x47781, 0x477a1, 0x477c1, 0x477e1,
+    0x47801, 0x47821, 0x47841, 0x47861, 0x47881, 0x478a1,
+    0x478c1, 0x478e1, 0x47901, 0x47921, 0x47942, 0x47981,
+    0x479a1, 0x479c1, 0x479e1, 0x47a01, 0x47a21, 0x47a41,
+    0x47a61, 0x47a81, 0x47aa1, 0x47ac1, 0x47ae2, 0x47b21,
+    0x47b41, 0x47b61, 0x47b81, 0x47ba1, 0x47bc1, 0x47be1,
+    0x47c01, 0x47c21, 0x47c41, 0x47c61, 0x47c81, 0x47ca1,
+    0x47cc1, 0x47ce1, 0x47d01, 0x47d21, 0x47d41, 0x47d61,
+    0x47d81, 0x47da1, 0x47dc1, 0x47de1, 0x47e01, 0x47e21,
+    0x47e41, 0x47e61, 0x47e81, 0x47ea1, 0x47ec1, 0x47ee1,
+    0x47f01, 0x47f21, 0x47f41, 0x47f61, 0x47f81, 0x47fa1,
+    0x47fc1, 0x47fe1, 0x48001, 0x48021, 0x48041, 0x48061,
+    0x48081, 0x480a1, 0x480c1, 0x480e1, 0x48101, 0x48121,
+    0x48141, 0x48161, 0x48181, 0x481a1, 0x481c1, 0x481e1,
+    0x48201, 0x48221, 0x48241, 0x48261, 0x48281, 0x482a1,
+    0x482c1, 0x482e1, 0x48301, 0x48321, 0x48341, 0x48361,
+    0x48381, 0x483a1, 0x483c1, 0x483e1, 0x48401, 0x48421,
+    0x48441, 0x48461, 0x48481, 0x484a1, 0x484c1, 0x484e1,
+    0x48501, 0x48521, 0x48541, 0x48561, 0x48581, 0x485a1,
+    0x485c1, 0x485e1, 0x48602, 0x48641, 0x48661, 0x48681,
+    0x486a1, 0x486c1, 0x486e1, 0x48701, 0x48721, 0x48741,
+    0x48761, 0x48781, 0x487a1, 0x487c1, 0x487e1, 0x48801,
+    0x48821, 0x48841, 0x48861, 0x48881, 0x488a1, 0x488c1,
+    0x488e1, 0x48901, 0x48921, 0x48941, 0x48961, 0x48981,
+    0x489a1, 0x489c1, 0x489e1, 0x48a01, 0x48a21, 0x48a41,
+    0x48a61, 0x48a81, 0x48aa1, 0x48ac1, 0x48ae1, 0x48b01,
+    0x48b21, 0x48b41, 0x48b61, 0x48b81, 0x48ba1, 0x48bc1,
+    0x48be1, 0x48c01, 0x48c21, 0x48c41, 0x48c61, 0x48c81,
+    0x48ca1, 0x48cc1, 0x48ce1, 0x48d01, 0x48d21, 0x48d41,
+    0x48d61, 0x48d81, 0x48da1, 0x48dc3, 0x48e21, 0x48e41,
+    0x48e61, 0x48e81, 0x48ea1, 0x48ec1, 0x48ee1, 0x48f01,
+    0x48f21, 0x48f41, 0x48f61, 0x48f81, 0x48fa1, 0x48fc1,
+    0x48fe1, 0x49001, 0x49021, 0x49041, 0x49061, 0x49081,
+    0x490a1, 0x490c1, 0x490e1, 0x49101, 0x49121, 0x49141,
+    0x49163, 0x491c1, 0x491e1, 0x49201, 0x49221, 0x49241,
+    0x49261, 0x49281, 0x492a1, 0x492c1, 0x492e1, 0x49301,
+    0x49321, 0x49341, 0x49361, 0x49381, 0x493a1, 0x493c1,
+    0x493e1, 0x49401, 0x49421, 0x49441, 0x49461, 0x49481,
+    0x494a1, 0x494c1, 0x494e1, 0x49501, 0x49521, 0x49541,
+    0x49561, 0x49581, 0x495a1, 0x495c1, 0x495e1, 0x49601,
+    0x49621, 0x49641, 0x49661, 0x49681, 0x496a1, 0x496c1,
+    0x496e1, 0x49701, 0x49721, 0x49741, 0x49761, 0x49781,
+    0x497a1, 0x497c1, 0x497e1, 0x49801, 0x49821, 0x49841,
+    0x49861, 0x49881, 0x498a1, 0x498c1, 0x498e1, 0x49901,
+    0x49921, 0x49941, 0x49961, 0x49981, 0x499a1, 0x499c1,
+    0x499e1, 0x49a01, 0x49a21, 0x49a41, 0x49a61, 0x49a81,
+    0x49aa1, 0x49ac1, 0x49ae1, 0x49b01, 0x49b21, 0x49b41,
+    0x49b61, 0x49b81, 0x49ba1, 0x49bc1, 0x49be1, 0x49c01,
+    0x49c21, 0x49c41, 0x49c61, 0x49c81, 0x49ca1, 0x49cc1,
+    0x49ce1, 0x49d01, 0x49d21, 0x49d41, 0x49d61, 0x49d81,
+    0x49da1, 0x49dc1, 0x49de1, 0x49e01, 0x49e21, 0x49e41,
+    0x49e61, 0x49e81, 0x49ea1, 0x49ec1, 0x49ee1, 0x49f01,
+    0x49f21, 0x49f41, 0x49f61, 0x49f81, 0x49fa1, 0x49fc1,
+    0x49fe1, 0x4a001, 0x4a021, 0x4a041, 0x4a061, 0x4a081,
+    0x4a0a1, 0x4a0c1, 0x4a0e1, 0x4a101, 0x4a121, 0x4a141,
+    0x4a161, 0x4a181, 0x4a1a1, 0x4a1c1, 0x4a1e1, 0x4a201,
+    0x4a221, 0x4a241, 0x4a261, 0x4a281, 0x4a2a1, 0x4a2c1,
+    0x4a2e1, 0x4a301, 0x4a321, 0x4a341, 0x4a361, 0x4a381,
+    0x4a3a1, 0x4a3c1, 0x4a3e1, 0x4a401, 0x4a421, 0x4a441,
+    0x4a461, 0x4a481, 0x4a4a1, 0x4a4c1, 0x4a4e1, 0x4a501,
+    0x4a521, 0x4a541, 0x4a561, 0x4a581, 0x4a5a1, 0x4a5c1,
+    0x4a5e1, 0x4a601, 0x4a621, 0x4a641, 0x4a661, 0x4a681,
+    0x4a6a1, 0x4a6c1, 0x4a6e1, 0x4a701, 0x4a721, 0x4a741,
+    0x4a761, 0x4a781, 0x4a7a1, 0x4a7c1, 0x4a7e1, 0x4a801,
+    0x4a821, 0x4a841, 0x4a861, 0x4a881, 0x4a8a1, 0x4a8c1,
+    0x4a8e1, 0x4a901, 0x4a921, 0x4a941, 0x4a961, 0x4a981,
+    0x4a9a1, 0x4a9c1, 0x4a9e1, 0x4aa01, 0x4aa21, 0x4aa41,
+    0x4aa61, 0x4aa81, 0x4aaa1, 0x4aac1, 0x4aae1, 0x4ab01,
+    0x4ab21, 0x4ab41, 0x4ab61, 0x4ab81, 0x4aba1, 0x4abc1,
+    0x4abe1, 0x4ac01, 0x4ac21, 0x4ac41, 0x4ac61, 0x4ac82,
+    0x4acc1, 0x4ace1, 0x4ad01, 0x4ad21, 0x4ad41, 0x4ad61,
+    0x4ad81, 0x4ada1, 0x4adc1, 0x4ade1, 0x4ae01, 0x4ae21,
+    0x4ae41, 0x4ae61, 0x4ae81, 0x4aea1, 0x4aec1, 0x4aee1,
+    0x4af01, 0x4af21, 0x4af41, 0x4af61, 0x4af81, 0x4afa1,
+    0x4afc1, 0x4afe1, 0x4b001, 0x4b021, 0x4b041, 0x4b061,
+    0x4b081, 0x4b0a1, 0x4b0c1, 0x4b0e1, 0x4b101, 0x4b121,
+    0x4b141, 0x4b161, 0x4b181, 0x4b1a1, 0x4b1c1, 0x4b1e1,
+    0x4b201, 0x4b221, 0x4b241, 0x4b261, 0x4b281, 0x4b2a1,
+    0x4b2c1, 0x4b2e1, 0x4b301, 0x4b321, 0x4b341, 0x4b361,
+    0x4b381, 0x4b3a1, 0x4b3c1, 0x4b3e1, 0x4b401, 0x4b421,
+    0x4b441, 0x4b461, 0x4b481, 0x4b4a1, 0x4b4c1, 0x4b4e1,
+    0x4b501, 0x4b521, 0x4b541, 0x4b561, 0x4b581, 0x4b5a1,
+    0x4b5c1, 0x4b5e1, 0x4b601, 0x4b621, 0x4b641, 0x4b661,
+    0x4b681, 0x4b6a1, 0x4b6c1, 0x4b6e1, 0x4b701, 0x4b721,
+    0x4b741, 0x4b761, 0x4b781, 0x4b7a1, 0x4b7c1, 0x4b7e1,
+    0x4b801, 0x4b821, 0x4b841, 0x4b861, 0x4b881, 0x4b8a1,
+    0x4b8c1, 0x4b8e1, 0x4b901, 0x4b921, 0x4b941, 0x4b961,
+    0x4b981, 0x4b9a1, 0x4b9c1, 0x4b9e1, 0x4ba01, 0x4ba21,
+    0x4ba41, 0x4ba61, 0x4ba81, 0x4baa1, 0x4bac1, 0x4bae1,
+    0x4bb01, 0x4bb21, 0x4bb41, 0x4bb61, 0x4bb81, 0x4bba1,
+    0x4bbc1, 0x4bbe1, 0x4bc01, 0x4bc21, 0x4bc41, 0x4bc61,
+    0x4bc81, 0x4bca1, 0x4bcc1, 0x4bce1, 0x4bd01, 0x4bd21,
+    0x4bd41, 0x4bd61, 0x4bd81, 0x4bda1, 0x4bdc1, 0x4bde1,
+    0x4be01, 0x4be21, 0x4be41, 0x4be61, 0x4be81, 0x4bea1,
+    0x4bec1, 0x4bee1, 0x4bf01, 0x4bf21, 0x4bf41, 0x4bf61,
+    0x4bf81, 0x4bfa1, 0x4bfc1, 0x4bfe1, 0x4c001, 0x4c021,
+    0x4c041, 0x4c061, 0x4c081, 0x4c0a1, 0x4c0c1, 0x4c0e1,
+    0x4c101, 0x4c121, 0x4c141, 0x4c161, 0x4c181, 0x4c1a1,
+    0x4c1c1, 0x4c1e1, 0x4c201, 0x4c221, 0x4c241, 0x4c261,
+    0x4c281, 0x4c2a1, 0x4c2c2, 0x4c302, 0x4c342, 0x4c382,
+    0x4c3c2, 0x4c401, 0x4c422, 0x4c461, 0x4c481, 0x4c4a1,
+    0x4c4c1, 0x4c4e1, 0x4c501, 0x4c521, 0x4c541, 0x4c561,
+    0x4c581, 0x4c5a1, 0x4c5c1, 0x4c5e1, 0x4c601, 0x4c621,
+    0x4c641, 0x4c661, 0x4c681, 0x4c6a1, 0x4c6c1, 0x4c6e1,
+    0x4c701, 0x4c721, 0x4c741, 0x4c761, 0x4c781, 0x4c7a1,
+    0x4c7c1, 0x4c7e1, 0x4c801, 0x4c821, 0x4c841, 0x4c861,
+    0x4c881, 0x4c8a1, 0x4c8c1, 0x4c8e1, 0x4c901, 0x4c921,
+    0x4c941, 0x4c961, 0x4c981, 0x4c9a1, 0x4c9c1, 0x4c9e1,
+    0x4ca01, 0x4ca21, 0x4ca41, 0x4ca61, 0x4ca81, 0x4caa1,
+    0x4cac1, 0x4cae1, 0x4cb01, 0x4cb21, 0x4cb41, 0x4cb61,
+    0x4cb81, 0x4cba1, 0x4cbc1, 0x4cbe1, 0x4cc01, 0x4cc21,
+    0x4cc41, 0x4cc61, 0x4cc81, 0x4cca1, 0x4ccc1, 0x4cce1,
+    0x4cd01, 0x4cd21, 0x4cd41, 0x4cd61, 0x4cd81, 0x4cda1,
+    0x4cdc1, 0x4cde1, 0x4ce01, 0x4ce21, 0x4ce41, 0x4ce61,
+    0x4ce81, 0x4cea1, 0x4cec1, 0x4cee2, 0x4cf23, 0x4cf83,
+    0x4cfe3, 0x4d041, 0x4d061, 0x4d081, 0x4d0a1, 0x4d0c1,
+    0x4d0e1, 0x4d101, 0x4d121, 0x4d141, 0x4d161, 0x4d181,
+    0x4d1a1, 0x4d1c2, 0x4d202, 0x4d242, 0x4d282, 0x4d2c2,
+    0x4d302, 0x4d342, 0x4d382, 0x4d3c2, 0x4d402, 0x4d442,
+    0x4d482, 0x4d4c2, 0x4d502, 0x4d542, 0x4d582, 0x4d5c2,
+    0x4d602, 0x4d642, 0x4d682, 0x4d6c2, 0x4d702, 0x4d742,
+    0x4d782, 0x4d7c2, 0x4d802, 0x4d842, 0x4d882, 0x4d8c2,
+    0x4d902, 0x4d942, 0x4d982, 0x4d9c2, 0x4da02, 0x4da42,
+    0x4da82, 0x4dac2, 0x4db02, 0x4db42, 0x4db82, 0x4dbc2,
+    0x4dc02, 0x4dc42, 0x4dc82, 0x4dcc2, 0x4dd02, 0x4dd42,
+    0x4dd82, 0x4ddc2, 0x4de02, 0x4de42, 0x4de82, 0x4dec3,
+    0x4df21, 0x4df41, 0x4df61, 0x4df81, 0x4dfa2, 0x4dfe1,
+    0x4e002, 0x4e042, 0x4e082, 0x4e0c2, 0x4e103, 0x4e161,
+    0x4e181, 0x4e1a1, 0x4e1c1, 0x4e1e2, 0x4e223, 0x4e283,
+    0x4e2e2, 0x4e323, 0x4e381, 0x4e3a1, 0x4e3c1, 0x4e3e1,
+    0x4e403, 0x4e463, 0x4e4c2, 0x4e502, 0x4e543, 0x4e5a1,
+    0x4e5c1, 0x4e5e1, 0x4e601, 0x4e621, 0x4e642, 0x4e682,
+    0x4e6c2, 0x4e702, 0x4e743, 0x4e7a1, 0x4e7c1, 0x4e7e1,
+    0x4e801, 0x4e822, 0x4e861, 0x4e881, 0x4e8a1, 0x4e8c1,
+    0x4e8e1, 0x4e901, 0x4e921, 0x4e941, 0x4e961, 0x4e981,
+    0x4e9a1, 0x4e9c1, 0x4e9e1, 0x4ea01, 0x4ea21, 0x4ea41,
+    0x4ea61, 0x4ea81, 0x4eaa1, 0x4eac1, 0x4eae1, 0x4eb01,
+    0x4eb21, 0x4eb41, 0x4eb61, 0x4eb81, 0x4eba1, 0x4ebc1,
+    0x4ebe1, 0x4ec01, 0x4ec21, 0x4ec41, 0x4ec61, 0x4ec81,
+    0x4eca1, 0x4ecc1, 0x4ece1, 0x4ed01, 0x4ed21, 0x4ed41,
+    0x4ed61, 0x4ed81, 0x4eda1, 0x4edc1, 0x4ede1, 0x4ee01,
+    0x4ee21, 0x4ee41, 0x4ee61, 0x4ee81, 0x4eea1, 0x4eec1,
+    0x4eee1, 0x4ef01, 0x4ef21, 0x4ef41, 0x4ef61, 0x4ef81,
+    0x4efa1, 0x4efc1, 0x4efe1, 0x4f001, 0x4f021, 0x4f041,
+    0x4f061, 0x4f081, 0x4f0a1, 0x4f0c1, 0x4f0e1, 0x4f101,
+    0x4f121, 0x4f141, 0x4f161, 0x4f181, 0x4f1a1, 0x4f1c1,
+    0x4f1e1, 0x4f201, 0x4f221, 0x4f241, 0x4f261, 0x4f281,
+    0x4f2a1, 0x4f2c1, 0x4f2e1, 0x4f301, 0x4f321, 0x4f341,
+    0x4f361, 0x4f381, 0x4f3a1, 0x4f3c1, 0x4f3e1, 0x4f401,
+    0x4f421, 0x4f441, 0x4f461, 0x4f481, 0x4f4a1, 0x4f4c1,
+    0x4f4e1, 0x4f501, 0x4f521, 0x4f541, 0x4f561, 0x4f581,
+    0x4f5a1, 0x4f5c1, 0x4f5e1, 0x4f601, 0x4f621, 0x4f641,
+    0x4f661, 0x4f681, 0x4f6a1, 0x4f6c1, 0x4f6e1, 0x4f701,
+    0x4f721, 0x4f741, 0x4f761, 0x4f781, 0x4f7a1, 0x4f7c1,
+    0x4f7e1, 0x4f801, 0x4f821, 0x4f841, 0x4f861, 0x4f881,
+    0x4f8a1, 0x4f8c1, 0x4f8e1, 0x4f901, 0x4f921, 0x4f941,
+    0x4f961, 0x4f981, 0x4f9a1, 0x4f9c1, 0x4f9e1, 0x4fa01,
+    0x4fa21, 0x4fa41, 0x4fa61, 0x4fa81, 0x4faa1, 0x4fac1,
+    0x4fae1, 0x4fb01, 0x4fb21, 0x4fb41, 0x4fb61, 0x4fb81,
+    0x4fba1, 0x4fbc1, 0x4fbe1, 0x4fc01, 0x4fc21, 0x4fc41,
+    0x4fc61, 0x4fc81, 0x4fca1, 0x4fcc1, 0x4fce1, 0x4fd01,
+    0x4fd21, 0x4fd41, 0x4fd61, 0x4fd81, 0x4fda1, 0x4fdc1,
+    0x4fde1, 0x4fe01, 0x4fe21, 0x4fe41, 0x4fe61, 0x4fe81,
+    0x4fea1, 0x4fec1, 0x4fee1, 0x4ff01, 0x4ff21, 0x4ff41,
+    0x4ff61, 0x4ff81, 0x4ffa1, 0x4ffc1, 0x4ffe1, 0x50001,
+    0x50021, 0x50041, 0x50061, 0x50081, 0x500a1, 0x500c1,
+    0x500e1, 0x50101, 0x50121, 0x50141, 0x50161, 0x50181,
+    0x501a1, 0x501c1, 0x501e1, 0x50201, 0x50221, 0x50241,
+    0x50261, 0x50281, 0x502a1, 0x502c1, 0x502e1, 0x50301,
+    0x50321, 0x50341, 0x50361, 0x50381, 0x503a1, 0x503c1,
+    0x503e1, 0x50401, 0x50421, 0x50441, 0x50461, 0x50481,
+    0x504a1, 0x504c1, 0x504e1, 0x50501, 0x50521, 0x50541,
+    0x50561, 0x50581, 0x505a1, 0x505c1, 0x505e1, 0x50601,
+    0x50621, 0x50641, 0x50661, 0x50681, 0x506a1, 0x506c1,
+    0x506e1, 0x50701, 0x50721, 0x50741, 0x50761, 0x50781,
+    0x507a1, 0x507c1, 0x507e1, 0x50801, 0x50821, 0x50841,
+    0x50861, 0x50881, 0x508a1, 0x508c1, 0x508e1, 0x50901,
+    0x50921, 0x50941, 0x50961, 0x50981, 0x509a1, 0x509c1,
+    0x509e1, 0x50a01, 0x50a21, 0x50a41, 0x50a61, 0x50a81,
+    0x50aa1, 0x50ac1, 0x50ae1, 0x50b01, 0x50b21, 0x50b41,
+    0x50b61, 0x50b81, 0x50ba1, 0x50bc1, 0x50be1, 0x50c01,
+    0x50c21, 0x50c41, 0x50c61, 0x50c81, 0x50ca1, 0x50cc1,
+    0x50ce1, 0x50d01, 0x50d21, 0x50d41, 0x50d61, 0x50d81,
+    0x50da1, 0x50dc1, 0x50de1, 0x50e01, 0x50e21, 0x50e41,
+    0x50e61, 0x50e81, 0x50ea1, 0x50ec1, 0x50ee1, 0x50f01,
+    0x50f21, 0x50f41, 0x50f61, 0x50f81, 0x50fa1, 0x50fc1,
+    0x50fe1, 0x51001, 0x51021, 0x51041, 0x51061, 0x51081,
+    0x510a1, 0x510c1, 0x510e1, 0x51101, 0x51121, 0x51141,
+    0x51161, 0x51181, 0x511a1, 0x511c1, 0x511e1, 0x51201,
+    0x51221, 0x51241, 0x51261, 0x51281, 0x512a1, 0x512c1,
+    0x512e1, 0x51301, 0x51321, 0x51341, 0x51361, 0x51381,
+    0x513a1, 0x513c1, 0x513e1, 0x51401, 0x51421, 0x51441,
+    0x51461, 0x51481, 0x514a1, 0x514c1, 0x514e1, 0x51501,
+    0x51521, 0x51541, 0x51561, 0x51581, 0x515a1, 0x515c1,
+    0x515e1, 0x51601, 0x51622, 0x51662, 0x516a2, 0x516e3,
+    0x51743, 0x517a2, 0x517e2, 0x51822, 0x51862, 0x518a2,
+    0x518e2, 0x51922, 0x51961, 0x51981, 0x519a1, 0x519c1,
+    0x519e1, 0x51a01, 0x51a21, 0x51a41, 0x51a61, 0x51a81,
+    0x51aa1, 0x51ac1, 0x51ae1, 0x51b01, 0x51b21, 0x51b41,
+    0x51b61, 0x51b81, 0x51ba1, 0x51bc1, 0x51be1, 0x51c01,
+    0x51c21, 0x51c41, 0x51c61, 0x51c81, 0x51ca1, 0x51cc1,
+    0x51ce1, 0x51d01, 0x51d21, 0x51d41, 0x51d61, 0x51d81,
+    0x51da1, 0x51dc1, 0x51de1, 0x51e01, 0x51e21, 0x51e41,
+    0x51e61, 0x51e81, 0x51ea1, 0x51ec1, 0x51ee1, 0x51f01,
+    0x51f21, 0x51f41, 0x51f61, 0x51f81, 0x51fa1, 0x51fc1,
+    0x51fe1, 0x52001, 0x52021, 0x52041, 0x52061, 0x52081,
+    0x520a1, 0x520c1, 0x520e1, 0x52101, 0x52121, 0x52141,
+    0x52161, 0x52181, 0x521a1, 0x521c1, 0x521e1, 0x52201,
+    0x52221, 0x52241, 0x52261, 0x52281, 0x522a1, 0x522c1,
+    0x522e1, 0x52301, 0x52321, 0x52341, 0x52361, 0x52381,
+    0x523a1, 0x523c1, 0x523e1, 0x52401, 0x52421, 0x52441,
+    0x52461, 0x52481, 0x524a1, 0x524c1, 0x524e1, 0x52501,
+    0x52521, 0x52541, 0x52561, 0x52581, 0x525a1, 0x525c1,
+    0x525e1, 0x52601, 0x52621, 0x52641, 0x52661, 0x52681,
+    0x526a1, 0x526c1, 0x526e1, 0x52701, 0x52721, 0x52741,
+    0x52761, 0x52781, 0x527a1, 0x527c1, 0x527e1, 0x52801,
+    0x52821, 0x52841, 0x52861, 0x52881, 0x528a1, 0x528c1,
+    0x528e1, 0x52901, 0x52921, 0x52941, 0x52961, 0x52981,
+    0x529a1, 0x529c1, 0x529e1, 0x52a01, 0x52a21, 0x52a41,
+    0x52a61, 0x52a81, 0x52aa1, 0x52ac1, 0x52ae1, 0x52b01,
+    0x52b21, 0x52b41, 0x52b61, 0x52b81, 0x52ba1, 0x52bc1,
+    0x52be1, 0x52c01, 0x52c21, 0x52c41, 0x52c61, 0x52c81,
+    0x52ca1, 0x52cc1, 0x52ce1, 0x52d01, 0x52d21, 0x52d41,
+    0x52d61, 0x52d81, 0x52da1, 0x52dc1, 0x52de1, 0x52e01,
+    0x52e21, 0x52e41, 0x52e61, 0x52e81, 0x52ea1, 0x52ec1,
+    0x52ee1, 0x52f01, 0x52f21, 0x52f41, 0x52f61, 0x52f81,
+    0x52fa1, 0x52fc1, 0x52fe1, 0x53001, 0x53021, 0x53041,
+    0x53061, 0x53081, 0x530a1, 0x530c1, 0x530e1, 0x53101,
+    0x53121, 0x53141, 0x53161, 0x53181, 0x531a1, 0x531c1,
+    0x531e1, 0x53201, 0x53221, 0x53241, 0x53261, 0x53281,
+    0x532a1, 0x532c1, 0x532e1, 0x53301, 0x53321, 0x53341,
+    0x53361, 0x53381, 0x533a1, 0x533c1, 0x533e1, 0x53401,
+    0x53421, 0x53441, 0x53461, 0x53481, 0x534a1, 0x534c1,
+    0x534e1, 0x53501, 0x53521, 0x53541, 0x53561, 0x53581,
+    0x535a1, 0x535c1, 0x535e1, 0x53601, 0x53621, 0x53641,
+    0x53661, 0x53681, 0x536a1, 0x536c1, 0x536e1, 0x53701,
+    0x53721, 0x53741, 0x53761, 0x53781, 0x537a1, 0x537c1,
+    0x537e1, 0x53801, 0x53821, 0x53841, 0x53861, 0x53881,
+    0x538a1, 0x538c1, 0x538e1, 0x53901, 0x53921, 0x53941,
+    0x53961, 0x53981, 0x539a1, 0x539c1, 0x539e1, 0x53a01,
+    0x53a21, 0x53a41, 0x53a61, 0x53a81, 0x53aa1, 0x53ac1,
+    0x53ae1, 0x53b01, 0x53b21, 0x53b41, 0x53b61, 0x53b81,
+    0x53ba1, 0x53bc1, 0x53be1, 0x53c01, 0x53c21, 0x53c41,
+    0x53c61, 0x53c81, 0x53ca1, 0x53cc1, 0x53ce1, 0x53d01
+};
@@ -0,0 +1,69 @@
+//
+// The Unicode normalization and case folding tables, compiled in for the
+//   name_normalizer class.  The norm-table.cc source is made from the
+//   UnicodeData.txt, CompositionExclusions.txt and CaseFolding.txt files
+//   of the Unicode Character Database by the mk-norm-table program in the
+//   uni-utils folder and is not edited by hand.
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// A cp_ref is the index of the first code point of a mapping in
+//   norm_cps_data shifted up 5 bits, with the count of its code points in
+//   the low 5 bits, the same way the ce_refs of ducet-table.h are made.
+//
+// The code points with a canonical combining class other than 0 are in
+//   norm_cccs, in code point order, with the code point shifted up 8 bits
+//   and the class in the low 8 bits.
+//
+// The code points with a decomposition are norm_decomp_cps, in code
+//   point order.  The cp_ref at the same index of norm_canon_refs is the
+//   full canonical decomposition, or 0 when the code point only has a
+//   compatibility one, and the cp_ref of norm_compat_refs is the full
+//   compatibility decomposition, which is the canonical one when there is
+//   no compatibility mapping along the way.  The Hangul syllables are not
+//   in the tables since they are decomposed by formula.
+//
+// The primary composites are 3 values each in norm_comps, the starter and
+//   the code point that follows it, then the composite, in the order of
+//   the starter and then the second code point.  Those are the canonical
+//   pairs that are not in the composition exclusions.
+//
+// The full case folding, the C and F lines of CaseFolding.txt, is the
+//   code points norm_fold_cps, in code point order, with their cp_refs at
+//   the same index of norm_fold_refs.
+//
+
+#ifndef NORM_TABLE_H
+#define NORM_TABLE_H
+
+#include <cstdint>
+
+extern const char *const norm_version;
+extern const int norm_ccc_cnt;
+extern const int norm_decomp_cnt;
+extern const int norm_comp_cnt;
+extern const int norm_fold_cnt;
+extern const uint32_t norm_cps_data[];
+extern const uint32_t norm_cccs[];
+extern const uint32_t norm_decomp_cps[];
+extern const uint32_t norm_canon_refs[];
+extern const uint32_t norm_compat_refs[];
+extern const uint32_t norm_comps[];
+extern const uint32_t norm_fold_cps[];
+extern const uint32_t norm_fold_refs[];
+
+#endif  //  NORM_TABLE_H
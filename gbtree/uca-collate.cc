@@ -0,0 +1,412 @@
+//
+// This file contains the code to implement the Unicode Collation Algorithm
+//   compare of the UTF-8 name strings with the compiled in DUCET
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// Use the following commands to build this object, save it to the library,
+//    and display the library contents:
+//
+//   g++ -std=c++17 -c uca-collate.cc
+//   ar -Prs ~/data/lib/libfoutil.a uca-collate.o
+//   ar -Ptv ~/data/lib/libfoutil.a
+
+#include "uca-collate.h"
+#include "ducet-table.h"
+#include <algorithm>
+#include <cstring>
+
+//
+// The Unified_Ideograph ranges of Unicode 13.0, the version of the DUCET
+//   in ducet-table.cc.  The ones in the CJK Unified Ideographs and CJK
+//   Compatibility Ideographs blocks get the 0xFB40 base weight and the
+//   ones in the extension blocks get 0xFB80.
+static const uint32_t core_han[][ 2 ] = {
+    { 0x4e00, 0x9ffc }, { 0xfa0e, 0xfa0f }, { 0xfa11, 0xfa11 },
+    { 0xfa13, 0xfa14 }, { 0xfa1f, 0xfa1f }, { 0xfa21, 0xfa21 },
+    { 0xfa23, 0xfa24 }, { 0xfa27, 0xfa29 } };
+static const uint32_t ext_han[][ 2 ] = {
+    { 0x3400, 0x4dbf }, { 0x20000, 0x2a6dd }, { 0x2a700, 0x2b734 },
+    { 0x2b740, 0x2b81d }, { 0x2b820, 0x2cea1 }, { 0x2ceb0, 0x2ebe0 },
+    { 0x30000, 0x3134a } };
+
+//
+// The Hangul syllables and the jamo they are made of
+static const uint32_t hangul_first = 0xac00;
+static const uint32_t hangul_last = 0xd7a3;
+static const uint32_t jamo_l_first = 0x1100;
+static const uint32_t jamo_v_first = 0x1161;
+static const uint32_t jamo_t_first = 0x11a7;
+static const uint32_t jamo_v_cnt = 21;
+static const uint32_t jamo_t_cnt = 28;
+
+uca_collator::uca_collator()
+  : tables_made( false )
+  , var_wgt( shifted )
+  , num_levels( 4 )
+  , after_variable( false )
+{
+    memset( ascii_ces, 0, sizeof( ascii_ces ) );
+    memset( ascii_fast, 0, sizeof( ascii_fast ) );
+}
+
+string uca_collator::get_version() const
+{
+    return ducet_version;
+}
+
+uint32_t uca_collator::find_contr( uint32_t cp_1, uint32_t cp_2,
+  uint32_t cp_3 )
+{
+    int lo = 0, hi = ducet_contr_cnt;
+    while ( lo < hi )
+    {
+        int mid = lo + ( hi - lo ) / 2;
+        const uint32_t *contr = &ducet_contrs[ mid * 4 ];
+        bool less = contr[ 0 ] != cp_1 ? contr[ 0 ] < cp_1 :
+          ( contr[ 1 ] != cp_2 ? contr[ 1 ] < cp_2 : contr[ 2 ] < cp_3 );
+        if ( less ) lo = mid + 1;
+        else hi = mid;
+    }
+    if ( lo < ducet_contr_cnt && ducet_contrs[ lo * 4 ] == cp_1 &&
+      ducet_contrs[ lo * 4 + 1 ] == cp_2 && ducet_contrs[ lo * 4 + 2 ] == cp_3 )
+      return ducet_contrs[ lo * 4 + 3 ];
+    return 0;
+}
+
+void uca_collator::implicit_ces( uint32_t code_pt, uint32_t ces[ 2 ] )
+{
+    uint32_t wgt_a = 0, wgt_b = 0;
+    for ( int idx = 0; idx < ducet_implicit_cnt && wgt_a == 0; idx++ )
+    {
+        const uint32_t *impl = &ducet_implicits[ idx * 4 ];
+        if ( code_pt < impl[ 0 ] || code_pt > impl[ 1 ] ) continue;
+        wgt_a = impl[ 3 ];
+        wgt_b = ( code_pt - impl[ 2 ] ) | 0x8000;
+    }
+    if ( wgt_a == 0 )
+    {
+        uint32_t base = 0xfbc0;
+        for ( auto& range : core_han )
+          if ( code_pt >= range[ 0 ] && code_pt <= range[ 1 ] ) base = 0xfb40;
+        for ( auto& range : ext_han )
+          if ( code_pt >= range[ 0 ] && code_pt <= range[ 1 ] ) base = 0xfb80;
+        wgt_a = base + ( code_pt >> 15 );
+        wgt_b = ( code_pt & 0x7fff ) | 0x8000;
+    }
+    //
+    // [.AAAA.0020.0002][.BBBB.0000.0000] packed as ducet-table.h describes
+    ces[ 0 ] = wgt_a << 16 | 0x20 << 7 | 0x02 << 2;
+    ces[ 1 ] = wgt_b << 16;
+}
+
+uint32_t uca_collator::find_single( uint32_t code_pt ) const
+{
+    if ( code_pt < fast_cp_lim ) return fast_ce_refs[ code_pt ];
+    const uint32_t *cps_end = ducet_cps + ducet_single_cnt;
+    const uint32_t *found = lower_bound( ducet_cps, cps_end, code_pt );
+    if ( found == cps_end || *found != code_pt ) return 0;
+    return ducet_ce_refs[ found - ducet_cps ];
+}
+
+bool uca_collator::starts_contr( uint32_t code_pt ) const
+{
+    if ( code_pt < fast_cp_lim ) return fast_contr_start[ code_pt ];
+    return binary_search( contr_starts.begin(), contr_starts.end(), code_pt );
+}
+
+void uca_collator::setup( variable_wgt var_set )
+{
+    var_wgt = var_set;
+    num_levels = var_wgt == shifted ? 4 : 3;
+    fast_ce_refs.assign( fast_cp_lim, 0 );
+    fast_contr_start.assign( fast_cp_lim, false );
+    contr_starts.clear();
+    for ( int idx = 0; idx < ducet_single_cnt; idx++ )
+      if ( ducet_cps[ idx ] < fast_cp_lim )
+        fast_ce_refs[ ducet_cps[ idx ] ] = ducet_ce_refs[ idx ];
+    for ( int idx = 0; idx < ducet_contr_cnt; idx++ )
+    {
+        uint32_t cp_1 = ducet_contrs[ idx * 4 ];
+        if ( cp_1 < fast_cp_lim ) fast_contr_start[ cp_1 ] = true;
+        if ( contr_starts.empty() || contr_starts.back() != cp_1 )
+          contr_starts.push_back( cp_1 );
+    }
+    //
+    // An ASCII byte can use the table when it has one element that weighs
+    //   the same wherever it is in the string, which leaves out a primary
+    //   ignorable that isn't completely ignorable since those weigh
+    //   nothing after a variable, and when it doesn't start a contraction
+    //   that is all ASCII.
+    for ( uint32_t ch_val = 0; ch_val < 128; ch_val++ )
+    {
+        uint32_t ce_ref = fast_ce_refs[ ch_val ];
+        ascii_fast[ ch_val ] = false;
+        if ( ( ce_ref & 0x1f ) != 1 ) continue;
+        uint32_t ce = ducet_ces[ ce_ref >> 5 ];
+        if ( ducet_primary( ce ) == 0 && ( ce & ~uint32_t( 1 ) ) != 0 )
+          continue;
+        after_variable = false;
+        ascii_ces[ ch_val ] = weigh( ce );
+        ascii_fast[ ch_val ] = true;
+    }
+    for ( int idx = 0; idx < ducet_contr_cnt; idx++ )
+    {
+        const uint32_t *contr = &ducet_contrs[ idx * 4 ];
+        if ( contr[ 0 ] < 128 && contr[ 1 ] < 128 && contr[ 2 ] < 128 )
+          ascii_fast[ contr[ 0 ] ] = false;
+    }
+    tables_made = true;
+}
+
+uint64_t uca_collator::weigh( uint32_t ce )
+{
+    uint64_t pri = ducet_primary( ce );
+    uint64_t sec = ducet_secondary( ce );
+    uint64_t ter = ducet_tertiary( ce );
+    if ( var_wgt == non_ignorable ) return pri << 48 | sec << 32 | ter << 16;
+    //
+    // The shifted weighting of UTS #10, where a variable element only has
+    //   its primary as the fourth level and the primary ignorables after
+    //   one weigh nothing.
+    if ( pri == 0 && sec == 0 && ter == 0 ) return 0;
+    if ( ducet_variable( ce ) )
+    {
+        after_variable = true;
+        return pri;
+    }
+    if ( pri == 0 )
+    {
+        if ( after_variable ) return 0;
+        return sec << 32 | ter << 16 | 0xffff;
+    }
+    after_variable = false;
+    return pri << 48 | sec << 32 | ter << 16 | 0xffff;
+}
+
+void uca_collator::add_ce_ref( uint32_t ce_ref, vector<uint64_t>& ces )
+{
+    const uint32_t *ce_ptr = &ducet_ces[ ce_ref >> 5 ];
+    for ( uint32_t idx = 0; idx < ( ce_ref & 0x1f ); idx++ )
+      ces.push_back( weigh( ce_ptr[ idx ] ) );
+}
+
+void uca_collator::get_ces( const char *str, size_t len,
+  vector<uint64_t>& ces )
+{
+    //
+    // The code points first, with a bad UTF-8 byte taken as U+FFFD
+    cp_buf.clear();
+    const unsigned char *ustr = reinterpret_cast<const unsigned char *>( str );
+    for ( size_t idx = 0; idx < len; )
+    {
+        uint32_t lead = ustr[ idx ];
+        int num_trail = lead < 0x80 ? 0 : ( lead < 0xc2 ? -1 : ( lead < 0xe0 ?
+          1 : ( lead < 0xf0 ? 2 : ( lead < 0xf5 ? 3 : -1 ) ) ) );
+        uint32_t code_pt = num_trail < 0 ? 0xfffd :
+          lead & ( num_trail == 0 ? 0x7f : 0x7f >> ( num_trail + 1 ) );
+        for ( int trl = 1; trl <= num_trail; trl++ )
+        {
+            if ( idx + trl >= len || ( ustr[ idx + trl ] & 0xc0 ) != 0x80 )
+            {
+                code_pt = 0xfffd;
+                num_trail = 0;
+                break;
+            }
+            code_pt = code_pt << 6 | ( ustr[ idx + trl ] & 0x3f );
+        }
+        //
+        // Overlong forms and surrogates aren't valid either
+        if ( ( num_trail == 2 && ( code_pt < 0x800 ||
+          ( code_pt >= 0xd800 && code_pt <= 0xdfff ) ) ) ||
+          ( num_trail == 3 && ( code_pt < 0x10000 || code_pt > 0x10ffff ) ) )
+          code_pt = 0xfffd;
+        cp_buf.push_back( code_pt );
+        idx += num_trail > 0 ? num_trail + 1 : 1;
+    }
+    ces.clear();
+    after_variable = false;
+    size_t num_cps = cp_buf.size();
+    for ( size_t idx = 0; idx < num_cps; idx++ )
+    {
+        uint32_t code_pt = cp_buf[ idx ];
+        if ( idx + 1 < num_cps && starts_contr( code_pt ) )
+        {
+            uint32_t ce_ref = 0;
+            if ( idx + 2 < num_cps )
+              ce_ref = find_contr( code_pt, cp_buf[ idx + 1 ],
+              cp_buf[ idx + 2 ] );
+            if ( ce_ref != 0 )
+            {
+                add_ce_ref( ce_ref, ces );
+                idx += 2;
+                continue;
+            }
+            ce_ref = find_contr( code_pt, cp_buf[ idx + 1 ], 0 );
+            if ( ce_ref != 0 )
+            {
+                add_ce_ref( ce_ref, ces );
+                idx += 1;
+                continue;
+            }
+        }
+        uint32_t ce_ref = find_single( code_pt );
+        if ( ce_ref != 0 )
+        {
+            add_ce_ref( ce_ref, ces );
+            continue;
+        }
+        if ( code_pt >= hangul_first && code_pt <= hangul_last )
+        {
+            uint32_t s_idx = code_pt - hangul_first;
+            uint32_t t_idx = s_idx % jamo_t_cnt;
+            add_ce_ref( find_single( jamo_l_first + s_idx /
+              ( jamo_v_cnt * jamo_t_cnt ) ), ces );
+            add_ce_ref( find_single( jamo_v_first + s_idx %
+              ( jamo_v_cnt * jamo_t_cnt ) / jamo_t_cnt ), ces );
+            if ( t_idx != 0 )
+              add_ce_ref( find_single( jamo_t_first + t_idx ), ces );
+            continue;
+        }
+        uint32_t impl_ces[ 2 ];
+        implicit_ces( code_pt, impl_ces );
+        ces.push_back( weigh( impl_ces[ 0 ] ) );
+        ces.push_back( weigh( impl_ces[ 1 ] ) );
+    }
+}
+
+//
+// Compares the weights of two strings a level at a time, skipping the 0
+//   weights, the same as memcmp() would compare their sort keys.  A string
+//   that runs out of weights first gets a 0, so it is the lesser.
+template <typename ce_at_type>
+static int cmp_levels( ce_at_type ce_at_a, size_t len_a,
+  ce_at_type ce_at_b, size_t len_b, int first_lvl, int num_levels )
+{
+    for ( int lvl = first_lvl; lvl < num_levels; lvl++ )
+    {
+        const int shift = 48 - 16 * lvl;
+        size_t idx_a = 0, idx_b = 0;
+        while ( true )
+        {
+            uint32_t wgt_a = 0, wgt_b = 0;
+            while ( wgt_a == 0 && idx_a < len_a )
+              wgt_a = ce_at_a( idx_a++ ) >> shift & 0xffff;
+            while ( wgt_b == 0 && idx_b < len_b )
+              wgt_b = ce_at_b( idx_b++ ) >> shift & 0xffff;
+            if ( wgt_a != wgt_b ) return wgt_a < wgt_b ? -1 : 1;
+            if ( wgt_a == 0 ) break;
+        }
+    }
+    return 0;
+}
+
+bool uca_collator::ascii_primary_cmp( const char *str_a, size_t len_a,
+  const char *str_b, size_t len_b, int& cmp_rslt ) const
+{
+    size_t idx_a = 0, idx_b = 0;
+    while ( true )
+    {
+        uint32_t wgt_a = 0, wgt_b = 0;
+        while ( wgt_a == 0 && idx_a < len_a )
+        {
+            unsigned char str_ch = str_a[ idx_a++ ];
+            if ( str_ch >= 128 || !ascii_fast[ str_ch ] ) return false;
+            wgt_a = ascii_ces[ str_ch ] >> 48;
+        }
+        while ( wgt_b == 0 && idx_b < len_b )
+        {
+            unsigned char str_ch = str_b[ idx_b++ ];
+            if ( str_ch >= 128 || !ascii_fast[ str_ch ] ) return false;
+            wgt_b = ascii_ces[ str_ch ] >> 48;
+        }
+        if ( wgt_a == wgt_b && wgt_a != 0 ) continue;
+        cmp_rslt = wgt_a == wgt_b ? 0 : ( wgt_a < wgt_b ? -1 : 1 );
+        break;
+    }
+    //
+    // A contraction is at most 3 code points, so the weights of the bytes
+    //   looked at can only be changed by the 2 bytes after them.
+    for ( size_t idx = idx_a; idx < len_a && idx < idx_a + 2; idx++ )
+      if ( static_cast<unsigned char>( str_a[ idx ] ) >= 128 ) return false;
+    for ( size_t idx = idx_b; idx < len_b && idx < idx_b + 2; idx++ )
+      if ( static_cast<unsigned char>( str_b[ idx ] ) >= 128 ) return false;
+    return true;
+}
+
+int uca_collator::compare( const char *str_a, size_t len_a,
+  const char *str_b, size_t len_b )
+{
+    if ( !tables_made ) setup();
+    int cmp_rslt;
+    //
+    // Most names are settled by the primary weights of their first few
+    //   bytes, so the ASCII table is used for those bytes even when the
+    //   names have other characters further on.  When the primaries are
+    //   all the same, the names were ASCII all the way through.
+    if ( ascii_primary_cmp( str_a, len_a, str_b, len_b, cmp_rslt ) )
+    {
+        if ( cmp_rslt != 0 ) return cmp_rslt;
+        auto ce_at = [ this ]( const char *str )
+        {
+            return [ this, str ]( size_t idx )
+              { return ascii_ces[ static_cast<unsigned char>( str[ idx ] ) ]; };
+        };
+        cmp_rslt = cmp_levels( ce_at( str_a ), len_a, ce_at( str_b ), len_b,
+          1, num_levels );
+    }
+    else
+    {
+        get_ces( str_a, len_a, ce_buf_a );
+        get_ces( str_b, len_b, ce_buf_b );
+        auto ce_at = []( const vector<uint64_t>& ces )
+        {
+            const uint64_t *ce_ptr = ces.data();
+            return [ ce_ptr ]( size_t idx ) { return ce_ptr[ idx ]; };
+        };
+        cmp_rslt = cmp_levels( ce_at( ce_buf_a ), ce_buf_a.size(),
+          ce_at( ce_buf_b ), ce_buf_b.size(), 0, num_levels );
+    }
+    if ( cmp_rslt != 0 ) return cmp_rslt;
+    //
+    // The identical level
+    cmp_rslt = memcmp( str_a, str_b, min( len_a, len_b ) );
+    if ( cmp_rslt != 0 ) return cmp_rslt < 0 ? -1 : 1;
+    return len_a < len_b ? -1 : ( len_a > len_b ? 1 : 0 );
+}
+
+string uca_collator::sort_key( const char *str, size_t len )
+{
+    if ( !tables_made ) setup();
+    get_ces( str, len, ce_buf_a );
+    string key;
+    key.reserve( ce_buf_a.size() * 2 * num_levels + len + 2 * num_levels );
+    for ( int lvl = 0; lvl < num_levels; lvl++ )
+    {
+        const int shift = 48 - 16 * lvl;
+        for ( uint64_t ce : ce_buf_a )
+        {
+            uint32_t wgt = ce >> shift & 0xffff;
+            if ( wgt == 0 ) continue;
+            key.push_back( char( wgt >> 8 ) );
+            key.push_back( char( wgt & 0xff ) );
+        }
+        key.append( 2, '\0' );
+    }
+    key.append( str, len );
+    return key;
+}
@@ -0,0 +1,135 @@
+//
+// The uca_collator class orders UTF-8 name strings by the Unicode
+//   Collation Algorithm with the DUCET compiled into the program, so the
+//   order of the names doesn't depend on the locale the program is run
+//   in the way strcoll() does.  A name btree built in one locale is then
+//   still in order when it is searched in another.
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+// The collation elements of a string are found as UTS #10 describes.  The
+//   longest contraction of the DUCET that starts at each code point is
+//   used first, then the entry of the code point alone, with its
+//   expansion when it has more than one element.  The Hangul syllables
+//   are split into their jamo, and the code points that aren't in the
+//   DUCET get the implicit weights, with the Han ideographs and the
+//   @implicitweights scripts given their own bases.  The string is not
+//   put in NFD first, and the contractions are only matched when their
+//   code points are next to each other.  The DUCET has entries for the
+//   precomposed characters, so that only makes a difference for names
+//   with more than one combining mark on a letter.
+//
+// The variable elements, the spaces and punctuation and most symbols, are
+//   shifted to a fourth level by default, so that "a-b" sorts next to
+//   "ab" the way the glibc locales sort them, or they can be kept as
+//   non-ignorable.  When all of the levels are the same the UTF-8 bytes
+//   decide, which is the identical level, so two names are only equal
+//   when they are the same string.  The name btree needs that, since a
+//   name that compares equal to one in the tree is taken to be that name.
+//
+// Most of the names are ASCII, and for the ASCII bytes that have one
+//   element and don't start a contraction with other ASCII bytes, which
+//   is all of them in the DUCET, the weights are kept in a table by
+//   byte.  Two ASCII names are compared with those a level at a time
+//   straight from the bytes.  The entries of the code points below
+//   fast_cp_lim, which covers the Latin, Greek, Cyrillic and the other
+//   alphabets of the common scripts, are kept in a table by code point,
+//   and the rest are found with a binary search of the DUCET.
+//
+
+#ifndef UCA_COLLATE_H
+#define UCA_COLLATE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+class uca_collator
+{
+public:
+    enum variable_wgt { non_ignorable, shifted };
+    static const uint32_t fast_cp_lim = 0x3000;
+
+private:
+    bool tables_made;
+    variable_wgt var_wgt;
+    int num_levels;
+    //
+    // The ce_ref of each code point below fast_cp_lim, or 0 when it has
+    //   no entry, and whether it starts a contraction.  The contraction
+    //   starts of all of the code points are in contr_starts.
+    vector<uint32_t> fast_ce_refs;
+    vector<bool> fast_contr_start;
+    vector<uint32_t> contr_starts;
+    //
+    // The weights of each ASCII byte packed the way the ce_buf elements
+    //   are, and whether the byte can be compared with them
+    uint64_t ascii_ces[ 128 ];
+    bool ascii_fast[ 128 ];
+    //
+    // The elements of the strings being compared, with the primary,
+    //   secondary, tertiary and quaternary weights in 16 bits each from
+    //   the top down, after the variable weighting is done.
+    vector<uint32_t> cp_buf;
+    vector<uint64_t> ce_buf_a;
+    vector<uint64_t> ce_buf_b;
+    bool after_variable;
+
+    static uint32_t find_contr( uint32_t cp_1, uint32_t cp_2, uint32_t cp_3 );
+    static void implicit_ces( uint32_t code_pt, uint32_t ces[ 2 ] );
+    uint32_t find_single( uint32_t code_pt ) const;
+    bool starts_contr( uint32_t code_pt ) const;
+    uint64_t weigh( uint32_t ce );
+    void add_ce_ref( uint32_t ce_ref, vector<uint64_t>& ces );
+    void get_ces( const char *str, size_t len, vector<uint64_t>& ces );
+    //
+    // Compares the primary weights of two names from the ASCII table,
+    //   giving false when some byte they depend on isn't in it
+    bool ascii_primary_cmp( const char *str_a, size_t len_a,
+      const char *str_b, size_t len_b, int& cmp_rslt ) const;
+
+public:
+    uca_collator();
+    //
+    // Makes the lookup tables.  It has to be done before the first
+    //   compare, and again to change the variable weighting.
+    void setup( variable_wgt var_set = shifted );
+    bool is_set_up() const { return tables_made; };
+    variable_wgt get_variable_wgt() const { return var_wgt; };
+    int get_level_cnt() const { return num_levels; };
+    string get_version() const;
+    //
+    // Gives less than, equal to or greater than 0 as str_a collates
+    //   before, the same as or after str_b
+    int compare( const char *str_a, size_t len_a, const char *str_b,
+      size_t len_b );
+    int compare( const string& str_a, const string& str_b )
+      { return compare( str_a.data(), str_a.size(), str_b.data(),
+      str_b.size() ); };
+    //
+    // The sort key of the string, which orders the same way with memcmp()
+    //   as the strings do with compare().  The weights are 2 bytes each,
+    //   high byte first, with 2 zero bytes after each level, and the UTF-8
+    //   bytes of the string are the last level.
+    string sort_key( const char *str, size_t len );
+    string sort_key( const string& str )
+      { return sort_key( str.data(), str.size() ); };
+};
+
+#endif  //  UCA_COLLATE_H
@@ -104,7 +104,12 @@ int utf8_name_store::store_name( string name_chars )
 
 string utf8_name_store::retrieve_name( int name_index )
 {
-    string ret_name = "� Invalid request";
+    return string( retrieve_name_view( name_index ) );
+}
+
+string_view utf8_name_store::retrieve_name_view( int name_index ) const
+{
+    static const char invalid_name[] = "� Invalid request";
     if ( name_index > nam_str_intro_last_idx && name_index < nxt_index )
     {
         if ( name_store[ name_index - 1 ] != '\0' )
@@ -114,7 +119,7 @@ string utf8_name_store::retrieve_name( int name_index )
               "    at the beginning of a string." << endl;
         }
         else
-          ret_name = &name_store[ name_index ];
+          return string_view( &name_store[ name_index ] );
     }
     else
     {
@@ -122,7 +127,7 @@ string utf8_name_store::retrieve_name( int name_index )
           name_index << ", valid range from " << nam_str_intro_last_idx + 1 <<
           " to less than " << nxt_index << "." << endl;
     }
-    return ret_name;
+    return string_view( invalid_name );
 }
 
 string utf8_name_store::get_name_store_chs( int start_idx, int nchars )
@@ -39,6 +39,7 @@
 #define UTF8_NAME_STORE_H
 
 #include "fo-common.h"
+#include <string_view>
 
 #ifdef INdevel
     // Declarations/definitions/code for development only
@@ -64,6 +65,11 @@ public:
     utf8_name_store();
     int store_name( string name_chars );  // returns start index
     string retrieve_name( int name_index );
+    //
+    // The name in place in the store, without a copy.  The view stays good
+    //   for the life of the store, since names are never moved or removed,
+    //   and the null at the end of the name is right after the view.
+    string_view retrieve_name_view( int name_index ) const;
     string get_name_store_chs( int start_idx, int nchars );
     size_t name_space_left();
     int get_intro_last_idx() { return nam_str_intro_last_idx; } ;
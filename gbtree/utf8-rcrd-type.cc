@@ -51,10 +51,13 @@
 //  #include "fo-utils.h"
 #include "../uni-utils/uni-utils.h"
 #include "../uni-utils/hex-symbol.h"
+#include <chrono>
+#include <clocale>
 #include <cstring>
 #include <iomanip>
 #include <ctype.h>
 #include <cmath>
+#include <algorithm>
 
 #ifdef USEncurses
 #include "ncursio.h"
@@ -164,49 +167,135 @@ int utf8_rcrd_type::base_search_last_lvl = 0;
 bool utf8_rcrd_type::track_base_search_vars = false;
 int utf8_rcrd_type::base_search_str_inf = 0;
 scc_idx utf8_rcrd_type::base_search_str_scc = {};
+map<string, int> utf8_rcrd_type::bsv_pins = {};
+#ifdef USEmerkle_dgst
+vector<merkle_dgst_type> utf8_rcrd_type::merkle_dgsts = {};
+bool utf8_rcrd_type::merkle_kept = false;
+#endif  //  #ifdef USEmerkle_dgst
+string utf8_rcrd_type::base_search_path = "";
+bool utf8_rcrd_type::base_search_frozen = false;
+vector<utf8_rcrd_type::bsv_memo_entry> utf8_rcrd_type::bsv_memo = {};
+bool utf8_rcrd_type::bsv_memo_on = false;
+long utf8_rcrd_type::bsv_memo_hits = 0;
+uint64_t utf8_rcrd_type::base_search_hash = 0;
+long utf8_rcrd_type::bsv_set_nsec = 0;
+long utf8_rcrd_type::bsv_set_cnt = 0;
 string utf8_rcrd_type::new_name_utf_8 = "";
+vector<utf8_rcrd_type::name_search_key> utf8_rcrd_type::srch_key_hld = {};
 vector<name_string_hold> utf8_rcrd_type::nmst_hld = {};
 vector<utf8_rcrd_type::spr_bss_state>
   utf8_rcrd_type::bss_state_vec = {};
 vector<utf8_rcrd_type>
   utf8_rcrd_type::name_string_rcrds = {};
 utf8_name_store utf8_rcrd_type::string_table;
+bool utf8_rcrd_type::sort_keys_on = false;
+string utf8_rcrd_type::sort_key_arena = "";
+vector<uint32_t> utf8_rcrd_type::sort_key_off = {};
+string utf8_rcrd_type::base_search_key = "";
+uint64_t utf8_rcrd_type::base_search_abbr = 0;
+string utf8_rcrd_type::find_key_name = "";
+string utf8_rcrd_type::find_key = "";
+uint64_t utf8_rcrd_type::find_abbr = 0;
+long utf8_rcrd_type::num_name_cmps = 0;
+long utf8_rcrd_type::num_abbr_cmps = 0;
+ascii_collator utf8_rcrd_type::ascii_coll;
+bool utf8_rcrd_type::ascii_coll_on = true;
+long utf8_rcrd_type::num_ascii_cmps = 0;
+utf8_rcrd_type::name_collation utf8_rcrd_type::coll_mode =
+  utf8_rcrd_type::locale_coll;
+uca_collator utf8_rcrd_type::uca_coll;
+#ifdef USEcompact_utf8_rcrd
+static_assert( dflt_store_size < ( 1 << 23 ),
+  "The name store is too big for the compact record str_start_idx" );
+//
+// The gbtree part is the vtable pointer and the three words of links and
+//   flags, 20 bytes, and the name store index with its flags makes 24.
+static_assert( sizeof( utf8_rcrd_type ) == 24,
+  "The compact utf8_rcrd_type record is not 24 bytes" );
+#endif  //  #ifdef USEcompact_utf8_rcrd
 
 void utf8_rcrd_type::init_rcrd()
 {
     str_start_idx = 0;
-    str_rec_flg = { 1, 1, 1, 0, 0, 0, 3 };
+    set_rec_flg( { 1, 1, 1, 0, 0, 0, 3 } );
+#ifdef USEsort_key_abbr
+    key_abbr = 0;
+#endif  //  #ifdef USEsort_key_abbr
+#ifndef USEcompact_utf8_rcrd
     srchstr_first_ch_idx = 0;
     for ( int idx = 0; idx < 6; idx++ ) srchstr_node_add[ idx ] = { 0, 0, 0 };
+#endif  //  #ifndef USEcompact_utf8_rcrd
+}
+
+styp_flags utf8_rcrd_type::get_rec_flg()
+{
+#ifdef USEcompact_utf8_rcrd
+    uint8_t flg_byte = str_rec_bits;
+    styp_flags typ_flgs;
+    memcpy( &typ_flgs, &flg_byte, sizeof( typ_flgs ) );
+    return typ_flgs;
+#else
+    return str_rec_flg;
+#endif  //  #ifdef USEcompact_utf8_rcrd
+}
+
+void utf8_rcrd_type::set_rec_flg( styp_flags typ_flgs )
+{
+#ifdef USEcompact_utf8_rcrd
+    uint8_t flg_byte;
+    memcpy( &flg_byte, &typ_flgs, sizeof( typ_flgs ) );
+    str_rec_bits = flg_byte;
+#else
+    str_rec_flg = typ_flgs;
+#endif  //  #ifdef USEcompact_utf8_rcrd
 }
 
 string utf8_rcrd_type::get_name_string()
+{
+    return string( get_name_view() );
+}
+
+string_view utf8_rcrd_type::get_name_view()
 {
     // The index for the string table title string end character is
     //   written to the static member name_intro_last_idx by the
     //   gbst_interface_type constructor and should not be
     //   accessable so
-    string namstr;
     if ( str_start_idx > name_intro_last_idx )
-    {
-        namstr = string_table.retrieve_name( str_start_idx );
-    }
+      return string_table.retrieve_name_view( str_start_idx );
     else if ( new_name_utf_8.size() > 0 )
+      return new_name_utf_8;
+    return "No valid string found!";
+}
+
+void utf8_rcrd_type::push_search_key( int nm_rc_id )
+{
+    srch_key_hld.emplace_back();
+    name_search_key& srch_key = srch_key_hld.back();
+    srch_key.name = get_name_view();
+    srch_key.key_abbr = 0;
+    if ( sort_keys_on )
     {
-         namstr = new_name_utf_8;
-    }
-    else
-    {
-        namstr = "No valid string found!";
+        //
+        // A record that is already placed has its key in the arena
+        if ( nm_rc_id >= 0 && nm_rc_id + 1 < int( sort_key_off.size() ) )
+          srch_key.sort_key.assign( sort_key_arena, sort_key_off[ nm_rc_id ],
+          sort_key_off[ nm_rc_id + 1 ] - sort_key_off[ nm_rc_id ] );
+        else srch_key.sort_key = name_sort_key( srch_key.name );
+        srch_key.key_abbr = make_key_abbr( srch_key.sort_key.data(),
+          srch_key.sort_key.size() );
     }
-    return namstr;
+}
+
+void utf8_rcrd_type::pop_search_key()
+{
+    srch_key_hld.pop_back();
 }
 
 #ifdef INFOdisplay
 void utf8_rcrd_type::push_name_struct( int nm_rc_id )
 {
-    string t_str( get_name_string() );
-    nmst_hld.emplace_back( t_str, lm_nm_str_sz );
+    nmst_hld.emplace_back( string( get_name_view() ), lm_nm_str_sz );
 
 #ifdef INdevel    // Declarations for development only
   if ( dbgf.a4 )
@@ -318,6 +407,11 @@ void utf8_rcrd_type::restore_bsv_state( int sv_idx )
     //    new_name_utf_8 = bss_state_vec[ sv_idx ].nam_strng;
     base_search_last_lvl = bss_state_vec[ sv_idx ].bs_lst_lvl;
     base_search_str_inf = bss_state_vec[ sv_idx ].bss_inf;
+    base_search_path = bss_state_vec[ sv_idx ].bss_path;
+    base_search_frozen = bss_state_vec[ sv_idx ].bss_frozen;
+    // The base_search_str isn't put back, so the memo deltas can't be
+    //   used from here
+    base_search_hash = 0;
 }
 
 void utf8_rcrd_type::release_bsv_state( int sv_idx )
@@ -333,6 +427,67 @@ void utf8_rcrd_type::release_bsv_state( int sv_idx )
     }
 }
 
+bool utf8_rcrd_type::set_bsv_pin( const string& path, int node_id )
+{
+    if ( node_id == 0 )
+    {
+        //
+        // Remove the pin for the position and every pin below it, which
+        //   are all of the keys that start with the path string.
+        auto pin_it = bsv_pins.lower_bound( path );
+        while ( pin_it != bsv_pins.end() &&
+          pin_it->first.compare( 0, path.size(), path ) == 0 )
+          pin_it = bsv_pins.erase( pin_it );
+    }
+    else
+    {
+        // get_node() exits the program for an invalid ID, so this also
+        //   verifies the record exists before it is used as a pin.
+        get_node( node_id );
+        bsv_pins[ path ] = node_id;
+    }
+    bsv_memo.clear();
+    return true;
+}
+
+bool utf8_rcrd_type::move_records( const vector<int>& new_order,
+  vector<int>& new_id_of )
+{
+    //
+    // The capacity is kept the same since prep4search() depends on it
+    vector<utf8_rcrd_type> moved_rcrds;
+    moved_rcrds.reserve( name_string_rcrds.capacity() );
+    new_id_of.assign( name_string_rcrds.size(), -1 );
+    for ( int old_id : new_order )
+    {
+        new_id_of[ old_id ] = moved_rcrds.size();
+        moved_rcrds.push_back( name_string_rcrds[ old_id ] );
+    }
+    for ( size_t old_id = 0; old_id < name_string_rcrds.size(); old_id++ )
+    {
+        if ( new_id_of[ old_id ] >= 0 ) continue;
+        new_id_of[ old_id ] = moved_rcrds.size();
+        moved_rcrds.push_back( name_string_rcrds[ old_id ] );
+    }
+    name_string_rcrds.swap( moved_rcrds );
+    if ( sort_keys_on ) rebuild_sort_keys();
+    //
+    // The pins hold the record of the name that is pinned
+    for ( auto& bsv_pin : bsv_pins )
+      bsv_pin.second = new_id_of[ bsv_pin.second ];
+    bsv_memo.clear();
+#ifdef USEmerkle_dgst
+    if ( merkle_kept )
+    {
+        vector<merkle_dgst_type> moved_dgsts( name_string_rcrds.size() );
+        for ( size_t old_id = 0; old_id < merkle_dgsts.size(); old_id++ )
+          moved_dgsts[ new_id_of[ old_id ] ] = merkle_dgsts[ old_id ];
+        merkle_dgsts.swap( moved_dgsts );
+    }
+#endif  //  #ifdef USEmerkle_dgst
+    return true;
+}
+
 int utf8_rcrd_type::what_is_my_id()
 {
     //
@@ -368,20 +523,22 @@ void utf8_rcrd_type::shossp( string intro )
 {
     dbgs << intro << ": gbtree level is " << get_level() <<
       endl << ", base_search_str_min \"" <<
-      trans_scc( base_search_str_min ) <<
+      bss_display( base_search_str_min ) <<
       "\", base_search_str_max \"" <<
-      trans_scc( base_search_str_max ) << "\"" << endl <<
+      bss_display( base_search_str_max ) << "\"" << endl <<
       "  str_start_idx " << str_start_idx <<
       ", node 2 base = " << get_nod2bas() <<
       ", base search var count = " << get_b_srch_cnt() <<
       ", base_search_str_inf " << base_search_str_inf <<
       ", base_search_str_scc \"" <<
-      trans_scc( base_search_str_scc ) <<
+      bss_display( base_search_str_scc ) <<
       "\", base_search_str \"" << base_search_str << "\"" << endl <<
       "  srchstr_node_add count = " << get_b_srch_cnt();
+#ifndef USEcompact_utf8_rcrd
     for ( int idx = 1; idx < 6; idx++ ) dbgs << ", el" << idx << ":" <<
       ( srchstr_node_add[ idx ].changed ? 't' : 'f' ) <<
       static_cast<uint16_t>( srchstr_node_add[ idx ].sccidx );
+#endif  //  #ifndef USEcompact_utf8_rcrd
     dbgs << ", new_name_utf_8 \"" << new_name_utf_8 << "\"" << endl;
 }
 
@@ -410,7 +567,7 @@ void utf8_rcrd_type::shofspa( string intro )
     {
         //
         // Using the reference, display the line of information for it
-        styp_flags flgs = forcrd.str_rec_flg;
+        styp_flags flgs = forcrd.get_rec_flg();
         iout << setw(5) << forcrd.get_parent_idx() <<
         "|" << setw(5) << forcrd.get_child_left_idx() <<
         setw(5) << forcrd.get_child_right_idx() <<
@@ -423,19 +580,28 @@ void utf8_rcrd_type::shofspa( string intro )
         "   " << t_or_f( flgs.UTF_16 ) <<
         "   " <<  forcrd.get_nod2bas() <<
         "   " <<  forcrd.get_rt_child_flg() << " " << setw(4) <<
+#ifdef USEcompact_utf8_rcrd
+        "-" <<
+#else
         static_cast<uint16_t>( forcrd.srchstr_first_ch_idx ) <<
+#endif  //  #ifdef USEcompact_utf8_rcrd
         "  " << forcrd.get_asn_cur_search_node() <<
         "  " << forcrd.get_verify_base_srch_var() <<
         "  " << forcrd.get_parent_is_self() <<
         "  " << forcrd.get_new_no_parent() << "|" <<
         setw(2) << forcrd.get_b_srch_cnt() << " :";
+#ifdef USEcompact_utf8_rcrd
+        // The compact record has no search string additions to show
+        iout << setw(24) << "";
+#else
         for ( int idx = 0; idx < 6; idx++ ) iout << setw(3) <<
           static_cast<uint16_t>( forcrd.srchstr_node_add[ idx ].sccidx ) <<
           setw(1) <<
           ( forcrd.srchstr_node_add[ idx ].changed ? 't' : 'f' );
+#endif  //  #ifdef USEcompact_utf8_rcrd
         string holdname;
         int snidx = forcrd.str_start_idx;
-        if ( snidx > 0 ) holdname = string_table.retrieve_name( snidx );
+        if ( snidx > 0 ) holdname = string_table.retrieve_name_view( snidx );
         else holdname = forcrd.new_name_utf_8;
         iout << ( snidx > 0 ? "|d\"" : "|s\"" ) << holdname << "\"" << endl;
     }
@@ -509,7 +675,7 @@ utf8_rcrd_type::utf8_rcrd_type( string new_name,
 {
     init_rcrd();
     new_name_utf_8 = new_name;
-    str_rec_flg = typ_flgs;
+    set_rec_flg( typ_flgs );
 }
 
 //
@@ -551,21 +717,46 @@ utf8_rcrd_type& utf8_rcrd_type::get_node( int node_idx )
 //   of the node that wants the compare
 int utf8_rcrd_type::cmp_node2base( void )
 {
-    string node_str2cmp = get_name_string();
-    int cmp_rslt = strcoll( node_str2cmp.c_str(), base_search_str.c_str() );
+    num_name_cmps++;
+    if ( sort_keys_on )
+    {
+#ifdef USEsort_key_abbr
+        if ( key_abbr != base_search_abbr )
+        {
+            num_abbr_cmps++;
+            return key_abbr < base_search_abbr ? -1 : 1;
+        }
+#endif  //  #ifdef USEsort_key_abbr
+        int my_id = what_is_my_id();
+        return cmp_sort_keys( &sort_key_arena[ sort_key_off[ my_id ] ],
+          sort_key_off[ my_id + 1 ] - sort_key_off[ my_id ],
+          base_search_key.data(), base_search_key.size() );
+    }
+    int cmp_rslt = coll_cmp( get_name_view(), base_search_str );
     return cmp_rslt;
 }
 
 int utf8_rcrd_type::cmp_rcrd2base( int node_idx )
 {
-    if ( dbgf.a1 )
-      dbgs << "where nmst_hld has " << nmst_hld.size() << " elements." << endl;
-    if ( dbgf.a1 ) dbgs << "where nmst_hld.back().nmstr.target size is " <<
-      nmst_hld.back().nmstr.target.size() << " with value [" <<
-      nmst_hld.back().nmstr.target << "]." << endl;
-    string st4r2b_cmp = nmst_hld.back().nmstr.target;
-    if ( dbgf.a1 ) dbgs << "Got name string [" << st4r2b_cmp << "]." << endl;
-    int cmp_rslt = strcoll( st4r2b_cmp.c_str(), base_search_str.c_str() );
+    const name_search_key& srch_key = srch_key_hld.back();
+    if ( dbgf.a1 ) dbgs << "where srch_key_hld has " << srch_key_hld.size() <<
+      " elements, and the name size is " << srch_key.name.size() <<
+      " with value [" << srch_key.name << "]." << endl;
+    num_name_cmps++;
+    if ( sort_keys_on )
+    {
+#ifdef USEsort_key_abbr
+        if ( srch_key.key_abbr != base_search_abbr )
+        {
+            num_abbr_cmps++;
+            return srch_key.key_abbr < base_search_abbr ? -1 : 1;
+        }
+#endif  //  #ifdef USEsort_key_abbr
+        return cmp_sort_keys( srch_key.sort_key.data(),
+          srch_key.sort_key.size(), base_search_key.data(),
+          base_search_key.size() );
+    }
+    int cmp_rslt = coll_cmp( srch_key.name, base_search_str );
     return cmp_rslt;
 }
 
@@ -580,12 +771,259 @@ int utf8_rcrd_type::cmp_rcrd2node( int node_idx )
       "record node_ref to cmp_rcrd2node()." << endl;
 #endif // #ifdef INdevel
 
-    string st4r2n_cmp = nmst_hld.back().nmstr.target;
-    string node_str2cmp = node_ref.get_name_string();
-    int cmp_rslt = strcoll( st4r2n_cmp.c_str(), node_str2cmp.c_str() );
+    num_name_cmps++;
+    const name_search_key& srch_key = srch_key_hld.back();
+    if ( sort_keys_on ) return cmp_to_node_key( srch_key.sort_key,
+      srch_key.key_abbr, node_idx );
+    int cmp_rslt = coll_cmp( srch_key.name, node_ref.get_name_view() );
     return cmp_rslt;
 }
 
+int utf8_rcrd_type::cmp_key2node( const string& key, int node_idx )
+{
+    num_name_cmps++;
+    if ( sort_keys_on )
+    {
+        //
+        // A lookup compares the same name at each level, so its key is
+        //   only made when the name changes.
+        if ( key != find_key_name )
+        {
+            find_key_name = key;
+            find_key = make_sort_key( key );
+            find_abbr = make_key_abbr( find_key.data(), find_key.size() );
+        }
+        get_node( node_idx );
+        return cmp_to_node_key( find_key, find_abbr, node_idx );
+    }
+    return coll_cmp( key, get_node( node_idx ).get_name_view() );
+}
+
+int utf8_rcrd_type::cmp_sort_keys( const char *key_a, size_t len_a,
+  const char *key_b, size_t len_b )
+{
+    int cmp_rslt = memcmp( key_a, key_b, min( len_a, len_b ) );
+    if ( cmp_rslt != 0 ) return cmp_rslt;
+    return len_a < len_b ? -1 : ( len_a > len_b ? 1 : 0 );
+}
+
+int utf8_rcrd_type::coll_cmp( string_view str_a, string_view str_b,
+  bool count_cmp )
+{
+    if ( coll_mode == byte_order_coll )
+      return cmp_sort_keys( str_a.data(), str_a.size(), str_b.data(),
+      str_b.size() );
+    if ( coll_mode != locale_coll ) return uca_coll.compare( str_a.data(),
+      str_a.size(), str_b.data(), str_b.size() );
+    if ( ascii_coll_on )
+    {
+        if ( !ascii_coll.is_set_up() ) ascii_coll.setup();
+        if ( ascii_coll.can_compare( str_a.data(), str_a.size() ) &&
+          ascii_coll.can_compare( str_b.data(), str_b.size() ) )
+        {
+            if ( count_cmp ) num_ascii_cmps++;
+            return ascii_coll.compare( str_a.data(), str_a.size(),
+              str_b.data(), str_b.size() );
+        }
+    }
+    //
+    // Each of the views is of a whole name with its null end after it
+    return strcoll( str_a.data(), str_b.data() );
+}
+
+bool utf8_rcrd_type::use_ascii_collation( bool use_ascii )
+{
+    ascii_coll_on = use_ascii;
+    if ( !use_ascii ) return true;
+    return ascii_coll.setup();
+}
+
+bool utf8_rcrd_type::set_collation( name_collation coll_set )
+{
+    //
+    // The names already in the tree were placed in the order of the other
+    //   collation, so the change is only allowed with an empty tree.
+    if ( name_string_rcrds.size() > 1 || !srch_key_hld.empty() )
+    {
+        if ( coll_set == coll_mode ) return true;
+        errs << "The collation can not be changed from " << coll_mode <<
+          " to " << coll_set << " once names have been placed." << endl;
+        return false;
+    }
+    coll_mode = coll_set;
+    if ( coll_set == uca_shifted_coll ) uca_coll.setup( uca_collator::shifted );
+    else if ( coll_set == uca_non_ign_coll )
+      uca_coll.setup( uca_collator::non_ignorable );
+    //
+    // The sort keys are made by the collation in use
+    if ( sort_keys_on ) use_sort_keys( true );
+    return true;
+}
+
+string utf8_rcrd_type::get_collation_locale()
+{
+    if ( coll_mode != locale_coll ) return "";
+    const char *loc_name = setlocale( LC_COLLATE, nullptr );
+    return loc_name != nullptr ? loc_name : "";
+}
+
+uint64_t utf8_rcrd_type::make_key_abbr( const char *key, size_t len )
+{
+    uint64_t abbr = 0;
+    for ( size_t idx = 0; idx < 8; idx++ )
+    {
+        abbr <<= 8;
+        if ( idx < len ) abbr |= static_cast<unsigned char>( key[ idx ] );
+    }
+    return abbr;
+}
+
+int utf8_rcrd_type::cmp_to_node_key( const string& key, uint64_t abbr,
+  int node_idx )
+{
+#ifdef USEsort_key_abbr
+    uint64_t node_abbr = name_string_rcrds[ node_idx ].key_abbr;
+    if ( abbr != node_abbr )
+    {
+        num_abbr_cmps++;
+        return abbr < node_abbr ? -1 : 1;
+    }
+#endif  //  #ifdef USEsort_key_abbr
+    return cmp_sort_keys( key.data(), key.size(),
+      &sort_key_arena[ sort_key_off[ node_idx ] ],
+      sort_key_off[ node_idx + 1 ] - sort_key_off[ node_idx ] );
+}
+
+string utf8_rcrd_type::get_sort_key( int node_idx )
+{
+    if ( sort_keys_on )
+    {
+        get_node( node_idx );
+        return sort_key_arena.substr( sort_key_off[ node_idx ],
+          sort_key_off[ node_idx + 1 ] - sort_key_off[ node_idx ] );
+    }
+    return name_sort_key( get_node( node_idx ).get_name_view() );
+}
+
+string utf8_rcrd_type::make_sort_key( const string& key )
+{
+    return name_sort_key( key );
+}
+
+string utf8_rcrd_type::name_sort_key( string_view name )
+{
+    //
+    // In byte order the name itself orders the same way under memcmp()
+    if ( coll_mode == byte_order_coll ) return string( name );
+    if ( coll_mode != locale_coll )
+      return uca_coll.sort_key( name.data(), name.size() );
+    //
+    // The names are ordered with strcoll(), and strxfrm() gives the byte
+    //   string that orders the same way under strcmp() for the current
+    //   locale.  The keys are only good for as long as the locale stays
+    //   the same.  The name has its null end after it, as in coll_cmp().
+    size_t xfrm_len = strxfrm( nullptr, name.data(), 0 );
+    string sort_key( xfrm_len + 1, '\0' );
+    strxfrm( &sort_key[ 0 ], name.data(), xfrm_len + 1 );
+    sort_key.resize( xfrm_len );
+    return sort_key;
+}
+
+string utf8_rcrd_type::get_node_name( int node_idx )
+{
+    return string( get_node( node_idx ).get_name_view() );
+}
+
+string_view utf8_rcrd_type::get_node_name_view( int node_idx )
+{
+    return get_node( node_idx ).get_name_view();
+}
+
+bool utf8_rcrd_type::use_sort_keys( bool use_keys )
+{
+    //
+    // The search keys of the names being placed are made for the compares
+    //   in use, so this can't be done while a name is being placed.
+    if ( !srch_key_hld.empty() )
+    {
+        errs << "The sort keys can not be turned " <<
+          ( use_keys ? "on" : "off" ) << " while a name is being placed." <<
+          endl;
+        return false;
+    }
+    sort_keys_on = use_keys;
+    // The memo has the base search keys of the compares in use
+    bsv_memo.clear();
+    find_key_name.clear();
+    find_key.clear();
+    if ( use_keys )
+    {
+        rebuild_sort_keys();
+        base_search_key = make_sort_key( base_search_str );
+        base_search_abbr = make_key_abbr( base_search_key.data(),
+          base_search_key.size() );
+    }
+    else
+    {
+        string().swap( sort_key_arena );
+        vector<uint32_t>().swap( sort_key_off );
+        base_search_key.clear();
+    }
+    return true;
+}
+
+void utf8_rcrd_type::rebuild_sort_keys()
+{
+    sort_key_arena.clear();
+    sort_key_off.clear();
+    sort_key_off.reserve( name_string_rcrds.capacity() + 1 );
+    sort_key_off.push_back( 0 );
+    for ( auto& name_rcrd : name_string_rcrds )
+    {
+        string sort_key = name_sort_key( name_rcrd.get_name_view() );
+#ifdef USEsort_key_abbr
+        name_rcrd.key_abbr = make_key_abbr( sort_key.data(), sort_key.size() );
+#endif  //  #ifdef USEsort_key_abbr
+        sort_key_arena += sort_key;
+        sort_key_off.push_back( sort_key_arena.size() );
+    }
+}
+
+size_t utf8_rcrd_type::get_sort_key_bytes()
+{
+    return sort_key_arena.capacity() +
+      sort_key_off.capacity() * sizeof( uint32_t );
+}
+
+string utf8_rcrd_type::get_node_key( int node_idx )
+{
+    return string( get_node( node_idx ).get_name_view() );
+}
+
+int utf8_rcrd_type::cmp_keys( const string& key_a, const string& key_b )
+{
+    return coll_cmp( key_a, key_b );
+}
+
+#ifdef USEmerkle_dgst
+bool utf8_rcrd_type::keep_merkle_dgsts( bool keep )
+{
+    merkle_kept = keep;
+    merkle_dgsts.clear();
+    if ( keep ) merkle_dgsts.resize( name_string_rcrds.size() );
+    return true;
+}
+
+merkle_dgst_type *utf8_rcrd_type::get_merkle_slot( int node_idx )
+{
+    if ( !merkle_kept ) return nullptr;
+    if ( size_t( node_idx ) >= merkle_dgsts.size() )
+      merkle_dgsts.resize(
+      max( size_t( node_idx ) + 1, name_string_rcrds.size() ) );
+    return &merkle_dgsts[ node_idx ];
+}
+#endif  //  #ifdef USEmerkle_dgst
+
 #ifdef USEmath4base_sss  // Use floating point math method
 double utf8_rcrd_type::set_base = 48.0;
 double utf8_rcrd_type::set_denom = 1.0;
@@ -622,6 +1060,302 @@ double utf8_rcrd_type::get_dif_value( scc_idx remain_str )
 };
 #endif  // #ifdef USEmath4base_sss  // Use floating point math method
 
+string utf8_rcrd_type::bss_to_name( const scc_idx& bss_strng )
+{
+    if ( coll_mode == byte_order_coll )
+      return string( bss_strng.begin(), bss_strng.end() );
+    return scc_set_array_to_utf8( bss_strng );
+}
+
+string utf8_rcrd_type::bss_display( const scc_idx& bss_strng )
+{
+    if ( coll_mode != byte_order_coll ) return trans_scc( bss_strng );
+    string tstr;
+    for ( uint8_t bss_byte : bss_strng )
+    {
+        if ( bss_byte < 0x80 && isgraph( bss_byte ) ) tstr += char( bss_byte );
+        else tstr += hex_symbol( bss_byte );
+    }
+    return tstr;
+}
+
+//
+// Works the same way as the floating point method of the scc_set strings
+//   below, but exactly, since the bytes can be added and halved as the
+//   digits of base 256 numbers.  The names don't have 0 bytes and none are
+//   left on the end of a midpoint, so two different strings always have
+//   a string between them, and the midpoint is cut to the same number of
+//   new characters as the scc_set one when that still leaves it after
+//   lo_bytes.
+scc_idx utf8_rcrd_type::byte_midpoint( const scc_idx& lo_bytes,
+  const scc_idx& hi_bytes )
+{
+    if ( !( lo_bytes < hi_bytes ) )
+    {
+        errs << "The byte_midpoint() method of the utf8_rcrd_type class" <<
+          " found a case where the" << endl << "base_search_str_min: \"" <<
+          bss_display( lo_bytes ) << "\" is not less than the" << endl <<
+          "base_search_str_max: \"" << bss_display( hi_bytes ) <<
+          "\" which is a critical error.  Exiting at source line " <<
+          __LINE__ << ":" << endl;
+        my_exit_msg = "Search var min not less than max.";
+        myexit();
+    }
+    size_t difpos = 0;
+    while ( difpos < lo_bytes.size() && difpos < hi_bytes.size() &&
+      lo_bytes[ difpos ] == hi_bytes[ difpos ] ) difpos++;
+    //
+    // Add the different parts from the last byte up, with an extra byte on
+    //   the end so the halving comes out even.  The carry out of the top
+    //   byte is the half of the common part that is left over, so it goes
+    //   back into the halving from the first byte down.
+    size_t sum_len = max( lo_bytes.size(), hi_bytes.size() ) + 1 - difpos;
+    vector<unsigned> byte_sum( sum_len );
+    unsigned carry = 0;
+    for ( size_t idx = sum_len; idx-- > 0; )
+    {
+        size_t pos = difpos + idx;
+        unsigned sum = carry +
+          ( pos < lo_bytes.size() ? lo_bytes[ pos ] : 0 ) +
+          ( pos < hi_bytes.size() ? hi_bytes[ pos ] : 0 );
+        byte_sum[ idx ] = sum & 0xff;
+        carry = sum >> 8;
+    }
+    scc_idx mid_bytes = lo_bytes.substr( 0, difpos );
+    for ( size_t idx = 0; idx < sum_len; idx++ )
+    {
+        unsigned val = carry << 8 | byte_sum[ idx ];
+        mid_bytes.push_back( val >> 1 );
+        carry = val & 1;
+    }
+    while ( !mid_bytes.empty() && mid_bytes.back() == 0 ) mid_bytes.pop_back();
+    size_t max_newch = difpos < 3 ? 6 - ( difpos + 1 ) / 2 : 4;
+    if ( mid_bytes.size() > difpos + max_newch )
+    {
+        scc_idx short_mid = mid_bytes.substr( 0, difpos + max_newch );
+        while ( !short_mid.empty() && short_mid.back() == 0 )
+          short_mid.pop_back();
+        if ( lo_bytes < short_mid ) return short_mid;
+    }
+    return mid_bytes;
+}
+
+//
+// The scc_set characters 1 to 48 are the digits 0 to 47 of base 48
+//   fractions, as in get_dif_value(), but the sum and the halving are done
+//   a digit at a time the way byte_midpoint() does them, so no precision
+//   is lost however long the common part or the strings are.  The 0 index
+//   of the level 1 min ends a string, and the top index of the level 1
+//   max is a whole 48 at its position, which carries into the digit
+//   before it.  The midpoint is cut to the same number of new characters
+//   as the floating point one when that still leaves it after lo_scc,
+//   and the 1 characters, the 0 digits, are taken off its end, so two
+//   midpoints never have only 0 digits between them.
+scc_idx utf8_rcrd_type::scc_midpoint( const scc_idx& lo_scc,
+  const scc_idx& hi_scc )
+{
+    const unsigned scc_base = scc_set_size - 2;
+    size_t lo_len = 0;
+    while ( lo_len < lo_scc.size() && lo_scc[ lo_len ] != 0 ) lo_len++;
+    size_t hi_len = 0;
+    while ( hi_len < hi_scc.size() && hi_scc[ hi_len ] != 0 &&
+      hi_scc[ hi_len ] < scc_set_size - 1 ) hi_len++;
+    bool hi_top = hi_len < hi_scc.size() && hi_scc[ hi_len ] != 0;
+    auto lo_val = [ &lo_scc, lo_len, scc_base ]( size_t idx )
+      { return idx < lo_len ? min( lo_scc[ idx ] - 1u, scc_base - 1 ) : 0u; };
+    auto hi_val = [ &hi_scc, hi_len, hi_top, scc_base ]( size_t idx )
+      { return idx < hi_len ? hi_scc[ idx ] - 1u :
+      ( idx == hi_len && hi_top ? scc_base : 0u ); };
+    size_t difpos = 0;
+    while ( difpos < lo_len && difpos < hi_len &&
+      lo_scc[ difpos ] == hi_scc[ difpos ] ) difpos++;
+    //
+    // Add the different parts from the last digit up, with an extra digit
+    //   on the end so the halving comes out even.  The carry out of the
+    //   top digit is the half of the common part that is left over, so it
+    //   goes back into the halving from the first digit down.
+    //   The digits are worked out in place past the common part of the
+    //   midpoint string.
+    size_t sum_len = max( lo_len, hi_len + hi_top ) + 1 - difpos;
+    scc_idx mid_scc( lo_scc, 0, difpos );
+    mid_scc.resize( difpos + sum_len );
+    uint8_t *mid_vals = &mid_scc[ difpos ];
+    unsigned carry = 0;
+    for ( size_t idx = sum_len; idx-- > 0; )
+    {
+        unsigned sum = carry + lo_val( difpos + idx ) + hi_val( difpos + idx );
+        mid_vals[ idx ] = sum % scc_base;
+        carry = sum / scc_base;
+    }
+    for ( size_t idx = 0; idx < sum_len; idx++ )
+    {
+        unsigned val = carry * scc_base + mid_vals[ idx ];
+        mid_vals[ idx ] = val / 2;
+        carry = val % 2;
+    }
+    //
+    // Both have digits 0 to 47 past the common part, so the first digit
+    //   that is different, with 0 digits past the end of the shorter one,
+    //   tells which is more.
+    auto after_lo = [ mid_vals, &lo_val, lo_len, difpos ]( size_t mid_len )
+    {
+        for ( size_t idx = 0; difpos + idx < max( lo_len, difpos + mid_len );
+          idx++ )
+        {
+            unsigned mid_val = idx < mid_len ? mid_vals[ idx ] : 0;
+            if ( mid_val != lo_val( difpos + idx ) )
+              return mid_val > lo_val( difpos + idx );
+        }
+        return false;
+    };
+    if ( !after_lo( sum_len ) )
+    {
+        // The midpoint is only the same as lo_scc when hi_scc is too
+        errs << "The scc_midpoint() method of the utf8_rcrd_type class" <<
+          " found a case where the" << endl << "base_search_str_min: \"" <<
+          bss_display( lo_scc ) << "\" is not less than the" << endl <<
+          "base_search_str_max: \"" << bss_display( hi_scc ) <<
+          "\" which is a critical error.  Exiting at source line " <<
+          __LINE__ << ":" << endl;
+        my_exit_msg = "Search var min not less than max.";
+        myexit();
+    }
+    size_t max_newch = difpos < 3 ? 6 - ( difpos + 1 ) / 2 : 4;
+    size_t mid_len = min( sum_len, max_newch );
+    while ( !after_lo( mid_len ) ) mid_len++;
+    while ( mid_len > 0 && mid_vals[ mid_len - 1 ] == 0 ) mid_len--;
+    for ( size_t idx = 0; idx < mid_len; idx++ ) mid_vals[ idx ]++;
+    mid_scc.resize( difpos + mid_len );
+    return mid_scc;
+}
+
+//
+// The balance points were picked for the order of the locale, but the
+//   ASCII ones that are there to begin with are in byte order as well.
+//   Ones derived from a file might not be, so a point that isn't between
+//   the min and max in byte order is replaced by their midpoint.
+scc_idx utf8_rcrd_type::byte_bal_point( int bal_idx )
+{
+    const string& bal_name = ggguniq_str_bal_list[ bal_idx ];
+    scc_idx bal_bytes( bal_name.begin(), bal_name.end() );
+    if ( base_search_str_min < bal_bytes && bal_bytes < base_search_str_max )
+      return bal_bytes;
+    return byte_midpoint( base_search_str_min, base_search_str_max );
+}
+
+bool utf8_rcrd_type::find_bsv_memo()
+{
+    int clevel = get_level();
+    bool right_chld = get_rt_child_flg() == 1;
+    //
+    // The hash of the path is mixed up from that of the parent position
+    //   and the child link taken to get here, with 0 kept for no hash.
+    if ( clevel == 1 || base_search_hash != 0 )
+    {
+        uint64_t path_hash = ( clevel == 1 ? 0 : base_search_hash ) +
+          ( right_chld ? 0x9e3779b97f4a7c15 : 0x7f4a7c159e3779b9 );
+        path_hash = ( path_hash ^ ( path_hash >> 30 ) ) * 0xbf58476d1ce4e5b9;
+        path_hash = ( path_hash ^ ( path_hash >> 27 ) ) * 0x94d049bb133111eb;
+        path_hash ^= path_hash >> 31;
+        base_search_hash = path_hash != 0 ? path_hash : 1;
+    }
+    size_t my_id = what_is_my_id();
+    if ( base_search_hash == 0 || my_id >= bsv_memo.size() ||
+      bsv_memo[ my_id ].path_hash != base_search_hash ) return false;
+    const bsv_memo_entry& memo = bsv_memo[ my_id ];
+    if ( !bsv_pins.empty() )
+    {
+        base_search_path.resize( clevel - 1, 'r' );
+        base_search_path.push_back( right_chld ? 'r' : 'l' );
+    }
+    //
+    // The min and max come from the parent's variables the same way as in
+    //   set_base_srch_var(), and the parent's scc and name strings are
+    //   cut back to what they have in common with this node's before the
+    //   rest is added.
+    if ( clevel == 1 ) set_bss_head_range();
+    else if ( !memo.bss_frozen )
+    {
+        if ( right_chld ) base_search_str_min = base_search_str_scc;
+        else base_search_str_max = base_search_str_scc;
+    }
+    base_search_str_scc.resize( memo.scc_keep );
+    base_search_str_scc += memo.scc_add;
+    base_search_str.resize( memo.name_keep );
+    base_search_str += memo.name_add;
+    base_search_str_inf = memo.bss_inf;
+    base_search_frozen = memo.bss_frozen;
+    if ( sort_keys_on )
+    {
+        base_search_key = memo.bss_key;
+        base_search_abbr = memo.bss_abbr;
+    }
+    base_search_last_lvl++;
+    bsv_memo_hits++;
+    return true;
+}
+
+void utf8_rcrd_type::save_bsv_memo( const string& bss_name )
+{
+    if ( base_search_hash == 0 ) return;
+    int clevel = get_level();
+    size_t my_id = what_is_my_id();
+    if ( my_id >= bsv_memo.size() ) bsv_memo.resize( my_id + 1 );
+    bsv_memo_entry& memo = bsv_memo[ my_id ];
+    memo.path_hash = base_search_hash;
+    memo.bss_frozen = base_search_frozen;
+    memo.bss_inf = base_search_str_inf;
+    //
+    // The parent's scc string is the new min or max by now, or the scc
+    //   string itself when it was kept, and what is left of the strings
+    //   from the search before is no use to the head.
+    static const scc_idx no_scc = {};
+    const scc_idx& prnt_scc = clevel == 1 ? no_scc : base_search_frozen ?
+      base_search_str_scc : get_rt_child_flg() == 1 ? base_search_str_min :
+      base_search_str_max;
+    size_t keep = 0;
+    while ( keep < prnt_scc.size() && keep < base_search_str_scc.size() &&
+      prnt_scc[ keep ] == base_search_str_scc[ keep ] ) keep++;
+    memo.scc_keep = keep;
+    memo.scc_add.assign( base_search_str_scc, keep );
+    keep = 0;
+    if ( clevel > 1 ) while ( keep < base_search_str.size() &&
+      keep < bss_name.size() && base_search_str[ keep ] == bss_name[ keep ] )
+      keep++;
+    memo.name_keep = keep;
+    memo.name_add.assign( bss_name, keep );
+    if ( sort_keys_on )
+    {
+        memo.bss_key = base_search_key;
+        memo.bss_abbr = base_search_abbr;
+    }
+}
+
+void utf8_rcrd_type::use_bsv_memo( bool use_memo )
+{
+    bsv_memo_on = use_memo;
+    // The path is only kept up to date while the memo is on
+    vector<bsv_memo_entry>().swap( bsv_memo );
+    base_search_hash = 0;
+}
+
+void utf8_rcrd_type::set_bss_head_range()
+{
+    base_search_str_min.clear();
+    base_search_str_max.clear();
+    if ( coll_mode == byte_order_coll )
+    {
+        // Every name sorts after the empty string, and no UTF-8 name has a
+        //   0xff byte.
+        base_search_str_max.push_back( 0xff );
+    }
+    else
+    {
+        base_search_str_min.push_back( 0 );
+        base_search_str_max.push_back( scc_set_size - 1 );
+    }
+}
+
 //
 // The base_search_str has been pre-computed for levels 1 to 5 based on the
 //   expected distribution of strings to be processed, and are stored in the
@@ -651,11 +1385,27 @@ int utf8_rcrd_type::set_base_srch_var()
     if ( dbgf.a5 ) dbgs << "set_base_srch_var() process starting:  ";
 #endif // #ifdef INdevel
 
+    auto bsv_start = chrono::steady_clock::now();
+    //
+    // The memo has what the rest of the search is worked out from as well
+    //   as the base_search_str, so none of it is needed then.
+    bool memo_hit = bsv_memo_on && base_search_last_lvl < get_level() &&
+      find_bsv_memo();
     // Compute these just once in case of error or we need to do some display
-    string min_strng = scc_set_array_to_utf8( base_search_str_min );
-    string max_strng = scc_set_array_to_utf8( base_search_str_max );
-    string grph_min_str = min_strng.size()==1 && !isgraph( min_strng[ 0 ] ) ?
-      hex_symbol( min_strng[0] ) : min_strng;
+    string min_strng, max_strng;
+    if ( !memo_hit )
+    {
+        min_strng = bss_to_name( base_search_str_min );
+        max_strng = bss_to_name( base_search_str_max );
+    }
+
+#ifdef INdevel    // Declarations for development only
+    // Only the debugging output shows this copy
+    string grph_min_str;
+    if ( dbgf.a5 || test_bsv_debug )
+      grph_min_str = min_strng.size()==1 && !isgraph( min_strng[ 0 ] ) ?
+        hex_symbol( min_strng[0] ) : min_strng;
+#endif // #ifdef INdevel
 
 #ifdef INdevel    // Declarations for development only
   if ( dbgf.a5 )
@@ -665,7 +1415,7 @@ int utf8_rcrd_type::set_base_srch_var()
   }
 #endif // #ifdef INdevel
 
-    int mnmxcmp = strcoll( min_strng.c_str(), max_strng.c_str() );
+    int mnmxcmp = memo_hit ? -1 : coll_cmp( min_strng, max_strng, false );
     if ( !(mnmxcmp < 0) )
     {
         errs << "Critical error found at " <<
@@ -693,10 +1443,29 @@ int utf8_rcrd_type::set_base_srch_var()
       clevel << endl;
 #endif  //  #ifdef INdevel
 
-    if ( base_search_last_lvl < clevel )
+    if ( memo_hit )
+    {
+        // Set from the memo by find_bsv_memo()
+    }
+    else if ( base_search_last_lvl < clevel )
     {
         bool right_chld = get_rt_child_flg() == 1;
-        if ( clevel > 1 )
+        if ( clevel == 1 ) base_search_frozen = false;
+        if ( !bsv_pins.empty() )
+        {
+            //
+            // Keep track of the path to this position so the pin for it
+            //   can be found below.  A position below a pinned one gets
+            //   the scc values of its parent unchanged, since the scc min
+            //   and max of a pinned path have nothing to do with the data
+            //   that actually reaches it, and narrowing them further only
+            //   runs out of scc precision on the deep paths.
+            base_search_path.resize( clevel - 1, 'r' );
+            if ( clevel > 1 && bsv_pins.count( base_search_path ) > 0 )
+              base_search_frozen = true;
+            base_search_path.push_back( right_chld ? 'r' : 'l' );
+        }
+        if ( clevel > 1 && !base_search_frozen )
         {
             //
             // Do common prerequisite operations needed for any level
@@ -716,14 +1485,12 @@ int utf8_rcrd_type::set_base_srch_var()
                 // Set the base_search_str_min to the value of
                 //   base_search_str_scc
                 base_search_str_min = base_search_str_scc;
-                string min_strng = scc_set_array_to_utf8( base_search_str_min );
             }
             else
             {
                 // The new node is a left child so set base_search_str_max
                 //   to the value of base_search_str_scc
                 base_search_str_max = base_search_str_scc;
-                string max_strng = scc_set_array_to_utf8( base_search_str_max );
             }
         }
         //
@@ -754,12 +1521,12 @@ int utf8_rcrd_type::set_base_srch_var()
             if ( dbgf.a5 ) dbgs << endl << "level 1 set being initialized, ";
 #endif // #ifdef INdevel
 
-            base_search_str_min.clear();
-            base_search_str_min.push_back( 0 );
-            base_search_str_max.clear();
-            base_search_str_max.push_back( scc_set_size - 1 );
+            set_bss_head_range();
             base_search_str_inf = new_level_offset_value[ 1 ];
-            base_search_str_scc = scc_idx_to_str_bal[ base_search_str_inf ];
+            if ( coll_mode == byte_order_coll )
+              base_search_str_scc = byte_bal_point( base_search_str_inf );
+            else
+              base_search_str_scc = scc_idx_to_str_bal[ base_search_str_inf ];
 
 #ifdef INdevel
             if ( dbgf.a5 || test_bsv_debug )
@@ -770,14 +1537,33 @@ int utf8_rcrd_type::set_base_srch_var()
 #endif  //  #ifdef INdevel
 
         }
+        else if ( base_search_frozen )
+        {
+            // Keep the base_search_str_scc of the parent position
+        }
         else if ( clevel <= 5 )
         {
             int lev_offset = new_level_offset_value[ clevel ];
             // Update the index value based on the right child flag
             base_search_str_inf += right_chld ? lev_offset : -lev_offset;
             // Set the new base search scc string value
-            base_search_str_scc = scc_idx_to_str_bal[ base_search_str_inf ];
+            if ( coll_mode == byte_order_coll )
+              base_search_str_scc = byte_bal_point( base_search_str_inf );
+            else
+              base_search_str_scc = scc_idx_to_str_bal[ base_search_str_inf ];
+        }
+        else if ( coll_mode == byte_order_coll )
+        {
+            base_search_str_scc = byte_midpoint( base_search_str_min,
+              base_search_str_max );
+        }
+#ifdef USEexact4base_sss
+        else
+        {
+            base_search_str_scc = scc_midpoint( base_search_str_min,
+              base_search_str_max );
         }
+#else  // not #ifdef USEexact4base_sss
         else
         {
             // This needs to process the levels higher than 5
@@ -1145,15 +1931,38 @@ int utf8_rcrd_type::set_base_srch_var()
 
             base_search_str_scc = tmp_base_sss;
         }
+#endif  //  #ifdef USEexact4base_sss
         base_search_last_lvl++;
     }
     else return -2; // Unnecessary repeated call to this method
 
-    base_search_str.clear();
-    for ( uint8_t blst_ch : base_search_str_scc )
+    if ( !memo_hit )
     {
-        base_search_str += scc_idx_to_UTF_8( blst_ch );
+        string bss_name = bss_to_name( base_search_str_scc );
+        if ( !bsv_pins.empty() )
+        {
+            //
+            // A pinned position uses the name string of the pin record as
+            //   its base search variable.  The scc min, max and current
+            //   values are left as computed above so the positions below
+            //   the pinned ones still get a consistent default computation.
+            auto pin_it = bsv_pins.find( base_search_path );
+            if ( pin_it != bsv_pins.end() ) bss_name =
+              name_string_rcrds[ pin_it->second ].get_name_view();
+        }
+        if ( sort_keys_on )
+        {
+            base_search_key = make_sort_key( bss_name );
+            base_search_abbr = make_key_abbr( base_search_key.data(),
+              base_search_key.size() );
+        }
+        // The memo keeps the name as a delta from the parent's
+        if ( bsv_memo_on ) save_bsv_memo( bss_name );
+        base_search_str.swap( bss_name );
     }
+    bsv_set_nsec += chrono::duration_cast<chrono::nanoseconds>(
+      chrono::steady_clock::now() - bsv_start ).count();
+    bsv_set_cnt++;
     if ( clevel == base_search_last_lvl )
     {
 
@@ -1170,17 +1979,18 @@ int utf8_rcrd_type::set_base_srch_var()
     }
 
 #ifdef INFOdisplay    // Declarations for development only
+    if ( !show_search_info() ) return base_search_supl_cnt;
     //
     // First define the strings
-    str_utf8 bsmin( trans_scc( base_search_str_min ), infsea_str_siz,
+    str_utf8 bsmin( bss_display( base_search_str_min ), infsea_str_siz,
       fit_center | fit_balance );
-    string real_bsmin = scc_set_array_to_utf8( base_search_str_min );
-    int cmp_sv2min = strcoll( base_search_str.c_str(), real_bsmin.c_str() );
-    str_utf8 bsmax( trans_scc( base_search_str_max ), infsea_str_siz,
+    string real_bsmin = bss_to_name( base_search_str_min );
+    int cmp_sv2min = coll_cmp( base_search_str, real_bsmin, false );
+    str_utf8 bsmax( bss_display( base_search_str_max ), infsea_str_siz,
       fit_center | fit_balance );
-    string real_bsmax = scc_set_array_to_utf8( base_search_str_max );
-    int cmp_max2sv = strcoll( real_bsmax.c_str(), base_search_str.c_str() );
-    str_utf8 bas_sea_trans( trans_scc( base_search_str_scc ), infsea_str_siz,
+    string real_bsmax = bss_to_name( base_search_str_max );
+    int cmp_max2sv = coll_cmp( real_bsmax, base_search_str, false );
+    str_utf8 bas_sea_trans( bss_display( base_search_str_scc ), infsea_str_siz,
       fit_center | fit_balance );
     ostringstream bsv_disp_strm;
     bsv_disp_strm.imbue(std::locale("C"));
@@ -1189,7 +1999,7 @@ int utf8_rcrd_type::set_base_srch_var()
       bas_sea_trans.target <<
       ( cmp_max2sv  > 0 ? "↑" : cmp_max2sv  < 0 ? "↓" : "0" ) <<
       bsmax.target << setw( id_str_siz ) << what_is_my_id() << " " <<
-      get_name_string();
+      get_name_view();
     info_add += bsv_disp_strm.str();
 
 #ifdef INdevel
@@ -1212,7 +2022,7 @@ int utf8_rcrd_type::set_base_srch_var()
     return base_search_supl_cnt;
 }
 
-void utf8_rcrd_type::test_bss_compute()
+void utf8_rcrd_type::test_bss_compute( int test_lvls )
 {
 #ifdef INFOdisplay  // test_bsv_compute only works with this set
     new_name_utf_8 = "test";
@@ -1224,12 +2034,45 @@ void utf8_rcrd_type::test_bss_compute()
       dbgs << "Calling new_str_ptr.test_bsv_compute()" << endl;
 #endif  //  #ifdef INdevel
 
-    test_bsv_compute( nlvl );
+    test_bsv_compute( test_lvls );
 #else
     iout << "method test_bss_compute() called without INFOdisplay set." << endl;
 #endif // #ifdef INFOdisplay
 }
 
+void utf8_rcrd_type::walk_bss_path( const string& path,
+  vector<bss_walk_lvl>& lvl_info )
+{
+    new_name_utf_8 = "test";
+    lvl_info.resize( path.size() );
+    size_t sso_cap = string().capacity();
+    auto str_bytes = [ sso_cap ]( size_t cap )
+      { return cap > sso_cap ? cap + 1 : 0; };
+    for ( size_t idx = 0; idx < path.size(); idx++ )
+    {
+        int node_id = walk_bsv_chain( idx + 1, path[ idx ] == 'r' );
+        bss_walk_lvl& lvl = lvl_info[ idx ];
+        lvl.scc_digits = base_search_str_scc.size();
+        lvl.in_range = coll_cmp( bss_to_name( base_search_str_min ),
+          base_search_str, false ) < 0 && coll_cmp( base_search_str,
+          bss_to_name( base_search_str_max ), false ) < 0;
+        lvl.whole_bytes = idx + 1 + base_search_str_min.size() +
+          base_search_str_max.size() + base_search_str_scc.size() +
+          base_search_str.size();
+        lvl.entry_bytes = lvl.delta_bytes = 0;
+        if ( static_cast<size_t>( node_id ) < bsv_memo.size() &&
+          bsv_memo[ node_id ].path_hash == base_search_hash )
+        {
+            const bsv_memo_entry& memo = bsv_memo[ node_id ];
+            lvl.delta_bytes = memo.scc_add.size() + memo.name_add.size();
+            lvl.entry_bytes = sizeof( bsv_memo_entry ) +
+              str_bytes( memo.scc_add.capacity() ) +
+              str_bytes( memo.name_add.capacity() ) +
+              str_bytes( memo.bss_key.capacity() );
+        }
+    }
+}
+
 void utf8_rcrd_type::traverse_utf8_records()
 {
 
@@ -1268,11 +2111,13 @@ utf8_rcrd_type&
     // GGG - Parts of this base search variable moving need to be done by
     //   the derived class, so need to be done here.
     //
+#ifndef USEcompact_utf8_rcrd
     srchstr_first_ch_idx = node2replace.srchstr_first_ch_idx;
     for ( int idx = 0; idx < 6; idx++ )
       srchstr_node_add[ idx ] = node2replace.srchstr_node_add[ idx ];
     node2replace.srchstr_node_add[ 0 ] = { 0, 0, 0 };
     node2replace.srchstr_node_add[ 1 ] = { 0, 0, 0 };
+#endif  //  #ifndef USEcompact_utf8_rcrd
 
     return node2replace;
 }
@@ -1288,6 +2133,21 @@ int utf8_rcrd_type::add_new_node()
     //   appear in any future references to the node actual node.
     str_start_idx = string_table.store_name( new_name_utf_8 );
     int new_str_place = name_string_rcrds.size();
+    if ( sort_keys_on )
+    {
+        //
+        // The key of a new name was made when it was pushed for its search
+        if ( !srch_key_hld.empty() &&
+          srch_key_hld.back().name == new_name_utf_8 )
+          sort_key_arena += srch_key_hld.back().sort_key;
+        else sort_key_arena += make_sort_key( new_name_utf_8 );
+        sort_key_off.push_back( sort_key_arena.size() );
+#ifdef USEsort_key_abbr
+        key_abbr = make_key_abbr( &sort_key_arena[ sort_key_off[
+          new_str_place ] ], sort_key_arena.size() - sort_key_off[
+          new_str_place ] );
+#endif  //  #ifdef USEsort_key_abbr
+    }
     name_string_rcrds.push_back( *this );
     return new_str_place;
 }
@@ -1364,6 +2224,12 @@ void utf8_rcrd_type::init_name_str_vector()
 #endif // #ifdef INFOdisplay
     base_search_str_scc = scc_idx_to_str_bal[ base_search_str_inf ];
     base_search_str = ggguniq_str_bal_list[ base_search_str_inf ];
+    if ( sort_keys_on )
+    {
+        base_search_key = make_sort_key( base_search_str );
+        base_search_abbr = make_key_abbr( base_search_key.data(),
+          base_search_key.size() );
+    }
 
     //
     // initialize fo_string_ptr[ 0 ] as the parent record with a
@@ -1384,6 +2250,7 @@ void utf8_rcrd_type::init_name_str_vector()
     bas_srch.push_back( u01 );
     str_start_idx = string_table.store_name( bas_srch );
     name_intro_last_idx = string_table.get_intro_last_idx();
+    srch_key_hld.reserve( 12 );
     nmst_hld.reserve( 12 );
     bas_srch = "Holding string for safety";
     nmst_hld.emplace_back( bas_srch, 20 );
@@ -1410,7 +2277,6 @@ string utf8_rcrd_type::retrieve_utf8_name( int fo_spt_idx )
           "retrieve_utf8_name( int fo_spt_idx ) called with invalid node_idx.";
         myexit();
     }
-    string req_utf8_name = name_string_rcrds[ fo_spt_idx ].get_name_string();
-    return req_utf8_name;
+    return string( name_string_rcrds[ fo_spt_idx ].get_name_view() );
 }
 
@@ -52,6 +52,9 @@
 #include "fo-utils.h"
 #include "gbtree.h"
 #include "utf8-name-store.h"
+#include "ascii-collate.h"
+#include "uca-collate.h"
+#include <map>
 
 #ifdef INdevel
     // Declarations/definitions/code for development only
@@ -68,6 +71,15 @@ struct b2s6 {
 
 class utf8_rcrd_type : public gbtree
 {
+public:
+    //
+    // The orders the names can be put in.  The value is the collation ID
+    //   saved with an archive of the names, so it can't change for a
+    //   collation once there are archives of it.
+    enum name_collation { locale_coll, uca_shifted_coll, uca_non_ign_coll,
+      byte_order_coll };
+
+private:
     struct spr_bss_state {
         scc_idx bss_min;
         scc_idx bss_max;
@@ -75,6 +87,8 @@ class utf8_rcrd_type : public gbtree
         // probably don't need this    string nam_strng;
         int bs_lst_lvl;
         int bss_inf;
+        string bss_path;
+        bool bss_frozen;
 
         spr_bss_state()
         {
@@ -84,9 +98,19 @@ class utf8_rcrd_type : public gbtree
             //    nam_strng = new_name_utf_8;
             bs_lst_lvl = base_search_last_lvl;
             bss_inf = base_search_str_inf;
+            bss_path = base_search_path;
+            bss_frozen = base_search_frozen;
         }
     };
 
+#ifdef USEcompact_utf8_rcrd
+    //
+    // The name store index only needs 20 bits for the size of the store,
+    //   so the encoding flags go in the top byte of the same word.  The
+    //   index stays signed since store_name() gives -1 when it fails.
+    int str_start_idx : 24;
+    unsigned int str_rec_bits : 8;
+#else
     int str_start_idx;
     styp_flags str_rec_flg;
     // GGG - Note that the following index has a max value of 255
@@ -94,8 +118,18 @@ class utf8_rcrd_type : public gbtree
     // Set of indexes into the scc_set array that can provide an addition
     //   of up to six UTF-8 characters to the base_search_str.  The number
     //   of characters to be added is returned to the base class in the
-    //   set_base_srch_var() method (to be implemented soon).
+    //   set_base_srch_var() method (to be implemented soon).  The bsv_memo
+    //   keeps the additions of each node now, with no limit on how many
+    //   there are, so these are not used.
     b2s6 srchstr_node_add[ 6 ];
+#endif  //  #ifdef USEcompact_utf8_rcrd
+#ifdef USEsort_key_abbr
+    //
+    // The first 8 bytes of the sort key as a big endian number, with 0
+    //   bytes after the end of a shorter key, which orders the same way as
+    //   the keys except for the ties.  Only set while sort_keys_on is set.
+    uint64_t key_abbr;
+#endif  //  #ifdef USEsort_key_abbr
     //
     // GGG - Consider moving the record data from gbst_interface_type
     //   record members to utf8_rcrd_type static data members
@@ -103,9 +137,33 @@ class utf8_rcrd_type : public gbtree
     //   Such a move could make the code considerably simpler and less
     //   error prone.
     static int name_intro_last_idx;
+    //
+    // The search key of a name being placed, made once when its search
+    //   starts and used for all of the compares of the search.  The name
+    //   is a view of the name store or of new_name_utf_8, which don't
+    //   move while the name is being placed, and the sort key and its
+    //   abbreviation are only set while sort_keys_on is set.  A replaced
+    //   node is placed again while the name that replaced it is still
+    //   being placed, so they are kept in a stack.
+    struct name_search_key {
+        string_view name;
+        string sort_key;
+        uint64_t key_abbr;
+    };
+    static vector<name_search_key> srch_key_hld;
+    //
+    // The display strings of the names being placed, which are only made
+    //   for the info display
     static vector<name_string_hold> nmst_hld;
     static vector<spr_bss_state> bss_state_vec;
     static vector<utf8_rcrd_type> name_string_rcrds;
+#ifdef USEmerkle_dgst
+    //
+    // The Merkle subtree digests indexed by node ID, which are only kept
+    //   while merkle_kept is set
+    static vector<merkle_dgst_type> merkle_dgsts;
+    static bool merkle_kept;
+#endif  //  #ifdef USEmerkle_dgst
     //
     // GGG - Consider replacing the utf8_name_store string_table with a
     //   string variable that will contain the set of name strings, and
@@ -114,6 +172,43 @@ class utf8_rcrd_type : public gbtree
     //   done in this class.
     static utf8_name_store string_table;
     //
+    // The strxfrm() sort keys of the names, which are only kept while
+    //   sort_keys_on is set, so that the compares of a search are done
+    //   with memcmp() in place of strcoll() on copies of the names.  The
+    //   key of node ID n is in sort_key_arena from sort_key_off[ n ] up to
+    //   sort_key_off[ n + 1 ].  The key of each name being placed is made
+    //   once and kept in its srch_key_hld entry, the key of base_search_str
+    //   once for each level it is set for, and the key of a name looked up
+    //   with cmp_key2node() once for each lookup.  Each of those has its
+    //   key_abbr kept with it.
+    static bool sort_keys_on;
+    static string sort_key_arena;
+    static vector<uint32_t> sort_key_off;
+    static string base_search_key;
+    static uint64_t base_search_abbr;
+    static string find_key_name;
+    static string find_key;
+    static uint64_t find_abbr;
+    static long num_name_cmps;
+    static long num_abbr_cmps;
+    //
+    // The compares that aren't done with the sort keys use the ASCII
+    //   collation tables when both names are ASCII and ascii_coll_on is
+    //   set.  The tables are made for the locale in use at the first
+    //   compare.
+    static ascii_collator ascii_coll;
+    static bool ascii_coll_on;
+    static long num_ascii_cmps;
+    //
+    // The collation the names are ordered by.  With either of the UCA
+    //   ones all of the compares and the sort keys are done with the built
+    //   in UCA collation in place of the locale.  In byte order the names
+    //   are compared with memcmp(), a name is its own sort key, and the
+    //   base search strings are worked out from the bytes of the names,
+    //   so the locale and the scc_set aren't used at all.
+    static name_collation coll_mode;
+    static uca_collator uca_coll;
+    //
     // The base_search_str_{min,max,scc} are sequences of indexes into the
     //   base_search_str values.  Since there is no real need to have actual
     //   character strings for base_search_str_{min,max}, they are only stored
@@ -121,6 +216,8 @@ class utf8_rcrd_type : public gbtree
     //   to be a legitimate UTF-8 string since it is compared with node
     //   strings during binary tree searches, so it is initialized whenever
     //   the base_search_str_scc changes.
+    //   In byte order the same variables hold the bytes of the strings in
+    //   place of scc_set indexes.
     static scc_idx base_search_str_min;
     static scc_idx base_search_str_max;
     // When at levels 1-5 the base_search_str_inf static variable holds the
@@ -131,15 +228,122 @@ class utf8_rcrd_type : public gbtree
     static bool track_base_search_vars;
     static scc_idx base_search_str_scc;
     static string base_search_str;
+    //
+    // Base search variables pinned to btree positions by the rebalancer.
+    //   The key is the path from the head of the tree ('r' for the head
+    //   itself followed by one 'l' or 'r' per level) and the value is the
+    //   ID of the record whose name string is the base_search_str for
+    //   that position.  The path of the current search position is only
+    //   tracked in base_search_path while there are pins to look up, and
+    //   base_search_frozen is set for positions below a pinned position.
+    static map<string, int> bsv_pins;
+    static string base_search_path;
+    static bool base_search_frozen;
+    //
+    // The base search variables worked out by set_base_srch_var() for each
+    //   node, kept while bsv_memo_on is set so that the next search that
+    //   goes through the node gets them without working them out again.
+    //   An entry only holds what changed from the base search variables
+    //   of the parent position, the part of the scc string and of the
+    //   name string past what they have in common with those of the
+    //   parent, so it stays small however deep the node is.  The min and
+    //   max are worked out from the parent's the same way as without the
+    //   memo, which takes no more than a copy.
+    // The entry is used when the path to the node is the one it was made
+    //   for, and it is made again when the node has been moved.  The path
+    //   isn't kept, only a 64 bit hash of it that is worked out a level at
+    //   a time from the hash of the parent position.  The memo is cleared
+    //   when the pins, the sort keys or the record IDs change.
+    struct bsv_memo_entry {
+        uint64_t path_hash;
+        bool bss_frozen;
+        int bss_inf;
+        uint16_t scc_keep;
+        uint16_t name_keep;
+        scc_idx scc_add;
+        string name_add;
+        string bss_key;
+        uint64_t bss_abbr;
+    };
+    static vector<bsv_memo_entry> bsv_memo;
+    static bool bsv_memo_on;
+    static long bsv_memo_hits;
+    //
+    // The path hash of the current level while the memo is on, or 0 when
+    //   the base search variables of the level above can't be worked on
+    //   from, as after restore_bsv_state()
+    static uint64_t base_search_hash;
+    //
+    // The time spent working out or looking up the base search variables,
+    //   without the info display, and the number of times it was done
+    static long bsv_set_nsec;
+    static long bsv_set_cnt;
     // Need to have the new name that is associated with the new_str_ptr
     //   record since it can not be added to the string_table until it is
     //   verified to be a unique new string
     static string new_name_utf_8;
 
     void init_rcrd();
+    styp_flags get_rec_flg();
+    void set_rec_flg( styp_flags typ_flgs );
+    void rebuild_sort_keys();
+    static int cmp_sort_keys( const char *key_a, size_t len_a,
+      const char *key_b, size_t len_b );
+    static uint64_t make_key_abbr( const char *key, size_t len );
+    // Sets the min and max of the base search variables for the head
+    static void set_bss_head_range();
+    //
+    // Sets the base search variables of this node from its bsv_memo entry
+    //   when there is one for the path it is at, and keeps them there.
+    //   save_bsv_memo() has to be called before the base_search_str of
+    //   the parent is replaced, with the new one.
+    bool find_bsv_memo();
+    void save_bsv_memo( const string& bss_name );
+    //
+    // Compares the key, with its key_abbr, to the key of the node
+    int cmp_to_node_key( const string& key, uint64_t abbr, int node_idx );
+    //
+    // Compares two names the way strcoll() does, or by the collation that
+    //   is set.  The compares of the base search strings aren't counted
+    //   with the name compares.  The views must each be of a whole string
+    //   with its null end, since strcoll() takes them as C strings.
+    static int coll_cmp( string_view str_a, string_view str_b,
+      bool count_cmp = true );
+    // The sort key of a name, with the same null end needed
+    static string name_sort_key( string_view name );
+    //
+    // The name string of a base search scc_idx string, and the form of it
+    //   for the info display, for the collation in use
+    static string bss_to_name( const scc_idx& bss_strng );
+    static string bss_display( const scc_idx& bss_strng );
+    //
+    // The byte string about halfway between lo_bytes and hi_bytes, taken
+    //   as base 256 fractions, which is the base search string of a level
+    //   past the pre-computed ones in byte order.  It always sorts after
+    //   lo_bytes and before hi_bytes.
+    static scc_idx byte_midpoint( const scc_idx& lo_bytes,
+      const scc_idx& hi_bytes );
+    // The byte string of a level up to 5 from the balance point list
+    static scc_idx byte_bal_point( int bal_idx );
+    //
+    // The scc_idx string halfway between lo_scc and hi_scc, worked out
+    //   exactly as base 48 fractions of the scc_set characters 1 to 48,
+    //   which is the base search string of a level past the pre-computed
+    //   ones.  It always sorts after lo_scc and before hi_scc.
+    static scc_idx scc_midpoint( const scc_idx& lo_scc,
+      const scc_idx& hi_scc );
 
 protected:
     string get_name_string();
+    //
+    // The name of the record where it is held, in the name store or in
+    //   new_name_utf_8, so it can be compared without a copy.
+    string_view get_name_view();
+//
+// Macro to work out the base search strings past level 5 with the exact
+//   integer math of scc_midpoint() in place of the floating point math of
+//   USEmath4base_sss, which runs out of precision at about 7 characters
+#define USEexact4base_sss
 #define USEmath4base_sss
 #ifdef USEmath4base_sss  // Use floating point math method
     static double set_base;
@@ -147,6 +351,9 @@ protected:
     double get_dif_value( scc_idx remain_str );
 #endif  // #ifdef USEmath4base_sss  // Use floating point math method
 
+    void push_search_key( int nm_rc_id );
+    void pop_search_key();
+
 #ifdef INFOdisplay
 
     void push_name_struct( int nm_rc_id );
@@ -162,7 +369,8 @@ protected:
     int save_bsv_state();
     void restore_bsv_state( int sv_idx );
     void release_bsv_state( int sv_idx );
-    static const int nlvl = 14;
+    bool set_bsv_pin( const string& path, int node_id );
+    bool move_records( const vector<int>& new_order, vector<int>& new_id_of );
 
 public:
     int what_is_my_id();
@@ -194,6 +402,88 @@ public:
     //   described above.
     int cmp_rcrd2base( int node_idx );
     int cmp_rcrd2node( int node_idx );
+    // Compares a search key to the node, used by the order statistics
+    int cmp_key2node( const string& key, int node_idx );
+    string get_sort_key( int node_idx );
+    string make_sort_key( const string& key );
+    string get_node_key( int node_idx );
+    int cmp_keys( const string& key_a, const string& key_b );
+#ifdef USEmerkle_dgst
+    bool keep_merkle_dgsts( bool keep );
+    merkle_dgst_type *get_merkle_slot( int node_idx );
+#endif  //  #ifdef USEmerkle_dgst
+    // Returns the UTF-8 name held by a node, such as one found by select()
+    string get_node_name( int node_idx );
+    // The same without a copy, which stays good since the names in the
+    //   name store are never moved
+    string_view get_node_name_view( int node_idx );
+    //
+    // Turns the sort key compares on or off, which can be done between any
+    //   two inserts.  Turning them on makes the keys of the names that are
+    //   already placed.  The names are placed in the same places either
+    //   way, since the keys compare the same as the names do.
+    bool use_sort_keys( bool use_keys );
+    bool sort_keys_used() { return sort_keys_on; };
+    // The bytes held for the sort keys, over what the records already use
+    size_t get_sort_key_bytes();
+    // The count of name compares done by the searches and lookups, and
+    //   how many of them were settled by the key_abbr of the two keys
+    long get_name_cmp_cnt() { return num_name_cmps; };
+    long get_abbr_cmp_cnt() { return num_abbr_cmps; };
+    //
+    // Turns the ASCII collation tables on or off for the compares that
+    //   aren't done with the sort keys.  They are on to begin with.
+    //   Turning them on makes the tables for the locale now in use, and
+    //   gives false when they can't be used for it, which includes a
+    //   locale where the sample strings of ascii_collator::setup() don't
+    //   come out in the order strcoll() gives.  Every compare then goes
+    //   to strcoll().
+    bool use_ascii_collation( bool use_ascii );
+    // The count of compares that were done with the ASCII tables
+    long get_ascii_cmp_cnt() { return num_ascii_cmps; };
+    //
+    // Sets the collation the names are ordered by, which is the collation
+    //   of the locale to begin with.  It can only be done before any names
+    //   are placed, and gives false after that.
+    bool set_collation( name_collation coll_set );
+    name_collation get_collation() { return coll_mode; };
+    uint32_t get_collation_id() { return coll_mode; };
+    // The LC_COLLATE locale now in use when the names are in its order
+    string get_collation_locale();
+    //
+    // Turns the memo of the base search variables of each node on or off,
+    //   which can be done between any two inserts.  The names are placed
+    //   in the same places either way.
+    void use_bsv_memo( bool use_memo );
+    // How many of the base search variables came from the memo, and the
+    //   time spent on them in set_base_srch_var() for the searches
+    long get_bsv_memo_hits() { return bsv_memo_hits; };
+    long get_bsv_set_cnt() { return bsv_set_cnt; };
+    long get_bsv_set_nsec() { return bsv_set_nsec; };
+    //
+    // What the base search variables of one level come to for
+    //   walk_bss_path().  in_range is set when the base_search_str is
+    //   after the min and before the max, as it has to be for the level
+    //   to split the names between its children.  The memo entry bytes
+    //   are its size with the heap space its strings have, and the delta
+    //   bytes are those of the strings in it, which is what the whole
+    //   bytes of the path and the min, max, scc and name strings of the
+    //   level would be without the deltas.
+    struct bss_walk_lvl {
+        size_t scc_digits;
+        bool in_range;
+        size_t entry_bytes;
+        size_t delta_bytes;
+        size_t whole_bytes;
+    };
+    //
+    // Works out the base search variables down a path of the btree, with
+    //   one 'l' or 'r' for each level, of which the first is the head, the
+    //   way a search that went down it would.  It goes down a chain of
+    //   one node for each level like test_bss_compute(), so the path can
+    //   be as deep as wanted without a tree of that many names, and it
+    //   has to be the only thing in the btree in the same way.
+    void walk_bss_path( const string& path, vector<bss_walk_lvl>& lvl_info );
 
     // This method is now driven by the base class management of the binary
     //   tree and as such, the base class knows when the base search variable
@@ -203,7 +493,7 @@ public:
     //   negative value if it detects an error.  This may be changed once
     //   the reliability of the process has been proven
     int set_base_srch_var();
-    void test_bss_compute();
+    void test_bss_compute( int test_lvls );
     void traverse_utf8_records();
     //
     // The derived class needs to do the replace part for the base search
@@ -0,0 +1,237 @@
+//
+// This program reads the DUCET allkeys.txt listing and writes the
+//   ducet-table.cc source with the tables that the uca_collator class of
+//   the gbtree folder uses, so that the Unicode collation of the names is
+//   compiled into the program rather than taken from the locale.
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//
+// Use the following commands to build the program and make the table:
+//   g++ -std=c++17 -o mk-ducet-table mk-ducet-table.cc
+//   ./mk-ducet-table allkeys.txt > ../gbtree/ducet-table.cc
+//
+// The layout of the tables is described in ducet-table.h.  The listing
+//   used for the table in the repository is allkeys-13.0.0.txt from
+//   2020-01-28, the one the significant_collation_chars comments of
+//   fo-utils.h are based on.
+//
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct ducet_line {
+    vector<uint32_t> cps;
+    vector<uint32_t> ces;
+};
+
+struct implicit_line {
+    uint32_t first;
+    uint32_t last;
+    uint32_t origin;
+    uint32_t base;
+};
+
+//
+// Packs one collation element the way ducet-table.h describes
+bool pack_ce( const string& ce_txt, uint32_t& ce )
+{
+    // ce_txt is the part between the brackets, as in "*0267.0020.0002"
+    if ( ce_txt.size() != 15 ) return false;
+    uint32_t var_flg = ce_txt[ 0 ] == '*' ? 1 : 0;
+    uint32_t pri = stoul( ce_txt.substr( 1, 4 ), nullptr, 16 );
+    uint32_t sec = stoul( ce_txt.substr( 6, 4 ), nullptr, 16 );
+    uint32_t ter = stoul( ce_txt.substr( 11, 4 ), nullptr, 16 );
+    if ( pri > 0xffff || sec > 0x1ff || ter > 0x1f ) return false;
+    ce = pri << 16 | sec << 7 | ter << 2 | var_flg;
+    return true;
+}
+
+void put_array( const string& decl, const vector<uint32_t>& vals )
+{
+    cout << decl << " = {" << endl;
+    for ( size_t idx = 0; idx < vals.size(); idx++ )
+    {
+        char hex_val[ 16 ];
+        snprintf( hex_val, sizeof( hex_val ), "0x%x", vals[ idx ] );
+        cout << ( idx % 6 == 0 ? "    " : " " ) << hex_val <<
+          ( idx + 1 < vals.size() ? "," : "" );
+        if ( idx % 6 == 5 || idx + 1 == vals.size() ) cout << endl;
+    }
+    cout << "};" << endl;
+}
+
+int main( int argc, char *argv[] )
+{
+    if ( argc != 2 )
+    {
+        cerr << "Usage: " << argv[ 0 ] << " allkeys.txt" << endl;
+        return 1;
+    }
+    ifstream keys_file( argv[ 1 ] );
+    if ( !keys_file )
+    {
+        cerr << "Can not open " << argv[ 1 ] << endl;
+        return 1;
+    }
+    string version;
+    map<uint32_t, ducet_line> singles;
+    map<vector<uint32_t>, ducet_line> contractions;
+    vector<implicit_line> implicits;
+    string in_line;
+    int line_num = 0;
+    while ( getline( keys_file, in_line ) )
+    {
+        line_num++;
+        if ( in_line.empty() || in_line[ 0 ] == '#' ) continue;
+        if ( in_line.compare( 0, 9, "@version " ) == 0 )
+        {
+            version = in_line.substr( 9 );
+            continue;
+        }
+        if ( in_line.compare( 0, 16, "@implicitweights" ) == 0 )
+        {
+            // As in "@implicitweights 17000..18AFF; FB00 # Tangut ..."
+            implicit_line impl;
+            istringstream impl_strm( in_line.substr( 16 ) );
+            string range, base;
+            impl_strm >> range >> base;
+            size_t dots = range.find( ".." );
+            impl.first = stoul( range.substr( 0, dots ), nullptr, 16 );
+            impl.last = stoul( range.substr( dots + 2 ), nullptr, 16 );
+            impl.base = stoul( base, nullptr, 16 );
+            //
+            // The second part of the weight counts from the start of the
+            //   first range that has the same base, so the Tangut
+            //   Supplement goes on from the Tangut block.
+            impl.origin = impl.first;
+            for ( auto& prev : implicits )
+              if ( prev.base == impl.base ) impl.origin = prev.origin;
+            implicits.push_back( impl );
+            continue;
+        }
+        if ( in_line[ 0 ] == '@' ) continue;
+        size_t semi = in_line.find( ';' );
+        if ( semi == string::npos )
+        {
+            cerr << "No ; in line " << line_num << endl;
+            return 1;
+        }
+        ducet_line entry;
+        istringstream cp_strm( in_line.substr( 0, semi ) );
+        string cp_txt;
+        while ( cp_strm >> cp_txt )
+          entry.cps.push_back( stoul( cp_txt, nullptr, 16 ) );
+        size_t ce_pos = in_line.find( '[', semi );
+        size_t cmnt = in_line.find( '#', semi );
+        while ( ce_pos != string::npos && ce_pos < cmnt )
+        {
+            size_t ce_end = in_line.find( ']', ce_pos );
+            uint32_t ce;
+            if ( ce_end == string::npos || !pack_ce( in_line.substr(
+              ce_pos + 1, ce_end - ce_pos - 1 ), ce ) )
+            {
+                cerr << "Bad collation element in line " << line_num << endl;
+                return 1;
+            }
+            entry.ces.push_back( ce );
+            ce_pos = in_line.find( '[', ce_end );
+        }
+        if ( entry.cps.empty() || entry.cps.size() > 3 ||
+          entry.ces.empty() || entry.ces.size() > 31 )
+        {
+            cerr << "Entry in line " << line_num << " does not fit" << endl;
+            return 1;
+        }
+        if ( entry.cps.size() == 1 ) singles[ entry.cps[ 0 ] ] = entry;
+        else contractions[ entry.cps ] = entry;
+    }
+    vector<uint32_t> ces, cps, ce_refs, contr;
+    auto add_ces = [ &ces ]( const ducet_line& entry )
+    {
+        uint32_t ce_ref = ces.size() << 5 | entry.ces.size();
+        ces.insert( ces.end(), entry.ces.begin(), entry.ces.end() );
+        return ce_ref;
+    };
+    for ( auto& single : singles )
+    {
+        cps.push_back( single.first );
+        ce_refs.push_back( add_ces( single.second ) );
+    }
+    for ( auto& contraction : contractions )
+    {
+        for ( size_t idx = 0; idx < 3; idx++ )
+          contr.push_back( idx < contraction.first.size() ?
+          contraction.first[ idx ] : 0 );
+        contr.push_back( add_ces( contraction.second ) );
+    }
+    vector<uint32_t> impl_vals;
+    for ( auto& impl : implicits )
+    {
+        impl_vals.push_back( impl.first );
+        impl_vals.push_back( impl.last );
+        impl_vals.push_back( impl.origin );
+        impl_vals.push_back( impl.base );
+    }
+
+    cout << "//" << endl <<
+      "// The DUCET tables of the uca_collator class, made from the" << endl <<
+      "//   allkeys-" << version << ".txt listing by the mk-ducet-table " <<
+      "program of the" << endl << "//   uni-utils folder.  Do not edit, " <<
+      "make it again instead." << endl <<
+      "//" << endl <<
+      "//    Copyright (C) 2022  George Ganoe" << endl <<
+      "//" << endl <<
+      "//    The DUCET is Copyright Unicode, Inc., for its terms of use see"
+      << endl << "//    http://www.unicode.org/terms_of_use.html" << endl <<
+      "//" << endl <<
+      "// Use the following commands to build this object, save it to the " <<
+      "library," << endl << "//    and display the library contents:" <<
+      endl << "//" << endl <<
+      "//   g++ -std=c++17 -c ducet-table.cc" << endl <<
+      "//   ar -Prs ~/data/lib/libfoutil.a ducet-table.o" << endl <<
+      "//   ar -Ptv ~/data/lib/libfoutil.a" << endl << endl <<
+      "#include \"ducet-table.h\"" << endl << endl <<
+      "const char *const ducet_version = \"" << version << "\";" << endl <<
+      "const int ducet_single_cnt = " << cps.size() << ";" << endl <<
+      "const int ducet_contr_cnt = " << contractions.size() << ";" << endl <<
+      "const int ducet_implicit_cnt = " << implicits.size() << ";" << endl <<
+      endl;
+    put_array( "const uint32_t ducet_ces[ " + to_string( ces.size() ) + " ]",
+      ces );
+    cout << endl;
+    put_array( "const uint32_t ducet_cps[ " + to_string( cps.size() ) + " ]",
+      cps );
+    cout << endl;
+    put_array( "const uint32_t ducet_ce_refs[ " + to_string( cps.size() ) +
+      " ]", ce_refs );
+    cout << endl;
+    put_array( "const uint32_t ducet_contrs[ " + to_string( contr.size() ) +
+      " ]", contr );
+    cout << endl;
+    put_array( "const uint32_t ducet_implicits[ " +
+      to_string( impl_vals.size() ) + " ]", impl_vals );
+    return 0;
+}
@@ -0,0 +1,281 @@
+//
+// This program reads the UnicodeData.txt, CompositionExclusions.txt and
+//   CaseFolding.txt files of the Unicode Character Database and writes
+//   the norm-table.cc source with the tables that the name_normalizer
+//   class of the gbtree folder uses, so that the NFC and NFKC forms and
+//   the case folding of the names are compiled into the program.
+//
+//    Copyright (C) 2022  George Ganoe
+//
+//    This program is free software; you can redistribute it and/or modify
+//    it under the terms of the GNU General Public License as published by
+//    the Free Software Foundation; either version 2 of the License, or
+//    (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful,
+//    but WITHOUT ANY WARRANTY; without even the implied warranty of
+//    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//    GNU General Public License for more details.
+//
+//    You should have received a copy of the GNU General Public License along
+//    with this program; if not, write to the Free Software Foundation, Inc.,
+//    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+//
+//
+// Use the following commands to build the program and make the table:
+//   g++ -std=c++17 -o mk-norm-table mk-norm-table.cc
+//   ./mk-norm-table UnicodeData.txt CompositionExclusions.txt
+//     CaseFolding.txt > ../gbtree/norm-table.cc
+//   with the three file names on one line.
+//
+// The layout of the tables is described in norm-table.h.  Only the code
+//   point, the canonical combining class and the decomposition fields of
+//   UnicodeData.txt are used.  The decompositions are written out in
+//   full, so the ones that refer to other decomposable code points are
+//   expanded here instead of when a name is normalized.  The version is
+//   taken from the first line of CaseFolding.txt, which names the file
+//   with its version, as in "# CaseFolding-14.0.0.txt".
+//
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+struct decomp_line {
+    bool compat;
+    vector<uint32_t> cps;
+};
+
+map<uint32_t, uint32_t> ccc_vals;
+map<uint32_t, decomp_line> decomps;
+
+//
+// Adds the full decomposition of code_pt to cps, with only the canonical
+//   mappings unless compat is set
+void add_full( uint32_t code_pt, bool compat, vector<uint32_t>& cps )
+{
+    auto dcmp = decomps.find( code_pt );
+    if ( dcmp == decomps.end() || ( dcmp->second.compat && !compat ) )
+    {
+        cps.push_back( code_pt );
+        return;
+    }
+    for ( uint32_t part : dcmp->second.cps ) add_full( part, compat, cps );
+}
+
+void put_array( const string& decl, const vector<uint32_t>& vals )
+{
+    cout << decl << " = {" << endl;
+    for ( size_t idx = 0; idx < vals.size(); idx++ )
+    {
+        char hex_val[ 16 ];
+        snprintf( hex_val, sizeof( hex_val ), "0x%x", vals[ idx ] );
+        cout << ( idx % 6 == 0 ? "    " : " " ) << hex_val <<
+          ( idx + 1 < vals.size() ? "," : "" );
+        if ( idx % 6 == 5 || idx + 1 == vals.size() ) cout << endl;
+    }
+    cout << "};" << endl;
+}
+
+int main( int argc, char *argv[] )
+{
+    if ( argc != 4 )
+    {
+        cerr << "Usage: " << argv[ 0 ] << " UnicodeData.txt " <<
+          "CompositionExclusions.txt CaseFolding.txt" << endl;
+        return 1;
+    }
+    ifstream data_file( argv[ 1 ] );
+    ifstream excl_file( argv[ 2 ] );
+    ifstream fold_file( argv[ 3 ] );
+    if ( !data_file || !excl_file || !fold_file )
+    {
+        cerr << "Can not open the input files" << endl;
+        return 1;
+    }
+    string in_line;
+    int line_num = 0;
+    while ( getline( data_file, in_line ) )
+    {
+        line_num++;
+        //
+        // The fields are separated by ; with the combining class in the
+        //   fourth and the decomposition in the sixth, as in
+        //   "00C0;LATIN CAPITAL LETTER A WITH GRAVE;Lu;0;L;0041 0300;;;..."
+        vector<string> fields;
+        istringstream line_strm( in_line );
+        string field;
+        while ( getline( line_strm, field, ';' ) ) fields.push_back( field );
+        if ( fields.size() < 6 )
+        {
+            cerr << "Too few fields in line " << line_num << endl;
+            return 1;
+        }
+        uint32_t code_pt = stoul( fields[ 0 ], nullptr, 16 );
+        uint32_t ccc = stoul( fields[ 3 ] );
+        if ( ccc != 0 ) ccc_vals[ code_pt ] = ccc;
+        if ( fields[ 5 ].empty() ) continue;
+        decomp_line dcmp;
+        dcmp.compat = fields[ 5 ][ 0 ] == '<';
+        istringstream dcmp_strm( fields[ 5 ].substr( dcmp.compat ?
+          fields[ 5 ].find( '>' ) + 1 : 0 ) );
+        string cp_txt;
+        while ( dcmp_strm >> cp_txt )
+          dcmp.cps.push_back( stoul( cp_txt, nullptr, 16 ) );
+        decomps[ code_pt ] = dcmp;
+    }
+    map<uint32_t, bool> excluded;
+    while ( getline( excl_file, in_line ) )
+    {
+        size_t cmnt = in_line.find( '#' );
+        istringstream excl_strm( in_line.substr( 0, cmnt ) );
+        string cp_txt;
+        if ( excl_strm >> cp_txt )
+          excluded[ stoul( cp_txt, nullptr, 16 ) ] = true;
+    }
+    string version;
+    map<uint32_t, vector<uint32_t> > folds;
+    line_num = 0;
+    while ( getline( fold_file, in_line ) )
+    {
+        line_num++;
+        if ( line_num == 1 )
+        {
+            size_t dash = in_line.find( "CaseFolding-" );
+            size_t txt = in_line.find( ".txt" );
+            if ( dash != string::npos && txt != string::npos )
+              version = in_line.substr( dash + 12, txt - dash - 12 );
+        }
+        if ( in_line.empty() || in_line[ 0 ] == '#' ) continue;
+        //
+        // As in "00DF; F; 0073 0073; # LATIN SMALL LETTER SHARP S", where
+        //   the C and F lines make the full case folding and the S and T
+        //   lines are left out.
+        vector<string> fields;
+        istringstream line_strm( in_line );
+        string field;
+        while ( getline( line_strm, field, ';' ) ) fields.push_back( field );
+        if ( fields.size() < 3 )
+        {
+            cerr << "Too few fields in case folding line " << line_num << endl;
+            return 1;
+        }
+        if ( fields[ 1 ] != " C" && fields[ 1 ] != " F" ) continue;
+        vector<uint32_t> fold_cps;
+        istringstream fold_strm( fields[ 2 ] );
+        string cp_txt;
+        while ( fold_strm >> cp_txt )
+          fold_cps.push_back( stoul( cp_txt, nullptr, 16 ) );
+        folds[ stoul( fields[ 0 ], nullptr, 16 ) ] = fold_cps;
+    }
+    if ( version.empty() )
+    {
+        cerr << "No version in the first line of " << argv[ 3 ] << endl;
+        return 1;
+    }
+
+    vector<uint32_t> cccs, cps_data, dcmp_cps, canon_refs, compat_refs;
+    vector<uint32_t> comps, fold_cps, fold_refs;
+    auto add_cps = [ &cps_data ]( const vector<uint32_t>& cps )
+    {
+        uint32_t cp_ref = cps_data.size() << 5 | cps.size();
+        cps_data.insert( cps_data.end(), cps.begin(), cps.end() );
+        return cp_ref;
+    };
+    for ( auto& ccc : ccc_vals ) cccs.push_back( ccc.first << 8 | ccc.second );
+    map<pair<uint32_t, uint32_t>, uint32_t> pairs;
+    for ( auto& dcmp : decomps )
+    {
+        vector<uint32_t> canon, compat;
+        add_full( dcmp.first, false, canon );
+        add_full( dcmp.first, true, compat );
+        if ( compat.size() > 31 )
+        {
+            cerr << "The decomposition of " << hex << dcmp.first <<
+              " does not fit" << endl;
+            return 1;
+        }
+        dcmp_cps.push_back( dcmp.first );
+        canon_refs.push_back( dcmp.second.compat ? 0 : add_cps( canon ) );
+        compat_refs.push_back( compat == canon && !dcmp.second.compat ?
+          canon_refs.back() : add_cps( compat ) );
+        //
+        // The primary composites are the canonical pairs that are not
+        //   excluded, with a starter for the code point and the first of
+        //   the pair.  The singletons have only one code point.
+        const vector<uint32_t>& parts = dcmp.second.cps;
+        if ( !dcmp.second.compat && parts.size() == 2 &&
+          excluded.count( dcmp.first ) == 0 &&
+          ccc_vals.count( dcmp.first ) == 0 &&
+          ccc_vals.count( parts[ 0 ] ) == 0 )
+          pairs[ make_pair( parts[ 0 ], parts[ 1 ] ) ] = dcmp.first;
+    }
+    for ( auto& pr : pairs )
+    {
+        comps.push_back( pr.first.first );
+        comps.push_back( pr.first.second );
+        comps.push_back( pr.second );
+    }
+    for ( auto& fold : folds )
+    {
+        fold_cps.push_back( fold.first );
+        fold_refs.push_back( add_cps( fold.second ) );
+    }
+
+    cout << "//" << endl <<
+      "// The normalization and case folding tables of the name_normalizer" <<
+      endl << "//   class, made from the " << version << " Unicode " <<
+      "Character Database files by" << endl << "//   the mk-norm-table " <<
+      "program of the uni-utils folder.  Do not edit, make" << endl <<
+      "//   it again instead." << endl <<
+      "//" << endl <<
+      "//    Copyright (C) 2022  George Ganoe" << endl <<
+      "//" << endl <<
+      "//    The UCD is Copyright Unicode, Inc., for its terms of use see" <<
+      endl << "//    http://www.unicode.org/terms_of_use.html" << endl <<
+      "//" << endl <<
+      "// Use the following commands to build this object, save it to the " <<
+      "library," << endl << "//    and display the library contents:" <<
+      endl << "//" << endl <<
+      "//   g++ -std=c++17 -c norm-table.cc" << endl <<
+      "//   ar -Prs ~/data/lib/libfoutil.a norm-table.o" << endl <<
+      "//   ar -Ptv ~/data/lib/libfoutil.a" << endl << endl <<
+      "#include \"norm-table.h\"" << endl << endl <<
+      "const char *const norm_version = \"" << version << "\";" << endl <<
+      "const int norm_ccc_cnt = " << cccs.size() << ";" << endl <<
+      "const int norm_decomp_cnt = " << dcmp_cps.size() << ";" << endl <<
+      "const int norm_comp_cnt = " << pairs.size() << ";" << endl <<
+      "const int norm_fold_cnt = " << fold_cps.size() << ";" << endl <<
+      endl;
+    put_array( "const uint32_t norm_cps_data[ " +
+      to_string( cps_data.size() ) + " ]", cps_data );
+    cout << endl;
+    put_array( "const uint32_t norm_cccs[ " + to_string( cccs.size() ) +
+      " ]", cccs );
+    cout << endl;
+    put_array( "const uint32_t norm_decomp_cps[ " +
+      to_string( dcmp_cps.size() ) + " ]", dcmp_cps );
+    cout << endl;
+    put_array( "const uint32_t norm_canon_refs[ " +
+      to_string( dcmp_cps.size() ) + " ]", canon_refs );
+    cout << endl;
+    put_array( "const uint32_t norm_compat_refs[ " +
+      to_string( dcmp_cps.size() ) + " ]", compat_refs );
+    cout << endl;
+    put_array( "const uint32_t norm_comps[ " + to_string( comps.size() ) +
+      " ]", comps );
+    cout << endl;
+    put_array( "const uint32_t norm_fold_cps[ " +
+      to_string( fold_cps.size() ) + " ]", fold_cps );
+    cout << endl;
+    put_array( "const uint32_t norm_fold_refs[ " +
+      to_string( fold_cps.size() ) + " ]", fold_refs );
+    return 0;
+}